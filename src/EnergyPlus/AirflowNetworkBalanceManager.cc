@@ -90,6 +90,7 @@
 #include <RoomAirModelManager.hh>
 #include <ScheduleManager.hh>
 #include <SingleDuct.hh>
+#include <SparseLUSolver.hh>
 #include <SplitterComponent.hh>
 #include <ThermalComfort.hh>
 #include <UtilityRoutines.hh>
@@ -239,6 +240,10 @@ namespace AirflowNetworkBalanceManager {
 	Array1D< Real64 > MA;
 	Array1D< Real64 > MV;
 	Array1D_int IVEC;
+	// Sparse node balance matrix
+	SparseLUSolver SparseMA;
+	Array1D_bool NodeSetByLink; // Node condition is set by a linked component (no prescription)
+	Array1D_bool NodeDownstreamOfOAN; // Node is fed by a linkage from an outdoor air node
 	Array1D_int SplitterNodeNumbers;
 
 	bool AirflowNetworkGetInputFlag( true );
@@ -307,6 +312,9 @@ namespace AirflowNetworkBalanceManager {
 		MA.deallocate();
 		MV.deallocate();
 		IVEC.deallocate();
+		SparseMA.clear();
+		NodeSetByLink.deallocate();
+		NodeDownstreamOfOAN.deallocate();
 		SplitterNodeNumbers.deallocate();
 		AirflowNetworkGetInputFlag = true;
 		VentilationCtrl = 0;
@@ -4315,9 +4323,16 @@ namespace AirflowNetworkBalanceManager {
 			AirflowNetworkLinkReport1.allocate( AirflowNetworkNumOfSurfaces );
 		}
 
-		MA.allocate( AirflowNetworkNumOfNodes * AirflowNetworkNumOfNodes );
+		// The node balance matrices share the linkage pattern: Set up its ordering and symbolic factorization once
+		SparseLUSolver::Couplings couplings;
+		couplings.reserve( AirflowNetworkNumOfLinks );
+		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
+			couplings.emplace_back( AirflowNetworkLinkageData( i ).NodeNums( 1 ), AirflowNetworkLinkageData( i ).NodeNums( 2 ) );
+		}
+		SparseMA.setup( AirflowNetworkNumOfNodes, couplings );
 		MV.allocate( AirflowNetworkNumOfNodes );
-		IVEC.allocate( AirflowNetworkNumOfNodes + 20 );
+		NodeSetByLink.dimension( AirflowNetworkNumOfNodes, false );
+		NodeDownstreamOfOAN.dimension( AirflowNetworkNumOfNodes, false );
 
 		AirflowNetworkReportData.allocate( NumOfZones ); // Report variables
 		AirflowNetworkZnRpt.allocate( NumOfZones ); // Report variables
@@ -5206,14 +5221,13 @@ namespace AirflowNetworkBalanceManager {
 		Real64 DirSign;
 		Real64 Tamb;
 		Real64 CpAir;
-		Real64 TZON;
 		Real64 load;
 		int ZoneNum;
-		bool found;
 		bool OANode;
 
-		MA = 0.0;
+		SparseMA.zero();
 		MV = 0.0;
+		SetNodeBalanceLinkFlags();
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			CompNum = AirflowNetworkLinkageData( i ).CompNum;
 			CompTypeNum = AirflowNetworkCompData( CompNum ).CompTypeNum;
@@ -5248,8 +5262,8 @@ namespace AirflowNetworkBalanceManager {
 				} else {
 					Tamb = ANZT( AirflowNetworkLinkageData( i ).ZoneNum );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir * Ei;
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir * Ei;
 				MV( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Tamb * ( 1.0 - Ei ) * CpAir;
 			}
 			if ( CompTypeNum == CompTypeNum_TMU ) { // Reheat unit: SINGLE DUCT:CONST VOLUME:REHEAT
@@ -5265,8 +5279,8 @@ namespace AirflowNetworkBalanceManager {
 				}
 				Ei = std::exp( -0.001 * DisSysCompTermUnitData( TypeNum ).L * DisSysCompTermUnitData( TypeNum ).D * Pi / ( DirSign * AirflowNetworkLinkSimu( i ).FLOW * CpAir ) );
 				Tamb = AirflowNetworkNodeSimu( LT ).TZ;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir * Ei;
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir * Ei;
 				MV( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Tamb * ( 1.0 - Ei ) * CpAir;
 			}
 			if ( CompTypeNum == CompTypeNum_COI ) { // heating or cooling coil
@@ -5297,8 +5311,8 @@ namespace AirflowNetworkBalanceManager {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
 				MV( LT ) = 0.0;
 			}
 			// Calculate return leak
@@ -5307,26 +5321,26 @@ namespace AirflowNetworkBalanceManager {
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * CpAir;
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 ) * CpAir;
 				}
 			}
 			// Check reheat unit or coil
@@ -5358,58 +5372,30 @@ namespace AirflowNetworkBalanceManager {
 
 		// Prescribe temperature for EPlus nodes
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			found = false;
-			OANode = false;
-			for ( j = 1; j <= AirflowNetworkNumOfLinks; ++j ) {
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 1 ) == i || AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-					CompNum = AirflowNetworkLinkageData( j ).CompNum;
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_RHT && ( ! AirflowNetworkLinkageData( j ).VAVTermDamper ) ) {
-						found = true;
-						break;
-					}
-					// Overwrite fan outlet node
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_FAN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-						found = false;
-						break;
-					}
-					// Overwrite return connection outlet
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_RCN ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_SCN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-				}
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i && AirflowNetworkNodeData( AirflowNetworkLinkageData( j ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_OAN ) {
-					OANode = true;
-					break;
-				}
-			}
-			if ( found ) continue;
+			if ( NodeSetByLink( i ) ) continue;
+			OANode = NodeDownstreamOfOAN( i );
 			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
 			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
 
 			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).Temp * 1.0e10;
 			}
 			if ( j > 0 && OANode ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).Temp * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && SparseMA.diagonal( i ) < 0.9e10 ) {
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = ANZT( ZoneNum ) * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 && SparseMA.diagonal( i ) < 0.9e10 ) {
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = OutDryBulbTempAt( AirflowNetworkNodeData( i ).NodeHeight ) * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).RAFNNodeNum > 0 && MA( ( i - 1 )*AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
-				MA( ( i - 1 )*AirflowNetworkNumOfNodes + i ) = 1.0e10;
+			if ( AirflowNetworkNodeData( i ).RAFNNodeNum > 0 && SparseMA.diagonal( i ) < 0.9e10 ) {
+				SparseMA.diagonal( i ) = 1.0e10;
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
 				if ( RoomAirflowNetworkZoneInfo( ZoneNum ).Node( AirflowNetworkNodeData( i ).RAFNNodeNum ).AirflowNetworkNodeID == i ) {
 					MV( i ) = RoomAirflowNetworkZoneInfo( ZoneNum ).Node( AirflowNetworkNodeData( i ).RAFNNodeNum ).AirTemp*1.0e10;
@@ -5419,21 +5405,17 @@ namespace AirflowNetworkBalanceManager {
 
 		// Check singularity
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			if ( MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 1.0e-6 ) {
+			if ( SparseMA.diagonal( i ) < 1.0e-6 ) {
 				ShowFatalError( "CalcAirflowNetworkHeatBalance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balances
+		SolveNodeBalanceMatrix();
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			TZON = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				TZON += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).TZ = TZON;
+			AirflowNetworkNodeSimu( i ).TZ = MV( i );
 		}
 
 	}
@@ -5486,14 +5468,13 @@ namespace AirflowNetworkBalanceManager {
 		Real64 Ei;
 		Real64 DirSign;
 		Real64 Wamb;
-		Real64 WZON;
 		Real64 load;
 		int ZoneNum;
-		bool found;
 		bool OANode;
 
-		MA = 0.0;
+		SparseMA.zero();
 		MV = 0.0;
+		SetNodeBalanceLinkFlags();
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			CompNum = AirflowNetworkLinkageData( i ).CompNum;
 			CompTypeNum = AirflowNetworkCompData( CompNum ).CompTypeNum;
@@ -5518,8 +5499,8 @@ namespace AirflowNetworkBalanceManager {
 				} else {
 					Wamb = ANZW( AirflowNetworkLinkageData( i ).ZoneNum );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Ei;
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Ei;
 				MV( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Wamb * ( 1.0 - Ei );
 			}
 			if ( CompTypeNum == CompTypeNum_TMU ) { // Reheat unit: SINGLE DUCT:CONST VOLUME:REHEAT
@@ -5535,8 +5516,8 @@ namespace AirflowNetworkBalanceManager {
 				}
 				Ei = std::exp( -0.0001 * DisSysCompTermUnitData( TypeNum ).L * DisSysCompTermUnitData( TypeNum ).D * Pi / ( DirSign * AirflowNetworkLinkSimu( i ).FLOW ) );
 				Wamb = AirflowNetworkNodeSimu( LT ).WZ;
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Ei;
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Ei;
 				MV( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW ) * Wamb * ( 1.0 - Ei );
 			}
 			if ( CompTypeNum == CompTypeNum_COI ) { // heating or cooling coil
@@ -5567,8 +5548,8 @@ namespace AirflowNetworkBalanceManager {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				MV( LT ) = 0.0;
 			}
 			// Calculate return leak
@@ -5577,26 +5558,26 @@ namespace AirflowNetworkBalanceManager {
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 			}
 			// Check reheat unit
@@ -5627,57 +5608,29 @@ namespace AirflowNetworkBalanceManager {
 
 		// Prescribe temperature for EPlus nodes
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			found = false;
-			OANode = false;
-			for ( j = 1; j <= AirflowNetworkNumOfLinks; ++j ) {
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 1 ) == i || AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-					CompNum = AirflowNetworkLinkageData( j ).CompNum;
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_RHT && ( ! AirflowNetworkLinkageData( j ).VAVTermDamper ) ) {
-						found = true;
-						break;
-					}
-					// Overwrite fan outlet node
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_FAN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-						found = false;
-						break;
-					}
-					// Overwrite return connection outlet
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_RCN ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_SCN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-				}
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i && AirflowNetworkNodeData( AirflowNetworkLinkageData( j ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_OAN ) {
-					OANode = true;
-					break;
-				}
-			}
-			if ( found ) continue;
+			if ( NodeSetByLink( i ) ) continue;
+			OANode = NodeDownstreamOfOAN( i );
 			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
 			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
 			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).HumRat * 1.0e10;
 			}
 			if ( j > 0 && OANode ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).HumRat * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && SparseMA.diagonal( i ) < 0.9e10 ) {
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = ANZW( ZoneNum ) * 1.0e10;
 			}
 			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = OutHumRat * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).RAFNNodeNum > 0 && MA( ( i - 1 )*AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
-				MA( ( i - 1 )*AirflowNetworkNumOfNodes + i ) = 1.0e10;
+			if ( AirflowNetworkNodeData( i ).RAFNNodeNum > 0 && SparseMA.diagonal( i ) < 0.9e10 ) {
+				SparseMA.diagonal( i ) = 1.0e10;
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
 				if ( RoomAirflowNetworkZoneInfo( ZoneNum ).Node( AirflowNetworkNodeData( i ).RAFNNodeNum ).AirflowNetworkNodeID == i ) {
 					MV( i ) = RoomAirflowNetworkZoneInfo( ZoneNum ).Node( AirflowNetworkNodeData( i ).RAFNNodeNum ).HumRat*1.0e10;
@@ -5687,21 +5640,17 @@ namespace AirflowNetworkBalanceManager {
 
 		// Check singularity
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			if ( MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 1.0e-6 ) {
+			if ( SparseMA.diagonal( i ) < 1.0e-6 ) {
 				ShowFatalError( "CalcAirflowNetworkMoisBalance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balances
+		SolveNodeBalanceMatrix();
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			WZON = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				WZON += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).WZ = WZON;
+			AirflowNetworkNodeSimu( i ).WZ = MV( i );
 		}
 
 	}
@@ -5750,13 +5699,12 @@ namespace AirflowNetworkBalanceManager {
 		int TypeNum;
 		std::string CompName;
 		Real64 DirSign;
-		Real64 COZN;
 		int ZoneNum;
-		bool found;
 		bool OANode;
 
-		MA = 0.0;
+		SparseMA.zero();
 		MV = 0.0;
+		SetNodeBalanceLinkFlags();
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			CompNum = AirflowNetworkLinkageData( i ).CompNum;
 			CompTypeNum = AirflowNetworkCompData( CompNum ).CompTypeNum;
@@ -5773,8 +5721,8 @@ namespace AirflowNetworkBalanceManager {
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					DirSign = -1.0;
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 			}
 			if ( CompTypeNum == CompTypeNum_TMU ) { // Reheat unit: SINGLE DUCT:CONST VOLUME:REHEAT
 				TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
@@ -5787,8 +5735,8 @@ namespace AirflowNetworkBalanceManager {
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					DirSign = -1.0;
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 			}
 			if ( CompTypeNum == CompTypeNum_COI ) { // heating or cooling coil
 				TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
@@ -5811,8 +5759,8 @@ namespace AirflowNetworkBalanceManager {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				MV( LT ) = 0.0;
 			}
 			// Calculate return leak
@@ -5821,100 +5769,68 @@ namespace AirflowNetworkBalanceManager {
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 			}
 		}
 
 		// Prescribe temperature for EPlus nodes
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			found = false;
-			OANode = false;
-			for ( j = 1; j <= AirflowNetworkNumOfLinks; ++j ) {
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 1 ) == i || AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-					CompNum = AirflowNetworkLinkageData( j ).CompNum;
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_RHT && ( ! AirflowNetworkLinkageData( j ).VAVTermDamper ) ) {
-						found = true;
-						break;
-					}
-					// Overwrite fan outlet node
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_FAN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-						found = false;
-						break;
-					}
-					// Overwrite return connection outlet
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_RCN ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_SCN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-				}
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i && AirflowNetworkNodeData( AirflowNetworkLinkageData( j ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_OAN ) {
-					OANode = true;
-					break;
-				}
-			}
-			if ( found ) continue;
+			if ( NodeSetByLink( i ) ) continue;
+			OANode = NodeDownstreamOfOAN( i );
 			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
 			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
 			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).CO2 * 1.0e10;
 			}
 			if ( j > 0 && OANode ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).CO2 * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && SparseMA.diagonal( i ) < 0.9e10 ) {
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = ANCO( ZoneNum ) * 1.0e10;
 			}
 			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = OutdoorCO2 * 1.0e10;
 			}
 		}
 
 		// Check singularity
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			if ( MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 1.0e-6 ) {
+			if ( SparseMA.diagonal( i ) < 1.0e-6 ) {
 				ShowFatalError( "CalcAirflowNetworkCO2Balance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balances
+		SolveNodeBalanceMatrix();
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			COZN = 0.0;
-			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				COZN += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
-			}
-			AirflowNetworkNodeSimu( i ).CO2Z = COZN;
+			AirflowNetworkNodeSimu( i ).CO2Z = MV( i );
 		}
 
 	}
@@ -5963,13 +5879,12 @@ namespace AirflowNetworkBalanceManager {
 		int TypeNum;
 		std::string CompName;
 		Real64 DirSign;
-		Real64 COZN;
 		int ZoneNum;
-		bool found;
 		bool OANode;
 
-		MA = 0.0;
+		SparseMA.zero();
 		MV = 0.0;
+		SetNodeBalanceLinkFlags();
 		for ( i = 1; i <= AirflowNetworkNumOfLinks; ++i ) {
 			CompNum = AirflowNetworkLinkageData( i ).CompNum;
 			CompTypeNum = AirflowNetworkCompData( CompNum ).CompTypeNum;
@@ -5986,8 +5901,8 @@ namespace AirflowNetworkBalanceManager {
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					DirSign = -1.0;
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 			}
 			if ( CompTypeNum == CompTypeNum_TMU ) { // Reheat unit: SINGLE DUCT:CONST VOLUME:REHEAT
 				TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
@@ -6000,8 +5915,8 @@ namespace AirflowNetworkBalanceManager {
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					DirSign = -1.0;
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 			}
 			if ( CompTypeNum == CompTypeNum_COI ) { // heating or cooling coil
 				TypeNum = AirflowNetworkCompData( CompNum ).TypeNum;
@@ -6024,8 +5939,8 @@ namespace AirflowNetworkBalanceManager {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 				}
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-				MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+				SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				MV( LT ) = 0.0;
 			}
 			// Calculate return leak
@@ -6034,100 +5949,164 @@ namespace AirflowNetworkBalanceManager {
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 1 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).EPlusZoneNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 				if ( ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).ExtNodeNum > 0 ) && ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).EPlusZoneNum == 0 ) && ( AirflowNetworkLinkSimu( i ).FLOW2 > 0.0 ) ) {
 					LF = AirflowNetworkLinkageData( i ).NodeNums( 2 );
 					LT = AirflowNetworkLinkageData( i ).NodeNums( 1 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
-					MA( ( LT - 1 ) * AirflowNetworkNumOfNodes + LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA.diagonal( LT ) += std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
+					SparseMA( LT, LF ) = -std::abs( AirflowNetworkLinkSimu( i ).FLOW2 );
 				}
 			}
 		}
 
 		// Prescribe temperature for EPlus nodes
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			found = false;
-			OANode = false;
-			for ( j = 1; j <= AirflowNetworkNumOfLinks; ++j ) {
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 1 ) == i || AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-					CompNum = AirflowNetworkLinkageData( j ).CompNum;
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_RHT && ( ! AirflowNetworkLinkageData( j ).VAVTermDamper ) ) {
-						found = true;
-						break;
-					}
-					// Overwrite fan outlet node
-					if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_FAN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
-						found = false;
-						break;
-					}
-					// Overwrite return connection outlet
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_RCN ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-					if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_SCN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) { // Modified on 9/2/09
-						found = true;
-						break;
-					}
-				}
-				if ( AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i && AirflowNetworkNodeData( AirflowNetworkLinkageData( j ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_OAN ) {
-					OANode = true;
-					break;
-				}
-			}
-			if ( found ) continue;
+			if ( NodeSetByLink( i ) ) continue;
+			OANode = NodeDownstreamOfOAN( i );
 			if ( AirflowNetworkNodeData( i ).EPlusZoneNum == 0 && AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_ZIN ) continue;
 			j = AirflowNetworkNodeData( i ).EPlusNodeNum;
 			if ( j > 0 && ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_FOU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_COU || AirflowNetworkNodeData( i ).EPlusTypeNum == EPlusTypeNum_HXO ) ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).GenContam * 1.0e10;
 			}
 			if ( j > 0 && OANode ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = Node( j ).GenContam * 1.0e10;
 			}
-			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 0.9e10 ) {
+			if ( AirflowNetworkNodeData( i ).EPlusZoneNum > 0 && SparseMA.diagonal( i ) < 0.9e10 ) {
 				ZoneNum = AirflowNetworkNodeData( i ).EPlusZoneNum;
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = ANGC( ZoneNum ) * 1.0e10;
 			}
 			if ( AirflowNetworkNodeData( i ).ExtNodeNum > 0 ) {
-				MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) = 1.0e10;
+				SparseMA.diagonal( i ) = 1.0e10;
 				MV( i ) = OutdoorGC * 1.0e10;
 			}
 		}
 
 		// Check singularity
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			if ( MA( ( i - 1 ) * AirflowNetworkNumOfNodes + i ) < 1.0e-6 ) {
+			if ( SparseMA.diagonal( i ) < 1.0e-6 ) {
 				ShowFatalError( "CalcAirflowNetworkGCBalance: A diagonal entity is zero in AirflowNetwork matrix at node " + AirflowNetworkNodeData( i ).Name );
 			}
 		}
 
-		// Get an inverse matrix
-		MRXINV( AirflowNetworkNumOfNodes );
+		// Solve the node balances
+		SolveNodeBalanceMatrix();
 
 		// Calculate node temperatures
 		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
-			COZN = 0.0;
+			AirflowNetworkNodeSimu( i ).GCZ = MV( i );
+		}
+
+	}
+
+	void
+	SetNodeBalanceLinkFlags()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine finds the nodes whose conditions are set by a linked component and the nodes fed
+		// from an outdoor air node for the node prescriptions of the heat, moisture, and contaminant balances.
+
+		// METHODOLOGY EMPLOYED:
+		// The first linkage connected to a node that decides its treatment wins, as in the original scan of all
+		// linkages for every node, but the linkages are visited once for all nodes. The flags are refreshed for
+		// each balance since ValidateDistributionSystem can revise the node and linkage types.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i;
+		int j;
+		int k;
+		int CompNum;
+		static Array1D_bool Decided;
+
+		Decided.dimension( AirflowNetworkNumOfNodes, false );
+		NodeSetByLink = false;
+		NodeDownstreamOfOAN = false;
+		for ( j = 1; j <= AirflowNetworkNumOfLinks; ++j ) {
+			CompNum = AirflowNetworkLinkageData( j ).CompNum;
+			for ( k = 1; k <= 2; ++k ) {
+				i = AirflowNetworkLinkageData( j ).NodeNums( k );
+				if ( Decided( i ) ) continue;
+				if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_RHT && ( ! AirflowNetworkLinkageData( j ).VAVTermDamper ) ) {
+					NodeSetByLink( i ) = true;
+					Decided( i ) = true;
+					continue;
+				}
+				// Overwrite fan outlet node
+				if ( AirflowNetworkCompData( CompNum ).EPlusTypeNum == EPlusTypeNum_FAN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
+					Decided( i ) = true;
+					continue;
+				}
+				// Overwrite return connection outlet
+				if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_RCN ) {
+					NodeSetByLink( i ) = true;
+					Decided( i ) = true;
+					continue;
+				}
+				if ( AirflowNetworkLinkageData( j ).ConnectionFlag == EPlusTypeNum_SCN && AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i ) {
+					NodeSetByLink( i ) = true;
+					Decided( i ) = true;
+					continue;
+				}
+				if ( AirflowNetworkLinkageData( j ).NodeNums( 2 ) == i && AirflowNetworkNodeData( AirflowNetworkLinkageData( j ).NodeNums( 1 ) ).EPlusTypeNum == EPlusTypeNum_OAN ) {
+					NodeDownstreamOfOAN( i ) = true;
+					Decided( i ) = true;
+				}
+			}
+		}
+
+	}
+
+	void
+	SolveNodeBalanceMatrix()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine solves the node balance system assembled in SparseMA and MV, returning the node
+		// values in MV.
+
+		// METHODOLOGY EMPLOYED:
+		// Sparse LU factorization using the fill-reducing ordering and symbolic factorization set up from the
+		// linkages in AllocateAndInitData. The balance matrices are diagonally dominant so no pivoting is needed
+		// in practice: if a vanishing pivot is met anyway the dense pivoting inverse MRXINV is used instead.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int i;
+		int j;
+		Real64 Sum;
+		static Array1D< Real64 > B;
+
+		if ( SparseMA.solve( MV ) ) return;
+
+		if ( ! allocated( MA ) ) {
+			MA.allocate( AirflowNetworkNumOfNodes * AirflowNetworkNumOfNodes );
+			IVEC.allocate( AirflowNetworkNumOfNodes + 20 );
+		}
+		SparseMA.to_dense( MA );
+		MRXINV( AirflowNetworkNumOfNodes );
+		B = MV;
+		for ( i = 1; i <= AirflowNetworkNumOfNodes; ++i ) {
+			Sum = 0.0;
 			for ( j = 1; j <= AirflowNetworkNumOfNodes; ++j ) {
-				COZN += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * MV( j );
+				Sum += MA( ( i - 1 ) * AirflowNetworkNumOfNodes + j ) * B( j );
 			}
-			AirflowNetworkNodeSimu( i ).GCZ = COZN;
+			MV( i ) = Sum;
 		}
 
 	}
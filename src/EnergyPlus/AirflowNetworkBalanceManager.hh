@@ -53,6 +53,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <SparseLUSolver.hh>
 
 namespace EnergyPlus {
 
@@ -82,6 +83,10 @@ namespace AirflowNetworkBalanceManager {
 	extern Array1D< Real64 > MA;
 	extern Array1D< Real64 > MV;
 	extern Array1D_int IVEC;
+	// Sparse node balance matrix
+	extern SparseLUSolver SparseMA;
+	extern Array1D_bool NodeSetByLink; // Node condition is set by a linked component (no prescription)
+	extern Array1D_bool NodeDownstreamOfOAN; // Node is fed by a linkage from an outdoor air node
 	extern Array1D_int SplitterNodeNumbers;
 
 	extern bool AirflowNetworkGetInputFlag;
@@ -218,6 +223,12 @@ namespace AirflowNetworkBalanceManager {
 	void
 	CalcAirflowNetworkGCBalance();
 
+	void
+	SetNodeBalanceLinkFlags();
+
+	void
+	SolveNodeBalanceMatrix();
+
 	void
 	MRXINV( int const NORDER );
 
@@ -64,6 +64,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <OutputProcessor.hh>
 #include <Psychrometrics.hh>
@@ -112,6 +113,8 @@ namespace AirflowNetworkSolver {
 	using DataEnvironment::OutHumRat;
 	using DataEnvironment::Latitude;
 	using DataSurfaces::Surface;
+	using DataSystemVariables::AFNSkylineSolver;
+	using DataSystemVariables::AFNModifiedNewton;
 	using Psychrometrics::PsyRhoAirFnPbTdbW;
 	using Psychrometrics::PsyCpAirFnWTdb;
 	using Psychrometrics::PsyHFnTdbW;
@@ -157,6 +160,11 @@ namespace AirflowNetworkSolver {
 	Array1D< Real64 > newAU; // noel
 #endif
 
+	// Sparse direct solver for the pressure Jacobian
+	int const MaxJacobianReuse( 3 ); // Maximum consecutive Newton iterations on one Jacobian factorization
+	SparseLUSolver PressureJacobian; // Whole network
+	SparseLUSolver PressureJacobianMultiZone; // Multizone subnetwork (distribution system fan off)
+
 	//REAL(r64), ALLOCATABLE, DIMENSION(:) :: AL
 	Array1D< Real64 > SUMF;
 	int Unit11( 0 );
@@ -170,6 +178,42 @@ namespace AirflowNetworkSolver {
 
 	// Functions
 
+	// Clears the global data in AirflowNetworkSolver.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		NetworkNumOfLinks = 0;
+		NetworkNumOfNodes = 0;
+		AFECTL.deallocate();
+		AFLOW2.deallocate();
+		AFLOW.deallocate();
+		PS.deallocate();
+		PW.deallocate();
+		RHOZ.deallocate();
+		SQRTDZ.deallocate();
+		VISCZ.deallocate();
+		SUMAF.deallocate();
+		TZ.deallocate();
+		WZ.deallocate();
+		PZ.deallocate();
+		ID.deallocate();
+		IK.deallocate();
+		AD.deallocate();
+		AU.deallocate();
+#ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
+		newIK.deallocate();
+		newAU.deallocate();
+#endif
+		PressureJacobian.clear();
+		PressureJacobianMultiZone.clear();
+		SUMF.deallocate();
+		DpProf.deallocate();
+		RhoProfF.deallocate();
+		RhoProfT.deallocate();
+		DpL.deallocate();
+	}
+
 	void
 	AllocateAirflowNetworkData()
 	{
@@ -412,7 +456,8 @@ namespace AirflowNetworkSolver {
 		//     form by using the location matrix.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The sparse LU patterns of the whole network and of its multizone subnetwork are set up here too:
+		// the fill-reducing elimination order and the symbolic factorization only depend on the linkages.
 
 		// REFERENCES:
 		// AIRNET
@@ -468,6 +513,61 @@ namespace AirflowNetworkSolver {
 			j = i;
 		}
 
+		// Set up the sparse LU patterns.
+		SetupPressureJacobian( PressureJacobian, NetworkNumOfNodes, NetworkNumOfLinks );
+		if ( NumOfNodesMultiZone > 0 && NumOfNodesMultiZone < NetworkNumOfNodes ) {
+			SetupPressureJacobian( PressureJacobianMultiZone, NumOfNodesMultiZone, NumOfLinksMultiZone );
+		} else {
+			PressureJacobianMultiZone.clear();
+		}
+
+	}
+
+	void
+	SetupPressureJacobian(
+		SparseLUSolver & A, // sparse matrix [A]
+		int const NumOfNodes, // number of nodes in the (sub)network
+		int const NumOfLinks // number of links in the (sub)network
+	)
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sets up the sparsity pattern and elimination order of the pressure Jacobian
+		// of a network made up of the first NumOfNodes nodes and NumOfLinks links.
+
+		// METHODOLOGY EMPLOYED:
+		// Every link couples the pressures of its two nodes. A minimum degree ordering keeps the
+		// fill of the LU factors low independent of the node numbering: highly connected nodes such
+		// as the external nodes are eliminated last.
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		SparseLUSolver::Couplings couplings;
+		int i;
+		int j;
+		int M;
+
+		// FLOW:
+		couplings.reserve( NumOfLinks );
+		for ( M = 1; M <= NumOfLinks; ++M ) {
+			i = AirflowNetworkLinkageData( M ).NodeNums( 1 );
+			j = AirflowNetworkLinkageData( M ).NodeNums( 2 );
+			if ( i < 1 || j < 1 || i > NumOfNodes || j > NumOfNodes ) continue;
+			couplings.emplace_back( ID( i ), ID( j ) );
+		}
+		A.setup( NumOfNodes, couplings, SparseLUSolver::Ordering::MinimumDegree );
+	}
+
+	SparseLUSolver &
+	ActivePressureJacobian()
+	{
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the sparse Jacobian matching the network currently being solved:
+		// only the multizone subnetwork is solved while the distribution system fan is off.
+
+		if ( PressureJacobianMultiZone.initialized() && NetworkNumOfNodes == PressureJacobianMultiZone.size() ) return PressureJacobianMultiZone;
+		return PressureJacobian;
 	}
 
 	void
@@ -643,7 +743,9 @@ namespace AirflowNetworkSolver {
 		// This subroutine solves zone pressures by modified Newton-Raphson iteration
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The linear systems are solved with the sparse LU factorization of the Jacobian unless the
+		// original skyline factorization is requested. With the sparse solver, the factorization may
+		// be reused for up to MaxJacobianReuse iterations while the residual is dropping steadily.
 
 		// REFERENCES:
 		// na
@@ -698,6 +800,9 @@ namespace AirflowNetworkSolver {
 		Real64 ACC0;
 		Real64 ACC1;
 		Array1D< Real64 > CCF( NetworkNumOfNodes );
+		SparseLUSolver & Jacobian( ActivePressureJacobian() );
+		bool JacobianUpdate;
+		int JacobianReuse;
 
 		// Formats
 		static gio::Fmt Format_901( "(A5,I3,2E14.6,0P,F8.4,F24.14)" );
@@ -706,6 +811,7 @@ namespace AirflowNetworkSolver {
 		ACC1 = 0.0;
 		ACCEL = 0;
 		NSYM = 0;
+		JacobianReuse = 0;
 		NNZE = IK( NetworkNumOfNodes + 1 ) - 1;
 		if ( LIST >= 2 ) gio::write( Unit21, fmtLD ) << "Initialization" << NetworkNumOfNodes << NetworkNumOfLinks << NNZE;
 		ITER = 0;
@@ -719,7 +825,7 @@ namespace AirflowNetworkSolver {
 			// Initialize node/zone pressure values by assuming only linear relationship between
 			// airflows and pressure drops.
 			LFLAG = 1;
-			FILJAC( NNZE, LFLAG );
+			FILJAC( NNZE, LFLAG, true );
 			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
 				if ( AirflowNetworkNodeData( n ).NodeTypeNum == 0 ) PZ( n ) = SUMF( n );
 			}
@@ -730,13 +836,18 @@ namespace AirflowNetworkSolver {
 				DUMPVR( "AF:", SUMF, NetworkNumOfNodes, Unit21 );
 			}
 			// Solve linear system for approximate PZ.
+			if ( AFNSkylineSolver ) {
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
-			FACSKY( newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM ); //noel
-			SLVSKY( newAU, AD, newAU, PZ, newIK, NetworkNumOfNodes, NSYM ); //noel
+				FACSKY( newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM ); //noel
+				SLVSKY( newAU, AD, newAU, PZ, newIK, NetworkNumOfNodes, NSYM ); //noel
 #else
-			FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
-			SLVSKY( AU, AD, AU, PZ, IK, NetworkNumOfNodes, NSYM );
+				FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
+				SLVSKY( AU, AD, AU, PZ, IK, NetworkNumOfNodes, NSYM );
 #endif
+			} else {
+				FACSPARSE( Jacobian );
+				Jacobian.back_substitute( PZ );
+			}
 			if ( LIST >= 2 ) DUMPVD( "PZ:", PZ, NetworkNumOfNodes, Unit21 );
 		}
 		// Solve nonlinear airflow network equations by modified Newton's method.
@@ -745,8 +856,13 @@ namespace AirflowNetworkSolver {
 			LFLAG = 0;
 			++ITER;
 			if ( LIST >= 2 ) gio::write( Unit21, fmtLD ) << "Begin iteration " << ITER;
+			// Keep the previous factorization (modified Newton) while the residual is at least halving.
+			JacobianUpdate = true;
+			if ( AFNModifiedNewton && ! AFNSkylineSolver && ITER > 2 && JacobianReuse < MaxJacobianReuse ) {
+				if ( ACCEL == 0 && ACC1 <= 0.5 * ACC0 ) JacobianUpdate = false;
+			}
 			// Set up the Jacobian matrix.
-			FILJAC( NNZE, LFLAG );
+			FILJAC( NNZE, LFLAG, JacobianUpdate );
 			// Data dump.
 			if ( LIST >= 3 ) {
 				DUMPVR( "SUMF:", SUMF, NetworkNumOfNodes, Unit21 );
@@ -777,13 +893,23 @@ namespace AirflowNetworkSolver {
 			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
 				CCF( n ) = SUMF( n );
 			}
+			if ( AFNSkylineSolver ) {
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
-			FACSKY( newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM ); //noel
-			SLVSKY( newAU, AD, newAU, CCF, newIK, NetworkNumOfNodes, NSYM ); //noel
+				FACSKY( newAU, AD, newAU, newIK, NetworkNumOfNodes, NSYM ); //noel
+				SLVSKY( newAU, AD, newAU, CCF, newIK, NetworkNumOfNodes, NSYM ); //noel
 #else
-			FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
-			SLVSKY( AU, AD, AU, CCF, IK, NetworkNumOfNodes, NSYM );
+				FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, NSYM );
+				SLVSKY( AU, AD, AU, CCF, IK, NetworkNumOfNodes, NSYM );
 #endif
+			} else {
+				if ( JacobianUpdate ) {
+					FACSPARSE( Jacobian );
+					JacobianReuse = 0;
+				} else {
+					++JacobianReuse;
+				}
+				Jacobian.back_substitute( CCF );
+			}
 			// Revise PZ (Steffensen iteration on the N-R correction factors to handle oscillating corrections).
 			if ( ACCEL == 1 ) {
 				ACCEL = 0;
@@ -835,7 +961,8 @@ namespace AirflowNetworkSolver {
 	void
 	FILJAC(
 		int const NNZE, // number of nonzero entries in the "AU" array.
-		int const LFLAG // if = 1, use laminar relationship (initialization).
+		int const LFLAG, // if = 1, use laminar relationship (initialization).
+		bool const JacobianUpdate // if false, only the residuals are evaluated and [A] is left unchanged.
 	)
 	{
 
@@ -899,6 +1026,9 @@ namespace AirflowNetworkSolver {
 		Real64 DP;
 		Array1D< Real64 > F( 2 );
 		Array1D< Real64 > DF( 2 );
+		SparseLUSolver & Jacobian( ActivePressureJacobian() );
+		bool const FillSkyline( JacobianUpdate && AFNSkylineSolver );
+		bool const FillSparse( JacobianUpdate && ! AFNSkylineSolver );
 
 		// Formats
 		static gio::Fmt Format_901( "(A5,3I3,4E16.7)" );
@@ -907,14 +1037,23 @@ namespace AirflowNetworkSolver {
 		for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
 			SUMF( n ) = 0.0;
 			SUMAF( n ) = 0.0;
-			if ( AirflowNetworkNodeData( n ).NodeTypeNum == 1 ) {
-				AD( n ) = 1.0;
-			} else {
-				AD( n ) = 0.0;
-			}
 		}
-		for ( n = 1; n <= NNZE; ++n ) {
-			AU( n ) = 0.0;
+		if ( FillSkyline ) {
+			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
+				if ( AirflowNetworkNodeData( n ).NodeTypeNum == 1 ) {
+					AD( n ) = 1.0;
+				} else {
+					AD( n ) = 0.0;
+				}
+			}
+			for ( n = 1; n <= NNZE; ++n ) {
+				AU( n ) = 0.0;
+			}
+		} else if ( FillSparse ) {
+			Jacobian.zero();
+			for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
+				if ( AirflowNetworkNodeData( n ).NodeTypeNum == 1 ) Jacobian.diagonal( n ) = 1.0;
+			}
 		}
 		//                              Set up the Jacobian matrix.
 		for ( i = 1; i <= NetworkNumOfLinks; ++i ) {
@@ -993,7 +1132,10 @@ namespace AirflowNetworkSolver {
 				SUMF( M ) -= F( 1 );
 				SUMAF( M ) += std::abs( F( 1 ) );
 			}
-			if ( FLAG != 1 ) FILSKY( X, AirflowNetworkLinkageData( i ).NodeNums, IK, AU, AD, FLAG );
+			if ( FLAG != 1 ) {
+				if ( FillSkyline ) FILSKY( X, AirflowNetworkLinkageData( i ).NodeNums, IK, AU, AD, FLAG );
+				if ( FillSparse ) FILSPARSE( X, AirflowNetworkLinkageData( i ).NodeNums, Jacobian, FLAG );
+			}
 			if ( NF == 1 ) continue;
 			AFLOW2( i ) = F( 2 );
 			if ( LIST >= 3 ) gio::write( Unit21, Format_901 ) << " NRj:" << i << n << M << AirflowNetworkLinkSimu( i ).DP << F( 2 ) << DF( 2 );
@@ -1012,10 +1154,14 @@ namespace AirflowNetworkSolver {
 				SUMF( M ) -= F( 2 );
 				SUMAF( M ) += std::abs( F( 2 ) );
 			}
-			if ( FLAG != 1 ) FILSKY( X, AirflowNetworkLinkageData( i ).NodeNums, IK, AU, AD, FLAG );
+			if ( FLAG != 1 ) {
+				if ( FillSkyline ) FILSKY( X, AirflowNetworkLinkageData( i ).NodeNums, IK, AU, AD, FLAG );
+				if ( FillSparse ) FILSPARSE( X, AirflowNetworkLinkageData( i ).NodeNums, Jacobian, FLAG );
+			}
 		}
 
 #ifdef SKYLINE_MATRIX_REMOVE_ZERO_COLUMNS
+		if ( ! FillSkyline ) return;
 
 		// After the matrix values have been set, we can look at them and see if any columns are filled with zeros.
 		// If they are, let's remove them from the matrix -- but only for the purposes of doing the solve.
@@ -4027,6 +4173,87 @@ Label90: ;
 		}
 	}
 
+	void
+	FACSPARSE(
+		SparseLUSolver & A // sparse matrix [A] before and after factoring
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine performs the L-U factorization of the sparse matrix [A]. It is the sparse
+		// counterpart of FACSKY; A.back_substitute then plays the part of SLVSKY.
+
+		// METHODOLOGY EMPLOYED:
+		// The factorization is done in the elimination order set up by SetupPressureJacobian and
+		// does not pivot, as the Jacobian of the network is symmetric with a dominant diagonal.
+		// A vanishing pivot is reported at the node whose equation it is.
+
+		// REFERENCES:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int k; // Node of the vanishing pivot
+
+		// FLOW:
+		if ( ! A.factor() ) {
+			for ( k = 1; k < A.size(); ++k ) {
+				if ( ID( k ) == A.singular() ) break;
+			}
+			ShowSevereError( "AirflowNetworkSolver: L-U factorization in Subroutine FACSPARSE." );
+			ShowContinueError( "The denominator used in L-U factorization is equal to 0.0 at node = " + AirflowNetworkNodeData( k ).Name + '.' );
+			ShowContinueError( "One possible cause is that this node may not be connected directly, or indirectly via airflow network connections " );
+			ShowContinueError( "(e.g., AirflowNetwork:Multizone:SurfaceCrack, AirflowNetwork:Multizone:Component:SimpleOpening, etc.), to an external" );
+			ShowContinueError( "node (AirflowNetwork:MultiZone:Surface)." );
+			ShowContinueError( "Please send your input file and weather file to EnergyPlus support/development team for further investigation." );
+			ShowFatalError( "Preceding condition causes termination." );
+		}
+	}
+
+	void
+	FILSPARSE(
+		Array1A< Real64 > const X, // element array (row-wise sequence)
+		Array1A_int const LM, // location matrix
+		SparseLUSolver & A, // sparse matrix [A]
+		int const FLAG // mode of operation
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine adds element array "X" to the sparse matrix [A]. It is the sparse
+		// counterpart of FILSKY and uses the same element array layout and modes of operation.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Argument array dimensioning
+		X.dim( 4 );
+		LM.dim( 2 );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int k;
+		int L;
+
+		// FLOW:
+		// K = row number, L = column number.
+		if ( FLAG > 1 ) {
+			k = LM( 1 );
+			L = LM( 2 );
+			if ( FLAG == 4 ) {
+				A.diagonal( k ) += X( 1 );
+				A( k, L ) += X( 2 );
+				A( L, k ) += X( 3 );
+				A.diagonal( L ) += X( 4 );
+			} else if ( FLAG == 3 ) {
+				A.diagonal( L ) += X( 4 );
+			} else if ( FLAG == 2 ) {
+				A.diagonal( k ) += X( 1 );
+			}
+		}
+	}
+
 	void
 	DUMPVD(
 		std::string const & S, // Description
@@ -53,6 +53,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
+#include <SparseLUSolver.hh>
 
 namespace EnergyPlus {
 
@@ -98,6 +99,11 @@ namespace AirflowNetworkSolver {
 	extern Array1D< Real64 > newAU; // noel
 #endif
 
+	// Sparse direct solver for the pressure Jacobian
+	extern int const MaxJacobianReuse; // Maximum consecutive Newton iterations on one Jacobian factorization
+	extern SparseLUSolver PressureJacobian; // Whole network
+	extern SparseLUSolver PressureJacobianMultiZone; // Multizone subnetwork (distribution system fan off)
+
 	//REAL(r64), ALLOCATABLE, DIMENSION(:) :: AL
 	extern Array1D< Real64 > SUMF;
 	extern int Unit11;
@@ -111,6 +117,9 @@ namespace AirflowNetworkSolver {
 
 	// Functions
 
+	void
+	clear_state();
+
 	void
 	AllocateAirflowNetworkData();
 
@@ -120,6 +129,16 @@ namespace AirflowNetworkSolver {
 	void
 	SETSKY();
 
+	void
+	SetupPressureJacobian(
+		SparseLUSolver & A, // sparse matrix [A]
+		int const NumOfNodes, // number of nodes in the (sub)network
+		int const NumOfLinks // number of links in the (sub)network
+	);
+
+	SparseLUSolver &
+	ActivePressureJacobian();
+
 	void
 	AIRMOV();
 
@@ -134,7 +153,8 @@ namespace AirflowNetworkSolver {
 	void
 	FILJAC(
 		int const NNZE, // number of nonzero entries in the "AU" array.
-		int const LFLAG // if = 1, use laminar relationship (initialization).
+		int const LFLAG, // if = 1, use laminar relationship (initialization).
+		bool const JacobianUpdate // if false, only the residuals are evaluated and [A] is left unchanged.
 	);
 
 	void
@@ -419,6 +439,19 @@ namespace AirflowNetworkSolver {
 		int const FLAG // mode of operation
 	);
 
+	void
+	FACSPARSE(
+		SparseLUSolver & A // sparse matrix [A] before and after factoring
+	);
+
+	void
+	FILSPARSE(
+		Array1A< Real64 > const X, // element array (row-wise sequence)
+		Array1A_int const LM, // location matrix
+		SparseLUSolver & A, // sparse matrix [A]
+		int const FLAG // mode of operation
+	);
+
 	void
 	DUMPVD(
 		std::string const & S, // Description
@@ -0,0 +1,271 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef BinaryPayload_hh_INCLUDED
+#define BinaryPayload_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/char.functions.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace BinaryPayload {
+
+	// Raw binary payloads for the files EnergyPlus writes for its own later use (caches, checkpoints):
+	// values are stored in the native layout, so a file is only read back by the same build on the same platform.
+
+	// 64-bit FNV-1a hash of everything fed to it
+	class KeyHash
+	{
+
+	public: // Methods
+
+		void
+		add( void const * data, std::size_t const n )
+		{
+			auto const p( static_cast< unsigned char const * >( data ) );
+			for ( std::size_t i = 0; i < n; ++i ) {
+				hash_ ^= p[ i ];
+				hash_ *= 1099511628211ull;
+			}
+		}
+
+		void
+		add( int const v )
+		{
+			add( &v, sizeof( v ) );
+		}
+
+		void
+		add( bool const v )
+		{
+			add( v ? 1 : 0 );
+		}
+
+		void
+		add( Real64 const v )
+		{
+			add( &v, sizeof( v ) );
+		}
+
+		void
+		add( std::uint64_t const v )
+		{
+			add( &v, sizeof( v ) );
+		}
+
+		void
+		add( std::string const & s )
+		{
+			add( static_cast< int >( s.size() ) );
+			add( s.data(), s.size() );
+		}
+
+		// Characters of s in lower case, without its length: the same for every spelling of a name
+		void
+		add_lower( std::string const & s )
+		{
+			for ( char const c : s ) {
+				hash_ ^= static_cast< unsigned char >( ObjexxFCL::to_lower( c ) );
+				hash_ *= 1099511628211ull;
+			}
+		}
+
+		template< typename A >
+		void
+		add_array( A const & a )
+		{
+			add( static_cast< int >( a.size() ) );
+			if ( a.size() > 0u ) add( a.data(), a.size() * sizeof( typename A::value_type ) );
+		}
+
+		std::uint64_t
+		value() const
+		{
+			return hash_;
+		}
+
+	private: // Data
+
+		std::uint64_t hash_ = 14695981039346656037ull;
+
+	};
+
+	// Appends raw values to an in-memory payload
+	class PayloadWriter
+	{
+
+	public: // Methods
+
+		template< typename T >
+		void
+		put( T const & v )
+		{
+			buffer.append( reinterpret_cast< char const * >( &v ), sizeof( T ) );
+		}
+
+		void
+		put_string( std::string const & s )
+		{
+			put( static_cast< std::uint64_t >( s.size() ) );
+			buffer.append( s );
+		}
+
+		template< typename A >
+		void
+		put_array( A const & a )
+		{
+			put( static_cast< std::uint64_t >( a.size() ) );
+			if ( a.size() > 0u ) buffer.append( reinterpret_cast< char const * >( a.data() ), a.size() * sizeof( typename A::value_type ) );
+		}
+
+	public: // Data
+
+		std::string buffer;
+
+	};
+
+	// Reads raw values back from a payload, failing on any overrun or size mismatch
+	class PayloadReader
+	{
+
+	public: // Creation
+
+		PayloadReader( char const * begin, char const * end ) :
+			pos_( begin ),
+			end_( end )
+		{}
+
+	public: // Methods
+
+		template< typename T >
+		bool
+		get( T & v )
+		{
+			if ( std::size_t( end_ - pos_ ) < sizeof( T ) ) return false;
+			std::memcpy( &v, pos_, sizeof( T ) );
+			pos_ += sizeof( T );
+			return true;
+		}
+
+		bool
+		get_string( std::string & s )
+		{
+			std::uint64_t n( 0 );
+			if ( ! get( n ) || std::uint64_t( end_ - pos_ ) < n ) return false;
+			s.assign( pos_, std::size_t( n ) );
+			pos_ += n;
+			return true;
+		}
+
+		template< typename A >
+		bool
+		get_array( A & a )
+		{
+			std::uint64_t n( 0 );
+			if ( ! get( n ) || n != a.size() ) return false;
+			std::size_t const bytes( a.size() * sizeof( typename A::value_type ) );
+			if ( std::size_t( end_ - pos_ ) < bytes ) return false;
+			if ( bytes > 0u ) std::memcpy( a.data(), pos_, bytes );
+			pos_ += bytes;
+			return true;
+		}
+
+		// Step over an array stored for one the size of a, leaving a untouched
+		template< typename A >
+		bool
+		skip_array( A const & a )
+		{
+			std::uint64_t n( 0 );
+			if ( ! get( n ) || n != a.size() ) return false;
+			std::size_t const bytes( a.size() * sizeof( typename A::value_type ) );
+			if ( std::size_t( end_ - pos_ ) < bytes ) return false;
+			pos_ += bytes;
+			return true;
+		}
+
+		bool
+		at_end() const
+		{
+			return pos_ == end_;
+		}
+
+		// Bytes not read yet
+		std::size_t
+		remaining() const
+		{
+			return std::size_t( end_ - pos_ );
+		}
+
+	private: // Data
+
+		char const * pos_;
+		char const * end_;
+
+	};
+
+	// Writes Contents to FilePath under a name unique to this process and moves it into place, so a reader
+	// never sees a partial file: Returns false if the file could not be written
+	bool
+	write_file(
+		std::string const & FilePath,
+		std::string const & Contents
+	);
+
+} // BinaryPayload
+
+} // EnergyPlus
+
+#endif
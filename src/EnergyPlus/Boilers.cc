@@ -568,7 +568,6 @@ namespace Boilers {
 		// Using/Aliasing
 		using DataGlobals::BeginEnvrnFlag;
 		using DataGlobals::AnyEnergyManagementSystemInModel;
-		using FluidProperties::GetDensityGlycol;
 		using PlantUtilities::InitComponentNodes;
 		using DataPlant::TypeOf_Boiler_Simple;
 		using DataPlant::PlantFirstSizesOkayToFinalize;
@@ -617,7 +616,7 @@ namespace Boilers {
 
 		if ( MyEnvrnFlag( BoilerNum ) && BeginEnvrnFlag && ( PlantFirstSizesOkayToFinalize ) ) {
 			//if ( ! PlantFirstSizeCompleted ) SizeBoiler( BoilerNum );
-			rho = GetDensityGlycol( PlantLoop( Boiler( BoilerNum ).LoopNum ).FluidName, DataGlobals::CWInitConvTemp, PlantLoop( Boiler( BoilerNum ).LoopNum ).FluidIndex, RoutineName );
+			rho = PlantLoop( Boiler( BoilerNum ).LoopNum ).glycol().rho( DataGlobals::CWInitConvTemp, RoutineName );
 			Boiler( BoilerNum ).DesMassFlowRate = Boiler( BoilerNum ).VolFlowRate * rho;
 
 			InitComponentNodes( 0.0, Boiler( BoilerNum ).DesMassFlowRate, Boiler( BoilerNum ).BoilerInletNodeNum, Boiler( BoilerNum ).BoilerOutletNodeNum, Boiler( BoilerNum ).LoopNum, Boiler( BoilerNum ).LoopSideNum, Boiler( BoilerNum ).BranchNum, Boiler( BoilerNum ).CompNum );
@@ -696,8 +695,6 @@ namespace Boilers {
 		using DataPlant::PlantFirstSizesOkayToFinalize;
 		using DataPlant::PlantFirstSizesOkayToReport;
 		using DataPlant::PlantFinalSizesOkayToReport;
-		using FluidProperties::GetDensityGlycol;
-		using FluidProperties::GetSpecificHeatGlycol;
 		using PlantUtilities::RegisterPlantCompDesignFlow;
 		using ReportSizingManager::ReportSizingOutput;
 		using namespace OutputReportPredefined;
@@ -724,8 +721,8 @@ namespace Boilers {
 		if ( PltSizNum > 0 ) {
 			if ( PlantSizData( PltSizNum ).DesVolFlowRate >= SmallWaterVolFlow ) {
 
-				rho = GetDensityGlycol( PlantLoop( Boiler( BoilerNum ).LoopNum ).FluidName, DataGlobals::CWInitConvTemp, PlantLoop( Boiler( BoilerNum ).LoopNum ).FluidIndex, RoutineName );
-				Cp = GetSpecificHeatGlycol( PlantLoop( Boiler( BoilerNum ).LoopNum ).FluidName, Boiler( BoilerNum ).TempDesBoilerOut, PlantLoop( Boiler( BoilerNum ).LoopNum ).FluidIndex, RoutineName );
+				rho = PlantLoop( Boiler( BoilerNum ).LoopNum ).glycol().rho( DataGlobals::CWInitConvTemp, RoutineName );
+				Cp = PlantLoop( Boiler( BoilerNum ).LoopNum ).glycol().cp( Boiler( BoilerNum ).TempDesBoilerOut, RoutineName );
 				tmpNomCap = Cp * rho * Boiler( BoilerNum ).SizFac * PlantSizData( PltSizNum ).DeltaT * PlantSizData( PltSizNum ).DesVolFlowRate;
 				if ( ! Boiler( BoilerNum ).NomCapWasAutoSized ) tmpNomCap = Boiler( BoilerNum ).NomCap;
 
@@ -874,7 +871,6 @@ namespace Boilers {
 		using DataGlobals::BeginEnvrnFlag;
 		using DataGlobals::WarmupFlag;
 
-		using FluidProperties::GetSpecificHeatGlycol;
 		using DataBranchAirLoopPlant::ControlType_SeriesActive;
 		using CurveManager::CurveValue;
 		using General::TrimSigDigits;
@@ -926,7 +922,7 @@ namespace Boilers {
 		LoopNum = Boiler( BoilerNum ).LoopNum;
 		LoopSideNum = Boiler( BoilerNum ).LoopSideNum;
 
-		Cp = GetSpecificHeatGlycol( PlantLoop( Boiler( BoilerNum ).LoopNum ).FluidName, Node( BoilerInletNode ).Temp, PlantLoop( Boiler( BoilerNum ).LoopNum ).FluidIndex, RoutineName );
+		Cp = PlantLoop( Boiler( BoilerNum ).LoopNum ).glycol().cp( Node( BoilerInletNode ).Temp, RoutineName );
 
 		//If the specified load is 0.0 or the boiler should not run then we leave this subroutine. Before leaving
 		//if the component control is SERIESACTIVE we set the component flow to inlet flow so that flow resolver
@@ -0,0 +1,154 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus Headers
+#include <EnergyPlus/BoundingVolumeHierarchy.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+
+namespace EnergyPlus {
+
+// Package: Bounding Volume Hierarchy
+//
+// Purpose: Spatial index over the axis-aligned bounding boxes of a set of items, such as surfaces,
+//  to find the items that may satisfy a geometric test without testing every item
+//
+// Notes:
+//  Building is O( N log N ): each level partitions its items about the median center with nth_element
+//  Items with coincident centers along the split axis cannot be separated so such ranges become leaves
+
+	// Build the tree over the item boxes: ids[ k ] is the id reported for boxes[ k ]
+	void
+	BoundingVolumeHierarchy::build(
+	 std::vector< Box > const & boxes,
+	 std::vector< int > const & ids,
+	 size_type const leafSize
+	)
+	{
+		assert( boxes.size() == ids.size() );
+		clear();
+		size_type const n( boxes.size() );
+		if ( n == 0u ) return;
+
+		std::vector< Vector > centers;
+		centers.reserve( n );
+		for ( Box const & box : boxes ) centers.push_back( box.center() );
+		std::vector< size_type > order( n );
+		for ( size_type k = 0; k < n; ++k ) order[ k ] = k;
+
+		nodes_.reserve( 2u * ( n / std::max( leafSize, size_type( 1u ) ) ) + 1u );
+		build_node( order, boxes, centers, 0u, n, std::max( leafSize, size_type( 1u ) ) );
+
+		// Store the items in tree order so leaves are contiguous
+		boxes_.reserve( n );
+		ids_.reserve( n );
+		for ( size_type const k : order ) {
+			boxes_.push_back( boxes[ k ] );
+			ids_.push_back( ids[ k ] );
+		}
+	}
+
+	// Release all storage
+	void
+	BoundingVolumeHierarchy::clear()
+	{
+		nodes_.clear();
+		nodes_.shrink_to_fit();
+		boxes_.clear();
+		boxes_.shrink_to_fit();
+		ids_.clear();
+		ids_.shrink_to_fit();
+	}
+
+	// Build the subtree over item positions [ b, e ) of the order: Returns its node index
+	BoundingVolumeHierarchy::size_type
+	BoundingVolumeHierarchy::build_node(
+	 std::vector< size_type > & order,
+	 std::vector< Box > const & boxes,
+	 std::vector< Vector > const & centers,
+	 size_type const b,
+	 size_type const e,
+	 size_type const leafSize
+	)
+	{
+		size_type const index( nodes_.size() );
+		nodes_.push_back( Node() );
+
+		Box box; // Bounds of the items
+		Box cbox; // Bounds of the item centers
+		for ( size_type k = b; k < e; ++k ) {
+			box.include( boxes[ order[ k ] ] );
+			cbox.include( centers[ order[ k ] ] );
+		}
+		nodes_[ index ].box = box;
+
+		// Split along the longest extent of the centers
+		Real64 const dx( cbox.u.x - cbox.l.x );
+		Real64 const dy( cbox.u.y - cbox.l.y );
+		Real64 const dz( cbox.u.z - cbox.l.z );
+		int const axis( ( dx >= dy ) && ( dx >= dz ) ? 0 : ( dy >= dz ? 1 : 2 ) );
+		Real64 const extent( std::max( { dx, dy, dz } ) );
+
+		if ( ( e - b <= leafSize ) || ( extent <= 0.0 ) ) { // Leaf
+			nodes_[ index ].first = b;
+			nodes_[ index ].count = e - b;
+			return index;
+		}
+
+		size_type const m( b + ( e - b ) / 2u );
+		std::nth_element( order.begin() + b, order.begin() + m, order.begin() + e, [ &centers, axis ]( size_type const i, size_type const j ) {
+			return centers[ i ][ axis ] < centers[ j ][ axis ];
+		} );
+
+		build_node( order, boxes, centers, b, m, leafSize ); // Left child is the next node
+		size_type const right( build_node( order, boxes, centers, m, e, leafSize ) );
+		nodes_[ index ].right = right;
+		return index;
+	}
+
+} // EnergyPlus
@@ -0,0 +1,235 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EnergyPlus_BoundingVolumeHierarchy_hh_INCLUDED
+#define EnergyPlus_BoundingVolumeHierarchy_hh_INCLUDED
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Vector3.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace EnergyPlus {
+
+// Package: Bounding Volume Hierarchy
+//
+// Purpose: Spatial index over the axis-aligned bounding boxes of a set of items, such as surfaces,
+//  to find the items that may satisfy a geometric test without testing every item
+//
+// Notes:
+//  The tree is a binary hierarchy built by median splits of the box centers along the longest axis
+//  Nodes are stored depth first: the left child of a node follows it and the right child is indexed
+//  A query takes a box test that must be conservative: it may only reject a box if no item inside
+//   it can pass the caller's exact test, since whole subtrees are skipped on a rejection
+//  Queries do not modify the tree so concurrent queries are safe
+
+class BoundingVolumeHierarchy
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Vector = ObjexxFCL::Vector3< Real64 >;
+
+	// Axis-aligned box
+	struct Box
+	{
+		Vector l; // Lower corner
+		Vector u; // Upper corner
+
+		// Default Constructor: Empty box
+		Box() :
+		 l( std::numeric_limits< Real64 >::max() ),
+		 u( std::numeric_limits< Real64 >::lowest() )
+		{}
+
+		// Grow to include a point
+		void
+		include( Vector const & p )
+		{
+			if ( p.x < l.x ) l.x = p.x;
+			if ( p.y < l.y ) l.y = p.y;
+			if ( p.z < l.z ) l.z = p.z;
+			if ( p.x > u.x ) u.x = p.x;
+			if ( p.y > u.y ) u.y = p.y;
+			if ( p.z > u.z ) u.z = p.z;
+		}
+
+		// Grow to include a box
+		void
+		include( Box const & b )
+		{
+			if ( b.l.x < l.x ) l.x = b.l.x;
+			if ( b.l.y < l.y ) l.y = b.l.y;
+			if ( b.l.z < l.z ) l.z = b.l.z;
+			if ( b.u.x > u.x ) u.x = b.u.x;
+			if ( b.u.y > u.y ) u.y = b.u.y;
+			if ( b.u.z > u.z ) u.z = b.u.z;
+		}
+
+		// Center
+		Vector
+		center() const
+		{
+			return Vector( 0.5 * ( l.x + u.x ), 0.5 * ( l.y + u.y ), 0.5 * ( l.z + u.z ) );
+		}
+	};
+
+public: // Creation
+
+	// Default Constructor
+	BoundingVolumeHierarchy()
+	{}
+
+public: // Properties
+
+	// Number of items
+	size_type
+	size() const
+	{
+		return ids_.size();
+	}
+
+	// No items?
+	bool
+	empty() const
+	{
+		return ids_.empty();
+	}
+
+	// Number of tree nodes
+	size_type
+	nodeCount() const
+	{
+		return nodes_.size();
+	}
+
+public: // Methods
+
+	// Build the tree over the item boxes: ids[ k ] is the id reported for boxes[ k ]
+	void
+	build(
+	 std::vector< Box > const & boxes,
+	 std::vector< int > const & ids,
+	 size_type const leafSize = 4
+	);
+
+	// Release all storage
+	void
+	clear();
+
+	// Visit the id of each item whose box passes the box test: visit( id ), test( Box const & ) -> bool
+	template< typename BoxTest, typename Visit >
+	void
+	query( BoxTest const & test, Visit const & visit ) const
+	{
+		if ( nodes_.empty() ) return;
+		std::vector< size_type > stack;
+		stack.reserve( 64 );
+		stack.push_back( 0u );
+		while ( ! stack.empty() ) {
+			size_type const i( stack.back() );
+			stack.pop_back();
+			Node const & node( nodes_[ i ] );
+			if ( ! test( node.box ) ) continue;
+			if ( node.count > 0u ) { // Leaf
+				for ( size_type k = node.first, e = node.first + node.count; k < e; ++k ) {
+					if ( test( boxes_[ k ] ) ) visit( ids_[ k ] );
+				}
+			} else {
+				stack.push_back( node.right );
+				stack.push_back( i + 1 );
+			}
+		}
+	}
+
+private: // Types
+
+	struct Node
+	{
+		Box box; // Bounds of the items below
+		size_type first; // Leaf: First item position
+		size_type count; // Leaf: Number of items (0 for an interior node)
+		size_type right; // Interior: Right child index (the left child is the next node)
+
+		// Default Constructor
+		Node() :
+		 first( 0u ),
+		 count( 0u ),
+		 right( 0u )
+		{}
+	};
+
+private: // Methods
+
+	// Build the subtree over item positions [ b, e ) of the order: Returns its node index
+	size_type
+	build_node(
+	 std::vector< size_type > & order,
+	 std::vector< Box > const & boxes,
+	 std::vector< Vector > const & centers,
+	 size_type const b,
+	 size_type const e,
+	 size_type const leafSize
+	);
+
+private: // Data
+
+	std::vector< Node > nodes_; // Tree nodes in depth first order
+	std::vector< Box > boxes_; // Item boxes in tree order
+	std::vector< int > ids_; // Item ids in tree order
+
+}; // BoundingVolumeHierarchy
+
+} // EnergyPlus
+
+#endif
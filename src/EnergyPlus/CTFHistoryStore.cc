@@ -0,0 +1,317 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus Headers
+#include <EnergyPlus/CTFHistoryStore.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <map>
+#include <utility>
+
+namespace EnergyPlus {
+
+	using DataGlobals::TimeStepZone;
+	using DataHeatBalance::Construct;
+	using DataHeatBalSurface::TH;
+	using DataHeatBalSurface::QH;
+	using DataHeatBalSurface::THM;
+	using DataHeatBalSurface::QHM;
+	using DataHeatBalSurface::SUMH;
+	using DataSurfaces::Surface;
+	using DataSurfaces::TotSurfaces;
+	using DataSurfaces::SurfaceClass_Window;
+	using DataSurfaces::SurfaceClass_TDD_Dome;
+	using DataSurfaces::HeatTransferModel_CTF;
+	using DataSurfaces::HeatTransferModel_EMPD;
+
+	// Has any packed surface changed construction?
+	bool
+	CTFHistoryStore::stale() const
+	{
+		for ( Group const & g : groups_ ) {
+			for ( int const SurfNum : g.Surfaces ) {
+				if ( Surface( SurfNum ).Construction != g.Construction ) return true;
+			}
+		}
+		return false;
+	}
+
+	// Pack the eligible surfaces from TH/QH/THM/QHM
+	void
+	CTFHistoryStore::build()
+	{
+		clear();
+		group_.assign( TotSurfaces + 1, 0 );
+
+		// Group by construction and history phase in surface order
+		std::map< std::pair< int, int >, int > keys;
+		size_type mMax( 0u );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( ! surface.HeatTransSurf ) continue;
+			if ( surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome ) continue;
+			if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) continue;
+			int const ConstrNum( surface.Construction );
+			auto const & construct( Construct( ConstrNum ) );
+			if ( construct.NumCTFTerms <= 1 || construct.SourceSinkPresent ) continue;
+
+			auto const key( std::make_pair( ConstrNum, SUMH( SurfNum ) ) );
+			auto const i( keys.find( key ) );
+			int gNum;
+			if ( i == keys.end() ) {
+				groups_.emplace_back();
+				gNum = keys[ key ] = int( groups_.size() );
+				Group & g( groups_.back() );
+				int const n( construct.NumCTFTerms );
+				g.Construction = ConstrNum;
+				g.NumTerms = n;
+				g.NumHistories = construct.NumHistories;
+				g.CTFTimeStep = construct.CTFTimeStep;
+				for ( int Term = 1; Term <= n; ++Term ) {
+					g.CTFOutside.push_back( construct.CTFOutside( Term ) );
+					g.CTFCross.push_back( construct.CTFCross( Term ) );
+					g.CTFInside.push_back( construct.CTFInside( Term ) );
+					g.CTFFlux.push_back( construct.CTFFlux( Term ) );
+				}
+			} else {
+				gNum = i->second;
+			}
+			Group & g( groups_[ gNum - 1 ] );
+			g.Surfaces.push_back( SurfNum );
+			if ( g.Surfaces.size() > mMax ) mMax = g.Surfaces.size();
+			group_[ SurfNum ] = gNum;
+		}
+
+		// Copy the histories: the current TH/QH values may be interpolated
+		for ( Group & g : groups_ ) {
+			size_type const m( g.Surfaces.size() );
+			size_type const nm( g.NumTerms * m );
+			g.THMOut.resize( nm );
+			g.THMIn.resize( nm );
+			g.QHMOut.resize( nm );
+			g.QHMIn.resize( nm );
+			g.THOut.resize( nm );
+			g.THIn.resize( nm );
+			g.QHOut.resize( nm );
+			g.QHIn.resize( nm );
+			g.Head = 0;
+			g.Interpolated = true;
+			for ( int t = 1; t <= g.NumTerms; ++t ) {
+				size_type const k( g.term( t ) );
+				for ( size_type i = 0; i < m; ++i ) {
+					int const SurfNum( g.Surfaces[ i ] );
+					auto const l1( TH.index( 1, t + 1, SurfNum ) );
+					auto const l2( TH.index( 2, t + 1, SurfNum ) );
+					g.THMOut[ k + i ] = THM[ l1 ];
+					g.THMIn[ k + i ] = THM[ l2 ];
+					g.QHMOut[ k + i ] = QHM[ l1 ];
+					g.QHMIn[ k + i ] = QHM[ l2 ];
+					g.THOut[ k + i ] = TH[ l1 ];
+					g.THIn[ k + i ] = TH[ l2 ];
+					g.QHOut[ k + i ] = QH[ l1 ];
+					g.QHIn[ k + i ] = QH[ l2 ];
+				}
+			}
+		}
+
+		qOut_.resize( mMax );
+		qIn_.resize( mMax );
+		built_ = true;
+	}
+
+	// Write the packed histories back to TH/QH/THM/QHM
+	void
+	CTFHistoryStore::unpack() const
+	{
+		for ( Group const & g : groups_ ) {
+			size_type const m( g.Surfaces.size() );
+			for ( int t = 1; t <= g.NumTerms; ++t ) {
+				size_type const km( g.slot( t ) );
+				size_type const k( g.Interpolated ? g.term( t ) : km );
+				auto const & THOut( g.Interpolated ? g.THOut : g.THMOut );
+				auto const & THIn( g.Interpolated ? g.THIn : g.THMIn );
+				auto const & QHOut( g.Interpolated ? g.QHOut : g.QHMOut );
+				auto const & QHIn( g.Interpolated ? g.QHIn : g.QHMIn );
+				for ( size_type i = 0; i < m; ++i ) {
+					int const SurfNum( g.Surfaces[ i ] );
+					auto const l1( TH.index( 1, t + 1, SurfNum ) );
+					auto const l2( TH.index( 2, t + 1, SurfNum ) );
+					THM[ l1 ] = g.THMOut[ km + i ];
+					THM[ l2 ] = g.THMIn[ km + i ];
+					QHM[ l1 ] = g.QHMOut[ km + i ];
+					QHM[ l2 ] = g.QHMIn[ km + i ];
+					TH[ l1 ] = THOut[ k + i ];
+					TH[ l2 ] = THIn[ k + i ];
+					QH[ l1 ] = QHOut[ k + i ];
+					QH[ l2 ] = QHIn[ k + i ];
+				}
+			}
+		}
+	}
+
+	// Drop the packed data without writing it back
+	void
+	CTFHistoryStore::clear()
+	{
+		built_ = false;
+		groups_.clear();
+		group_.clear();
+		qOut_.clear();
+		qIn_.clear();
+	}
+
+	// History sums (constant parts of the CTF equations) of the packed surfaces
+	void
+	CTFHistoryStore::sumConstParts(
+	 Array1D< Real64 > & ConstOutPart,
+	 Array1D< Real64 > & ConstInPart
+	)
+	{
+		Real64 * const qOut( qOut_.data() );
+		Real64 * const qIn( qIn_.data() );
+		for ( Group const & g : groups_ ) {
+			size_type const m( g.Surfaces.size() );
+			std::fill_n( qOut, m, 0.0 );
+			std::fill_n( qIn, m, 0.0 );
+			for ( int t = 1; t <= g.NumTerms; ++t ) { // Same term order and expressions as the surface by surface sums
+				size_type const k( g.Interpolated ? g.term( t ) : g.slot( t ) );
+				Real64 const * const THOut( ( g.Interpolated ? g.THOut : g.THMOut ).data() + k );
+				Real64 const * const THIn( ( g.Interpolated ? g.THIn : g.THMIn ).data() + k );
+				Real64 const * const QHOut( ( g.Interpolated ? g.QHOut : g.QHMOut ).data() + k );
+				Real64 const * const QHIn( ( g.Interpolated ? g.QHIn : g.QHMIn ).data() + k );
+				Real64 const ctf_out( g.CTFOutside[ t - 1 ] );
+				Real64 const ctf_cross( g.CTFCross[ t - 1 ] );
+				Real64 const ctf_in( g.CTFInside[ t - 1 ] );
+				Real64 const ctf_flux( g.CTFFlux[ t - 1 ] );
+				for ( size_type i = 0; i < m; ++i ) { // Contiguous: vectorizable
+					qIn[ i ] += ctf_cross * THOut[ i ] - ctf_in * THIn[ i ] + ctf_flux * QHIn[ i ];
+					qOut[ i ] += ctf_out * THOut[ i ] - ctf_cross * THIn[ i ] + ctf_flux * QHOut[ i ];
+				}
+			}
+			for ( size_type i = 0; i < m; ++i ) {
+				int const SurfNum( g.Surfaces[ i ] );
+				ConstOutPart( SurfNum ) = qOut[ i ];
+				ConstInPart( SurfNum ) = qIn[ i ];
+			}
+		}
+	}
+
+	// Shift or interpolate the packed histories at the end of a zone time step
+	void
+	CTFHistoryStore::updateHistories(
+	 Array1D< Real64 > const & TempExt1,
+	 Array1D< Real64 > const & TempInt1,
+	 Array1D< Real64 > const & QExt1,
+	 Array1D< Real64 > const & QInt1
+	)
+	{
+		for ( Group & g : groups_ ) {
+			size_type const m( g.Surfaces.size() );
+			int const n( g.NumTerms );
+			int sumh( 0 );
+			for ( int const SurfNum : g.Surfaces ) sumh = ++SUMH( SurfNum ); // Group surfaces share their phase
+
+			if ( sumh == g.NumHistories ) { // Shift: rotate the ring so the oldest slot becomes term 1
+
+				for ( int const SurfNum : g.Surfaces ) SUMH( SurfNum ) = 0;
+				g.Head = ( g.Head + n - 1 ) % n;
+				g.Interpolated = false;
+				size_type const k( g.slot( 1 ) );
+				for ( size_type i = 0; i < m; ++i ) {
+					int const SurfNum( g.Surfaces[ i ] );
+					auto const l21( TH.index( 1, 2, SurfNum ) );
+					auto const l22( TH.index( 2, 2, SurfNum ) );
+					TH[ l21 ] = THM[ l21 ] = g.THMOut[ k + i ] = TempExt1( SurfNum );
+					TH[ l22 ] = THM[ l22 ] = g.THMIn[ k + i ] = TempInt1( SurfNum );
+					QH[ l21 ] = QHM[ l21 ] = g.QHMOut[ k + i ] = QExt1( SurfNum );
+					QH[ l22 ] = QHM[ l22 ] = g.QHMIn[ k + i ] = QInt1( SurfNum );
+				}
+
+			} else { // Interpolate between the master history terms
+
+				Real64 const sum_steps( ( double( sumh ) * TimeStepZone ) / g.CTFTimeStep );
+				g.Interpolated = true;
+				for ( int t = 2; t <= n; ++t ) {
+					Real64 const * const THMOut( g.THMOut.data() + g.slot( t ) );
+					Real64 const * const THMIn( g.THMIn.data() + g.slot( t ) );
+					Real64 const * const QHMOut( g.QHMOut.data() + g.slot( t ) );
+					Real64 const * const QHMIn( g.QHMIn.data() + g.slot( t ) );
+					Real64 const * const THMOut0( g.THMOut.data() + g.slot( t - 1 ) );
+					Real64 const * const THMIn0( g.THMIn.data() + g.slot( t - 1 ) );
+					Real64 const * const QHMOut0( g.QHMOut.data() + g.slot( t - 1 ) );
+					Real64 const * const QHMIn0( g.QHMIn.data() + g.slot( t - 1 ) );
+					Real64 * const THOut( g.THOut.data() + g.term( t ) );
+					Real64 * const THIn( g.THIn.data() + g.term( t ) );
+					Real64 * const QHOut( g.QHOut.data() + g.term( t ) );
+					Real64 * const QHIn( g.QHIn.data() + g.term( t ) );
+					for ( size_type i = 0; i < m; ++i ) { // Contiguous: vectorizable
+						THOut[ i ] = THMOut[ i ] - ( THMOut[ i ] - THMOut0[ i ] ) * sum_steps;
+						THIn[ i ] = THMIn[ i ] - ( THMIn[ i ] - THMIn0[ i ] ) * sum_steps;
+						QHOut[ i ] = QHMOut[ i ] - ( QHMOut[ i ] - QHMOut0[ i ] ) * sum_steps;
+						QHIn[ i ] = QHMIn[ i ] - ( QHMIn[ i ] - QHMIn0[ i ] ) * sum_steps;
+					}
+				}
+				size_type const k( g.slot( 1 ) );
+				for ( size_type i = 0; i < m; ++i ) { // Term 1 interpolates toward the first time step values
+					int const SurfNum( g.Surfaces[ i ] );
+					auto const l21( TH.index( 1, 2, SurfNum ) );
+					auto const l22( TH.index( 2, 2, SurfNum ) );
+					TH[ l21 ] = g.THOut[ i ] = g.THMOut[ k + i ] - ( g.THMOut[ k + i ] - TempExt1( SurfNum ) ) * sum_steps;
+					TH[ l22 ] = g.THIn[ i ] = g.THMIn[ k + i ] - ( g.THMIn[ k + i ] - TempInt1( SurfNum ) ) * sum_steps;
+					QH[ l21 ] = g.QHOut[ i ] = g.QHMOut[ k + i ] - ( g.QHMOut[ k + i ] - QExt1( SurfNum ) ) * sum_steps;
+					QH[ l22 ] = g.QHIn[ i ] = g.QHMIn[ k + i ] - ( g.QHMIn[ k + i ] - QInt1( SurfNum ) ) * sum_steps;
+				}
+
+			}
+		}
+	}
+
+} // EnergyPlus
@@ -0,0 +1,192 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EnergyPlus_CTFHistoryStore_hh_INCLUDED
+#define EnergyPlus_CTFHistoryStore_hh_INCLUDED
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <vector>
+
+namespace EnergyPlus {
+
+// Package: CTF History Store
+//
+// Purpose: Packed structure-of-arrays copy of the conduction transfer function (CTF) coefficients
+//  and temperature/flux histories of the opaque CTF surfaces, grouped by construction, so that the
+//  history sums run as contiguous loops over the surfaces sharing a construction and the master
+//  histories are shifted by rotating a ring index instead of copying every term
+//
+// Notes:
+//  Surfaces with internal sources/sinks or fewer than two CTF terms stay in the TH/QH/THM/QHM arrays
+//  Groups are keyed by construction and history phase (SUMH) so all of their surfaces shift together
+//  While a surface is packed only history term 1 (index 2) of TH/QH/THM/QHM is kept current:
+//   unpack writes all of the terms back, and must be called before anything else reads them
+//  The sums and updates use the same expressions in the same term order as the surface by surface
+//   code so the results are identical
+//  A construction change (EMS actuator) makes the store stale: unpack and build it again
+
+class CTFHistoryStore
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+
+	// Surfaces sharing a construction and history phase
+	struct Group
+	{
+		int Construction = 0; // Construction index
+		int NumTerms = 0; // Number of CTF history terms (n)
+		int NumHistories = 1; // Number of zone time steps per CTF time step
+		Real64 CTFTimeStep = 0.0; // CTF time step (hr)
+		std::vector< int > Surfaces; // Surface numbers (m)
+		std::vector< Real64 > CTFOutside; // CTF terms 1..n
+		std::vector< Real64 > CTFCross;
+		std::vector< Real64 > CTFInside;
+		std::vector< Real64 > CTFFlux;
+		std::vector< Real64 > THMOut; // Master histories: ring of n slots of m surfaces
+		std::vector< Real64 > THMIn;
+		std::vector< Real64 > QHMOut;
+		std::vector< Real64 > QHMIn;
+		std::vector< Real64 > THOut; // Interpolated histories: n terms of m surfaces
+		std::vector< Real64 > THIn;
+		std::vector< Real64 > QHOut;
+		std::vector< Real64 > QHIn;
+		int Head = 0; // Ring slot of master history term 1
+		bool Interpolated = false; // Interpolated histories differ from the master histories
+
+		// Master history slot of term t (1..n)
+		size_type
+		slot( int const t ) const
+		{
+			return size_type( ( Head + t - 1 ) % NumTerms ) * Surfaces.size();
+		}
+
+		// Interpolated history offset of term t (1..n)
+		size_type
+		term( int const t ) const
+		{
+			return size_type( t - 1 ) * Surfaces.size();
+		}
+	};
+
+public: // Properties
+
+	// Built?
+	bool
+	built() const
+	{
+		return built_;
+	}
+
+	// Groups
+	std::vector< Group > const &
+	groups() const
+	{
+		return groups_;
+	}
+
+	// Is a surface packed?
+	bool
+	packed( int const SurfNum ) const
+	{
+		return ( size_type( SurfNum ) < group_.size() ) && ( group_[ SurfNum ] > 0 );
+	}
+
+	// Has any packed surface changed construction?
+	bool
+	stale() const;
+
+public: // Methods
+
+	// Pack the eligible surfaces from TH/QH/THM/QHM
+	void
+	build();
+
+	// Write the packed histories back to TH/QH/THM/QHM
+	void
+	unpack() const;
+
+	// Drop the packed data without writing it back
+	void
+	clear();
+
+	// History sums (constant parts of the CTF equations) of the packed surfaces
+	void
+	sumConstParts(
+	 Array1D< Real64 > & ConstOutPart,
+	 Array1D< Real64 > & ConstInPart
+	);
+
+	// Shift or interpolate the packed histories at the end of a zone time step
+	void
+	updateHistories(
+	 Array1D< Real64 > const & TempExt1,
+	 Array1D< Real64 > const & TempInt1,
+	 Array1D< Real64 > const & QExt1,
+	 Array1D< Real64 > const & QInt1
+	);
+
+private: // Data
+
+	bool built_ = false;
+	std::vector< Group > groups_;
+	std::vector< int > group_; // Group number (1-based) of each surface (0 if not packed)
+	std::vector< Real64 > qOut_; // Sum scratch
+	std::vector< Real64 > qIn_; // Sum scratch
+
+};
+
+} // EnergyPlus
+
+#endif
@@ -0,0 +1,550 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+// Third-party Headers
+#include <zlib.h>
+
+// EnergyPlus Headers
+#include <ColumnarOutput.hh>
+#include <ColumnarOutputFormat.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace ColumnarOutput {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Writes the report variable and meter time series to a columnar binary file alongside the eso and mtr
+	// files, so that post-processing can read one variable over a time range without parsing the text output.
+
+	// METHODOLOGY EMPLOYED:
+	// The output processor hands over the same records it gives the SQLite database: a dictionary item per
+	// report id, a row per time stamp and the values of the row.  Rows are collected into chunks of up to
+	// ChunkRows rows of one environment; each column (report id) with a value in the chunk is written as one
+	// block, so a reader seeks straight to the blocks of the variables it wants.  The dictionary and an index
+	// of the chunks and blocks are written when the file is closed.  See ColumnarOutputFormat.hh for the layout.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// The column buffers are kept by report id and reused from chunk to chunk, so adding a value does not
+	// allocate once the first chunk has been written.
+
+	// Using/Aliasing
+	using namespace ColumnarOutputFormat;
+
+	// Data
+	// MODULE VARIABLE DECLARATIONS:
+	bool Active( false ); // True while the columnar time series file is open
+
+	namespace {
+		// Values of one column in the current chunk
+		struct ColumnBuffer
+		{
+			std::vector< std::uint32_t > Rows; // Row numbers within the chunk
+			std::vector< double > Values;
+			std::vector< double > MinValues; // Empty unless the column has minimum and maximum values
+			std::vector< std::int32_t > MinDates;
+			std::vector< double > MaxValues;
+			std::vector< std::int32_t > MaxDates;
+		};
+
+		std::ofstream File;
+		std::string FileName;
+		std::uint64_t Position( 0u ); // Bytes written to the file
+		bool Compress( false ); // Compress the blocks
+		std::vector< std::string > DayTypes; // Day type names in order of first use
+		std::vector< Environment > Environments;
+		std::vector< Variable > Variables;
+		std::vector< TimeStamp > Rows; // Rows of the current chunk
+		std::vector< ColumnBuffer > Columns; // Column buffers by report id
+		std::vector< int > ChunkColumns; // Report ids with a value in the current chunk
+		std::vector< ChunkEntry > Chunks; // Index of the chunks written
+		std::vector< ColumnEntry > ColumnEntries; // Index of the column blocks written
+		std::vector< char > Buffer; // Block being encoded
+		std::vector< Bytef > Compressed; // Block being compressed
+	}
+
+	// Functions
+
+	void
+	clear_state()
+	{
+		if ( File.is_open() ) File.close();
+		Active = false;
+		FileName.clear();
+		Position = 0u;
+		Compress = false;
+		DayTypes.clear();
+		Environments.clear();
+		Variables.clear();
+		Rows.clear();
+		Columns.clear();
+		ChunkColumns.clear();
+		Chunks.clear();
+		ColumnEntries.clear();
+		Buffer.clear();
+		Compressed.clear();
+	}
+
+	namespace {
+
+		// Write Buffer to the file as a block, compressed if that is on and makes it smaller
+		void
+		WriteBlock(
+			std::uint64_t & offset, // Block location
+			std::uint32_t & storedSize, // Block size in the file
+			std::uint8_t & flags // Block flags: BlockCompressed is set if compressed
+		)
+		{
+			offset = Position;
+			if ( Compress && ! Buffer.empty() ) {
+				uLongf size( compressBound( uLong( Buffer.size() ) ) );
+				Compressed.resize( size );
+				// Fastest level: the blocks are compressed on the simulation thread
+				if ( ( compress2( Compressed.data(), &size, reinterpret_cast< Bytef const * >( Buffer.data() ), uLong( Buffer.size() ), Z_BEST_SPEED ) == Z_OK ) && ( size < Buffer.size() ) ) {
+					File.write( reinterpret_cast< char const * >( Compressed.data() ), size );
+					Position += size;
+					storedSize = std::uint32_t( size );
+					flags |= BlockCompressed;
+					return;
+				}
+			}
+			File.write( Buffer.data(), Buffer.size() );
+			Position += Buffer.size();
+			storedSize = std::uint32_t( Buffer.size() );
+		}
+
+		// Write the rows and column blocks collected for the current chunk
+		void
+		WriteChunk()
+		{
+			if ( Rows.empty() ) return;
+
+			ChunkEntry chunk;
+			chunk.Rows = std::uint32_t( Rows.size() );
+			chunk.Environment = std::uint32_t( Environments.size() );
+			chunk.FirstKey = chunk.LastKey = time_key( Rows.front() );
+			Buffer.clear();
+			for ( auto const & row : Rows ) {
+				double const key( time_key( row ) );
+				chunk.FirstKey = std::min( chunk.FirstKey, key );
+				chunk.LastKey = std::max( chunk.LastKey, key );
+				put_time_stamp( Buffer, row );
+			}
+			WriteBlock( chunk.Offset, chunk.StoredSize, chunk.Flags );
+
+			std::sort( ChunkColumns.begin(), ChunkColumns.end() );
+			chunk.FirstColumn = std::uint32_t( ColumnEntries.size() );
+			chunk.NumColumns = std::uint32_t( ChunkColumns.size() );
+			for ( int const reportID : ChunkColumns ) {
+				ColumnBuffer & column( Columns[ reportID ] );
+				ColumnEntry entry;
+				entry.ReportID = reportID;
+				entry.Count = std::uint32_t( column.Values.size() );
+				Buffer.clear();
+				if ( column.Values.size() < Rows.size() ) {
+					entry.Flags |= BlockSparse;
+					for ( auto const row : column.Rows ) put_u32( Buffer, row );
+				}
+				for ( auto const value : column.Values ) put_f64( Buffer, value );
+				if ( ! column.MinValues.empty() ) {
+					entry.Flags |= BlockMinMax;
+					std::size_t const n( column.Values.size() );
+					column.MinValues.resize( n );
+					column.MinDates.resize( n );
+					column.MaxValues.resize( n );
+					column.MaxDates.resize( n );
+					for ( auto const value : column.MinValues ) put_f64( Buffer, value );
+					for ( auto const date : column.MinDates ) put_i32( Buffer, date );
+					for ( auto const value : column.MaxValues ) put_f64( Buffer, value );
+					for ( auto const date : column.MaxDates ) put_i32( Buffer, date );
+				}
+				entry.RawSize = std::uint32_t( Buffer.size() );
+				WriteBlock( entry.Offset, entry.StoredSize, entry.Flags );
+				ColumnEntries.push_back( entry );
+
+				column.Rows.clear();
+				column.Values.clear();
+				column.MinValues.clear();
+				column.MinDates.clear();
+				column.MaxValues.clear();
+				column.MaxDates.clear();
+			}
+
+			Chunks.push_back( chunk );
+			Rows.clear();
+			ChunkColumns.clear();
+		}
+
+		// Add a value of the current row: Returns the column
+		ColumnBuffer &
+		AppendValue(
+			int const reportID,
+			Real64 const value
+		)
+		{
+			if ( std::size_t( reportID ) >= Columns.size() ) Columns.resize( std::max( std::size_t( reportID ) + 1u, 2u * Columns.size() ) );
+			ColumnBuffer & column( Columns[ reportID ] );
+			std::uint32_t const row( std::uint32_t( Rows.size() - 1u ) );
+			if ( column.Rows.empty() ) {
+				ChunkColumns.push_back( reportID );
+			} else if ( column.Rows.back() == row ) { // Reported twice in a row: keep the last value
+				column.Values.back() = value;
+				return column;
+			}
+			column.Rows.push_back( row );
+			column.Values.push_back( value );
+			return column;
+		}
+
+	}
+
+	bool
+	OpenColumnarFile(
+		std::string const & fileName, // Columnar time series file
+		bool const compress // Compress the column blocks with zlib
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Opens the columnar time series file and writes its header: Returns false if it could not be opened.
+
+		clear_state();
+		File.open( fileName, std::ios::binary | std::ios::trunc );
+		if ( ! File ) return false;
+		FileName = fileName;
+		Compress = compress;
+
+		Buffer.clear();
+		Buffer.insert( Buffer.end(), HeaderMagic, HeaderMagic + MagicSize );
+		put_u32( Buffer, Version );
+		put_u32( Buffer, Compress ? FileCompressed : 0u );
+		File.write( Buffer.data(), Buffer.size() );
+		Position = Buffer.size();
+		Active = true;
+		return true;
+	}
+
+	void
+	CloseColumnarFile()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the last chunk, the dictionary, the index and the trailer and closes the file.
+		// Also called when the simulation is aborted, so that what was simulated can still be read.
+
+		if ( ! Active ) return;
+		Active = false;
+		WriteChunk();
+
+		std::uint64_t const DictionaryOffset( Position );
+		Buffer.clear();
+		Buffer.insert( Buffer.end(), DictionaryMagic, DictionaryMagic + 4 );
+		put_u32( Buffer, std::uint32_t( DayTypes.size() ) );
+		for ( auto const & dayType : DayTypes ) put_string( Buffer, dayType );
+		put_u32( Buffer, std::uint32_t( Environments.size() ) );
+		for ( auto const & environment : Environments ) {
+			put_string( Buffer, environment.Title );
+			put_f64( Buffer, environment.Latitude );
+			put_f64( Buffer, environment.Longitude );
+			put_f64( Buffer, environment.TimeZone );
+			put_f64( Buffer, environment.Elevation );
+		}
+		put_u32( Buffer, std::uint32_t( Variables.size() ) );
+		for ( auto const & variable : Variables ) {
+			put_i32( Buffer, variable.ReportID );
+			put_i32( Buffer, variable.Interval );
+			put_u8( Buffer, std::uint8_t( variable.Kind ) );
+			put_u8( Buffer, std::uint8_t( variable.StoreType ) );
+			put_u8( Buffer, variable.MeterFileOnly ? 1u : 0u );
+			put_u8( Buffer, std::uint8_t( variable.IndexType ) );
+			put_string( Buffer, variable.IndexGroup );
+			put_string( Buffer, variable.Key );
+			put_string( Buffer, variable.Name );
+			put_string( Buffer, variable.Units );
+			put_string( Buffer, variable.Schedule );
+		}
+		File.write( Buffer.data(), Buffer.size() );
+		Position += Buffer.size();
+
+		std::uint64_t const IndexOffset( Position );
+		Buffer.clear();
+		Buffer.insert( Buffer.end(), IndexMagic, IndexMagic + 4 );
+		put_u32( Buffer, std::uint32_t( Chunks.size() ) );
+		for ( auto const & chunk : Chunks ) {
+			put_u64( Buffer, chunk.Offset );
+			put_u32( Buffer, chunk.StoredSize );
+			put_u8( Buffer, chunk.Flags );
+			put_u32( Buffer, chunk.Rows );
+			put_u32( Buffer, chunk.Environment );
+			put_f64( Buffer, chunk.FirstKey );
+			put_f64( Buffer, chunk.LastKey );
+			put_u32( Buffer, chunk.FirstColumn );
+			put_u32( Buffer, chunk.NumColumns );
+		}
+		put_u32( Buffer, std::uint32_t( ColumnEntries.size() ) );
+		for ( auto const & entry : ColumnEntries ) {
+			put_i32( Buffer, entry.ReportID );
+			put_u8( Buffer, entry.Flags );
+			put_u64( Buffer, entry.Offset );
+			put_u32( Buffer, entry.StoredSize );
+			put_u32( Buffer, entry.RawSize );
+			put_u32( Buffer, entry.Count );
+		}
+
+		put_u64( Buffer, DictionaryOffset );
+		put_u64( Buffer, IndexOffset );
+		put_u32( Buffer, Version );
+		put_u32( Buffer, 0u );
+		Buffer.insert( Buffer.end(), TrailerMagic, TrailerMagic + MagicSize );
+		File.write( Buffer.data(), Buffer.size() );
+		Position += Buffer.size();
+
+		File.close();
+		if ( File.fail() ) {
+			ShowWarningError( "CloseColumnarFile: Could not write the columnar time series file " + FileName );
+		}
+		clear_state();
+	}
+
+	void
+	AddVariable(
+		int const reportID, // The reporting ID for the data
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		int const kind, // ColumnarOutputFormat::KindVariable, KindMeter or KindCumulativeMeter
+		int const storeType, // Averaged or summed
+		bool const meterFileOnly, // Meter reported to the mtr file only
+		int const indexType, // Zone or system time step
+		std::string const & indexGroup, // The reporting group (e.g., Zone, Plant Loop, etc.)
+		std::string const & keyedValue, // The key name for the data
+		std::string const & variableName, // The variable's or meter's name
+		std::string const & unitsString, // The variable's units
+		std::string const & scheduleName // The reporting schedule (blank for none)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a data dictionary item: one column of the file.
+
+		if ( ! Active ) return;
+		Variables.emplace_back();
+		Variable & variable( Variables.back() );
+		variable.ReportID = reportID;
+		variable.Interval = reportingInterval;
+		variable.Kind = kind;
+		variable.StoreType = storeType;
+		variable.MeterFileOnly = meterFileOnly;
+		variable.IndexType = indexType;
+		variable.IndexGroup = indexGroup;
+		variable.Key = keyedValue;
+		variable.Name = variableName;
+		variable.Units = unitsString;
+		variable.Schedule = scheduleName;
+	}
+
+	void
+	BeginEnvironment(
+		std::string const & Title, // Environment stamp title
+		Real64 const Latitude,
+		Real64 const Longitude,
+		Real64 const TimeZone,
+		Real64 const Elevation
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts the rows of a new environment (or warmup day) at the eso environment stamp.
+
+		if ( ! Active ) return;
+		WriteChunk(); // Chunks do not span environments
+		Environments.emplace_back();
+		Environment & environment( Environments.back() );
+		environment.Title = Title;
+		environment.Latitude = Latitude;
+		environment.Longitude = Longitude;
+		environment.TimeZone = TimeZone;
+		environment.Elevation = Elevation;
+	}
+
+	void
+	AddTimeStamp(
+		int const reportingInterval, // The reporting interval of the row
+		int const DayOfSim, // the number of days simulated so far
+		int const Month, // the month of the reporting interval (0 for run period)
+		int const DayOfMonth, // The day of the reporting interval (0 for monthly and run period)
+		int const Hour, // The hour of the reporting interval (0 for daily and longer)
+		Real64 const EndMinute, // The last minute in the reporting interval (detailed and time step)
+		Real64 const StartMinute, // The starting minute of the reporting interval (detailed and time step)
+		int const DST, // A flag indicating whether daylight savings time is observed
+		std::string const & DayType, // The day type (blank for monthly and run period)
+		bool const Warmup // Written during warmup
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts a row: the values added next belong to this time stamp, as in the SQLite time index.
+
+		if ( ! Active ) return;
+		if ( Rows.size() == ChunkRows ) WriteChunk();
+
+		Rows.emplace_back();
+		TimeStamp & row( Rows.back() );
+		row.DayOfSim = DayOfSim;
+		row.Interval = reportingInterval;
+		row.Month = Month;
+		row.DayOfMonth = DayOfMonth;
+		row.Hour = Hour;
+		row.DST = DST;
+		row.Warmup = Warmup;
+		row.StartMinute = StartMinute;
+		row.EndMinute = EndMinute;
+		if ( ! DayType.empty() ) {
+			auto const dayType( std::find( DayTypes.begin(), DayTypes.end(), DayType ) );
+			row.DayType = int( dayType - DayTypes.begin() ) + 1;
+			if ( dayType == DayTypes.end() ) DayTypes.push_back( DayType );
+		}
+	}
+
+	void
+	AddValue(
+		int const reportID, // The variable's report ID
+		Real64 const value // The variable's value
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a value to the current row.
+
+		if ( ! Active || Rows.empty() || ( reportID <= 0 ) ) return;
+		AppendValue( reportID, value );
+	}
+
+	void
+	AddValue(
+		int const reportID, // The variable's report ID
+		Real64 const value, // The variable's value
+		Real64 const minValue, // The variable's minimum value during the reporting interval
+		int const minValueDate, // The date the minimum value occurred
+		Real64 const maxValue, // The variable's maximum value during the reporting interval
+		int const maxValueDate // The date the maximum value occurred
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Adds a value with its minimum and maximum (daily and longer intervals) to the current row.
+
+		if ( ! Active || Rows.empty() || ( reportID <= 0 ) ) return;
+		ColumnBuffer & column( AppendValue( reportID, value ) );
+		std::size_t const n( column.Values.size() ); // Earlier values without a minimum and maximum get 0
+		column.MinValues.resize( n );
+		column.MinDates.resize( n );
+		column.MaxValues.resize( n );
+		column.MaxDates.resize( n );
+		column.MinValues.back() = minValue;
+		column.MinDates.back() = minValueDate;
+		column.MaxValues.back() = maxValue;
+		column.MaxDates.back() = maxValueDate;
+	}
+
+} // ColumnarOutput
+
+} // EnergyPlus
@@ -0,0 +1,136 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ColumnarOutput_hh_INCLUDED
+#define ColumnarOutput_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+
+namespace EnergyPlus {
+
+namespace ColumnarOutput {
+
+	// Data
+	// MODULE VARIABLE DECLARATIONS:
+	extern bool Active; // True while the columnar time series file is open
+
+	// Functions
+
+	void
+	clear_state();
+
+	bool
+	OpenColumnarFile(
+		std::string const & fileName, // Columnar time series file
+		bool const compress // Compress the column blocks with zlib
+	);
+
+	void
+	CloseColumnarFile();
+
+	void
+	AddVariable(
+		int const reportID, // The reporting ID for the data
+		int const reportingInterval, // The reporting interval (e.g., hourly, daily)
+		int const kind, // ColumnarOutputFormat::KindVariable, KindMeter or KindCumulativeMeter
+		int const storeType, // Averaged or summed
+		bool const meterFileOnly, // Meter reported to the mtr file only
+		int const indexType, // Zone or system time step
+		std::string const & indexGroup, // The reporting group (e.g., Zone, Plant Loop, etc.)
+		std::string const & keyedValue, // The key name for the data
+		std::string const & variableName, // The variable's or meter's name
+		std::string const & unitsString, // The variable's units
+		std::string const & scheduleName // The reporting schedule (blank for none)
+	);
+
+	void
+	BeginEnvironment(
+		std::string const & Title, // Environment stamp title
+		Real64 const Latitude,
+		Real64 const Longitude,
+		Real64 const TimeZone,
+		Real64 const Elevation
+	);
+
+	void
+	AddTimeStamp(
+		int const reportingInterval, // The reporting interval of the row
+		int const DayOfSim, // the number of days simulated so far
+		int const Month, // the month of the reporting interval (0 for run period)
+		int const DayOfMonth, // The day of the reporting interval (0 for monthly and run period)
+		int const Hour, // The hour of the reporting interval (0 for daily and longer)
+		Real64 const EndMinute, // The last minute in the reporting interval (detailed and time step)
+		Real64 const StartMinute, // The starting minute of the reporting interval (detailed and time step)
+		int const DST, // A flag indicating whether daylight savings time is observed
+		std::string const & DayType, // The day type (blank for monthly and run period)
+		bool const Warmup // Written during warmup
+	);
+
+	void
+	AddValue(
+		int const reportID, // The variable's report ID
+		Real64 const value // The variable's value
+	);
+
+	void
+	AddValue(
+		int const reportID, // The variable's report ID
+		Real64 const value, // The variable's value
+		Real64 const minValue, // The variable's minimum value during the reporting interval
+		int const minValueDate, // The date the minimum value occurred
+		Real64 const maxValue, // The variable's maximum value during the reporting interval
+		int const maxValueDate // The date the maximum value occurred
+	);
+
+} // ColumnarOutput
+
+} // EnergyPlus
+
+#endif
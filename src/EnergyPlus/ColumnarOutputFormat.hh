@@ -0,0 +1,457 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ColumnarOutputFormat_hh_INCLUDED
+#define ColumnarOutputFormat_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace EnergyPlus {
+
+namespace ColumnarOutputFormat {
+
+	// Layout of the columnar time series file written by ColumnarOutput and read by ColumnarOutputReader.
+	// This header has no EnergyPlus dependencies so that the reader builds on its own.
+	//
+	//  Header      Magic "EPCOLTS1", Version (u32), Flags (u32)
+	//  Chunks      Up to ChunkRows rows of one environment: the time stamp block, then one block per column
+	//               (report variable or meter) that has a value in any of those rows
+	//  Dictionary  Magic "DICT", day type names, environments, then the variables with the metadata of the
+	//               eso/mtr data dictionary
+	//  Index       Magic "INDX", the chunks (location, rows, environment, time key range, columns) and the
+	//               column blocks (report id, location, sizes, value count)
+	//  Trailer     Dictionary offset (u64), Index offset (u64), Version (u32), 0 (u32), Magic "EPCOLEND"
+	//
+	// Integers are little-endian and reals are IEEE 754 binary64; strings are a u32 length and the characters.
+	// A column block holds, uncompressed: the row numbers within the chunk (u32) when the column does not have
+	//  a value in every row, the values (f64), and for daily and longer intervals the minimum values (f64),
+	//  minimum dates (i32), maximum values (f64) and maximum dates (i32). Dates are packed as in the eso.
+	// Blocks are zlib compressed when the file is written with compression and that makes them smaller.
+	// A time stamp (32 bytes) is: DayOfSim (i32), Interval (i8), Month, DayOfMonth, Hour, DST, DayType
+	//  (day type number, 0 if none), Warmup (u8 each), 5 bytes of 0, StartMinute (f64), EndMinute (f64).
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	std::uint32_t const Version = 1u;
+	std::size_t const MagicSize = 8u;
+	char const HeaderMagic[] = "EPCOLTS1";
+	char const TrailerMagic[] = "EPCOLEND";
+	char const DictionaryMagic[] = "DICT";
+	char const IndexMagic[] = "INDX";
+	std::size_t const HeaderSize = 16u;
+	std::size_t const TrailerSize = 32u;
+	std::size_t const TimeStampSize = 32u;
+	std::size_t const ChunkRows = 4096u; // Rows per chunk
+	std::size_t const MaxColumnRowSize = 36u; // Largest uncompressed column block bytes per row: row number, value, minimum and maximum values and dates
+
+	std::uint32_t const FileCompressed = 1u; // Header flag: blocks may be compressed
+
+	std::uint8_t const BlockSparse = 1u; // Column block: row numbers precede the values
+	std::uint8_t const BlockMinMax = 2u; // Column block: minimum and maximum values and dates follow the values
+	std::uint8_t const BlockCompressed = 4u; // Block is zlib compressed
+
+	// Reporting intervals: same values as OutputProcessor::ReportEach ... ReportSim
+	int const IntervalEach = -1;
+	int const IntervalTimeStep = 0;
+	int const IntervalHourly = 1;
+	int const IntervalDaily = 2;
+	int const IntervalMonthly = 3;
+	int const IntervalRunPeriod = 4;
+
+	// Kinds of columns
+	int const KindVariable = 0; // Report variable
+	int const KindMeter = 1; // Meter
+	int const KindCumulativeMeter = 2; // Cumulative meter
+
+	// Types
+
+	// Time stamp of a row: the fields of the eso time stamp lines
+	struct TimeStamp
+	{
+		// Members
+		int DayOfSim; // Days simulated in the environment
+		int Interval; // Reporting interval (IntervalEach ... IntervalRunPeriod)
+		int Month;
+		int DayOfMonth;
+		int Hour;
+		int DST; // Daylight saving time indicator
+		int DayType; // Day type number: 1 based into the dictionary's day types, 0 if none
+		bool Warmup; // Written during warmup
+		double StartMinute; // Detailed and time step intervals
+		double EndMinute; // Detailed and time step intervals
+
+		// Default Constructor
+		TimeStamp() :
+			DayOfSim( 0 ),
+			Interval( IntervalEach ),
+			Month( 0 ),
+			DayOfMonth( 0 ),
+			Hour( 0 ),
+			DST( 0 ),
+			DayType( 0 ),
+			Warmup( false ),
+			StartMinute( 0.0 ),
+			EndMinute( 0.0 )
+		{}
+
+	};
+
+	// Report variable or meter: the eso/mtr data dictionary line of a column
+	struct Variable
+	{
+		// Members
+		int ReportID;
+		int Interval; // Reporting interval
+		int Kind; // KindVariable, KindMeter or KindCumulativeMeter
+		int StoreType; // 1 = averaged, 2 = summed
+		bool MeterFileOnly; // Meter reported to the mtr file only
+		int IndexType; // 1 = zone time step, 2 = system time step
+		std::string IndexGroup;
+		std::string Key; // Key name (blank for meters)
+		std::string Name; // Variable or meter name
+		std::string Units;
+		std::string Schedule; // Reporting schedule name (blank for none)
+
+		// Default Constructor
+		Variable() :
+			ReportID( 0 ),
+			Interval( IntervalEach ),
+			Kind( KindVariable ),
+			StoreType( 1 ),
+			MeterFileOnly( false ),
+			IndexType( 1 )
+		{}
+
+	};
+
+	// Environment: the eso environment stamp
+	struct Environment
+	{
+		// Members
+		std::string Title;
+		double Latitude;
+		double Longitude;
+		double TimeZone;
+		double Elevation;
+
+		// Default Constructor
+		Environment() :
+			Latitude( 0.0 ),
+			Longitude( 0.0 ),
+			TimeZone( 0.0 ),
+			Elevation( 0.0 )
+		{}
+
+	};
+
+	// Location of a chunk
+	struct ChunkEntry
+	{
+		// Members
+		std::uint64_t Offset; // Time stamp block
+		std::uint32_t StoredSize; // Time stamp block size in the file
+		std::uint8_t Flags; // Time stamp block flags
+		std::uint32_t Rows;
+		std::uint32_t Environment; // 1 based into the dictionary's environments, 0 before the first environment
+		double FirstKey; // Time key of the first row
+		double LastKey; // Time key of the last row
+		std::uint32_t FirstColumn; // First of the chunk's column entries (sorted by report id)
+		std::uint32_t NumColumns;
+
+		// Default Constructor
+		ChunkEntry() :
+			Offset( 0u ),
+			StoredSize( 0u ),
+			Flags( 0u ),
+			Rows( 0u ),
+			Environment( 0u ),
+			FirstKey( 0.0 ),
+			LastKey( 0.0 ),
+			FirstColumn( 0u ),
+			NumColumns( 0u )
+		{}
+
+	};
+
+	// Location of a column block
+	struct ColumnEntry
+	{
+		// Members
+		int ReportID;
+		std::uint8_t Flags; // BlockSparse, BlockMinMax, BlockCompressed
+		std::uint64_t Offset;
+		std::uint32_t StoredSize; // Size in the file
+		std::uint32_t RawSize; // Size uncompressed
+		std::uint32_t Count; // Values
+
+		// Default Constructor
+		ColumnEntry() :
+			ReportID( 0 ),
+			Flags( 0u ),
+			Offset( 0u ),
+			StoredSize( 0u ),
+			RawSize( 0u ),
+			Count( 0u )
+		{}
+
+	};
+
+	// Functions
+
+	// Time key of a row: minutes from the start of the environment to the end of the reporting interval
+	inline
+	double
+	time_key( TimeStamp const & stamp )
+	{
+		double const day( ( stamp.DayOfSim - 1 ) * 1440.0 );
+		if ( stamp.Interval <= IntervalTimeStep ) {
+			return day + ( stamp.Hour - 1 ) * 60.0 + stamp.EndMinute;
+		} else if ( stamp.Interval == IntervalHourly ) {
+			return day + stamp.Hour * 60.0;
+		} else {
+			return day + 1440.0;
+		}
+	}
+
+	// Little-endian encoding into a byte buffer
+
+	inline
+	void
+	put_u8( std::vector< char > & buf, std::uint8_t const v )
+	{
+		buf.push_back( static_cast< char >( v ) );
+	}
+
+	inline
+	void
+	put_u32( std::vector< char > & buf, std::uint32_t const v )
+	{
+		for ( int i = 0; i < 32; i += 8 ) buf.push_back( static_cast< char >( ( v >> i ) & 0xFFu ) );
+	}
+
+	inline
+	void
+	put_i32( std::vector< char > & buf, std::int32_t const v )
+	{
+		put_u32( buf, static_cast< std::uint32_t >( v ) );
+	}
+
+	inline
+	void
+	put_u64( std::vector< char > & buf, std::uint64_t const v )
+	{
+		for ( int i = 0; i < 64; i += 8 ) buf.push_back( static_cast< char >( ( v >> i ) & 0xFFu ) );
+	}
+
+	inline
+	void
+	put_f64( std::vector< char > & buf, double const v )
+	{
+		std::uint64_t bits;
+		std::memcpy( &bits, &v, sizeof( bits ) );
+		put_u64( buf, bits );
+	}
+
+	inline
+	void
+	put_string( std::vector< char > & buf, std::string const & s )
+	{
+		put_u32( buf, static_cast< std::uint32_t >( s.size() ) );
+		buf.insert( buf.end(), s.begin(), s.end() );
+	}
+
+	inline
+	void
+	put_time_stamp( std::vector< char > & buf, TimeStamp const & stamp )
+	{
+		put_i32( buf, stamp.DayOfSim );
+		put_u8( buf, static_cast< std::uint8_t >( static_cast< std::int8_t >( stamp.Interval ) ) );
+		put_u8( buf, static_cast< std::uint8_t >( stamp.Month ) );
+		put_u8( buf, static_cast< std::uint8_t >( stamp.DayOfMonth ) );
+		put_u8( buf, static_cast< std::uint8_t >( stamp.Hour ) );
+		put_u8( buf, static_cast< std::uint8_t >( stamp.DST ) );
+		put_u8( buf, static_cast< std::uint8_t >( stamp.DayType ) );
+		put_u8( buf, stamp.Warmup ? 1u : 0u );
+		buf.insert( buf.end(), 5u, '\0' );
+		put_f64( buf, stamp.StartMinute );
+		put_f64( buf, stamp.EndMinute );
+	}
+
+	// Little-endian decoding from a byte range: Reads past the end set ok false and return 0
+	class Cursor
+	{
+
+	public: // Creation
+
+		Cursor(
+			char const * const begin,
+			char const * const end
+		) :
+			p_( begin ),
+			end_( end )
+		{}
+
+	public: // Methods
+
+		bool
+		ok() const
+		{
+			return ok_;
+		}
+
+		std::size_t
+		remaining() const
+		{
+			return std::size_t( end_ - p_ );
+		}
+
+		char const *
+		take( std::size_t const n )
+		{
+			if ( ! ok_ || remaining() < n ) {
+				ok_ = false;
+				return nullptr;
+			}
+			char const * const q( p_ );
+			p_ += n;
+			return q;
+		}
+
+		std::uint8_t
+		u8()
+		{
+			char const * const q( take( 1u ) );
+			return q ? static_cast< std::uint8_t >( *q ) : 0u;
+		}
+
+		std::uint32_t
+		u32()
+		{
+			char const * const q( take( 4u ) );
+			if ( ! q ) return 0u;
+			std::uint32_t v( 0u );
+			for ( int i = 3; i >= 0; --i ) v = ( v << 8 ) | static_cast< std::uint8_t >( q[ i ] );
+			return v;
+		}
+
+		// Count of entries that each take at least entrySize bytes: Counts the rest of the range cannot hold set ok false and return 0
+		std::uint32_t
+		count( std::size_t const entrySize )
+		{
+			std::uint32_t const n( u32() );
+			if ( ok_ && ( n > remaining() / entrySize ) ) ok_ = false;
+			return ok_ ? n : 0u;
+		}
+
+		std::int32_t
+		i32()
+		{
+			return static_cast< std::int32_t >( u32() );
+		}
+
+		std::uint64_t
+		u64()
+		{
+			char const * const q( take( 8u ) );
+			if ( ! q ) return 0u;
+			std::uint64_t v( 0u );
+			for ( int i = 7; i >= 0; --i ) v = ( v << 8 ) | static_cast< std::uint8_t >( q[ i ] );
+			return v;
+		}
+
+		double
+		f64()
+		{
+			std::uint64_t const bits( u64() );
+			double v;
+			std::memcpy( &v, &bits, sizeof( v ) );
+			return v;
+		}
+
+		std::string
+		string()
+		{
+			std::uint32_t const n( u32() );
+			char const * const q( take( n ) );
+			return q ? std::string( q, n ) : std::string();
+		}
+
+		TimeStamp
+		time_stamp()
+		{
+			TimeStamp stamp;
+			stamp.DayOfSim = i32();
+			stamp.Interval = static_cast< std::int8_t >( u8() );
+			stamp.Month = u8();
+			stamp.DayOfMonth = u8();
+			stamp.Hour = u8();
+			stamp.DST = u8();
+			stamp.DayType = u8();
+			stamp.Warmup = ( u8() != 0u );
+			take( 5u );
+			stamp.StartMinute = f64();
+			stamp.EndMinute = f64();
+			return stamp;
+		}
+
+	private: // Data
+
+		char const * p_;
+		char const * end_;
+		bool ok_ = true;
+
+	};
+
+} // ColumnarOutputFormat
+
+} // EnergyPlus
+
+#endif
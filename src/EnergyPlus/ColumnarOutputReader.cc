@@ -0,0 +1,522 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+
+// Third-party Headers
+#include <zlib.h>
+
+// EnergyPlus Headers
+#include <ColumnarOutputReader.hh>
+
+namespace EnergyPlus {
+
+	using namespace ColumnarOutputFormat;
+
+	namespace {
+
+		// Interval name of the CSV column headings
+		char const *
+		interval_name( int const interval )
+		{
+			switch ( interval ) {
+			case IntervalEach:
+				return "Detailed";
+			case IntervalTimeStep:
+				return "TimeStep";
+			case IntervalHourly:
+				return "Hourly";
+			case IntervalDaily:
+				return "Daily";
+			case IntervalMonthly:
+				return "Monthly";
+			default:
+				return "RunPeriod";
+			}
+		}
+
+		// Date/Time field of a CSV line
+		std::string
+		date_time( TimeStamp const & stamp )
+		{
+			static char const * const MonthNames[] = { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" };
+			char buf[ 64 ]; // Room for any field values: a damaged file must not truncate
+			if ( stamp.Interval <= IntervalHourly ) {
+				long const seconds( stamp.Interval == IntervalHourly ? stamp.Hour * 3600l : std::lround( ( ( stamp.Hour - 1 ) * 60.0 + stamp.EndMinute ) * 60.0 ) );
+				std::snprintf( buf, sizeof( buf ), " %02d/%02d  %02ld:%02ld:%02ld", stamp.Month, stamp.DayOfMonth, seconds / 3600l, ( seconds / 60l ) % 60l, seconds % 60l );
+			} else if ( stamp.Interval == IntervalDaily ) {
+				std::snprintf( buf, sizeof( buf ), " %02d/%02d", stamp.Month, stamp.DayOfMonth );
+			} else if ( ( stamp.Interval == IntervalMonthly ) && ( stamp.Month >= 1 ) && ( stamp.Month <= 12 ) ) {
+				return MonthNames[ stamp.Month - 1 ];
+			} else {
+				return "RunPeriod";
+			}
+			return buf;
+		}
+
+		// Shortest of 15 and 17 significant digits that reads back as the same value
+		void
+		write_value(
+			std::ostream & stream,
+			double const value
+		)
+		{
+			char buf[ 32 ];
+			std::snprintf( buf, sizeof( buf ), "%.15g", value );
+			if ( std::strtod( buf, nullptr ) != value ) std::snprintf( buf, sizeof( buf ), "%.17g", value );
+			stream << buf;
+		}
+
+	}
+
+	// File Constructor
+	ColumnarOutputReader::
+	ColumnarOutputReader( std::string const & fileName )
+	{
+		open( fileName );
+	}
+
+	// Dictionary item of a report id or nullptr
+	ColumnarOutputReader::Variable const *
+	ColumnarOutputReader::
+	variable( int const reportID ) const
+	{
+		auto const i( variableIndex_.find( reportID ) );
+		return i != variableIndex_.end() ? &variables_[ i->second ] : nullptr;
+	}
+
+	// Report ids of a key and variable name (all reporting intervals): blank key for meters
+	std::vector< int >
+	ColumnarOutputReader::
+	find(
+		std::string const & key,
+		std::string const & name
+	) const
+	{
+		std::vector< int > reportIDs;
+		for ( auto const & variable : variables_ ) {
+			if ( ( variable.Key == key ) && ( variable.Name == name ) ) reportIDs.push_back( variable.ReportID );
+		}
+		return reportIDs;
+	}
+
+	// Open a file and read its dictionary and index: Returns false with error() set on failure
+	bool
+	ColumnarOutputReader::
+	open( std::string const & fileName )
+	{
+		close();
+		auto const failed( [&]( std::string const & message ) { // Leaves no file open, so is_open() tells of the failure
+			close();
+			return fail( message );
+		} );
+		file_.open( fileName, std::ios::binary );
+		if ( ! file_ ) return failed( "Could not open " + fileName );
+
+		// Header
+		char header[ HeaderSize ];
+		if ( ! file_.read( header, HeaderSize ) || ( std::memcmp( header, HeaderMagic, MagicSize ) != 0 ) ) return failed( fileName + " is not a columnar time series file" );
+		Cursor headerCursor( header + MagicSize, header + HeaderSize );
+		if ( headerCursor.u32() != Version ) return failed( fileName + " has an unsupported version" );
+		flags_ = headerCursor.u32();
+
+		// Trailer
+		char trailer[ TrailerSize ];
+		file_.seekg( 0, std::ios::end );
+		std::uint64_t const fileSize( file_.tellg() );
+		if ( fileSize < HeaderSize + TrailerSize ) return failed( fileName + " is incomplete" );
+		file_.seekg( fileSize - TrailerSize );
+		if ( ! file_.read( trailer, TrailerSize ) || ( std::memcmp( trailer + TrailerSize - MagicSize, TrailerMagic, MagicSize ) != 0 ) ) {
+			return failed( fileName + " is incomplete: the simulation did not close it" );
+		}
+		Cursor trailerCursor( trailer, trailer + TrailerSize );
+		std::uint64_t const dictionaryOffset( trailerCursor.u64() );
+		std::uint64_t const indexOffset( trailerCursor.u64() );
+		if ( ( dictionaryOffset > indexOffset ) || ( indexOffset > fileSize - TrailerSize ) ) return failed( fileName + " has a damaged trailer" );
+
+		// Dictionary and index
+		std::vector< char > tail( fileSize - TrailerSize - dictionaryOffset );
+		file_.seekg( dictionaryOffset );
+		if ( ! file_.read( tail.data(), tail.size() ) ) return failed( "Could not read the dictionary of " + fileName );
+		Cursor cursor( tail.data(), tail.data() + tail.size() );
+
+		char const * magic( cursor.take( 4u ) );
+		if ( ! magic || ( std::memcmp( magic, DictionaryMagic, 4u ) != 0 ) ) return failed( fileName + " has a damaged dictionary" );
+		dayTypes_.resize( cursor.count( 4u ) ); // Counts are checked against the bytes left before anything is sized from them
+		for ( auto & dayType : dayTypes_ ) dayType = cursor.string();
+		environments_.resize( cursor.count( 36u ) );
+		for ( auto & environment : environments_ ) {
+			environment.Title = cursor.string();
+			environment.Latitude = cursor.f64();
+			environment.Longitude = cursor.f64();
+			environment.TimeZone = cursor.f64();
+			environment.Elevation = cursor.f64();
+		}
+		variables_.resize( cursor.count( 32u ) );
+		for ( auto & variable : variables_ ) {
+			variable.ReportID = cursor.i32();
+			variable.Interval = cursor.i32();
+			variable.Kind = cursor.u8();
+			variable.StoreType = cursor.u8();
+			variable.MeterFileOnly = ( cursor.u8() != 0u );
+			variable.IndexType = cursor.u8();
+			variable.IndexGroup = cursor.string();
+			variable.Key = cursor.string();
+			variable.Name = cursor.string();
+			variable.Units = cursor.string();
+			variable.Schedule = cursor.string();
+		}
+		if ( ! cursor.ok() ) return failed( fileName + " has a damaged dictionary" );
+		for ( std::size_t i = 0; i < variables_.size(); ++i ) variableIndex_[ variables_[ i ].ReportID ] = i;
+
+		magic = cursor.take( 4u );
+		if ( ! magic || ( std::memcmp( magic, IndexMagic, 4u ) != 0 ) ) return failed( fileName + " has a damaged index" );
+		chunks_.resize( cursor.count( 45u ) );
+		for ( auto & chunk : chunks_ ) {
+			chunk.Offset = cursor.u64();
+			chunk.StoredSize = cursor.u32();
+			chunk.Flags = cursor.u8();
+			chunk.Rows = cursor.u32();
+			chunk.Environment = cursor.u32();
+			chunk.FirstKey = cursor.f64();
+			chunk.LastKey = cursor.f64();
+			chunk.FirstColumn = cursor.u32();
+			chunk.NumColumns = cursor.u32();
+		}
+		columns_.resize( cursor.count( 25u ) );
+		for ( auto & entry : columns_ ) {
+			entry.ReportID = cursor.i32();
+			entry.Flags = cursor.u8();
+			entry.Offset = cursor.u64();
+			entry.StoredSize = cursor.u32();
+			entry.RawSize = cursor.u32();
+			entry.Count = cursor.u32();
+		}
+		if ( ! cursor.ok() ) return failed( fileName + " has a damaged index" );
+		// Blocks must lie before the dictionary and have sizes a chunk of at most ChunkRows rows can give
+		auto const inChunks( [dictionaryOffset]( std::uint64_t const offset, std::uint32_t const storedSize ) {
+			return ( offset >= HeaderSize ) && ( offset <= dictionaryOffset ) && ( storedSize <= dictionaryOffset - offset );
+		} );
+		for ( auto const & chunk : chunks_ ) {
+			if ( ( chunk.Rows > ChunkRows ) || ! inChunks( chunk.Offset, chunk.StoredSize ) ) return failed( fileName + " has a damaged index" );
+			if ( std::uint64_t( chunk.FirstColumn ) + chunk.NumColumns > columns_.size() ) return failed( fileName + " has a damaged index" );
+			std::uint64_t const maxRawSize( std::uint64_t( chunk.Rows ) * MaxColumnRowSize );
+			for ( std::uint32_t c = 0; c < chunk.NumColumns; ++c ) {
+				ColumnEntry const & entry( columns_[ chunk.FirstColumn + c ] );
+				if ( ( entry.Count > chunk.Rows ) || ( entry.RawSize > maxRawSize ) || ! inChunks( entry.Offset, entry.StoredSize ) ) return failed( fileName + " has a damaged index" );
+			}
+		}
+		error_.clear();
+		return true;
+	}
+
+	void
+	ColumnarOutputReader::
+	close()
+	{
+		if ( file_.is_open() ) file_.close();
+		file_.clear();
+		flags_ = 0u;
+		dayTypes_.clear();
+		environments_.clear();
+		variables_.clear();
+		variableIndex_.clear();
+		chunks_.clear();
+		columns_.clear();
+	}
+
+	// Read the values of a column in an environment (0 for all) and time key range: Returns false with error() set on failure
+	bool
+	ColumnarOutputReader::
+	read(
+		int const reportID,
+		Series & series,
+		std::uint32_t const environment,
+		double const fromKey,
+		double const toKey
+	)
+	{
+		series = Series();
+		if ( ! is_open() ) return fail( "No file is open" );
+		std::vector< TimeStamp > times;
+		Block block;
+		for ( std::size_t i = 0; i < chunks_.size(); ++i ) {
+			ChunkEntry const & chunk( chunks_[ i ] );
+			if ( ( environment != 0u ) && ( chunk.Environment != environment ) ) continue;
+			if ( ( chunk.LastKey < fromKey ) || ( chunk.FirstKey > toKey ) ) continue;
+			ColumnEntry const * entry( column_entry( chunk, reportID ) );
+			if ( ! entry ) continue;
+			if ( ! read_time_stamps( i, times ) || ! read_block( *entry, chunk.Rows, block ) ) return false;
+			bool const minMax( ! block.MinValues.empty() );
+			for ( std::size_t k = 0; k < block.Values.size(); ++k ) {
+				TimeStamp const & stamp( times[ block.Rows[ k ] ] );
+				double const key( time_key( stamp ) );
+				if ( ( key < fromKey ) || ( key > toKey ) ) continue;
+				series.Times.push_back( stamp );
+				series.Environments.push_back( chunk.Environment );
+				series.Values.push_back( block.Values[ k ] );
+				if ( minMax ) {
+					series.MinValues.resize( series.Values.size() - 1u ); // Earlier values without a minimum and maximum get 0
+					series.MinDates.resize( series.Values.size() - 1u );
+					series.MaxValues.resize( series.Values.size() - 1u );
+					series.MaxDates.resize( series.Values.size() - 1u );
+					series.MinValues.push_back( block.MinValues[ k ] );
+					series.MinDates.push_back( block.MinDates[ k ] );
+					series.MaxValues.push_back( block.MaxValues[ k ] );
+					series.MaxDates.push_back( block.MaxDates[ k ] );
+				}
+			}
+		}
+		return true;
+	}
+
+	// Read the time stamps of a chunk: Returns false with error() set on failure
+	bool
+	ColumnarOutputReader::
+	read_time_stamps(
+		std::size_t const chunk,
+		std::vector< TimeStamp > & times
+	)
+	{
+		times.clear();
+		if ( chunk >= chunks_.size() ) return fail( "No such chunk" );
+		ChunkEntry const & entry( chunks_[ chunk ] );
+		if ( ! read_raw( entry.Offset, entry.StoredSize, std::uint32_t( entry.Rows * TimeStampSize ), entry.Flags ) ) return false;
+		Cursor cursor( raw_.data(), raw_.data() + raw_.size() );
+		times.reserve( entry.Rows );
+		for ( std::uint32_t row = 0; row < entry.Rows; ++row ) times.push_back( cursor.time_stamp() );
+		return cursor.ok() ? true : fail( "Damaged time stamp block" );
+	}
+
+	// Write the columns (all if reportIDs is empty) of an environment (0 for all) as CSV, one line per time:
+	//  Returns false with error() set on failure
+	bool
+	ColumnarOutputReader::
+	write_csv(
+		std::ostream & stream,
+		std::vector< int > const & reportIDs,
+		std::uint32_t const environment
+	)
+	{
+		if ( ! is_open() ) return fail( "No file is open" );
+
+		// Columns in dictionary order
+		std::vector< Variable const * > columns;
+		if ( reportIDs.empty() ) {
+			for ( auto const & variable : variables_ ) columns.push_back( &variable );
+		} else {
+			for ( int const reportID : reportIDs ) {
+				Variable const * const variable( this->variable( reportID ) );
+				if ( ! variable ) return fail( "No variable has report id " + std::to_string( reportID ) );
+				columns.push_back( variable );
+			}
+		}
+
+		stream << "Date/Time";
+		for ( auto const variable : columns ) {
+			stream << ',';
+			if ( variable->Kind == KindCumulativeMeter ) stream << "Cumulative ";
+			if ( ! variable->Key.empty() ) stream << variable->Key << ':';
+			stream << variable->Name << " [" << variable->Units << "](" << interval_name( variable->Interval ) << ')';
+		}
+		stream << '\n';
+
+		// Rows of the same environment and time key (e.g., the last time step and the hour) share a line
+		std::size_t const nColumns( columns.size() );
+		std::vector< double > line( nColumns );
+		std::vector< char > has( nColumns, 0 );
+		std::string lineTime; // Date/Time of the pending line
+		std::uint32_t lineEnvironment( 0u );
+		double lineKey( 0.0 );
+		bool pending( false );
+		auto const write_line( [&]() {
+			stream << lineTime;
+			for ( std::size_t c = 0; c < nColumns; ++c ) {
+				stream << ',';
+				if ( has[ c ] ) write_value( stream, line[ c ] );
+				has[ c ] = 0;
+			}
+			stream << '\n';
+		} );
+
+		std::vector< TimeStamp > times;
+		std::vector< Block > blocks( nColumns );
+		std::vector< std::size_t > next( nColumns ); // Next value of each column's block
+		std::vector< char > present( nColumns ); // Column has a block in the chunk
+		for ( std::size_t i = 0; i < chunks_.size(); ++i ) {
+			ChunkEntry const & chunk( chunks_[ i ] );
+			if ( ( environment != 0u ) && ( chunk.Environment != environment ) ) continue;
+			if ( ! read_time_stamps( i, times ) ) return false;
+			for ( std::size_t c = 0; c < nColumns; ++c ) {
+				ColumnEntry const * entry( column_entry( chunk, columns[ c ]->ReportID ) );
+				present[ c ] = ( entry != nullptr );
+				next[ c ] = 0u;
+				if ( entry && ! read_block( *entry, chunk.Rows, blocks[ c ] ) ) return false;
+			}
+			for ( std::uint32_t row = 0; row < chunk.Rows; ++row ) {
+				double const key( time_key( times[ row ] ) );
+				if ( ! pending || ( chunk.Environment != lineEnvironment ) || ( key != lineKey ) ) {
+					if ( pending ) write_line();
+					lineTime = date_time( times[ row ] );
+					lineEnvironment = chunk.Environment;
+					lineKey = key;
+					pending = true;
+				}
+				for ( std::size_t c = 0; c < nColumns; ++c ) {
+					if ( ! present[ c ] ) continue;
+					Block const & block( blocks[ c ] );
+					std::size_t & k( next[ c ] );
+					if ( ( k < block.Rows.size() ) && ( block.Rows[ k ] == row ) ) {
+						line[ c ] = block.Values[ k ];
+						has[ c ] = 1;
+						++k;
+					}
+				}
+			}
+		}
+		if ( pending ) write_line();
+		return stream ? true : fail( "Could not write the CSV output" );
+	}
+
+	// Read a block into raw_, uncompressing it
+	bool
+	ColumnarOutputReader::
+	read_raw(
+		std::uint64_t const offset,
+		std::uint32_t const storedSize,
+		std::uint32_t const rawSize,
+		std::uint8_t const flags
+	)
+	{
+		std::vector< char > & buffer( ( flags & BlockCompressed ) ? stored_ : raw_ );
+		buffer.resize( storedSize );
+		file_.clear();
+		file_.seekg( offset );
+		if ( ! file_.read( buffer.data(), storedSize ) ) return fail( "Could not read a block" );
+		if ( flags & BlockCompressed ) {
+			raw_.resize( rawSize );
+			uLongf size( rawSize );
+			if ( ( uncompress( reinterpret_cast< Bytef * >( raw_.data() ), &size, reinterpret_cast< Bytef const * >( stored_.data() ), storedSize ) != Z_OK ) || ( size != rawSize ) ) {
+				return fail( "Could not uncompress a block" );
+			}
+		} else if ( storedSize != rawSize ) {
+			return fail( "Damaged block" );
+		}
+		return true;
+	}
+
+	// Read and decode a column block
+	bool
+	ColumnarOutputReader::
+	read_block(
+		ColumnEntry const & entry,
+		std::uint32_t const rows,
+		Block & block
+	)
+	{
+		if ( ! read_raw( entry.Offset, entry.StoredSize, entry.RawSize, entry.Flags ) ) return false;
+		Cursor cursor( raw_.data(), raw_.data() + raw_.size() );
+		std::uint32_t const n( entry.Count );
+		if ( n > cursor.remaining() / sizeof( double ) ) return fail( "Damaged column block" );
+		block.Rows.resize( n );
+		if ( entry.Flags & BlockSparse ) {
+			for ( auto & row : block.Rows ) row = cursor.u32();
+		} else {
+			for ( std::uint32_t k = 0; k < n; ++k ) block.Rows[ k ] = k;
+		}
+		block.Values.resize( n );
+		for ( auto & value : block.Values ) value = cursor.f64();
+		if ( entry.Flags & BlockMinMax ) {
+			block.MinValues.resize( n );
+			block.MinDates.resize( n );
+			block.MaxValues.resize( n );
+			block.MaxDates.resize( n );
+			for ( auto & value : block.MinValues ) value = cursor.f64();
+			for ( auto & date : block.MinDates ) date = cursor.i32();
+			for ( auto & value : block.MaxValues ) value = cursor.f64();
+			for ( auto & date : block.MaxDates ) date = cursor.i32();
+		} else {
+			block.MinValues.clear();
+			block.MinDates.clear();
+			block.MaxValues.clear();
+			block.MaxDates.clear();
+		}
+		if ( ! cursor.ok() ) return fail( "Damaged column block" );
+		for ( std::uint32_t k = 0; k < n; ++k ) {
+			if ( ( block.Rows[ k ] >= rows ) || ( ( k > 0u ) && ( block.Rows[ k ] <= block.Rows[ k - 1u ] ) ) ) return fail( "Damaged column block" );
+		}
+		return true;
+	}
+
+	// Column entry of a report id in a chunk or nullptr
+	ColumnarOutputReader::ColumnEntry const *
+	ColumnarOutputReader::
+	column_entry(
+		ChunkEntry const & chunk,
+		int const reportID
+	) const
+	{
+		auto const begin( columns_.begin() + chunk.FirstColumn );
+		auto const end( begin + chunk.NumColumns );
+		auto const i( std::lower_bound( begin, end, reportID, []( ColumnEntry const & entry, int const id ) { return entry.ReportID < id; } ) );
+		return ( ( i != end ) && ( i->ReportID == reportID ) ) ? &*i : nullptr;
+	}
+
+	bool
+	ColumnarOutputReader::
+	fail( std::string const & message )
+	{
+		error_ = message;
+		return false;
+	}
+
+} // EnergyPlus
@@ -0,0 +1,256 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef ColumnarOutputReader_hh_INCLUDED
+#define ColumnarOutputReader_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// EnergyPlus Headers
+#include <ColumnarOutputFormat.hh>
+
+namespace EnergyPlus {
+
+// Reader of the columnar time series file written by ColumnarOutput
+//
+// Notes:
+//  Opening reads the header, dictionary and index; the values are read on demand, seeking straight
+//   to the blocks of the requested column in the chunks that overlap the requested time range
+//  Depends only on ColumnarOutputFormat.hh and zlib so that post-processing tools can use it without
+//   the rest of EnergyPlus
+class ColumnarOutputReader
+{
+
+public: // Types
+
+	using TimeStamp = ColumnarOutputFormat::TimeStamp;
+	using Variable = ColumnarOutputFormat::Variable;
+	using Environment = ColumnarOutputFormat::Environment;
+	using ChunkEntry = ColumnarOutputFormat::ChunkEntry;
+	using ColumnEntry = ColumnarOutputFormat::ColumnEntry;
+
+	// Values of one column
+	struct Series
+	{
+		std::vector< TimeStamp > Times;
+		std::vector< std::uint32_t > Environments; // Environment of each value: 1 based, 0 before the first environment
+		std::vector< double > Values;
+		std::vector< double > MinValues; // Empty unless the column has minimum and maximum values
+		std::vector< int > MinDates;
+		std::vector< double > MaxValues;
+		std::vector< int > MaxDates;
+	};
+
+public: // Creation
+
+	// Default Constructor
+	ColumnarOutputReader() = default;
+
+	// File Constructor
+	explicit
+	ColumnarOutputReader( std::string const & fileName );
+
+public: // Properties
+
+	bool
+	is_open() const
+	{
+		return file_.is_open();
+	}
+
+	// Why the last operation failed
+	std::string const &
+	error() const
+	{
+		return error_;
+	}
+
+	// Blocks may be compressed
+	bool
+	compressed() const
+	{
+		return ( flags_ & ColumnarOutputFormat::FileCompressed ) != 0u;
+	}
+
+	std::vector< Variable > const &
+	variables() const
+	{
+		return variables_;
+	}
+
+	std::vector< Environment > const &
+	environments() const
+	{
+		return environments_;
+	}
+
+	std::vector< std::string > const &
+	day_types() const
+	{
+		return dayTypes_;
+	}
+
+	std::vector< ChunkEntry > const &
+	chunks() const
+	{
+		return chunks_;
+	}
+
+	// Dictionary item of a report id or nullptr
+	Variable const *
+	variable( int const reportID ) const;
+
+	// Report ids of a key and variable name (all reporting intervals): blank key for meters
+	std::vector< int >
+	find(
+		std::string const & key,
+		std::string const & name
+	) const;
+
+public: // Methods
+
+	// Open a file and read its dictionary and index: Returns false with error() set on failure
+	bool
+	open( std::string const & fileName );
+
+	void
+	close();
+
+	// Read the values of a column in an environment (0 for all) and time key range: Returns false with error() set on failure
+	bool
+	read(
+		int const reportID,
+		Series & series,
+		std::uint32_t const environment = 0u,
+		double const fromKey = -std::numeric_limits< double >::infinity(),
+		double const toKey = std::numeric_limits< double >::infinity()
+	);
+
+	// Read the time stamps of a chunk: Returns false with error() set on failure
+	bool
+	read_time_stamps(
+		std::size_t const chunk,
+		std::vector< TimeStamp > & times
+	);
+
+	// Write the columns (all if reportIDs is empty) of an environment (0 for all) as CSV, one line per time:
+	//  Returns false with error() set on failure
+	bool
+	write_csv(
+		std::ostream & stream,
+		std::vector< int > const & reportIDs = std::vector< int >(),
+		std::uint32_t const environment = 0u
+	);
+
+private: // Types
+
+	// Decoded column block
+	struct Block
+	{
+		std::vector< std::uint32_t > Rows;
+		std::vector< double > Values;
+		std::vector< double > MinValues;
+		std::vector< int > MinDates;
+		std::vector< double > MaxValues;
+		std::vector< int > MaxDates;
+	};
+
+private: // Methods
+
+	// Read a block into raw_, uncompressing it
+	bool
+	read_raw(
+		std::uint64_t const offset,
+		std::uint32_t const storedSize,
+		std::uint32_t const rawSize,
+		std::uint8_t const flags
+	);
+
+	// Read and decode a column block
+	bool
+	read_block(
+		ColumnEntry const & entry,
+		std::uint32_t const rows,
+		Block & block
+	);
+
+	// Column entry of a report id in a chunk or nullptr
+	ColumnEntry const *
+	column_entry(
+		ChunkEntry const & chunk,
+		int const reportID
+	) const;
+
+	bool
+	fail( std::string const & message );
+
+private: // Data
+
+	std::ifstream file_;
+	std::string error_;
+	std::uint32_t flags_ = 0u;
+	std::vector< std::string > dayTypes_;
+	std::vector< Environment > environments_;
+	std::vector< Variable > variables_;
+	std::unordered_map< int, std::size_t > variableIndex_; // Dictionary position by report id
+	std::vector< ChunkEntry > chunks_;
+	std::vector< ColumnEntry > columns_;
+	std::vector< char > stored_; // Block as read
+	std::vector< char > raw_; // Block uncompressed
+
+};
+
+} // EnergyPlus
+
+#endif
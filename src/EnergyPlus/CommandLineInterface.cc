@@ -55,6 +55,7 @@
 #include <DataGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DisplayRoutines.hh>
 #include <EnergyPlus.hh>
 #include <FileSystem.hh>
@@ -62,6 +63,7 @@
 #include <OutputProcessor.hh>
 #include <OutputReportTabular.hh>
 #include <OutputReports.hh>
+#include <RunPeriodSegments.hh>
 #include <SimulationManager.hh>
 #include <SolarShading.hh>
 #include <UtilityRoutines.hh>
@@ -158,6 +160,18 @@ ProcessArgs(int argc, const char * argv[])
 
 	opt.add("", 0, 0, 0, "Run ExpandObjects prior to simulation", "-x", "--expandobjects");
 
+	opt.add("1", 0, 1, 0, "Split each weather file run period into this many segments of whole months, simulated in parallel (default: 1)", "--segments");
+
+	opt.add("0", 0, 1, 0, "Days simulated ahead of each run period segment without reporting (default: 0)", "--segment-overlap");
+
+	opt.add("", 0, 1, 0, "Standard output file of a serial run to compare the stitched segment output with", "--segment-reference");
+
+	opt.add("0", 0, 1, 0, "Simulate only this run period segment (used by the segment processes)", "--segment");
+
+	opt.add("", 0, 0, 0, "Write a time profile of the simulation (profile tree and Chrome trace files)", "--profile");
+
+	opt.add("", 0, 0, 0, "Also write the report variable and meter time series to a columnar binary file (read with ConvertColumnarOutput)", "--columnar");
+
 	opt.example = "energyplus -w weather.epw -r input.idf";
 
 	std::string errorFollowUp = "Type 'energyplus --help' for usage.";
@@ -193,6 +207,18 @@ ProcessArgs(int argc, const char * argv[])
 
 	AnnualSimulation = opt.isSet("-a");
 
+	opt.get("--segments")->getInt(RunPeriodSegments::NumSegments);
+
+	opt.get("--segment-overlap")->getInt(RunPeriodSegments::OverlapDays);
+
+	opt.get("--segment")->getInt(RunPeriodSegments::SegmentNum);
+
+	opt.get("--segment-reference")->getString(RunPeriodSegments::ReferenceEsoFileName);
+
+	DataTimings::ProfilingEnabled = opt.isSet("--profile");
+
+	WriteColumnarOutput = opt.isSet("--columnar");
+
 	// Process standard arguments
 	if (opt.isSet("-h")) {
 		DisplayString(usage);
@@ -271,12 +297,15 @@ ProcessArgs(int argc, const char * argv[])
 		opt.get("-p")->getString(prefixOutName);
 		makeNativePath(prefixOutName);
 		outputFilePrefix = dirPathName + prefixOutName;
+		RunPeriodSegments::OutputPrefixName = prefixOutName;
 	} else {
 		outputFilePrefix = dirPathName + "eplus";
 	}
+	RunPeriodSegments::SegmentDirectoryPrefix = outputFilePrefix;
 
 	std::string suffixType;
 	opt.get("-s")->getString(suffixType);
+	RunPeriodSegments::OutputSuffixStyle = suffixType;
 
 
 	std::string outputEpmdetFileName;
@@ -294,6 +323,7 @@ ProcessArgs(int argc, const char * argv[])
 	std::string sqliteSuffix;
 	std::string adsSuffix;
 	std::string screenSuffix;
+	std::string segSuffix;
 
 	if (suffixType == "L" || suffixType == "l")	{
 
@@ -306,6 +336,7 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "sqlite";
 		adsSuffix = "ADS";
 		screenSuffix = "screen";
+		segSuffix = "seg";
 
 	} else if (suffixType == "D" || suffixType == "d") {
 
@@ -318,6 +349,7 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "-sqlite";
 		adsSuffix = "-ads";
 		screenSuffix = "-screen";
+		segSuffix = "-segments";
 
 	} else if (suffixType == "C" || suffixType == "c") {
 
@@ -330,6 +362,7 @@ ProcessArgs(int argc, const char * argv[])
 		sqliteSuffix = "Sqlite";
 		adsSuffix = "Ads";
 		screenSuffix = "Screen";
+		segSuffix = "Segments";
 
 	} else {
 		DisplayString("ERROR: Unrecognized argument for output suffix style: " + suffixType);
@@ -357,6 +390,7 @@ ProcessArgs(int argc, const char * argv[])
 	outputSciFileName = outputFilePrefix + normalSuffix + ".sci";
 	outputWrlFileName = outputFilePrefix + normalSuffix + ".wrl";
 	outputSqlFileName = outputFilePrefix + normalSuffix + ".sql";
+	outputColFileName = outputFilePrefix + normalSuffix + ".col";
 	outputDbgFileName = outputFilePrefix + normalSuffix + ".dbg";
 	outputTblCsvFileName = outputFilePrefix + tableSuffix + ".csv";
 	outputTblHtmFileName = outputFilePrefix + tableSuffix + ".htm";
@@ -394,6 +428,14 @@ ProcessArgs(int argc, const char * argv[])
 	outputMtrCsvFileName = outputFilePrefix + meterSuffix + ".csv";
 	outputRvauditFileName = outputFilePrefix + normalSuffix + ".rvaudit";
 
+	// Run period segment files
+	outputSegFileName = outputFilePrefix + normalSuffix + ".seg";
+	outputSegCsvFileName = outputFilePrefix + segSuffix + ".csv";
+
+	// Profile files
+	outputProfFileName = outputFilePrefix + normalSuffix + ".prof";
+	outputProfTraceFileName = outputFilePrefix + normalSuffix + ".prof.json";
+
 	// EPMacro files
 	outputEpmdetFileName = outputFilePrefix + normalSuffix + ".epmdet";
 	outputEpmidfFileName = outputFilePrefix + normalSuffix + ".epmidf";
@@ -441,6 +483,19 @@ ProcessArgs(int argc, const char * argv[])
 		exit(EXIT_FAILURE);
 	}
 
+	// Run period segments
+	if (RunPeriodSegments::NumSegments < 1 || RunPeriodSegments::OverlapDays < 0 || RunPeriodSegments::SegmentNum < 0 || RunPeriodSegments::SegmentNum > RunPeriodSegments::NumSegments) {
+		DisplayString("ERROR: Invalid run period segment options. '--segments' must be at least 1, '--segment-overlap' at least 0 and '--segment' at most '--segments'.");
+		DisplayString(errorFollowUp);
+		exit(EXIT_FAILURE);
+	}
+
+	if (RunPeriodSegments::NumSegments > 1 && DDOnlySimulation) {
+		DisplayString("ERROR: Cannot split a design-day-only simulation into run period segments. Set either '-D' or '--segments', but not both.");
+		DisplayString(errorFollowUp);
+		exit(EXIT_FAILURE);
+	}
+
 	// Read path from INI file if it exists
 	bool EPlusINI;
 	int LFN; // Unit Number for reads
@@ -115,8 +115,6 @@ namespace CondenserLoopTowers {
 	using DataEnvironment::OutBaroPress;
 	using DataEnvironment::OutWetBulbTemp;
 
-	using FluidProperties::GetDensityGlycol;
-	using FluidProperties::GetSpecificHeatGlycol;
 	using DataPlant::PlantLoop;
 	using Psychrometrics::PsyWFnTdbTwbPb;
 	using Psychrometrics::PsyRhoAirFnPbTdbW;
@@ -2232,7 +2230,7 @@ namespace CondenserLoopTowers {
 		// Begin environment initializations
 		if ( MyEnvrnFlag( TowerNum ) && BeginEnvrnFlag && ( PlantFirstSizesOkayToFinalize ) ) {
 
-			rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+			rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( DataGlobals::InitConvTemp, RoutineName );
 
 			SimpleTower( TowerNum ).DesWaterMassFlowRate = SimpleTower( TowerNum ).DesignWaterFlowRate * rho;
 			SimpleTower( TowerNum ).DesWaterMassFlowRatePerCell = SimpleTower( TowerNum ).DesWaterMassFlowRate / SimpleTower( TowerNum ).NumCell;
@@ -2373,15 +2371,15 @@ namespace CondenserLoopTowers {
 
 		if ( SimpleTower( TowerNum ).PerformanceInputMethod_Num == PIM_UFactor && (! SimpleTower( TowerNum ).HighSpeedTowerUAWasAutoSized )) {
 			if ( PltSizCondNum > 0 ) {
-				rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-				Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+				rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
+				Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 				DesTowerLoad = rho * Cp * SimpleTower( TowerNum ).DesignWaterFlowRate * PlantSizData( PltSizCondNum ).DeltaT;
 				SimpleTower( TowerNum ).TowerNominalCapacity = DesTowerLoad / SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
 			} else {
 				AssumedDeltaT = 11.0;
 				AssumedExitTemp = 21.0;
-				rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, AssumedExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-				Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, AssumedExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+				rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( AssumedExitTemp, RoutineName );
+				Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( AssumedExitTemp, RoutineName );
 
 				DesTowerLoad = rho * Cp * SimpleTower( TowerNum ).DesignWaterFlowRate * AssumedDeltaT;
 				SimpleTower( TowerNum ).TowerNominalCapacity = DesTowerLoad / SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
@@ -2449,8 +2447,8 @@ namespace CondenserLoopTowers {
 			} else {
 				if ( PltSizCondNum > 0 ) {
 					if ( PlantSizData( PltSizCondNum ).DesVolFlowRate >= SmallWaterVolFlow ) {
-						rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-						Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+						rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( DataGlobals::InitConvTemp, RoutineName );
+						Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 						DesTowerLoad = rho * Cp * tmpDesignWaterFlowRate * PlantSizData( PltSizCondNum ).DeltaT;
 						tmpHighSpeedFanPower = 0.0105 * DesTowerLoad;
 						if ( PlantFirstSizesOkayToFinalize ) SimpleTower( TowerNum ).HighSpeedFanPower = tmpHighSpeedFanPower;
@@ -2515,8 +2513,8 @@ namespace CondenserLoopTowers {
 		if ( SimpleTower( TowerNum ).HighSpeedTowerUAWasAutoSized ) {
 			if ( PltSizCondNum > 0 ) {
 				if ( PlantSizData( PltSizCondNum ).DesVolFlowRate >= SmallWaterVolFlow ) {
-					rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-					Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+					rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( DataGlobals::InitConvTemp, RoutineName );
+					Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 					DesTowerLoad = rho * Cp * tmpDesignWaterFlowRate * PlantSizData( PltSizCondNum ).DeltaT;
 
 					// This conditional statement is to trap when the user specified condenser/tower water design setpoint
@@ -2591,8 +2589,8 @@ namespace CondenserLoopTowers {
 		if ( SimpleTower( TowerNum ).PerformanceInputMethod_Num == PIM_NominalCapacity ) {
 			if ( SimpleTower( TowerNum ).DesignWaterFlowRate >= SmallWaterVolFlow ) {
 				// nominal capacity doesn't include compressor heat; predefined factor was 1.25 W heat rejection per W of delivered cooling but now is a user input
-				rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, 29.44, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName ); // 85F design exiting water temp
-				Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, 29.44, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName ); // 85F design exiting water temp
+				rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( 29.44, RoutineName ); // 85F design exiting water temp
+				Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( 29.44, RoutineName ); // 85F design exiting water temp
 
 				DesTowerLoad = SimpleTower( TowerNum ).TowerNominalCapacity * SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
 				Par( 1 ) = DesTowerLoad;
@@ -2722,8 +2720,8 @@ namespace CondenserLoopTowers {
 		if ( SimpleTower( TowerNum ).PerformanceInputMethod_Num == PIM_NominalCapacity && SameString( SimpleTower( TowerNum ).TowerType, "CoolingTower:TwoSpeed" ) ) {
 			if ( SimpleTower( TowerNum ).DesignWaterFlowRate >= SmallWaterVolFlow && SimpleTower( TowerNum ).TowerLowSpeedNomCap > 0.0 ) {
 				// nominal capacity doesn't include compressor heat; predefined factor was 1.25 W heat rejection per W of evap cooling but now is a user input
-				rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, 29.44, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName ); // 85F design exiting water temp
-				Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, 29.44, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName ); // 85F design exiting water temp
+				rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( 29.44, RoutineName ); // 85F design exiting water temp
+				Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( 29.44, RoutineName ); // 85F design exiting water temp
 				DesTowerLoad = SimpleTower( TowerNum ).TowerLowSpeedNomCap * SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
 				Par( 1 ) = DesTowerLoad;
 				Par( 2 ) = double( TowerNum );
@@ -2793,8 +2791,8 @@ namespace CondenserLoopTowers {
 		if ( SimpleTower( TowerNum ).PerformanceInputMethod_Num == PIM_NominalCapacity ) {
 			if ( SimpleTower( TowerNum ).DesignWaterFlowRate >= SmallWaterVolFlow && SimpleTower( TowerNum ).TowerFreeConvNomCap > 0.0 ) {
 				// nominal capacity doesn't include compressor heat; predefined factor was 1.25 W heat rejection per W of evap cooling but now user input
-				rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, 29.44, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName ); // 85F design exiting water temp
-				Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, 29.44, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName ); // 85F design exiting water temp
+				rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( 29.44, RoutineName ); // 85F design exiting water temp
+				Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( 29.44, RoutineName ); // 85F design exiting water temp
 				DesTowerLoad = SimpleTower( TowerNum ).TowerFreeConvNomCap * SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
 				Par( 1 ) = DesTowerLoad;
 				Par( 2 ) = double( TowerNum );
@@ -2914,8 +2912,8 @@ namespace CondenserLoopTowers {
 				ShowWarningError( "CoolingTower:VariableSpeed, \"" + SimpleTower( TowerNum ).Name + "\" the calibrated water flow rate ratio is determined to be " + OutputChar2 + ". This is outside the valid range of " + OutputCharLo + " to " + OutputCharHi + '.' );
 			}
 
-			rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, ( Twb + Ta + Tr ), PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-			Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, ( Twb + Ta + Tr ), PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+			rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( ( Twb + Ta + Tr ), RoutineName );
+			Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( ( Twb + Ta + Tr ), RoutineName );
 
 			SimpleTower( TowerNum ).TowerNominalCapacity = ( ( rho * tmpDesignWaterFlowRate ) * Cp * Tr );
 			if ( PlantFinalSizesOkayToReport ) {
@@ -3076,8 +3074,8 @@ namespace CondenserLoopTowers {
 				// get nominal capacity from PlantSizData(PltSizCondNum)%DeltaT and PlantSizData(PltSizCondNum)%DesVolFlowRate
 				if ( PltSizCondNum > 0 ) {
 					if ( PlantSizData( PltSizCondNum ).DesVolFlowRate >= SmallWaterVolFlow ) {
-						rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-						Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+						rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
+						Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 						DesTowerLoad = rho * Cp * PlantSizData( PltSizCondNum ).DesVolFlowRate * PlantSizData( PltSizCondNum ).DeltaT * SimpleTower( TowerNum ).SizFac;
 						tmpNomTowerCap = DesTowerLoad / SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
 						if ( PlantFirstSizesOkayToFinalize ) {
@@ -3171,13 +3169,13 @@ namespace CondenserLoopTowers {
 			// now calcuate UA values from nominal capacities and flow rates
 			if ( PlantFirstSizesOkayToFinalize ) {
 				if ( PltSizCondNum > 0 ) { // user has a plant sizing object
-					Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+					Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 					SimpleTowerInlet( TowerNum ).WaterTemp = PlantSizData( PltSizCondNum ).ExitTemp + PlantSizData( PltSizCondNum ).DeltaT;
 				} else { // probably no plant sizing object
-					Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+					Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( DataGlobals::InitConvTemp, RoutineName );
 					SimpleTowerInlet( TowerNum ).WaterTemp = 35.0; // design condition
 				}
-				rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+				rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( DataGlobals::InitConvTemp, RoutineName );
 
 				// full speed fan tower UA
 				Par( 1 ) = tmpNomTowerCap * SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
@@ -3279,8 +3277,8 @@ namespace CondenserLoopTowers {
 				// get nominal capacity from PlantSizData(PltSizCondNum)%DeltaT and PlantSizData(PltSizCondNum)%DesVolFlowRate
 				if ( PltSizCondNum > 0 ) {
 					if ( PlantSizData( PltSizCondNum ).DesVolFlowRate >= SmallWaterVolFlow ) {
-						rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-						Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+						rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
+						Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 						DesTowerLoad = rho * Cp * PlantSizData( PltSizCondNum ).DesVolFlowRate * PlantSizData( PltSizCondNum ).DeltaT * SimpleTower( TowerNum ).SizFac;
 						tmpNomTowerCap = DesTowerLoad / SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
 						if ( PlantFirstSizesOkayToFinalize ) {
@@ -3362,8 +3360,8 @@ namespace CondenserLoopTowers {
 				}
 				// now calcuate UA values from nominal capacities and flow rates
 				if ( PlantFirstSizesOkayToFinalize ) {
-					rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-					Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+					rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( DataGlobals::InitConvTemp, RoutineName );
+					Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 					// full speed fan tower UA
 					Par( 1 ) = tmpNomTowerCap * SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
 					Par( 2 ) = double( TowerNum );
@@ -3447,8 +3445,8 @@ namespace CondenserLoopTowers {
 					// get nominal capacity from PlantSizData(PltSizCondNum)%DeltaT and PlantSizData(PltSizCondNum)%DesVolFlowRate
 					if ( PltSizCondNum > 0 ) {
 						if ( PlantSizData( PltSizCondNum ).DesVolFlowRate >= SmallWaterVolFlow ) {
-							rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-							Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+							rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
+							Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 							DesTowerLoad = rho * Cp * PlantSizData( PltSizCondNum ).DesVolFlowRate * PlantSizData( PltSizCondNum ).DeltaT;
 							tmpNomTowerCap = DesTowerLoad / SimpleTower( TowerNum ).HeatRejectCapNomCapSizingRatio;
 							if ( PlantFirstSizesOkayToFinalize ) {
@@ -3504,8 +3502,8 @@ namespace CondenserLoopTowers {
 
 				} else { // UA and Air flow rate given, so find Nominal Cap from running model
 
-					rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
-					Cp = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, PlantSizData( PltSizCondNum ).ExitTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+					rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
+					Cp = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( PlantSizData( PltSizCondNum ).ExitTemp, RoutineName );
 
 					SimpleTowerInlet( TowerNum ).WaterTemp = PlantSizData( PltSizCondNum ).ExitTemp + PlantSizData( PltSizCondNum ).DeltaT;
 					SimpleTowerInlet( TowerNum ).AirTemp = 35.0;
@@ -3899,7 +3897,7 @@ namespace CondenserLoopTowers {
 		// output the number of cells operating
 		SimpleTower( TowerNum ).NumCellOn = NumCellOn;
 		//Should this be water inlet node num?????
-		CpWater = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, Node( WaterInletNode ).Temp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+		CpWater = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( Node( WaterInletNode ).Temp, RoutineName );
 
 		Qactual = WaterMassFlowRate * CpWater * ( Node( WaterInletNode ).Temp - OutletWaterTemp );
 		AirFlowRateRatio = ( AirFlowRate * SimpleTower( TowerNum ).NumCell ) / SimpleTower( TowerNum ).HighSpeedAirFlowRate;
@@ -4146,7 +4144,7 @@ namespace CondenserLoopTowers {
 		SimpleTower( TowerNum ).SpeedSelected = SpeedSel;
 		SimpleTower( TowerNum ).NumCellOn = NumCellOn;
 
-		CpWater = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, Node( WaterInletNode ).Temp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+		CpWater = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( Node( WaterInletNode ).Temp, RoutineName );
 		Qactual = WaterMassFlowRate * CpWater * ( Node( WaterInletNode ).Temp - OutletWaterTemp );
 		AirFlowRateRatio = ( AirFlowRate * SimpleTower( TowerNum ).NumCell ) / SimpleTower( TowerNum ).HighSpeedAirFlowRate;
 
@@ -4225,7 +4223,7 @@ namespace CondenserLoopTowers {
 		Real64 FanPowerAdjustFac;
 
 		WaterInletNode = SimpleTower( TowerNum ).WaterInletNodeNum;
-		CpWater = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, Node( WaterInletNode ).Temp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+		CpWater = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( Node( WaterInletNode ).Temp, RoutineName );
 		WaterOutletNode = SimpleTower( TowerNum ).WaterOutletNodeNum;
 		Qactual = 0.0;
 		CTFanPower = 0.0;
@@ -4688,7 +4686,7 @@ namespace CondenserLoopTowers {
 		while ( IncrNumCellFlag ) {
 			IncrNumCellFlag = false;
 			// Initialize inlet node water properties
-			WaterDensity = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, Node( WaterInletNode ).Temp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+			WaterDensity = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( Node( WaterInletNode ).Temp, RoutineName );
 			WaterFlowRateRatio = WaterMassFlowRatePerCell / ( WaterDensity * SimpleTower( TowerNum ).CalibratedWaterFlowRate / SimpleTower( TowerNum ).NumCell );
 
 			// check independent inputs with respect to model boundaries
@@ -4810,7 +4808,7 @@ namespace CondenserLoopTowers {
 			} // IF(OutletWaterTempOFF .GT. TempSetPoint)THEN
 		} // IF(OutletWaterTempON .LT. TempSetPoint) ie if tower should not run at full capacity
 
-		CpWater = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, Node( SimpleTower( TowerNum ).WaterInletNodeNum ).Temp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+		CpWater = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( Node( SimpleTower( TowerNum ).WaterInletNodeNum ).Temp, RoutineName );
 		Qactual = WaterMassFlowRate * CpWater * ( Node( WaterInletNode ).Temp - OutletWaterTemp );
 		SimpleTower( TowerNum ).NumCellOn = NumCellOn;
 		// Set water and air properties
@@ -4959,7 +4957,7 @@ namespace CondenserLoopTowers {
 		AirDensity = PsyRhoAirFnPbTdbW( SimpleTowerInlet( TowerNum ).AirPress, InletAirTemp, SimpleTowerInlet( TowerNum ).AirHumRat );
 		AirMassFlowRate = AirFlowRate * AirDensity;
 		CpAir = PsyCpAirFnWTdb( SimpleTowerInlet( TowerNum ).AirHumRat, InletAirTemp );
-		CpWater = GetSpecificHeatGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, SimpleTowerInlet( TowerNum ).WaterTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+		CpWater = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().cp( SimpleTowerInlet( TowerNum ).WaterTemp, RoutineName );
 		InletAirEnthalpy = PsyHFnTdbRhPb( SimpleTowerInlet( TowerNum ).AirWetBulb, 1.0, SimpleTowerInlet( TowerNum ).AirPress );
 
 		// initialize exiting wet bulb temperature before iterating on final solution
@@ -5703,7 +5701,7 @@ namespace CondenserLoopTowers {
 				TairAvg = ( SimpleTowerInlet( TowerNum ).AirTemp + OutletAirTSat ) / 2.0;
 
 				// Amount of water evaporated, get density water at air temp or 4 C if too cold
-				rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, max( TairAvg, 4.0 ), PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+				rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( max( TairAvg, 4.0 ), RoutineName );
 
 				EvapVdot = ( AirMassFlowRate * ( OutSpecificHumRat - InSpecificHumRat ) ) / rho; // [m3/s]
 				if ( EvapVdot < 0.0 ) EvapVdot = 0.0;
@@ -5714,7 +5712,7 @@ namespace CondenserLoopTowers {
 		} else if ( SimpleTower( TowerNum ).EvapLossMode == EvapLossByUserFactor ) {
 			//    EvapVdot   = SimpleTower(TowerNum)%UserEvapLossFactor * (InletWaterTemp - OutletWaterTemp) &
 			//                     * SimpleTower(TowerNum)%DesignWaterFlowRate
-			rho = GetDensityGlycol( PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidName, AverageWaterTemp, PlantLoop( SimpleTower( TowerNum ).LoopNum ).FluidIndex, RoutineName );
+			rho = PlantLoop( SimpleTower( TowerNum ).LoopNum ).glycol().rho( AverageWaterTemp, RoutineName );
 
 			EvapVdot = SimpleTower( TowerNum ).UserEvapLossFactor * ( InletWaterTemp - OutletWaterTemp ) * ( WaterMassFlowRate / rho );
 			if ( EvapVdot < 0.0 ) EvapVdot = 0.0;
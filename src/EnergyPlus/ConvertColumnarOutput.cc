@@ -0,0 +1,133 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Converts a columnar time series file (eplusout.col) to CSV, or lists its data dictionary
+
+// C++ Headers
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include <ColumnarOutputReader.hh>
+
+namespace {
+
+	int
+	usage()
+	{
+		std::cerr << "Usage: ConvertColumnarOutput [options] input-file [csv-file]\n"
+			"Writes the time series of a columnar output file as CSV (to standard output without csv-file)\n"
+			"  -l, --list               List the data dictionary: report id, interval, key, name and units\n"
+			"  -v, --variable ID        Write only this report id (repeat for more)\n"
+			"  -e, --environment N      Write only environment N (see --list)\n";
+		return EXIT_FAILURE;
+	}
+
+}
+
+int
+main( int argc, char * argv[] )
+{
+	using EnergyPlus::ColumnarOutputReader;
+
+	bool list( false );
+	std::vector< int > reportIDs;
+	unsigned long environment( 0ul );
+	std::vector< std::string > files;
+	for ( int i = 1; i < argc; ++i ) {
+		std::string const arg( argv[ i ] );
+		if ( ( arg == "-l" ) || ( arg == "--list" ) ) {
+			list = true;
+		} else if ( ( ( arg == "-v" ) || ( arg == "--variable" ) ) && ( i + 1 < argc ) ) {
+			reportIDs.push_back( std::atoi( argv[ ++i ] ) );
+		} else if ( ( ( arg == "-e" ) || ( arg == "--environment" ) ) && ( i + 1 < argc ) ) {
+			environment = std::strtoul( argv[ ++i ], nullptr, 10 );
+		} else if ( ( arg.size() > 1u ) && ( arg[ 0 ] == '-' ) ) {
+			return usage();
+		} else {
+			files.push_back( arg );
+		}
+	}
+	if ( files.empty() || ( files.size() > 2u ) ) return usage();
+
+	ColumnarOutputReader reader;
+	if ( ! reader.open( files[ 0 ] ) ) {
+		std::cerr << reader.error() << '\n';
+		return EXIT_FAILURE;
+	}
+
+	if ( list ) {
+		auto const & environments( reader.environments() );
+		for ( std::size_t i = 0; i < environments.size(); ++i ) {
+			std::cout << "Environment " << i + 1 << ": " << environments[ i ].Title << '\n';
+		}
+		for ( auto const & variable : reader.variables() ) {
+			std::cout << variable.ReportID << ',' << variable.Interval << ',' << variable.Key << ',' << variable.Name << " [" << variable.Units << "]\n";
+		}
+		return EXIT_SUCCESS;
+	}
+
+	bool ok;
+	if ( files.size() == 2u ) {
+		std::ofstream csv( files[ 1 ] );
+		if ( ! csv ) {
+			std::cerr << "Could not open " << files[ 1 ] << '\n';
+			return EXIT_FAILURE;
+		}
+		ok = reader.write_csv( csv, reportIDs, std::uint32_t( environment ) );
+	} else {
+		ok = reader.write_csv( std::cout, reportIDs, std::uint32_t( environment ) );
+	}
+	if ( ! ok ) {
+		std::cerr << reader.error() << '\n';
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
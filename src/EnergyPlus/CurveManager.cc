@@ -45,6 +45,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <cassert>
 #include <cmath>
 #include <string>
 
@@ -65,6 +66,7 @@
 #include <EMSManager.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
+#include <NameIndex.hh>
 #include <OutputProcessor.hh>
 #include <UtilityRoutines.hh>
 
@@ -212,6 +214,9 @@ namespace CurveManager {
 	Array1D< TableDataStruct > TempTableData;
 	Array1D< TableDataStruct > Temp2TableData;
 	Array1D< TableLookupData > TableLookup;
+	namespace {
+		NameIndex PerfCurveIndex; // Index of the PerfCurve names
+	}
 
 	// Functions
 
@@ -228,6 +233,7 @@ namespace CurveManager {
 		TempTableData.deallocate();
 		Temp2TableData.deallocate();
 		TableLookup.deallocate();
+		PerfCurveIndex.clear();
 	}
 
 	void
@@ -343,7 +349,17 @@ namespace CurveManager {
 
 		{ auto const SELECT_CASE_var( PerfCurve( CurveIndex ).InterpolationType );
 		if ( SELECT_CASE_var == EvaluateCurveToLimits ) {
-			CurveValue = PerformanceCurveObject( CurveIndex, Var1, Var2, Var3 );
+			auto const & Curve( PerfCurve( CurveIndex ) );
+			if ( Curve.Evaluator != nullptr ) { // Specialized form of PerformanceCurveObject
+				Real64 const V1( max( min( Var1, Curve.Var1Max ), Curve.Var1Min ) ); // 1st independent variable after limits imposed
+				Real64 const V2( Var2.present() ? max( min( Var2, Curve.Var2Max ), Curve.Var2Min ) : 0.0 ); // 2nd independent variable after limits imposed
+				Real64 const V3( Var3.present() ? max( min( Var3, Curve.Var3Max ), Curve.Var3Min ) : 0.0 ); // 3rd independent variable after limits imposed
+				CurveValue = Curve.Evaluator( Curve, V1, V2, V3 );
+				if ( Curve.CurveMinPresent ) CurveValue = max( CurveValue, Curve.CurveMin );
+				if ( Curve.CurveMaxPresent ) CurveValue = min( CurveValue, Curve.CurveMax );
+			} else {
+				CurveValue = PerformanceCurveObject( CurveIndex, Var1, Var2, Var3 );
+			}
 		} else if ( SELECT_CASE_var == LinearInterpolationOfTable ) {
 			CurveValue = PerformanceTableObject( CurveIndex, Var1, Var2, Var3 );
 		} else if ( SELECT_CASE_var == LagrangeInterpolationLinearExtrapolation ) {
@@ -546,6 +562,8 @@ namespace CurveManager {
 		// initialize the array
 
 		CurveNum = 0;
+		PerfCurveIndex.clear();
+		PerfCurveIndex.reserve( NumCurves );
 		// Loop over biquadratic curves and load data
 		CurrentModuleObject = "Curve:Biquadratic";
 		for ( CurveIndex = 1; CurveIndex <= NumBiQuad; ++CurveIndex ) {
@@ -553,7 +571,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -626,7 +644,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -705,7 +723,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -763,7 +781,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -822,7 +840,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -879,7 +897,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -950,7 +968,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1021,7 +1039,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1076,7 +1094,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1151,7 +1169,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1259,7 +1277,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1355,7 +1373,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1406,7 +1424,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1462,7 +1480,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1521,7 +1539,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1581,7 +1599,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1639,7 +1657,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1697,7 +1715,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1755,7 +1773,7 @@ namespace CurveManager {
 			++CurveNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -1821,7 +1839,7 @@ namespace CurveManager {
 			TableData( TableNum ).Y.allocate( NumTableEntries );
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -2047,7 +2065,7 @@ namespace CurveManager {
 			TableData( TableNum ).Y.allocate( NumTableEntries );
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -2389,7 +2407,7 @@ namespace CurveManager {
 			++TableNum;
 			IsNotOK = false;
 			IsBlank = false;
-			VerifyName( Alphas( 1 ), PerfCurve, CurveNum - 1, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
+			VerifyName( Alphas( 1 ), PerfCurveIndex, IsNotOK, IsBlank, CurrentModuleObject + " Name" );
 			if ( IsNotOK ) {
 				ErrorsFound = true;
 				if ( IsBlank ) Alphas( 1 ) = "xxxxx";
@@ -2705,6 +2723,13 @@ namespace CurveManager {
 
 		}
 
+		// Resolve the specialized evaluators now that regression and interpolation choices are final
+		for ( CurveIndex = 1; CurveIndex <= NumCurves; ++CurveIndex ) {
+			if ( PerfCurve( CurveIndex ).InterpolationType == EvaluateCurveToLimits ) {
+				PerfCurve( CurveIndex ).Evaluator = GetCurveEvaluator( PerfCurve( CurveIndex ).CurveType );
+			}
+		}
+
 	}
 
 	void
@@ -3915,6 +3940,369 @@ Label999: ;
 		return CurveValue;
 	}
 
+	namespace {
+
+		// Coefficients and limits of a curve copied out of PerfCurve, so the batch loops work on
+		// values the compiler knows cannot alias the results
+		struct CurveCoefficients
+		{
+			// Members
+			Real64 Coeff1;
+			Real64 Coeff2;
+			Real64 Coeff3;
+			Real64 Coeff4;
+			Real64 Coeff5;
+			Real64 Coeff6;
+			Real64 Coeff7;
+			Real64 Coeff8;
+			Real64 Coeff9;
+			Real64 Coeff10;
+			Real64 Coeff11;
+			Real64 Coeff12;
+
+			// Curve Constructor
+			explicit
+			CurveCoefficients( PerfomanceCurveData const & Curve ) :
+				Coeff1( Curve.Coeff1 ),
+				Coeff2( Curve.Coeff2 ),
+				Coeff3( Curve.Coeff3 ),
+				Coeff4( Curve.Coeff4 ),
+				Coeff5( Curve.Coeff5 ),
+				Coeff6( Curve.Coeff6 ),
+				Coeff7( Curve.Coeff7 ),
+				Coeff8( Curve.Coeff8 ),
+				Coeff9( Curve.Coeff9 ),
+				Coeff10( Curve.Coeff10 ),
+				Coeff11( Curve.Coeff11 ),
+				Coeff12( Curve.Coeff12 )
+			{}
+
+		};
+
+		// Curve forms, written once for both PerfomanceCurveData (CurveValue) and CurveCoefficients
+		// (CurveValueBatch). The expressions are those of PerformanceCurveObject, operation for
+		// operation, so all three paths give identical results.
+
+		template< typename C >
+		Real64
+		EvaluateLinear( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * Curve.Coeff2;
+		}
+
+		template< typename C >
+		Real64
+		EvaluateQuadratic( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 );
+		}
+
+		template< typename C >
+		Real64
+		EvaluateCubic( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) );
+		}
+
+		template< typename C >
+		Real64
+		EvaluateQuartic( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * ( Curve.Coeff4 + V1 * Curve.Coeff5 ) ) );
+		}
+
+		template< typename C >
+		Real64
+		EvaluateBiQuadratic( C const & Curve, Real64 const V1, Real64 const V2, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) + V2 * ( Curve.Coeff4 + V2 * Curve.Coeff5 ) + V1 * V2 * Curve.Coeff6;
+		}
+
+		template< typename C >
+		Real64
+		EvaluateQuadraticLinear( C const & Curve, Real64 const V1, Real64 const V2, Real64 const )
+		{
+			return ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) ) + ( Curve.Coeff4 + V1 * ( Curve.Coeff5 + V1 * Curve.Coeff6 ) ) * V2;
+		}
+
+		template< typename C >
+		Real64
+		EvaluateCubicLinear( C const & Curve, Real64 const V1, Real64 const V2, Real64 const )
+		{
+			return ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) ) ) + ( Curve.Coeff5 + V1 * Curve.Coeff6 ) * V2;
+		}
+
+		template< typename C >
+		Real64
+		EvaluateBiCubic( C const & Curve, Real64 const V1, Real64 const V2, Real64 const )
+		{
+			return Curve.Coeff1 + V1 * Curve.Coeff2 + V1 * V1 * Curve.Coeff3 + V2 * Curve.Coeff4 + V2 * V2 * Curve.Coeff5 + V1 * V2 * Curve.Coeff6 + V1 * V1 * V1 * Curve.Coeff7 + V2 * V2 * V2 * Curve.Coeff8 + V1 * V1 * V2 * Curve.Coeff9 + V1 * V2 * V2 * Curve.Coeff10;
+		}
+
+		template< typename C >
+		Real64
+		EvaluateChillerPartLoadWithLift( C const & Curve, Real64 const V1, Real64 const V2, Real64 const V3 )
+		{
+			return Curve.Coeff1 + Curve.Coeff2*V1 + Curve.Coeff3*V1*V1 + Curve.Coeff4*V2 + Curve.Coeff5*V2*V2 + Curve.Coeff6*V1*V2  + Curve.Coeff7*V1*V1*V1 + Curve.Coeff8*V2*V2*V2 + Curve.Coeff9*V1*V1*V2 + Curve.Coeff10*V1*V2*V2 + Curve.Coeff11*V1*V1*V2*V2 + Curve.Coeff12*V3*V2*V2*V2;
+		}
+
+		template< typename C >
+		Real64
+		EvaluateExponent( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + Curve.Coeff2 * std::pow( V1, Curve.Coeff3 );
+		}
+
+		template< typename C >
+		Real64
+		EvaluateFanPressureRise( C const & Curve, Real64 const V1, Real64 const V2, Real64 const )
+		{
+			return V1 * ( Curve.Coeff1 * V1 + Curve.Coeff2 + Curve.Coeff3 * std::sqrt( V2 ) ) + Curve.Coeff4 * V2;
+		}
+
+		template< typename C >
+		Real64
+		EvaluateRectangularHyperbola1( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			Real64 const CurveValueNumer( Curve.Coeff1 * V1 );
+			Real64 const CurveValueDenom( Curve.Coeff2 + V1 );
+			return ( CurveValueNumer / CurveValueDenom ) + Curve.Coeff3;
+		}
+
+		template< typename C >
+		Real64
+		EvaluateRectangularHyperbola2( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			Real64 const CurveValueNumer( Curve.Coeff1 * V1 );
+			Real64 const CurveValueDenom( Curve.Coeff2 + V1 );
+			return ( CurveValueNumer / CurveValueDenom ) + ( Curve.Coeff3 * V1 );
+		}
+
+		template< typename C >
+		Real64
+		EvaluateExponentialDecay( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 );
+		}
+
+		template< typename C >
+		Real64
+		EvaluateDoubleExponentialDecay( C const & Curve, Real64 const V1, Real64 const, Real64 const )
+		{
+			return Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 ) + Curve.Coeff4 * std::exp( Curve.Coeff5 * V1 );
+		}
+
+		// Batch evaluation of one curve form: limits and coefficients are loop invariants, so the
+		// polynomial forms vectorize
+		template< Real64 ( *Evaluate )( CurveCoefficients const &, Real64 const, Real64 const, Real64 const ) >
+		void
+		EvaluateCurveBatch(
+			PerfomanceCurveData const & Curve,
+			int const NumPoints,
+			Real64 const * const Var1,
+			Real64 const * const Var2, // nullptr for one independent variable
+			Real64 * const Result
+		)
+		{
+			CurveCoefficients const Coeffs( Curve );
+			Real64 const Var1Min( Curve.Var1Min ), Var1Max( Curve.Var1Max );
+			Real64 const Var2Min( Curve.Var2Min ), Var2Max( Curve.Var2Max );
+			bool const CurveMinPresent( Curve.CurveMinPresent ), CurveMaxPresent( Curve.CurveMaxPresent );
+			Real64 const CurveMin( Curve.CurveMin ), CurveMax( Curve.CurveMax );
+			if ( Var2 == nullptr ) {
+				for ( int i = 0; i < NumPoints; ++i ) {
+					Real64 const V1( max( min( Var1[ i ], Var1Max ), Var1Min ) );
+					Real64 const Value( Evaluate( Coeffs, V1, 0.0, 0.0 ) );
+					Real64 const ValueMin( CurveMinPresent ? max( Value, CurveMin ) : Value );
+					Result[ i ] = ( CurveMaxPresent ? min( ValueMin, CurveMax ) : ValueMin );
+				}
+			} else {
+				for ( int i = 0; i < NumPoints; ++i ) {
+					Real64 const V1( max( min( Var1[ i ], Var1Max ), Var1Min ) );
+					Real64 const V2( max( min( Var2[ i ], Var2Max ), Var2Min ) );
+					Real64 const Value( Evaluate( Coeffs, V1, V2, 0.0 ) );
+					Real64 const ValueMin( CurveMinPresent ? max( Value, CurveMin ) : Value );
+					Result[ i ] = ( CurveMaxPresent ? min( ValueMin, CurveMax ) : ValueMin );
+				}
+			}
+		}
+
+		// Batch evaluation of the curve forms with a batch kernel: false if there is none for the curve type
+		bool
+		EvaluateCurveBatch(
+			PerfomanceCurveData const & Curve,
+			int const NumPoints,
+			Real64 const * const Var1,
+			Real64 const * const Var2,
+			Real64 * const Result
+		)
+		{
+			{ auto const SELECT_CASE_var( Curve.CurveType );
+			if ( SELECT_CASE_var == Linear ) {
+				EvaluateCurveBatch< EvaluateLinear< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == Quadratic ) {
+				EvaluateCurveBatch< EvaluateQuadratic< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == Cubic ) {
+				EvaluateCurveBatch< EvaluateCubic< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == Quartic ) {
+				EvaluateCurveBatch< EvaluateQuartic< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == BiQuadratic ) {
+				EvaluateCurveBatch< EvaluateBiQuadratic< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == QuadraticLinear ) {
+				EvaluateCurveBatch< EvaluateQuadraticLinear< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == CubicLinear ) {
+				EvaluateCurveBatch< EvaluateCubicLinear< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == BiCubic ) {
+				EvaluateCurveBatch< EvaluateBiCubic< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == Exponent ) {
+				EvaluateCurveBatch< EvaluateExponent< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else if ( SELECT_CASE_var == ExponentialDecay ) {
+				EvaluateCurveBatch< EvaluateExponentialDecay< CurveCoefficients > >( Curve, NumPoints, Var1, Var2, Result );
+			} else {
+				return false;
+			}}
+			return true;
+		}
+
+	}
+
+	CurveEvaluator
+	GetCurveEvaluator( int const CurveType ) // curve type (see parameter definitions above)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the evaluation function specialized for a curve type, or nullptr for the curve
+		// types that PerformanceCurveObject evaluates directly.
+
+		// METHODOLOGY EMPLOYED:
+		// Resolved once per curve in GetCurveInputData so CurveValue makes one indirect call
+		// instead of testing the curve type against each form in turn. QuadLinear is left to
+		// PerformanceCurveObject since CurveValue does not pass it the 4th variable, and the
+		// TriQuadratic and exponential skew normal forms are rare enough not to need one.
+
+		{ auto const SELECT_CASE_var( CurveType );
+		if ( SELECT_CASE_var == Linear ) {
+			return EvaluateLinear< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == Quadratic ) {
+			return EvaluateQuadratic< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == Cubic ) {
+			return EvaluateCubic< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == Quartic ) {
+			return EvaluateQuartic< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == BiQuadratic ) {
+			return EvaluateBiQuadratic< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == QuadraticLinear ) {
+			return EvaluateQuadraticLinear< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == CubicLinear ) {
+			return EvaluateCubicLinear< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == BiCubic ) {
+			return EvaluateBiCubic< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == ChillerPartLoadWithLift ) {
+			return EvaluateChillerPartLoadWithLift< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == Exponent ) {
+			return EvaluateExponent< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == FanPressureRise ) {
+			return EvaluateFanPressureRise< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == RectangularHyperbola1 ) {
+			return EvaluateRectangularHyperbola1< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == RectangularHyperbola2 ) {
+			return EvaluateRectangularHyperbola2< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == ExponentialDecay ) {
+			return EvaluateExponentialDecay< PerfomanceCurveData >;
+		} else if ( SELECT_CASE_var == DoubleExponentialDecay ) {
+			return EvaluateDoubleExponentialDecay< PerfomanceCurveData >;
+		} else {
+			return nullptr;
+		}}
+
+	}
+
+	void
+	CurveValueBatch(
+		int const CurveIndex, // index of curve in curve array
+		Array1D< Real64 > const & Var1, // 1st independent variable at each point
+		Array1D< Real64 > & Result // curve value at each point
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates a curve of one independent variable at each point of an array, with the same
+		// results as calling CurveValue for each point in turn.
+
+		// METHODOLOGY EMPLOYED:
+		// Polynomial and exponent curves evaluated to limits use a batch loop over the points.
+		// Everything else, and the last point, go through CurveValue so the EMS override and the
+		// curve report variables behave as for individual calls.
+
+		assert( Result.size() == Var1.size() );
+		int const NumPoints( Var1.isize() );
+		if ( NumPoints == 0 ) return;
+		if ( ( CurveIndex <= 0 ) || ( CurveIndex > NumCurves ) ) {
+			ShowFatalError( "CurveValueBatch: Invalid curve passed." );
+		}
+		auto const & Curve( PerfCurve( CurveIndex ) );
+		int Loop( 1 );
+		if ( Curve.InterpolationType == EvaluateCurveToLimits && ! Curve.EMSOverrideOn && EvaluateCurveBatch( Curve, NumPoints - 1, Var1.data(), nullptr, Result.data() ) ) {
+			Loop = NumPoints;
+		}
+		for ( ; Loop <= NumPoints; ++Loop ) {
+			Result( Loop ) = CurveValue( CurveIndex, Var1( Loop ) );
+		}
+
+	}
+
+	void
+	CurveValueBatch(
+		int const CurveIndex, // index of curve in curve array
+		Array1D< Real64 > const & Var1, // 1st independent variable at each point
+		Array1D< Real64 > const & Var2, // 2nd independent variable at each point
+		Array1D< Real64 > & Result // curve value at each point
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates a curve of two independent variables at each pair of points of two arrays, with
+		// the same results as calling CurveValue for each pair in turn.
+
+		// METHODOLOGY EMPLOYED:
+		// As for the single variable form.
+
+		assert( Var2.size() == Var1.size() );
+		assert( Result.size() == Var1.size() );
+		int const NumPoints( Var1.isize() );
+		if ( NumPoints == 0 ) return;
+		if ( ( CurveIndex <= 0 ) || ( CurveIndex > NumCurves ) ) {
+			ShowFatalError( "CurveValueBatch: Invalid curve passed." );
+		}
+		auto const & Curve( PerfCurve( CurveIndex ) );
+		int Loop( 1 );
+		if ( Curve.InterpolationType == EvaluateCurveToLimits && ! Curve.EMSOverrideOn && EvaluateCurveBatch( Curve, NumPoints - 1, Var1.data(), Var2.data(), Result.data() ) ) {
+			Loop = NumPoints;
+		}
+		for ( ; Loop <= NumPoints; ++Loop ) {
+			Result( Loop ) = CurveValue( CurveIndex, Var1( Loop ), Var2( Loop ) );
+		}
+
+	}
+
 	Real64
 	PerformanceTableObject(
 		int const CurveIndex, // index of curve in curve array
@@ -5323,14 +5711,11 @@ Label999: ;
 		// Given a curve name, returns the curve index
 
 		// METHODOLOGY EMPLOYED:
-		// uses FindItemInList to search the curve array for the curve name
+		// looks the curve name up in the hash index of the curve names (FindItemInList semantics)
 
 		// REFERENCES:
 		// na
 
-		// Using/Aliasing
-		using InputProcessor::FindItemInList;
-
 		// Return value
 		int GetCurveIndex;
 
@@ -5357,7 +5742,7 @@ Label999: ;
 		}
 
 		if ( NumCurves > 0 ) {
-			GetCurveIndex = FindItemInList( CurveName, PerfCurve );
+			GetCurveIndex = PerfCurveIndex.find( CurveName, PerfCurve, PerfCurve.isize() );
 		} else {
 			GetCurveIndex = 0;
 		}
@@ -5604,7 +5989,7 @@ Label999: ;
 			}
 			// Need to verify that this name isn't used in Performance Curves as well.
 			if ( NumCurves > 0 ) {
-				CurveFound = FindItemInList( Alphas( 1 ), PerfCurve );
+				CurveFound = PerfCurveIndex.find( Alphas( 1 ), PerfCurve, PerfCurve.isize() );
 				if ( CurveFound != 0 ) {
 					ShowSevereError( "GetPressureCurveInput: " + CurveObjectName + "=\"" + Alphas( 1 ) + "\", duplicate curve name." );
 					ShowContinueError( "...Curve name duplicates one of the Performance Curves. Names must be unique across all curves." );
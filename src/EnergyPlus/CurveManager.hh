@@ -239,6 +239,13 @@ namespace CurveManager {
 
 	};
 
+	struct PerfomanceCurveData;
+
+	// Evaluation function specialized for one EvaluateCurveToLimits curve type: takes the independent
+	// variables after the input limits have been imposed and returns the curve value before the
+	// output limits (same expressions as PerformanceCurveObject)
+	typedef Real64 ( *CurveEvaluator )( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const V3 );
+
 	struct PerfomanceCurveData
 	{
 		// Members
@@ -299,6 +306,7 @@ namespace CurveManager {
 		Real64 CurveInput3; // curve input #1 (e.g., z or X3 variable)
 		Real64 CurveInput4; // curve input #1 (e.g., X4 variable)
 		Real64 CurveInput5; // curve input #1 (e.g., X5 variable)
+		CurveEvaluator Evaluator; // Set in GetCurveInputData for curve types with a specialized evaluator
 
 		// Default Constructor
 		PerfomanceCurveData() :
@@ -355,7 +363,8 @@ namespace CurveManager {
 			CurveInput2( 0.0 ),
 			CurveInput3( 0.0 ),
 			CurveInput4( 0.0 ),
-			CurveInput5( 0.0 )
+			CurveInput5( 0.0 ),
+			Evaluator( nullptr )
 		{}
 
 	};
@@ -418,6 +427,24 @@ namespace CurveManager {
 		Optional< Real64 const > Var5 = _ // 5th independent variable
 	);
 
+	void
+	CurveValueBatch(
+		int const CurveIndex, // index of curve in curve array
+		Array1D< Real64 > const & Var1, // 1st independent variable at each point
+		Array1D< Real64 > & Result // curve value at each point
+	);
+
+	void
+	CurveValueBatch(
+		int const CurveIndex, // index of curve in curve array
+		Array1D< Real64 > const & Var1, // 1st independent variable at each point
+		Array1D< Real64 > const & Var2, // 2nd independent variable at each point
+		Array1D< Real64 > & Result // curve value at each point
+	);
+
+	CurveEvaluator
+	GetCurveEvaluator( int const CurveType ); // curve type (see parameter definitions above)
+
 	void
 	GetCurveInput();
 
@@ -231,6 +231,8 @@ namespace DataHeatBalSurface {
 	//the next user requested time step)
 	Array3D< Real64 > THM; // Master Temperature History (on the time step for the construct)
 	Array3D< Real64 > QHM; // Master Flux History (on the time step for the construct)
+	//Hist Terms 3 and up of TH, QH, THM and QHM are held in HeatBalanceSurfaceManager's packed CTF history
+	//store for opaque surfaces without sources/sinks; only Hist Term 2 is kept current here for them
 	Array2D< Real64 > TsrcHist; // Temperature history at the source location (SurfNum,Term)
 	Array2D< Real64 > TuserHist; // Temperature history at the user specified location (SurfNum,Term)
 	Array2D< Real64 > QsrcHist; // Heat source/sink history for the surface (SurfNum,Term)
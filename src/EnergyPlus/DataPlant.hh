@@ -56,6 +56,7 @@
 #include <EnergyPlus.hh>
 #include <DataGlobals.hh>
 #include <DataLoopNode.hh>
+#include <FluidProperties.hh>
 #include <PlantComponent.hh>
 
 namespace EnergyPlus {
@@ -936,6 +937,7 @@ namespace DataPlant {
 		std::string FluidName; // Name of the fluid specified for this loop
 		int FluidType; // Type of fluid in the loop
 		int FluidIndex; // Index for Fluid in FluidProperties
+		FluidProperties::GlycolHandle Glycol; // Property handle for the loop fluid: Set up by glycol()
 		int MFErrIndex; // for recurring mass flow errors
 		int MFErrIndex1; // for recurring mass flow errors
 		int MFErrIndex2; // for recurring mass flow errors
@@ -1029,6 +1031,17 @@ namespace DataPlant {
 			PressureEffectiveK( 0.0 )
 		{}
 
+		// Property handle for the loop fluid: Resolves FluidIndex if GetPlantLoopData has not
+		FluidProperties::GlycolHandle const &
+		glycol()
+		{
+			if ( ( FluidIndex == 0 ) || ( Glycol.Index != FluidIndex ) ) {
+				if ( FluidIndex == 0 ) FluidIndex = FluidProperties::FindGlycol( FluidName );
+				Glycol = FluidProperties::GlycolHandle( FluidIndex, FluidName );
+			}
+			return Glycol;
+		}
+
 	};
 
 	struct ComponentData
@@ -104,6 +104,7 @@ namespace DataStringGlobals {
 	extern std::string outputSszTxtFileName;
 	extern std::string outputScreenCsvFileName;
 	extern std::string outputSqlFileName;
+	extern std::string outputColFileName;
 	extern std::string outputSqliteErrFileName;
 	extern std::string EnergyPlusIniFileName;
 	extern std::string inStatFileName;
@@ -112,6 +113,10 @@ namespace DataStringGlobals {
 	extern std::string outputCsvFileName;
 	extern std::string outputMtrCsvFileName;
 	extern std::string outputRvauditFileName;
+	extern std::string outputSegFileName;
+	extern std::string outputSegCsvFileName;
+	extern std::string outputProfFileName;
+	extern std::string outputProfTraceFileName;
 
 	extern std::string weatherFileNameOnly;
 	extern std::string idfDirPathName;
@@ -161,6 +161,7 @@ namespace DataStringGlobals {
 	std::string outputSszTxtFileName("eplusssz.txt");
 	std::string outputScreenCsvFileName("eplusscreen.csv");
 	std::string outputSqlFileName("eplusout.sql");
+	std::string outputColFileName("eplusout.col");
 	std::string outputSqliteErrFileName("eplussqlite.err");
 	std::string EnergyPlusIniFileName;
 	std::string inStatFileName;
@@ -169,6 +170,10 @@ namespace DataStringGlobals {
 	std::string outputCsvFileName("eplusout.csv");
 	std::string outputMtrCsvFileName("eplusmtr.csv");
 	std::string outputRvauditFileName("eplusout.rvaudit");
+	std::string outputSegFileName("eplusout.seg");
+	std::string outputSegCsvFileName("eplusseg.csv");
+	std::string outputProfFileName("eplusout.prof");
+	std::string outputProfTraceFileName("eplusout.prof.json");
 
 	std::string idfFileNameOnly;
 	std::string idfDirPathName;
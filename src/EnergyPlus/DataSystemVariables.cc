@@ -110,6 +110,7 @@ namespace DataSystemVariables {
 	std::string const cDisplayUnusedSchedules( "DisplayUnusedSchedules" );
 	std::string const cDisplayZoneAirHeatBalanceOffBalance( "DisplayZoneAirHeatBalanceOffBalance" );
 	std::string const cSortIDD( "SortIDD" );
+	std::string const cUseCompiledIDD( "UseCompiledIDD" );
 	std::string const cReportDuringWarmup( "ReportDuringWarmup" );
 	std::string const cReportDuringHVACSizingSimulation( "REPORTDURINGHVACSIZINGSIMULATION" );
 	std::string const cIgnoreSolarRadiation( "IgnoreSolarRadiation" );
@@ -118,6 +119,17 @@ namespace DataSystemVariables {
 	std::string const cSutherlandHodgman( "SutherlandHodgman" );
 	std::string const cMinimalSurfaceVariables( "CreateMinimalSurfaceVariables" );
 	std::string const cMinimalShadowing( "MinimalShadowing" );
+	std::string const cCheckShadowingCombinations( "CheckShadowingCombinations" );
+	std::string const cShadingCacheDirectory( "ShadingCacheDirectory" );
+	std::string const cSimulationCheckpointFile( "SimulationCheckpointFile" );
+	std::string const cSimulationRestartFile( "SimulationRestartFile" );
+	std::string const cAFNSkylineSolver( "AFNSkylineSolver" );
+	std::string const cAFNModifiedNewton( "AFNModifiedNewton" );
+	std::string const cThreadedSurfaceHeatBalance( "ThreadedSurfaceHeatBalance" );
+	std::string const cAsyncOutputWriter( "AsyncOutputWriter" );
+	std::string const cColumnarOutputCompression( "ColumnarOutputCompression" );
+	std::string const cEnvSetThreads( "OMP_NUM_THREADS" ); // Number of threads from the OpenMP style environment variable
+	std::string const cepEnvSetThreads( "EP_OMP_NUM_THREADS" ); // Number of threads from the EnergyPlus specific environment variable
 	std::string const cNumActiveSims( "cntActv" );
 	std::string const cInputPath1( "epin" ); // EP-Launch setting.  Full path + project name
 	std::string const cInputPath2( "input_path" ); // RunEplus.bat setting.  Full path
@@ -146,6 +158,16 @@ namespace DataSystemVariables {
 	bool DeveloperFlag( false ); // TRUE if developer flag is turned on. (turns on more displays to console)
 	bool TimingFlag( false ); // TRUE if timing flag is turned on. (turns on more timing displays to console)
 	bool SutherlandHodgman( true ); // TRUE if SutherlandHodgman algorithm for polygon clipping is to be used.
+	bool CheckShadowingCombinations( false ); // TRUE if the shadowing combinations are to be verified against an exhaustive search
+	std::string ShadingCacheDirectory; // Directory for the beam solar multiplier cache (blank = no cache)
+	std::string SimulationCheckpointFile; // File the end-of-warmup state is written to (blank = none)
+	std::string SimulationRestartFile; // File the end-of-warmup state is restored from (blank = none)
+	bool AFNSkylineSolver( false ); // TRUE if the AirflowNetwork pressure solver is to use the original skyline factorization
+	bool AFNModifiedNewton( false ); // TRUE if the AirflowNetwork pressure solver may reuse the Jacobian factorization across iterations
+	bool ThreadedSurfaceHeatBalance( false ); // TRUE if the surface heat balances are to run zones concurrently
+	bool AsyncOutputWriter( false ); // TRUE if the eso and mtr report lines are to be formatted and written on a background thread
+	bool WriteColumnarOutput( false ); // TRUE if the report variable and meter time series are also written to the columnar binary file
+	bool ColumnarOutputCompression( true ); // TRUE if the blocks of the columnar binary file are zlib compressed
 	bool DetailedSkyDiffuseAlgorithm( false ); // use detailed diffuse shading algorithm for sky (shading transmittance varies)
 	bool DetailedSolarTimestepIntegration( false ); // when true, use detailed timestep integration for all solar,shading, etc.
 	bool TrackAirLoopEnvFlag( false ); // If TRUE generates a file with runtime statistics for each HVAC
@@ -165,6 +187,7 @@ namespace DataSystemVariables {
 	std::string cMinReportFrequency; // String for minimum reporting frequency
 	int MinReportFrequency( -2 ); // Frequency var turned into integer during get report var input.
 	bool SortedIDD( true ); // after processing, use sorted IDD to obtain Defs, etc.
+	bool UseCompiledIDD( true ); // read the IDD definitions from (and save them to) a compiled IDD file next to the IDD
 	bool lMinimalShadowing( false ); // TRUE if MinimalShadowing is to override Solar Distribution flag
 	std::string TempFullFileName;
 	std::string envinputpath1;
@@ -181,6 +204,8 @@ namespace DataSystemVariables {
 	bool lnumActiveSims( false );
 	int MaxNumberOfThreads( 1 );
 	int NumberIntRadThreads( 1 );
+	int NumberShadingThreads( 1 ); // Number of threads used for the sun position shadowing calculations
+	int NumberSurfaceHeatBalanceThreads( 1 ); // Number of threads used for the surface heat balances
 	int iNominalTotSurfaces( 0 );
 	bool Threading( false );
 
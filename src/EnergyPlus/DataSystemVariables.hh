@@ -79,6 +79,7 @@ namespace DataSystemVariables {
 	extern std::string const cDisplayUnusedSchedules;
 	extern std::string const cDisplayZoneAirHeatBalanceOffBalance;
 	extern std::string const cSortIDD;
+	extern std::string const cUseCompiledIDD;
 	extern std::string const cReportDuringWarmup;
 	extern std::string const cReportDuringHVACSizingSimulation;
 	extern std::string const cIgnoreSolarRadiation;
@@ -87,6 +88,17 @@ namespace DataSystemVariables {
 	extern std::string const cSutherlandHodgman;
 	extern std::string const cMinimalSurfaceVariables;
 	extern std::string const cMinimalShadowing;
+	extern std::string const cCheckShadowingCombinations;
+	extern std::string const cShadingCacheDirectory;
+	extern std::string const cSimulationCheckpointFile;
+	extern std::string const cSimulationRestartFile;
+	extern std::string const cAFNSkylineSolver;
+	extern std::string const cAFNModifiedNewton;
+	extern std::string const cThreadedSurfaceHeatBalance;
+	extern std::string const cAsyncOutputWriter;
+	extern std::string const cColumnarOutputCompression;
+	extern std::string const cEnvSetThreads; // Number of threads from the OpenMP style environment variable
+	extern std::string const cepEnvSetThreads; // Number of threads from the EnergyPlus specific environment variable
 	extern std::string const cNumActiveSims;
 	extern std::string const cInputPath1; // EP-Launch setting.  Full path + project name
 	extern std::string const cInputPath2; // RunEplus.bat setting.  Full path
@@ -115,6 +127,16 @@ namespace DataSystemVariables {
 	extern bool DeveloperFlag; // TRUE if developer flag is turned on. (turns on more displays to console)
 	extern bool TimingFlag; // TRUE if timing flag is turned on. (turns on more timing displays to console)
 	extern bool SutherlandHodgman; // TRUE if SutherlandHodgman algorithm for polygon clipping is to be used.
+	extern bool CheckShadowingCombinations; // TRUE if the shadowing combinations are to be verified against an exhaustive search
+	extern std::string ShadingCacheDirectory; // Directory for the beam solar multiplier cache (blank = no cache)
+	extern std::string SimulationCheckpointFile; // File the end-of-warmup state is written to (blank = none)
+	extern std::string SimulationRestartFile; // File the end-of-warmup state is restored from (blank = none)
+	extern bool AFNSkylineSolver; // TRUE if the AirflowNetwork pressure solver is to use the original skyline factorization
+	extern bool AFNModifiedNewton; // TRUE if the AirflowNetwork pressure solver may reuse the Jacobian factorization across iterations
+	extern bool ThreadedSurfaceHeatBalance; // TRUE if the surface heat balances are to run zones concurrently
+	extern bool AsyncOutputWriter; // TRUE if the eso and mtr report lines are to be formatted and written on a background thread
+	extern bool WriteColumnarOutput; // TRUE if the report variable and meter time series are also written to the columnar binary file
+	extern bool ColumnarOutputCompression; // TRUE if the blocks of the columnar binary file are zlib compressed
 	extern bool DetailedSkyDiffuseAlgorithm; // use detailed diffuse shading algorithm for sky (shading transmittance varies)
 	extern bool DetailedSolarTimestepIntegration; // when true, use detailed timestep integration for all solar,shading, etc.
 	extern bool TrackAirLoopEnvFlag; // If TRUE generates a file with runtime statistics for each HVAC
@@ -134,6 +156,7 @@ namespace DataSystemVariables {
 	extern std::string cMinReportFrequency; // String for minimum reporting frequency
 	extern int MinReportFrequency; // Frequency var turned into integer during get report var input.
 	extern bool SortedIDD; // after processing, use sorted IDD to obtain Defs, etc.
+	extern bool UseCompiledIDD; // read the IDD definitions from (and save them to) a compiled IDD file next to the IDD
 	extern bool lMinimalShadowing; // TRUE if MinimalShadowing is to override Solar Distribution flag
 	extern std::string TempFullFileName;
 	extern std::string envinputpath1;
@@ -150,6 +173,8 @@ namespace DataSystemVariables {
 	extern bool lnumActiveSims;
 	extern int MaxNumberOfThreads;
 	extern int NumberIntRadThreads;
+	extern int NumberShadingThreads; // Number of threads used for the sun position shadowing calculations
+	extern int NumberSurfaceHeatBalanceThreads; // Number of threads used for the surface heat balances
 	extern int iNominalTotSurfaces;
 	extern bool Threading;
 
@@ -44,6 +44,18 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+// C++ Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/gio.hh>
 #include <ObjexxFCL/Time_Date.hh>
@@ -140,6 +152,156 @@ namespace DataTimings {
 	// Object Data
 	Array1D< timings > Timing;
 
+	// Scoped profiler
+	bool ProfilingEnabled( false );
+	std::size_t MaxTraceEvents( 1000000 );
+
+	namespace {
+		// Profiler state is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+
+		typedef std::chrono::steady_clock ProfileClock;
+
+		// Node of the call tree of one thread: a zone under a given chain of enclosing zones
+		struct ProfileNode
+		{
+			// Members
+			int ZoneID; // Zone of this node (-1 for the root)
+			int Parent; // Index of the enclosing node (-1 for the root)
+			std::int64_t Calls; // Number of times the zone was entered here
+			std::int64_t InclusiveTime; // Time in the zone including enclosed zones [ns]
+			std::vector< std::pair< int, int > > Children; // Zone id and node index of the enclosed zones
+
+			// Member Constructor
+			ProfileNode(
+				int const ZoneID,
+				int const Parent
+			) :
+				ZoneID( ZoneID ),
+				Parent( Parent ),
+				Calls( 0 ),
+				InclusiveTime( 0 )
+			{}
+
+		};
+
+		// Entered zone that is still open
+		struct ProfileFrame
+		{
+			// Members
+			int Node; // Call tree node of the zone
+			std::int64_t StartTime; // Time the zone was entered [ns]
+		};
+
+		// Completed zone kept for the trace file
+		struct ProfileEvent
+		{
+			// Members
+			int ZoneID;
+			std::int64_t StartTime; // [ns]
+			std::int64_t Duration; // [ns]
+		};
+
+		// Profile data recorded by one thread; only the owning thread writes to it
+		struct ProfileBuffer
+		{
+			// Members
+			int ThreadNum; // Order in which the thread first entered a zone
+			std::vector< ProfileNode > Nodes; // Call tree, Nodes[ 0 ] is the root
+			std::vector< ProfileFrame > Stack; // Open zones, innermost last
+			std::vector< ProfileEvent > Events; // Completed zones in order of completion
+			bool EventsTruncated; // MaxTraceEvents was reached
+
+			// Member Constructor
+			explicit
+			ProfileBuffer( int const ThreadNum ) :
+				ThreadNum( ThreadNum ),
+				Nodes( 1, ProfileNode( -1, -1 ) ),
+				EventsTruncated( false )
+			{}
+
+		};
+
+		std::mutex ProfileMutex; // Guards the zone registry and the list of buffers
+		std::vector< std::string > ProfileZoneNames; // Zone names indexed by zone id
+		std::unordered_map< std::string, int > ProfileZoneIDs; // Zone ids by name
+		std::vector< std::unique_ptr< ProfileBuffer > > ProfileBuffers; // Buffers of all threads
+		int ProfileGeneration( 0 ); // Incremented by clear_state to invalidate the cached thread buffers
+		ProfileClock::time_point const ProfileEpoch( ProfileClock::now() ); // Origin of the recorded times
+
+		inline
+		std::int64_t
+		ProfileNow()
+		{
+			return std::chrono::duration_cast< std::chrono::nanoseconds >( ProfileClock::now() - ProfileEpoch ).count();
+		}
+
+		ProfileBuffer &
+		ThreadProfileBuffer()
+		{
+			// Each thread caches a pointer to its own buffer so recording a zone needs no locking
+			thread_local ProfileBuffer * Buffer( nullptr );
+			thread_local int BufferGeneration( -1 );
+			if ( BufferGeneration != ProfileGeneration ) {
+				std::lock_guard< std::mutex > lock( ProfileMutex );
+				ProfileBuffers.emplace_back( new ProfileBuffer( static_cast< int >( ProfileBuffers.size() ) ) );
+				Buffer = ProfileBuffers.back().get();
+				BufferGeneration = ProfileGeneration;
+			}
+			return *Buffer;
+		}
+
+		void
+		WriteJSONString(
+			std::ostream & os,
+			std::string const & str
+		)
+		{
+			os << '"';
+			for ( char const c : str ) {
+				if ( c == '"' || c == '\\' ) {
+					os << '\\' << c;
+				} else if ( static_cast< unsigned char >( c ) < 0x20 ) {
+					os << ' ';
+				} else {
+					os << c;
+				}
+			}
+			os << '"';
+		}
+
+		void
+		WriteProfileNode(
+			std::ostream & os,
+			ProfileBuffer const & Buffer,
+			int const NodeNum,
+			int const Depth,
+			std::int64_t const TotalTime
+		)
+		{
+			ProfileNode const & Node( Buffer.Nodes[ NodeNum ] );
+
+			// Children in order of decreasing inclusive time
+			std::vector< int > Children;
+			Children.reserve( Node.Children.size() );
+			std::int64_t ChildrenTime( 0 );
+			for ( auto const & Child : Node.Children ) {
+				Children.push_back( Child.second );
+				ChildrenTime += Buffer.Nodes[ Child.second ].InclusiveTime;
+			}
+			std::stable_sort( Children.begin(), Children.end(), [ &Buffer ]( int const a, int const b ) { return Buffer.Nodes[ a ].InclusiveTime > Buffer.Nodes[ b ].InclusiveTime; } );
+
+			if ( NodeNum != 0 ) {
+				Real64 const Inclusive( Node.InclusiveTime * 1.0e-9 );
+				Real64 const Exclusive( std::max( Node.InclusiveTime - ChildrenTime, std::int64_t( 0 ) ) * 1.0e-9 );
+				os << std::string( 2 * ( Depth - 1 ), ' ' ) << ProfileZoneNames[ Node.ZoneID ] << ',' << Node.Calls << ',' << Inclusive << ',' << Exclusive << ',' << ( TotalTime > 0 ? 100.0 * Node.InclusiveTime / TotalTime : 0.0 ) << '\n';
+			}
+			for ( int const Child : Children ) {
+				WriteProfileNode( os, Buffer, Child, Depth + 1, TotalTime );
+			}
+		}
+
+	} // namespace
+
 	// Functions
 
 	void
@@ -624,6 +786,224 @@ namespace DataTimings {
 
 	}
 
+	void
+	ProfileZone::ProfileBegin( int const ZoneID )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Enter a profile zone on the calling thread.
+
+		// METHODOLOGY EMPLOYED:
+		// The zone becomes a child of the innermost open zone in the thread's call tree; the
+		// child is found by a linear search since a zone encloses only a handful of others.
+
+		ProfileBuffer & Buffer( ThreadProfileBuffer() );
+		int const Parent( Buffer.Stack.empty() ? 0 : Buffer.Stack.back().Node );
+		int Node( -1 );
+		for ( auto const & Child : Buffer.Nodes[ Parent ].Children ) {
+			if ( Child.first == ZoneID ) {
+				Node = Child.second;
+				break;
+			}
+		}
+		if ( Node == -1 ) {
+			Node = static_cast< int >( Buffer.Nodes.size() );
+			Buffer.Nodes.emplace_back( ZoneID, Parent );
+			Buffer.Nodes[ Parent ].Children.emplace_back( ZoneID, Node );
+		}
+		Buffer.Stack.push_back( { Node, ProfileNow() } );
+
+	}
+
+	void
+	ProfileZone::ProfileEnd()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Leave the innermost open profile zone of the calling thread.
+
+		std::int64_t const EndTime( ProfileNow() );
+		ProfileBuffer & Buffer( ThreadProfileBuffer() );
+		if ( Buffer.Stack.empty() ) return; // Profile was cleared while the zone was open
+		ProfileFrame const Frame( Buffer.Stack.back() );
+		Buffer.Stack.pop_back();
+		ProfileNode & Node( Buffer.Nodes[ Frame.Node ] );
+		++Node.Calls;
+		Node.InclusiveTime += EndTime - Frame.StartTime;
+		if ( Buffer.Events.size() < MaxTraceEvents ) {
+			Buffer.Events.push_back( { Node.ZoneID, Frame.StartTime, EndTime - Frame.StartTime } );
+		} else {
+			Buffer.EventsTruncated = true;
+		}
+
+	}
+
+	int
+	ProfileZoneID( std::string const & ZoneName )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Return the id of the named profile zone, registering it on first use.
+
+		// METHODOLOGY EMPLOYED:
+		// Static zones call this once through EP_PROFILE_ZONE; zones named at run time, such as
+		// the environments, call it each time they are entered.
+
+		std::lock_guard< std::mutex > lock( ProfileMutex );
+		auto const Found( ProfileZoneIDs.find( ZoneName ) );
+		if ( Found != ProfileZoneIDs.end() ) return Found->second;
+		int const ZoneID( static_cast< int >( ProfileZoneNames.size() ) );
+		ProfileZoneNames.push_back( ZoneName );
+		ProfileZoneIDs.emplace( ZoneName, ZoneID );
+		return ZoneID;
+
+	}
+
+	std::string
+	ProfileZoneName( int const ZoneID )
+	{
+		// Copied under the lock: registering a zone can reallocate the names
+		std::lock_guard< std::mutex > lock( ProfileMutex );
+		return ProfileZoneNames[ ZoneID ];
+	}
+
+	void
+	WriteProfileTree( std::ostream & os )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Write the call tree of each thread with the calls, inclusive and exclusive times of each zone.
+
+		// METHODOLOGY EMPLOYED:
+		// Enclosed zones are indented under their parent and sorted by inclusive time. Each
+		// environment is a zone of its own, so the tree splits the run time by environment.
+
+		std::lock_guard< std::mutex > lock( ProfileMutex );
+		auto const Flags( os.flags() );
+		auto const Precision( os.precision() );
+		os << std::fixed << std::setprecision( 6 );
+		for ( auto const & Buffer : ProfileBuffers ) {
+			if ( Buffer->Nodes.size() == 1u ) continue;
+			std::int64_t TotalTime( 0 );
+			for ( auto const & Child : Buffer->Nodes[ 0 ].Children ) {
+				TotalTime += Buffer->Nodes[ Child.second ].InclusiveTime;
+			}
+			os << "Thread " << Buffer->ThreadNum << '\n';
+			os << "Zone,Calls,Inclusive Time {s},Exclusive Time {s},Inclusive Time {% of thread}\n";
+			WriteProfileNode( os, *Buffer, 0, 0, TotalTime );
+			os << '\n';
+		}
+		os.flags( Flags );
+		os.precision( Precision );
+
+	}
+
+	void
+	WriteProfileTrace( std::ostream & os )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Write the recorded zones in the Chrome trace event format (chrome://tracing).
+
+		// METHODOLOGY EMPLOYED:
+		// Each zone is a complete ("X") event with its start and duration in microseconds.
+
+		std::lock_guard< std::mutex > lock( ProfileMutex );
+		auto const Flags( os.flags() );
+		auto const Precision( os.precision() );
+		os << std::fixed << std::setprecision( 3 );
+		os << "{\"traceEvents\":[";
+		bool First( true );
+		bool Truncated( false );
+		for ( auto const & Buffer : ProfileBuffers ) {
+			for ( auto const & Event : Buffer->Events ) {
+				os << ( First ? "\n" : ",\n" ) << "{\"name\":";
+				WriteJSONString( os, ProfileZoneNames[ Event.ZoneID ] );
+				os << ",\"ph\":\"X\",\"ts\":" << Event.StartTime * 1.0e-3 << ",\"dur\":" << Event.Duration * 1.0e-3 << ",\"pid\":1,\"tid\":" << Buffer->ThreadNum << '}';
+				First = false;
+			}
+			if ( Buffer->EventsTruncated ) Truncated = true;
+		}
+		os << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"truncated\":" << ( Truncated ? "true" : "false" ) << "}}\n";
+		os.flags( Flags );
+		os.precision( Precision );
+
+	}
+
+	void
+	WriteProfileReports(
+		std::string const & TreeFileName,
+		std::string const & TraceFileName
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Write the profile tree and trace files at the end of a profiled run.
+
+		std::ofstream TreeFile( TreeFileName );
+		if ( TreeFile ) {
+			WriteProfileTree( TreeFile );
+		} else {
+			ShowWarningError( "WriteProfileReports: Could not open file \"" + TreeFileName + "\" for output (write)." );
+		}
+		std::ofstream TraceFile( TraceFileName );
+		if ( TraceFile ) {
+			WriteProfileTrace( TraceFile );
+		} else {
+			ShowWarningError( "WriteProfileReports: Could not open file \"" + TraceFileName + "\" for output (write)." );
+		}
+
+	}
+
+	// Clears the global data in DataTimings.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state()
+	{
+		std::lock_guard< std::mutex > lock( ProfileMutex );
+		ProfilingEnabled = false;
+		MaxTraceEvents = 1000000;
+		ProfileBuffers.clear();
+		++ProfileGeneration;
+		// Zone ids are kept: EP_PROFILE_ZONE holds them in function-local statics
+	}
+
 } // DataTimings
 
 } // EnergyPlus
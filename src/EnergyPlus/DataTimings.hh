@@ -54,6 +54,11 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
+// C++ Headers
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
 namespace EnergyPlus {
 
 #ifdef EP_NO_Timings
@@ -132,6 +137,52 @@ namespace DataTimings {
 	// Object Data
 	extern Array1D< timings > Timing;
 
+	// Scoped profiler (--profile)
+	extern bool ProfilingEnabled; // True when profile zones are recorded
+	extern std::size_t MaxTraceEvents; // Trace events kept per thread for the Chrome trace file
+
+	// Zone of the scoped profiler: records the wall time between its construction and destruction
+	// when profiling is enabled, otherwise costs a single test of ProfilingEnabled
+	class ProfileZone
+	{
+
+	public: // Creation
+
+		explicit
+		ProfileZone( int const ZoneID ) :
+			Active( ProfilingEnabled )
+		{
+			if ( Active ) ProfileBegin( ZoneID );
+		}
+
+		~ProfileZone()
+		{
+			if ( Active ) ProfileEnd();
+		}
+
+	private: // Creation
+
+		ProfileZone( ProfileZone const & ); // Disallow copying
+
+		ProfileZone &
+		operator =( ProfileZone const & ); // Disallow assignment
+
+	public: // Static Functions
+
+		static
+		void
+		ProfileBegin( int const ZoneID );
+
+		static
+		void
+		ProfileEnd();
+
+	private: // Data
+
+		bool const Active; // Profiling was enabled when the zone was entered
+
+	};
+
 	// Functions
 
 	void
@@ -159,8 +210,34 @@ namespace DataTimings {
 	Real64
 	epElapsedTime();
 
+	int
+	ProfileZoneID( std::string const & ZoneName );
+
+	std::string
+	ProfileZoneName( int const ZoneID );
+
+	void
+	WriteProfileReports(
+		std::string const & TreeFileName,
+		std::string const & TraceFileName
+	);
+
+	void
+	WriteProfileTree( std::ostream & os );
+
+	void
+	WriteProfileTrace( std::ostream & os );
+
+	void
+	clear_state();
+
 } // DataTimings
 
 } // EnergyPlus
 
+// Profile the enclosing scope as the named zone; the zone id is registered on first use
+#define EP_PROFILE_ZONE( ZoneName ) \
+	static int const EP_ProfileZoneID( EnergyPlus::DataTimings::ProfileZoneID( ZoneName ) ); \
+	EnergyPlus::DataTimings::ProfileZone const EP_ProfileZone( EP_ProfileZoneID )
+
 #endif
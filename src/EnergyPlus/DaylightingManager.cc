@@ -76,6 +76,7 @@
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DaylightingDevices.hh>
 #include <DElightManagerF.hh>
 #include <DisplayRoutines.hh>
@@ -528,6 +529,8 @@ namespace DaylightingManager {
 		static gio::Fmt Format_700( "('! <Sky Daylight Factors>, MonthAndDay, Zone Name, Window Name, Daylight Fac: Ref Pt #1, Daylight Fac: Ref Pt #2')" );
 
 		// FLOW:
+		EP_PROFILE_ZONE( "CalcDayltgCoefficients" );
+
 		if ( firstTime ) {
 			GetDaylightingParametersInput();
 			CheckTDDsAndLightShelvesInDaylitZones();
@@ -5864,6 +5867,8 @@ namespace DaylightingManager {
 
 		if ( ZoneDaylight( ZoneNum ).DaylightMethod != SplitFluxDaylighting ) return;
 
+		EP_PROFILE_ZONE( "DayltgInteriorIllum" );
+
 		// Three arrays to save original clear and dark (fully switched) states'
 		//  zone/window daylighting properties.
 		if ( firstTime ) {
@@ -206,6 +206,7 @@
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
 #include <Psychrometrics.hh>
+#include <RunPeriodSegments.hh>
 #include <ScheduleManager.hh>
 #include <SimulationManager.hh>
 #include <UtilityRoutines.hh>
@@ -355,6 +356,9 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( cSortIDD, cEnvValue );
 	if ( ! cEnvValue.empty() ) SortedIDD = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( cUseCompiledIDD, cEnvValue );
+	if ( ! cEnvValue.empty() ) UseCompiledIDD = env_var_on( cEnvValue ); // Yes or True
+
 	get_environment_variable( MinReportFrequencyEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) cMinReportFrequency = cEnvValue; // turned into value later
 
@@ -370,9 +374,72 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( cSutherlandHodgman, cEnvValue );
 	if ( ! cEnvValue.empty() ) SutherlandHodgman = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( cCheckShadowingCombinations, cEnvValue );
+	if ( ! cEnvValue.empty() ) CheckShadowingCombinations = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cShadingCacheDirectory, cEnvValue );
+	if ( ! cEnvValue.empty() ) ShadingCacheDirectory = cEnvValue; // Directory path
+
+	get_environment_variable( cSimulationCheckpointFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) SimulationCheckpointFile = cEnvValue; // File path
+
+	get_environment_variable( cSimulationRestartFile, cEnvValue );
+	if ( ! cEnvValue.empty() ) SimulationRestartFile = cEnvValue; // File path
+
+	// Each run period segment keeps its own checkpoint
+	if ( RunPeriodSegments::SegmentNum > 0 ) {
+		std::string const SegmentSuffix( ".segment" + std::to_string( RunPeriodSegments::SegmentNum ) );
+		if ( ! SimulationCheckpointFile.empty() ) SimulationCheckpointFile += SegmentSuffix;
+		if ( ! SimulationRestartFile.empty() ) SimulationRestartFile += SegmentSuffix;
+	}
+
 	get_environment_variable( cMinimalShadowing, cEnvValue );
 	if ( ! cEnvValue.empty() ) lMinimalShadowing = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( cAFNSkylineSolver, cEnvValue );
+	if ( ! cEnvValue.empty() ) AFNSkylineSolver = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cAFNModifiedNewton, cEnvValue );
+	if ( ! cEnvValue.empty() ) AFNModifiedNewton = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cThreadedSurfaceHeatBalance, cEnvValue );
+	if ( ! cEnvValue.empty() ) ThreadedSurfaceHeatBalance = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cAsyncOutputWriter, cEnvValue );
+	if ( ! cEnvValue.empty() ) AsyncOutputWriter = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cColumnarOutputCompression, cEnvValue );
+	if ( ! cEnvValue.empty() ) ColumnarOutputCompression = env_var_on( cEnvValue ); // Yes or True
+
+	// Threads used for the parallel shadowing calculations: EP_OMP_NUM_THREADS overrides OMP_NUM_THREADS,
+	// otherwise the simulation stays on one thread
+	get_environment_variable( cEnvSetThreads, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		bool ErrFlag( false );
+		Real64 const NumThreads( ProcessNumber( cEnvValue, ErrFlag ) );
+		if ( ! ErrFlag && NumThreads >= 1.0 ) {
+			iEnvSetThreads = int( NumThreads );
+			lEnvSetThreadsInput = true;
+		}
+	}
+	get_environment_variable( cepEnvSetThreads, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		bool ErrFlag( false );
+		Real64 const NumThreads( ProcessNumber( cEnvValue, ErrFlag ) );
+		if ( ! ErrFlag && NumThreads >= 1.0 ) {
+			iepEnvSetThreads = int( NumThreads );
+			lepSetThreadsInput = true;
+		}
+	}
+	if ( lepSetThreadsInput ) {
+		NumberShadingThreads = iepEnvSetThreads;
+	} else if ( lEnvSetThreadsInput ) {
+		NumberShadingThreads = iEnvSetThreads;
+	}
+	MaxNumberOfThreads = NumberShadingThreads;
+	Threading = ( NumberShadingThreads > 1 );
+	if ( ThreadedSurfaceHeatBalance ) NumberSurfaceHeatBalanceThreads = NumberShadingThreads; // Same thread count as the shadowing
+
 	get_environment_variable( cTimingFlag, cEnvValue );
 	if ( ! cEnvValue.empty() ) TimingFlag = env_var_on( cEnvValue ); // Yes or True
 
@@ -436,19 +503,31 @@ EnergyPlusPgm( std::string const & filepath )
 
 	try {
 
-		ProcessInput();
+		if ( RunPeriodSegments::IsDriver() ) {
+
+			RunPeriodSegments::ManageSegments();
 
-		ManageSimulation();
+		} else {
 
-		ShowMessage( "Simulation Error Summary *************" );
+			ProcessInput();
 
-		GenOutputVariablesAuditReport();
+			ManageSimulation();
 
-		ShowPsychrometricSummary();
+			ShowMessage( "Simulation Error Summary *************" );
 
-		ReportOrphanRecordObjects();
-		ReportOrphanFluids();
-		ReportOrphanSchedules();
+			GenOutputVariablesAuditReport();
+
+			ShowPsychrometricSummary();
+
+			ReportOrphanRecordObjects();
+			ReportOrphanFluids();
+			ReportOrphanSchedules();
+
+			if ( RunPeriodSegments::SegmentNum > 0 ) RunPeriodSegments::WriteManifest( outputSegFileName );
+
+			if ( ProfilingEnabled ) WriteProfileReports( outputProfFileName, outputProfTraceFileName );
+
+		}
 
 		if (runReadVars) {
 			std::string readVarsPath = exeDirectory + "ReadVarsESO" + exeExtension;
@@ -318,6 +318,11 @@ namespace ExternalInterface {
 			ErrorsFound = true;
 		}
 
+		// Exchanged variables are read from their zone time step values, which must be kept even if they are not reported
+		if ( haveExternalInterfaceBCVTB || haveExternalInterfaceFMUExport || haveExternalInterfaceFMUImport ) {
+			OutputProcessor::RequestAllVariablesAccumulated();
+		}
+
 		if ( NumExternalInterfacesBCVTB > 1 ) {
 			ShowSevereError( "GetExternalInterfaceInput: Cannot have more than one Ptolemy interface." );
 			ShowContinueError( "GetExternalInterfaceInput: Errors found in input." );
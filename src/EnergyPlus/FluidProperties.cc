@@ -112,6 +112,7 @@ namespace FluidProperties {
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS
+	static std::string const BlankString;
 	std::string const Refrig( "REFRIGERANT" );
 	std::string const Glycol( "GLYCOL" );
 	std::string const Pressure( "PRESSURE" );
@@ -130,6 +131,9 @@ namespace FluidProperties {
 	int const PropyleneGlycolIndex( -1 );
 	int const iRefrig( 1 );
 	int const iGlycol( 1 );
+	int const PropertyMethodExact( 1 );
+	int const PropertyMethodUniformGrid( 2 );
+	int const MaxUniformGridCells( 16384 );
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -149,6 +153,8 @@ namespace FluidProperties {
 	int FluidIndex_Water( 0 );
 	int FluidIndex_EthyleneGlycol( 0 );
 	int FluidIndex_PropoleneGlycol( 0 );
+	int PropertyMethod( PropertyMethodExact ); // PropertyMethodExact or PropertyMethodUniformGrid (FluidProperties:Settings)
+	Real64 UniformGridTolerance( 1.0e-5 ); // largest relative deviation allowed for a resampled table
 
 	// ACCESSIBLE SPECIFICATIONS OF MODULE SUBROUTINES OR FUNCTONS:
 
@@ -177,6 +183,8 @@ namespace FluidProperties {
 		FluidIndex_Water = 0;
 		FluidIndex_EthyleneGlycol = 0;
 		FluidIndex_PropoleneGlycol = 0;
+		PropertyMethod = PropertyMethodExact;
+		UniformGridTolerance = 1.0e-5;
 		RefrigData.deallocate();
 		RefrigErrorTracking.deallocate();
 		GlyRawData.deallocate();
@@ -480,6 +488,11 @@ namespace FluidProperties {
 			MaxAlphas = max( MaxAlphas, NumAlphas );
 			MaxNumbers = max( MaxNumbers, NumNumbers );
 		}
+		if ( GetNumObjectsFound( "FluidProperties:Settings" ) > 0 ) {
+			GetObjectDefMaxArgs( "FluidProperties:Settings", Status, NumAlphas, NumNumbers );
+			MaxAlphas = max( MaxAlphas, NumAlphas );
+			MaxNumbers = max( MaxNumbers, NumNumbers );
+		}
 
 		Alphas.allocate( MaxAlphas );
 		cAlphaFieldNames.allocate( MaxAlphas );
@@ -1913,6 +1926,23 @@ namespace FluidProperties {
 
 		if ( ! ErrorsFound ) InitializeRefrigerantLimits( ErrorsFound ); // Initialize the limits for the refrigerants
 
+		CurrentModuleObject = "FluidProperties:Settings";
+		if ( GetNumObjectsFound( CurrentModuleObject ) > 0 ) {
+			GetObjectItem( CurrentModuleObject, 1, Alphas, NumAlphas, Numbers, NumNumbers, Status, lNumericFieldBlanks, lAlphaFieldBlanks, cAlphaFieldNames, cNumericFieldNames );
+			if ( lAlphaFieldBlanks( 1 ) || SameString( Alphas( 1 ), "Exact" ) ) {
+				PropertyMethod = PropertyMethodExact;
+			} else if ( SameString( Alphas( 1 ), "UniformGrid" ) ) {
+				PropertyMethod = PropertyMethodUniformGrid;
+			} else {
+				ShowSevereError( RoutineName + CurrentModuleObject + ": Invalid " + cAlphaFieldNames( 1 ) + " entered=" + Alphas( 1 ) );
+				ShowContinueError( "Valid choices are Exact or UniformGrid." );
+				ErrorsFound = true;
+			}
+			if ( NumNumbers > 0 && ! lNumericFieldBlanks( 1 ) ) UniformGridTolerance = Numbers( 1 );
+		}
+
+		if ( ! ErrorsFound && PropertyMethod == PropertyMethodUniformGrid ) InitializeUniformGrids();
+
 		FluidTemps.deallocate();
 
 		Alphas.deallocate();
@@ -2857,6 +2887,279 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	void
+	InitializeUniformGrids()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine sets up the resampled tables and bracket indexes used by the
+		// property functions when the UniformGrid method is selected in FluidProperties:Settings.
+
+		// METHODOLOGY EMPLOYED:
+		// Glycol properties and saturated refrigerant properties that are interpolated
+		// in temperature are resampled on uniform temperature grids (SetupUniformGrid).
+		// Saturated densities are resampled as specific volumes because that is what
+		// GetSatDensityRefrig interpolates; densities that include zeros are left to
+		// the supplied tables. Lookups in pressure and in the superheated
+		// tables keep the supplied values but find their brackets with a uniform index
+		// (SetupUniformIndex), which gives the same bracket as FindArrayIndex.
+		// Each table and its accuracy are listed in the eio file.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataGlobals::OutputFileInits;
+
+		// Locals
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array1D< Real64 > SpecificVolumes; // reciprocal of the saturated densities
+
+		gio::write( OutputFileInits, fmtA ) << "! <Fluid Property Uniform Grid>,Fluid Name,Property,Grid Points,Maximum Relative Deviation,Method";
+
+		auto ReportGrid = [&]( std::string const & FluidName, std::string const & Property, FluidPropsUniformGrid const & Grid ) {
+			if ( ! Grid.Active ) return;
+			gio::write( OutputFileInits, fmtA ) << " Fluid Property Uniform Grid," + FluidName + ',' + Property + ',' + RoundSigDigits( Grid.Resampled ? Grid.NumCells + 1 : Grid.NumPoints ) + ',' + RoundSigDigits( Grid.MaxDeviation, 8 ) + ',' + ( Grid.Resampled ? "Resampled" : "Indexed" );
+		};
+
+		for ( auto & glycol : GlycolData ) {
+			if ( glycol.CpDataPresent ) SetupUniformGrid( glycol.CpGrid, glycol.CpTemps, glycol.CpValues, glycol.CpLowTempIndex, glycol.CpHighTempIndex, true );
+			if ( glycol.RhoDataPresent ) SetupUniformGrid( glycol.RhoGrid, glycol.RhoTemps, glycol.RhoValues, glycol.RhoLowTempIndex, glycol.RhoHighTempIndex, true );
+			if ( glycol.CondDataPresent ) SetupUniformGrid( glycol.CondGrid, glycol.CondTemps, glycol.CondValues, glycol.CondLowTempIndex, glycol.CondHighTempIndex, true );
+			if ( glycol.ViscDataPresent ) SetupUniformGrid( glycol.ViscGrid, glycol.ViscTemps, glycol.ViscValues, glycol.ViscLowTempIndex, glycol.ViscHighTempIndex, true );
+			ReportGrid( glycol.Name, "Specific Heat", glycol.CpGrid );
+			ReportGrid( glycol.Name, "Density", glycol.RhoGrid );
+			ReportGrid( glycol.Name, "Conductivity", glycol.CondGrid );
+			ReportGrid( glycol.Name, "Viscosity", glycol.ViscGrid );
+		}
+
+		for ( auto & refrig : RefrigData ) {
+			if ( refrig.NumPsPoints > 0 ) {
+				SetupUniformGrid( refrig.PsGrid, refrig.PsTemps, refrig.PsValues, refrig.PsLowTempIndex, refrig.PsHighTempIndex, false );
+				SetupUniformIndex( refrig.PsPresIndex, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex );
+			}
+			if ( refrig.NumHPoints > 0 ) {
+				SetupUniformGrid( refrig.HfGrid, refrig.HTemps, refrig.HfValues, refrig.HfLowTempIndex, refrig.HfHighTempIndex, false );
+				SetupUniformGrid( refrig.HfgGrid, refrig.HTemps, refrig.HfgValues, refrig.HfLowTempIndex, refrig.HfHighTempIndex, false );
+			}
+			if ( refrig.NumCpPoints > 0 ) {
+				SetupUniformGrid( refrig.CpfGrid, refrig.CpTemps, refrig.CpfValues, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex, false );
+				SetupUniformGrid( refrig.CpfgGrid, refrig.CpTemps, refrig.CpfgValues, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex, false );
+			}
+			if ( refrig.NumRhoPoints > 0 ) {
+				SpecificVolumes.dimension( refrig.NumRhoPoints, 0.0 );
+				bool Valid( true );
+				for ( int Loop = refrig.RhofLowTempIndex; Loop <= refrig.RhofHighTempIndex; ++Loop ) {
+					if ( refrig.RhofValues( Loop ) <= 0.0 || refrig.RhofgValues( Loop ) <= 0.0 ) Valid = false;
+				}
+				if ( Valid ) {
+					for ( int Loop = refrig.RhofLowTempIndex; Loop <= refrig.RhofHighTempIndex; ++Loop ) SpecificVolumes( Loop ) = 1.0 / refrig.RhofValues( Loop );
+					SetupUniformGrid( refrig.VfGrid, refrig.RhoTemps, SpecificVolumes, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex, false );
+					for ( int Loop = refrig.RhofLowTempIndex; Loop <= refrig.RhofHighTempIndex; ++Loop ) SpecificVolumes( Loop ) = 1.0 / refrig.RhofgValues( Loop );
+					SetupUniformGrid( refrig.VfgGrid, refrig.RhoTemps, SpecificVolumes, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex, false );
+				}
+			}
+			if ( refrig.NumSuperTempPts > 0 && refrig.NumSuperPressPts > 0 ) {
+				SetupUniformIndex( refrig.SHTempIndex, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+				SetupUniformIndex( refrig.SHPressIndex, refrig.SHPress, 1, refrig.NumSuperPressPts );
+			}
+			// The saturated functions combine the fluid and fluid/gas values, so a pair is used together or not at all
+			if ( ! ( refrig.HfGrid.Active && refrig.HfgGrid.Active ) ) refrig.HfGrid.Active = refrig.HfgGrid.Active = false;
+			if ( ! ( refrig.CpfGrid.Active && refrig.CpfgGrid.Active ) ) refrig.CpfGrid.Active = refrig.CpfgGrid.Active = false;
+			if ( ! ( refrig.VfGrid.Active && refrig.VfgGrid.Active ) ) refrig.VfGrid.Active = refrig.VfgGrid.Active = false;
+			ReportGrid( refrig.Name, "Saturation Pressure", refrig.PsGrid );
+			ReportGrid( refrig.Name, "Saturated Fluid Enthalpy", refrig.HfGrid );
+			ReportGrid( refrig.Name, "Saturated Fluid/Gas Enthalpy", refrig.HfgGrid );
+			ReportGrid( refrig.Name, "Saturated Fluid Specific Heat", refrig.CpfGrid );
+			ReportGrid( refrig.Name, "Saturated Fluid/Gas Specific Heat", refrig.CpfgGrid );
+			ReportGrid( refrig.Name, "Saturated Fluid Specific Volume", refrig.VfGrid );
+			ReportGrid( refrig.Name, "Saturated Fluid/Gas Specific Volume", refrig.VfgGrid );
+		}
+
+	}
+
+	//*****************************************************************************
+
+	void
+	SetupUniformGrid(
+		FluidPropsUniformGrid & Grid, // resampled table to set up
+		Array1D< Real64 > const & Temps, // temperatures of the supplied table
+		Array1D< Real64 > const & Values, // property values of the supplied table
+		int const LowBound, // first valid point of the supplied table
+		int const UpperBound, // last valid point of the supplied table
+		bool const FromUpper // true to interpolate kept points back from the upper point (glycols)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine resamples a property table between LowBound and UpperBound
+		// on a uniform temperature grid so that a lookup needs no search.
+
+		// METHODOLOGY EMPLOYED:
+		// The grid starts at four intervals per closest pair of supplied temperatures
+		// and the values at the grid points are linear interpolations in the supplied
+		// table. Both tables are piecewise linear and agree at the grid points, so their
+		// largest difference is found at one of the supplied points. The differences
+		// there, relative to the supplied values (or to a thousandth of the largest
+		// magnitude in the table for values near zero), are compared with
+		// UniformGridTolerance and the grid is refined by halving until it passes or
+		// reaches MaxUniformGridCells. A table that cannot pass keeps the supplied
+		// points, which are then located with a uniform bracket index (SetupUniformIndex),
+		// so it is still looked up without a search. The kept points are interpolated in
+		// the same form as the Exact lookup of the same table (back from the upper point
+		// for glycols), so a glycol property or a saturation pressure gives the same value
+		// as in Exact mode. The other saturated refrigerant properties combine two such
+		// tables at the given quality, which can differ from Exact mode in the last bits.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		Grid.Active = false;
+		Grid.Resampled = false;
+		Grid.FromUpper = FromUpper;
+		Grid.MaxDeviation = 0.0;
+		Grid.NumCells = 0;
+		Grid.GridValues.deallocate();
+		Grid.NumPoints = 0;
+		Grid.PointTemps.deallocate();
+		Grid.PointValues.deallocate();
+		if ( ( LowBound < 1 ) || ( UpperBound <= LowBound ) ) return;
+
+		Real64 const LowTemp( Temps( LowBound ) );
+		Real64 const TempRange( Temps( UpperBound ) - LowTemp );
+		Real64 MinSpacing( TempRange );
+		Real64 MaxMagnitude( 0.0 );
+		for ( int Loop = LowBound; Loop <= UpperBound; ++Loop ) {
+			if ( Loop > LowBound ) MinSpacing = min( MinSpacing, Temps( Loop ) - Temps( Loop - 1 ) );
+			MaxMagnitude = max( MaxMagnitude, std::abs( Values( Loop ) ) );
+		}
+		if ( MinSpacing <= 0.0 ) return;
+		Grid.Active = true;
+		Real64 const SmallMagnitude( 1.0e-3 * MaxMagnitude ); // values near zero are compared with this instead
+
+		Real64 const StartCells( 4.0 * std::ceil( TempRange / MinSpacing ) );
+		int NumCells( StartCells < MaxUniformGridCells ? static_cast< int >( StartCells ) : MaxUniformGridCells );
+		while ( true ) {
+			Grid.LowTempValue = LowTemp;
+			Grid.InvTempStep = NumCells / TempRange;
+			Grid.NumCells = NumCells;
+			Grid.GridValues.dimension( { 0, NumCells } );
+			int Loop( LowBound ); // supplied interval holding the grid point
+			for ( int Cell = 0; Cell <= NumCells; ++Cell ) {
+				Real64 const Temperature( Cell < NumCells ? LowTemp + ( Cell * TempRange ) / NumCells : Temps( UpperBound ) );
+				while ( ( Loop + 1 < UpperBound ) && ( Temps( Loop + 1 ) < Temperature ) ) ++Loop;
+				Grid.GridValues( Cell ) = Values( Loop ) + ( Temperature - Temps( Loop ) ) / ( Temps( Loop + 1 ) - Temps( Loop ) ) * ( Values( Loop + 1 ) - Values( Loop ) );
+			}
+
+			Grid.Resampled = true;
+			Grid.MaxDeviation = 0.0;
+			for ( Loop = LowBound; Loop <= UpperBound; ++Loop ) {
+				Real64 const Scale( max( std::abs( Values( Loop ) ), SmallMagnitude ) );
+				if ( Scale > 0.0 ) Grid.MaxDeviation = max( Grid.MaxDeviation, std::abs( Grid.value( Temps( Loop ) ) - Values( Loop ) ) / Scale );
+			}
+
+			if ( Grid.MaxDeviation <= UniformGridTolerance ) {
+				return;
+			} else if ( NumCells >= MaxUniformGridCells ) {
+				break;
+			}
+			NumCells = min( 2 * NumCells, MaxUniformGridCells );
+		}
+
+		// Keep the supplied points and find their brackets with a uniform index instead
+		Grid.Resampled = false;
+		Grid.MaxDeviation = 0.0;
+		Grid.NumCells = 0;
+		Grid.GridValues.deallocate();
+		Grid.NumPoints = UpperBound - LowBound + 1;
+		Grid.PointTemps.dimension( Grid.NumPoints );
+		Grid.PointValues.dimension( Grid.NumPoints );
+		for ( int Loop = LowBound; Loop <= UpperBound; ++Loop ) {
+			Grid.PointTemps( Loop - LowBound + 1 ) = Temps( Loop );
+			Grid.PointValues( Loop - LowBound + 1 ) = Values( Loop );
+		}
+		SetupUniformIndex( Grid.Index, Grid.PointTemps, 1, Grid.NumPoints );
+
+	}
+
+	//*****************************************************************************
+
+	void
+	SetupUniformIndex(
+		FluidPropsUniformIndex & Index, // index to set up
+		Array1D< Real64 > const & Array, // values in ascending order
+		int const LowBound, // valid values lower bound
+		int const UpperBound // valid values upper bound
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This routine sets up the bracket index used by FindArrayIndex in place of
+		// interval halving for tables that are not resampled.
+
+		// METHODOLOGY EMPLOYED:
+		// The range between LowBound and UpperBound is split into uniform cells, two
+		// per closest pair of values up to MaxUniformGridCells. Each cell stores the
+		// highest bracket whose lower value maps to an earlier cell; because the mapping
+		// of a value to its cell never decreases, that bracket is at or below the bracket
+		// of any value in the cell and FindArrayIndex only has to step forward from it.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		Index.Active = false;
+		Index.NumCells = 0;
+		Index.CellStart.deallocate();
+		if ( ( LowBound < 1 ) || ( UpperBound <= LowBound ) ) return;
+
+		Real64 const Range( Array( UpperBound ) - Array( LowBound ) );
+		Real64 MinSpacing( Range );
+		for ( int Loop = LowBound + 1; Loop <= UpperBound; ++Loop ) MinSpacing = min( MinSpacing, Array( Loop ) - Array( Loop - 1 ) );
+		if ( MinSpacing <= 0.0 ) return;
+
+		Real64 const Cells( 2.0 * std::ceil( Range / MinSpacing ) );
+		Index.NumCells = ( Cells < MaxUniformGridCells ? static_cast< int >( Cells ) : MaxUniformGridCells );
+		Index.LowValue = Array( LowBound );
+		Index.InvStep = Index.NumCells / Range;
+		Index.CellStart.dimension( { 0, Index.NumCells - 1 } );
+		int Bracket( LowBound );
+		for ( int Cell = 0; Cell < Index.NumCells; ++Cell ) {
+			while ( ( Bracket + 1 < UpperBound ) && ( static_cast< int >( ( Array( Bracket + 1 ) - Index.LowValue ) * Index.InvStep ) < Cell ) ) ++Bracket;
+			Index.CellStart( Cell ) = Bracket;
+		}
+		Index.Active = true;
+
+	}
+
+	//*****************************************************************************
+
 	void
 	ReportAndTestGlycols()
 	{
@@ -3499,6 +3802,11 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
+		// use the resampled table when the temperature is within the supplied data
+		if ( refrig.PsGrid.Active && ( Temperature >= refrig.PsTemps( refrig.PsLowTempIndex ) ) && ( Temperature <= refrig.PsTemps( refrig.PsHighTempIndex ) ) ) {
+			return refrig.PsGrid.value( Temperature );
+		}
+
 		// determine array indices for
 		LoTempIndex = FindArrayIndex( Temperature, refrig.PsTemps, refrig.PsLowTempIndex, refrig.PsHighTempIndex );
 		HiTempIndex = LoTempIndex + 1;
@@ -3613,7 +3921,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// get the array indices
-		LoPresIndex = FindArrayIndex( Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex );
+		LoPresIndex = FindArrayIndex( Pressure, refrig.PsValues, refrig.PsLowPresIndex, refrig.PsHighPresIndex, refrig.PsPresIndex );
 		HiPresIndex = LoPresIndex + 1;
 
 		// check for out of data bounds problems
@@ -3725,6 +4033,12 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
+		// Use the resampled tables when the temperature is within the supplied data
+		if ( refrig.HfGrid.Active && ( Temperature >= refrig.HTemps( refrig.HfLowTempIndex ) ) && ( Temperature <= refrig.HTemps( refrig.HfHighTempIndex ) ) ) {
+			Real64 const SatLiqEnthalpy( refrig.HfGrid.value( Temperature ) );
+			return SatLiqEnthalpy + Quality * ( refrig.HfgGrid.value( Temperature ) - SatLiqEnthalpy );
+		}
+
 		// Apply linear interpolation function
 		return GetInterpolatedSatProp( Temperature, refrig.HTemps, refrig.HfValues, refrig.HfgValues, Quality, CalledFrom, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
 
@@ -3821,6 +4135,12 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
+		// Use the resampled specific volumes when the temperature is within the supplied data
+		if ( refrig.VfGrid.Active && ( Temperature >= refrig.RhoTemps( refrig.RhofLowTempIndex ) ) && ( Temperature <= refrig.RhoTemps( refrig.RhofHighTempIndex ) ) ) {
+			Real64 const SatLiqVolume( refrig.VfGrid.value( Temperature ) );
+			return 1.0 / ( SatLiqVolume + Quality * ( refrig.VfgGrid.value( Temperature ) - SatLiqVolume ) );
+		}
+
 		ErrorFlag = false;
 
 		LoTempIndex = FindArrayIndex( Temperature, refrig.RhoTemps, refrig.RhofLowTempIndex, refrig.RhofHighTempIndex );
@@ -3955,6 +4275,12 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
+		// Use the resampled tables when the temperature is within the supplied data
+		if ( refrig.CpfGrid.Active && ( Temperature >= refrig.CpTemps( refrig.CpfLowTempIndex ) ) && ( Temperature <= refrig.CpTemps( refrig.CpfHighTempIndex ) ) ) {
+			Real64 const SatLiqSpecificHeat( refrig.CpfGrid.value( Temperature ) );
+			return SatLiqSpecificHeat + Quality * ( refrig.CpfgGrid.value( Temperature ) - SatLiqSpecificHeat );
+		}
+
 		// Apply linear interpolation function
 		ReturnValue = GetInterpolatedSatProp( Temperature, refrig.CpTemps, refrig.CpfValues, refrig.CpfgValues, Quality, CalledFrom, refrig.CpfLowTempIndex, refrig.CpfHighTempIndex );
 
@@ -4072,8 +4398,8 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempIndex );
+		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressIndex );
 
 		// check temperature data range and attempt to cap if necessary
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
@@ -4315,7 +4641,7 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		LoTempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempIndex );
 		HiTempIndex = LoTempIndex + 1;
 
 		// check temperature data range and attempt to cap if necessary
@@ -4767,7 +5093,7 @@ namespace FluidProperties {
 		auto const & refrig( RefrigData( RefrigNum ) );
 
 		// check temperature data range and attempt to cap if necessary
-		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts );
+		TempIndex = FindArrayIndex( Temperature, refrig.SHTemps, 1, refrig.NumSuperTempPts, refrig.SHTempIndex );
 		if ( ( TempIndex > 0 ) && ( TempIndex < refrig.NumSuperTempPts ) ) { // in range
 			HiTempIndex = TempIndex + 1;
 			TempInterpRatio = ( Temperature - refrig.SHTemps( TempIndex ) ) / ( refrig.SHTemps( HiTempIndex ) - refrig.SHTemps( TempIndex ) );
@@ -4787,7 +5113,7 @@ namespace FluidProperties {
 		}
 
 		// check pressure data range and attempt to cap if necessary
-		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts );
+		LoPressIndex = FindArrayIndex( Pressure, refrig.SHPress, 1, refrig.NumSuperPressPts, refrig.SHPressIndex );
 		if ( ( LoPressIndex > 0 ) && ( LoPressIndex < refrig.NumSuperPressPts ) ) { // in range
 			HiPressIndex = LoPressIndex + 1;
 			Real64 const SHPress_Lo( refrig.SHPress( LoPressIndex ) );
@@ -4996,6 +5322,8 @@ namespace FluidProperties {
 				ShowRecurringWarningErrorAtEnd( RoutineName + "Temperature out of range (too high) for fluid [" + glycol_data.Name + "] specific heat **", GlycolErrorTracking( GlycolIndex ).SpecHeatHighErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
 			}
 			return glycol_data.CpValues( glycol_data.CpHighTempIndex );
+		} else if ( glycol_data.CpGrid.Active ) { // Temperature within the resampled table
+			return glycol_data.CpGrid.value( Temperature );
 		} else { // Temperature somewhere between the lowest and highest value
 			auto const & glycol_CpTemps( glycol_data.CpTemps );
 			auto const & glycol_CpValues( glycol_data.CpValues );
@@ -5112,6 +5440,8 @@ namespace FluidProperties {
 		} else if ( Temperature > GlycolData( GlycolIndex ).RhoHighTempValue ) { // Temperature too high
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoHighTempIndex );
+		} else if ( GlycolData( GlycolIndex ).RhoGrid.Active ) { // Temperature within the resampled table
+			ReturnValue = GlycolData( GlycolIndex ).RhoGrid.value( Temperature );
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).RhoValues( GlycolData( GlycolIndex ).RhoLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
@@ -5253,6 +5583,8 @@ namespace FluidProperties {
 		} else if ( Temperature > GlycolData( GlycolIndex ).CondHighTempValue ) { // Temperature too high
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondHighTempIndex );
+		} else if ( GlycolData( GlycolIndex ).CondGrid.Active ) { // Temperature within the resampled table
+			ReturnValue = GlycolData( GlycolIndex ).CondGrid.value( Temperature );
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).CondValues( GlycolData( GlycolIndex ).CondLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
@@ -5394,6 +5726,8 @@ namespace FluidProperties {
 		} else if ( Temperature > GlycolData( GlycolIndex ).ViscHighTempValue ) { // Temperature too high
 			HighErrorThisTime = true;
 			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscHighTempIndex );
+		} else if ( GlycolData( GlycolIndex ).ViscGrid.Active ) { // Temperature within the resampled table
+			ReturnValue = GlycolData( GlycolIndex ).ViscGrid.value( Temperature );
 		} else { // Temperature somewhere between the lowest and highest value
 			ReturnValue = GlycolData( GlycolIndex ).ViscValues( GlycolData( GlycolIndex ).ViscLowTempIndex );
 			// bracket is temp > low, <= high (for interpolation
@@ -5443,6 +5777,64 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	GlycolHandle
+	GlycolHandle::resolve( std::string const & Glycol )
+	{
+		return GlycolHandle( FindGlycol( Glycol ), Glycol );
+	}
+
+	// The checked paths hand the index and name to the full property routines, which report
+	// range warnings against CalledFrom and name the glycol in their error messages. A handle
+	// made from an index alone takes the name of the resolved glycol.
+
+	std::string const &
+	GlycolHandle::name() const
+	{
+		return ( Name.empty() && Index > 0 && ! GetInput ) ? GlycolData( Index ).Name : Name;
+	}
+
+	Real64
+	GlycolHandle::cp_checked(
+		Real64 const Temperature,
+		std::string const & CalledFrom
+	) const
+	{
+		int GlycolIndex( Index );
+		return GetSpecificHeatGlycol( name(), Temperature, GlycolIndex, CalledFrom );
+	}
+
+	Real64
+	GlycolHandle::rho_checked(
+		Real64 const Temperature,
+		std::string const & CalledFrom
+	) const
+	{
+		int GlycolIndex( Index );
+		return GetDensityGlycol( name(), Temperature, GlycolIndex, CalledFrom );
+	}
+
+	Real64
+	GlycolHandle::k_checked(
+		Real64 const Temperature,
+		std::string const & CalledFrom
+	) const
+	{
+		int GlycolIndex( Index );
+		return GetConductivityGlycol( name(), Temperature, GlycolIndex, CalledFrom );
+	}
+
+	Real64
+	GlycolHandle::mu_checked(
+		Real64 const Temperature,
+		std::string const & CalledFrom
+	) const
+	{
+		int GlycolIndex( Index );
+		return GetViscosityGlycol( name(), Temperature, GlycolIndex, CalledFrom );
+	}
+
+	//*****************************************************************************
+
 	void
 	GetInterpValue_error()
 	{
@@ -5529,26 +5921,31 @@ namespace FluidProperties {
 		}
 		auto const & refrig( RefrigData( RefrigNum ) );
 
-		LoTempIndex = FindArrayIndex( Temperature, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
-		HiTempIndex = LoTempIndex + 1;
+		if ( refrig.HfGrid.Active && ( Temperature >= refrig.HTemps( refrig.HfLowTempIndex ) ) && ( Temperature <= refrig.HTemps( refrig.HfHighTempIndex ) ) ) { // within the resampled tables
+			SatLiqEnthalpy = refrig.HfGrid.value( Temperature );
+			SatVapEnthalpy = refrig.HfgGrid.value( Temperature );
+		} else {
+			LoTempIndex = FindArrayIndex( Temperature, refrig.HTemps, refrig.HfLowTempIndex, refrig.HfHighTempIndex );
+			HiTempIndex = LoTempIndex + 1;
 
-		// check on the data bounds and adjust indices to give clamped return value
-		if ( LoTempIndex == 0 ) {
-			SatLiqEnthalpy = refrig.HfValues( refrig.HfLowTempIndex );
-			SatVapEnthalpy = refrig.HfgValues( refrig.HfLowTempIndex );
-			// Temperature supplied is out of bounds--produce an error message...
-			if ( ! WarmupFlag ) ShowRecurringWarningErrorAtEnd( "GetQualityRefrig: ** Temperature for requested quality is below the range of data supplied **", TempLoRangeErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
+			// check on the data bounds and adjust indices to give clamped return value
+			if ( LoTempIndex == 0 ) {
+				SatLiqEnthalpy = refrig.HfValues( refrig.HfLowTempIndex );
+				SatVapEnthalpy = refrig.HfgValues( refrig.HfLowTempIndex );
+				// Temperature supplied is out of bounds--produce an error message...
+				if ( ! WarmupFlag ) ShowRecurringWarningErrorAtEnd( "GetQualityRefrig: ** Temperature for requested quality is below the range of data supplied **", TempLoRangeErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
 
-		} else if ( HiTempIndex > refrig.NumHPoints ) {
-			SatLiqEnthalpy = refrig.HfValues( refrig.HfHighTempIndex );
-			SatVapEnthalpy = refrig.HfgValues( refrig.HfHighTempIndex );
-			// Temperature supplied is out of bounds--produce an error message...
-			if ( ! WarmupFlag ) ShowRecurringWarningErrorAtEnd( "GetQualityRefrig: ** Temperature requested quality is above the range of data supplied **", TempHiRangeErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
+			} else if ( HiTempIndex > refrig.NumHPoints ) {
+				SatLiqEnthalpy = refrig.HfValues( refrig.HfHighTempIndex );
+				SatVapEnthalpy = refrig.HfgValues( refrig.HfHighTempIndex );
+				// Temperature supplied is out of bounds--produce an error message...
+				if ( ! WarmupFlag ) ShowRecurringWarningErrorAtEnd( "GetQualityRefrig: ** Temperature requested quality is above the range of data supplied **", TempHiRangeErrIndex, Temperature, Temperature, _, "{C}", "{C}" );
 
-		} else { // in normal range work out interpolated liq and gas enthalpies
-			TempInterpRatio = ( Temperature - refrig.HTemps( LoTempIndex ) ) / ( refrig.HTemps( HiTempIndex ) - refrig.HTemps( LoTempIndex ) );
-			SatLiqEnthalpy = TempInterpRatio * refrig.HfValues( HiTempIndex ) + ( 1.0 - TempInterpRatio ) * refrig.HfValues( LoTempIndex );
-			SatVapEnthalpy = TempInterpRatio * refrig.HfgValues( HiTempIndex ) + ( 1.0 - TempInterpRatio ) * refrig.HfgValues( LoTempIndex );
+			} else { // in normal range work out interpolated liq and gas enthalpies
+				TempInterpRatio = ( Temperature - refrig.HTemps( LoTempIndex ) ) / ( refrig.HTemps( HiTempIndex ) - refrig.HTemps( LoTempIndex ) );
+				SatLiqEnthalpy = TempInterpRatio * refrig.HfValues( HiTempIndex ) + ( 1.0 - TempInterpRatio ) * refrig.HfValues( LoTempIndex );
+				SatVapEnthalpy = TempInterpRatio * refrig.HfgValues( HiTempIndex ) + ( 1.0 - TempInterpRatio ) * refrig.HfgValues( LoTempIndex );
+			}
 		}
 
 		// calculate final quality value from enthalpy ratio
@@ -5871,6 +6268,40 @@ namespace FluidProperties {
 		}
 	}
 
+	int
+	FindArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsUniformIndex const & Index // Bracket index set up for the same array and bounds
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Same result as FindArrayIndex with bounds, using the bracket index set up by
+		// SetupUniformIndex when it is active.
+
+		// METHODOLOGY EMPLOYED:
+		// The cell holding the value gives a bracket at or below the answer, which is
+		// then stepped forward. The cells are about half the closest spacing of the
+		// array, so this is usually no more than one step.
+
+		if ( ! Index.Active ) return FindArrayIndex( Value, Array, LowBound, UpperBound );
+		if ( Value < Array( LowBound ) ) {
+			return 0;
+		} else if ( Value > Array( UpperBound ) ) {
+			return UpperBound;
+		} else {
+			return Index.bracket( Value, Array, UpperBound );
+		}
+	}
+
 	//*****************************************************************************
 
 	Real64
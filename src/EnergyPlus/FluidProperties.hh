@@ -48,6 +48,7 @@
 #define FluidProperties_hh_INCLUDED
 
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 
 // ObjexxFCL Headers
@@ -86,6 +87,9 @@ namespace FluidProperties {
 	extern int const PropyleneGlycolIndex;
 	extern int const iRefrig;
 	extern int const iGlycol;
+	extern int const PropertyMethodExact; // interpolate in the supplied property tables
+	extern int const PropertyMethodUniformGrid; // interpolate in tables resampled on uniform grids
+	extern int const MaxUniformGridCells; // largest number of intervals in a resampled table
 
 	// DERIVED TYPE DEFINITIONS
 
@@ -105,11 +109,97 @@ namespace FluidProperties {
 	extern int FluidIndex_Water;
 	extern int FluidIndex_EthyleneGlycol;
 	extern int FluidIndex_PropoleneGlycol;
+	extern int PropertyMethod; // PropertyMethodExact or PropertyMethodUniformGrid (FluidProperties:Settings)
+	extern Real64 UniformGridTolerance; // largest relative deviation allowed for a resampled table
 
 	// ACCESSIBLE SPECIFICATIONS OF MODULE SUBROUTINES OR FUNCTONS:
 
 	// Types
 
+	struct FluidPropsUniformIndex
+	{
+		// Members
+		bool Active; // Set when the index is used in place of interval halving
+		Real64 LowValue; // Array value at the lower bound
+		Real64 InvStep; // Reciprocal of the cell width
+		int NumCells; // Number of cells
+		Array1D_int CellStart; // Highest bracket index that can hold a value in each cell (0:NumCells-1)
+
+		// Default Constructor
+		FluidPropsUniformIndex() :
+			Active( false ),
+			LowValue( 0.0 ),
+			InvStep( 0.0 ),
+			NumCells( 0 )
+		{}
+
+		// Index of the point below Value, the caller has checked that Value is within Array( LowBound:UpperBound )
+		int
+		bracket(
+			Real64 const Value,
+			Array1D< Real64 > const & Array,
+			int const UpperBound
+		) const
+		{
+			int Bracket( CellStart( std::min( static_cast< int >( ( Value - LowValue ) * InvStep ), NumCells - 1 ) ) );
+			while ( ( Bracket + 1 < UpperBound ) && ( Array( Bracket + 1 ) < Value ) ) ++Bracket;
+			return Bracket;
+		}
+
+	};
+
+	struct FluidPropsUniformGrid
+	{
+		// Members
+		bool Active; // Set when this table is used in place of the supplied table
+		bool Resampled; // Values are on a uniform grid, otherwise the supplied points are looked up with Index
+		bool FromUpper; // Supplied points are interpolated back from the upper point, as the glycol functions do
+		Real64 LowTempValue; // Temperature of the first grid point
+		Real64 InvTempStep; // Reciprocal of the grid spacing
+		int NumCells; // Number of grid intervals
+		Array1D< Real64 > GridValues; // Property values at the grid points (0:NumCells)
+		int NumPoints; // Number of supplied points kept when the table could not be resampled
+		Array1D< Real64 > PointTemps; // Supplied temperatures within the valid range
+		Array1D< Real64 > PointValues; // Supplied values within the valid range
+		FluidPropsUniformIndex Index; // Bracket index into PointTemps
+		Real64 MaxDeviation; // Largest relative deviation of the resampled values at the supplied points
+
+		// Default Constructor
+		FluidPropsUniformGrid() :
+			Active( false ),
+			Resampled( false ),
+			FromUpper( false ),
+			LowTempValue( 0.0 ),
+			InvTempStep( 0.0 ),
+			NumCells( 0 ),
+			NumPoints( 0 ),
+			MaxDeviation( 0.0 )
+		{}
+
+		// Interpolated value, the caller has checked that Temperature is within the supplied data
+		Real64
+		value( Real64 const Temperature ) const
+		{
+			if ( Resampled ) {
+				Real64 const x( ( Temperature - LowTempValue ) * InvTempStep );
+				int const i( std::min( static_cast< int >( x ), NumCells - 1 ) );
+				Real64 const Value_i( GridValues( i ) );
+				return Value_i + ( x - i ) * ( GridValues( i + 1 ) - Value_i );
+			} else {
+				int const i( Index.bracket( Temperature, PointTemps, NumPoints ) );
+				if ( FromUpper ) { // Same form as GetInterpValue
+					Real64 const Temp_u( PointTemps( i + 1 ) );
+					Real64 const Value_u( PointValues( i + 1 ) );
+					return Value_u - ( ( ( Temp_u - Temperature ) / ( Temp_u - PointTemps( i ) ) ) * ( Value_u - PointValues( i ) ) );
+				}
+				Real64 const Temp_i( PointTemps( i ) );
+				Real64 const Value_i( PointValues( i ) );
+				return Value_i + ( Temperature - Temp_i ) / ( PointTemps( i + 1 ) - Temp_i ) * ( PointValues( i + 1 ) - Value_i );
+			}
+		}
+
+	};
+
 	struct FluidPropsRefrigerantData
 	{
 		// Members
@@ -167,6 +257,16 @@ namespace FluidProperties {
 		Array1D< Real64 > SHPress; // Pressures for superheated gas
 		Array2D< Real64 > HshValues; // Enthalpy of superheated gas at HshTemps, HshPress
 		Array2D< Real64 > RhoshValues; // Density of superheated gas at HshTemps, HshPress
+		FluidPropsUniformGrid PsGrid; // Resampled saturation pressure
+		FluidPropsUniformGrid HfGrid; // Resampled enthalpy of saturated fluid
+		FluidPropsUniformGrid HfgGrid; // Resampled enthalpy of saturated fluid/gas
+		FluidPropsUniformGrid CpfGrid; // Resampled specific heat of saturated fluid
+		FluidPropsUniformGrid CpfgGrid; // Resampled specific heat of saturated fluid/gas
+		FluidPropsUniformGrid VfGrid; // Resampled specific volume of saturated fluid
+		FluidPropsUniformGrid VfgGrid; // Resampled specific volume of saturated fluid/gas
+		FluidPropsUniformIndex PsPresIndex; // Bracket index into PsValues
+		FluidPropsUniformIndex SHTempIndex; // Bracket index into SHTemps
+		FluidPropsUniformIndex SHPressIndex; // Bracket index into SHPress
 
 		// Default Constructor
 		FluidPropsRefrigerantData() :
@@ -300,6 +400,10 @@ namespace FluidProperties {
 		int ViscHighTempIndex; // High Temperature Max Index for Visc (>0.0)
 		Array1D< Real64 > ViscTemps; // Temperatures for viscosity of glycol
 		Array1D< Real64 > ViscValues; // viscosity values (mPa-s)
+		FluidPropsUniformGrid CpGrid; // Resampled specific heat
+		FluidPropsUniformGrid RhoGrid; // Resampled density
+		FluidPropsUniformGrid CondGrid; // Resampled conductivity
+		FluidPropsUniformGrid ViscGrid; // Resampled viscosity
 
 		// Default Constructor
 		FluidPropsGlycolData() :
@@ -486,6 +590,33 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	void
+	InitializeUniformGrids();
+
+	//*****************************************************************************
+
+	void
+	SetupUniformGrid(
+		FluidPropsUniformGrid & Grid, // resampled table to set up
+		Array1D< Real64 > const & Temps, // temperatures of the supplied table
+		Array1D< Real64 > const & Values, // property values of the supplied table
+		int const LowBound, // first valid point of the supplied table
+		int const UpperBound, // last valid point of the supplied table
+		bool const FromUpper // true to interpolate kept points back from the upper point (glycols)
+	);
+
+	//*****************************************************************************
+
+	void
+	SetupUniformIndex(
+		FluidPropsUniformIndex & Index, // index to set up
+		Array1D< Real64 > const & Array, // values in ascending order
+		int const LowBound, // valid values lower bound
+		int const UpperBound // valid values upper bound
+	);
+
+	//*****************************************************************************
+
 	void
 	ReportAndTestGlycols();
 
@@ -714,6 +845,172 @@ namespace FluidProperties {
 
 	//*****************************************************************************
 
+	inline
+	Real64
+	GetInterpValueInRange(
+		Real64 const Temperature, // actual temperature, within Temps( LowIndex ) to Temps( HighIndex )
+		Array1D< Real64 > const & Temps, // temperatures at which property data is available
+		Array1D< Real64 > const & Values, // property values at Temps
+		int const LowIndex, // lowest valid data index
+		int const HighIndex // highest valid data index
+	)
+	{
+		// Bracket is temp > low, <= high, as in the glycol property getters
+		int beg( LowIndex ), mid, end( HighIndex );
+		if ( beg == end ) return Values( beg );
+		while ( beg + 1 < end ) {
+			mid = ( ( beg + end ) >> 1 ); // bit shifting is faster than /2
+			( Temperature > Temps( mid ) ? beg : end ) = mid;
+		}
+		return GetInterpValue_fast( Temperature, Temps( beg ), Temps( end ), Values( beg ), Values( end ) );
+	}
+
+	//*****************************************************************************
+
+	// Glycol reference resolved once (normally at input, via FindGlycol) so that hot-path
+	// property calls need neither the fluid name nor an index lookup. Temperatures inside the
+	// supplied data range are evaluated inline; anything else (range warnings, missing data,
+	// input not yet read) goes through the full Get*Glycol routines, which is the only place
+	// the CalledFrom context and the glycol name are used.
+	struct GlycolHandle
+	{
+		// Members
+		int Index; // Index into GlycolData (0 if not resolved)
+		std::string Name; // Glycol name for the error messages of the full routines
+
+		// Default Constructor
+		GlycolHandle() :
+			Index( 0 )
+		{}
+
+		// Index Constructor
+		explicit
+		GlycolHandle( int const Index ) :
+			Index( Index )
+		{}
+
+		// Index and Name Constructor
+		GlycolHandle(
+			int const Index,
+			std::string const & Name
+		) :
+			Index( Index ),
+			Name( Name )
+		{}
+
+		// Resolve a glycol by name
+		static
+		GlycolHandle
+		resolve( std::string const & Glycol );
+
+		bool
+		resolved() const
+		{
+			return Index > 0;
+		}
+
+		// Specific heat {J/kg-K}
+		Real64
+		cp(
+			Real64 const Temperature,
+			std::string const & CalledFrom
+		) const
+		{
+			if ( Index > 0 && ! GetInput ) {
+				auto const & glycol( GlycolData( Index ) );
+				if ( glycol.CpDataPresent && Temperature >= glycol.CpLowTempValue && Temperature <= glycol.CpHighTempValue ) {
+					if ( glycol.CpGrid.Active ) return glycol.CpGrid.value( Temperature );
+					return GetInterpValueInRange( Temperature, glycol.CpTemps, glycol.CpValues, glycol.CpLowTempIndex, glycol.CpHighTempIndex );
+				}
+			}
+			return cp_checked( Temperature, CalledFrom );
+		}
+
+		// Density {kg/m3}
+		Real64
+		rho(
+			Real64 const Temperature,
+			std::string const & CalledFrom
+		) const
+		{
+			if ( Index > 0 && ! GetInput ) {
+				auto const & glycol( GlycolData( Index ) );
+				if ( glycol.RhoDataPresent && Temperature >= glycol.RhoLowTempValue && Temperature <= glycol.RhoHighTempValue ) {
+					if ( glycol.RhoGrid.Active ) return glycol.RhoGrid.value( Temperature );
+					return GetInterpValueInRange( Temperature, glycol.RhoTemps, glycol.RhoValues, glycol.RhoLowTempIndex, glycol.RhoHighTempIndex );
+				}
+			}
+			return rho_checked( Temperature, CalledFrom );
+		}
+
+		// Conductivity {W/m-K}
+		Real64
+		k(
+			Real64 const Temperature,
+			std::string const & CalledFrom
+		) const
+		{
+			if ( Index > 0 && ! GetInput ) {
+				auto const & glycol( GlycolData( Index ) );
+				if ( glycol.CondDataPresent && Temperature >= glycol.CondLowTempValue && Temperature <= glycol.CondHighTempValue ) {
+					if ( glycol.CondGrid.Active ) return glycol.CondGrid.value( Temperature );
+					return GetInterpValueInRange( Temperature, glycol.CondTemps, glycol.CondValues, glycol.CondLowTempIndex, glycol.CondHighTempIndex );
+				}
+			}
+			return k_checked( Temperature, CalledFrom );
+		}
+
+		// Viscosity
+		Real64
+		mu(
+			Real64 const Temperature,
+			std::string const & CalledFrom
+		) const
+		{
+			if ( Index > 0 && ! GetInput ) {
+				auto const & glycol( GlycolData( Index ) );
+				if ( glycol.ViscDataPresent && Temperature >= glycol.ViscLowTempValue && Temperature <= glycol.ViscHighTempValue ) {
+					if ( glycol.ViscGrid.Active ) return glycol.ViscGrid.value( Temperature );
+					return GetInterpValueInRange( Temperature, glycol.ViscTemps, glycol.ViscValues, glycol.ViscLowTempIndex, glycol.ViscHighTempIndex );
+				}
+			}
+			return mu_checked( Temperature, CalledFrom );
+		}
+
+	private: // Out-of-range and error paths
+
+		// Glycol name for the full routines
+		std::string const &
+		name() const;
+
+		Real64
+		cp_checked(
+			Real64 const Temperature,
+			std::string const & CalledFrom
+		) const;
+
+		Real64
+		rho_checked(
+			Real64 const Temperature,
+			std::string const & CalledFrom
+		) const;
+
+		Real64
+		k_checked(
+			Real64 const Temperature,
+			std::string const & CalledFrom
+		) const;
+
+		Real64
+		mu_checked(
+			Real64 const Temperature,
+			std::string const & CalledFrom
+		) const;
+
+	};
+
+	//*****************************************************************************
+
 	Real64
 	GetQualityRefrig(
 		std::string const & Refrigerant, // carries in substance name
@@ -754,6 +1051,15 @@ namespace FluidProperties {
 		Array1D< Real64 > const & Array // Array of values in ascending order
 	);
 
+	int
+	FindArrayIndex(
+		Real64 const Value, // Value to be placed/found within the array of values
+		Array1D< Real64 > const & Array, // Array of values in ascending order
+		int const LowBound, // Valid values lower bound (set by calling program)
+		int const UpperBound, // Valid values upper bound (set by calling program)
+		FluidPropsUniformIndex const & Index // Bracket index set up for the same array and bounds
+	);
+
 	//*****************************************************************************
 
 	Real64
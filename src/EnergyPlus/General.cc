@@ -48,6 +48,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
@@ -64,6 +65,7 @@
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
 #include <InputProcessor.hh>
+#include <NumericFormat.hh>
 #include <UtilityRoutines.hh>
 
 #if defined( _WIN32 ) && _MSC_VER < 1900
@@ -116,6 +118,30 @@ namespace General {
 	//PUBLIC  SaveCompDesWaterFlow
 	//PUBLIC  ErfFunction
 
+	namespace {
+
+		// Digit that follows a digit value in RoundSigDigits rounding (9 wraps to 0)
+		inline
+		char
+		next_digit( int const Digit )
+		{
+			return ( Digit == 9 ? '0' : char( '0' + Digit + 1 ) );
+		}
+
+		// String of the buffer characters with the surrounding spaces stripped
+		inline
+		std::string
+		stripped_buffer( char const * const String, std::size_t const SLen )
+		{
+			std::size_t b( 0u );
+			std::size_t e( SLen );
+			while ( ( b < e ) && ( String[ b ] == ' ' ) ) ++b;
+			while ( ( e > b ) && ( String[ e - 1 ] == ' ' ) ) --e;
+			return std::string( String + b, e - b );
+		}
+
+	} // namespace
+
 	// Functions
 
 	void
@@ -1046,7 +1072,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 2002
-		//       MODIFIED       na
+		//       MODIFIED       Formats into a character buffer through NumericFormat
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1055,7 +1081,7 @@ namespace General {
 		// that is appropriate.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The list-directed field is truncated in place: Only the returned string is allocated.
 
 		// REFERENCES:
 		// na
@@ -1070,8 +1096,7 @@ namespace General {
 
 		// FUNCTION PARAMETER DEFINITIONS:
 		static std::string const NAN_string( "NAN" );
-		static std::string const ZEROOOO( "0.000000000000000000000000000" );
-		static gio::Fmt fmtLD( "*" );
+		static char const ZEROOOO[] = "0.000000000000000000000000000";
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1083,33 +1108,39 @@ namespace General {
 
 		if ( std::isnan( RealValue ) ) return NAN_string;
 
-		std::string String; // Working string
+		char String[ NumericFormat::BufferSize ]; // Working string
+		std::size_t SLen; // Length of String (w/o E part)
 		if ( RealValue != 0.0 ) {
-			gio::write( String, fmtLD ) << RealValue;
+			SLen = NumericFormat::format_list_directed( RealValue, String );
 		} else {
-			String = ZEROOOO;
+			SLen = sizeof( ZEROOOO ) - 1;
+			std::memcpy( String, ZEROOOO, sizeof( ZEROOOO ) );
 		}
-		std::string::size_type const EPos = index( String, 'E' ); // Position of E in original string format xxEyy
-		std::string EString; // E string retained from original string
-		if ( EPos != std::string::npos ) {
-			EString = String.substr( EPos );
-			String.erase( EPos );
+		char EString[ NumericFormat::BufferSize ]; // E string retained from original string
+		std::size_t ELen( 0u ); // Length of EString
+		char const * const EPtr( static_cast< char const * >( std::memchr( String, 'E', SLen ) ) ); // E in original string format xxEyy
+		if ( EPtr != nullptr ) {
+			std::size_t const EPos( EPtr - String ); // Position of E in original string format xxEyy
+			ELen = SLen - EPos;
+			std::memcpy( EString, EPtr, ELen );
+			SLen = EPos;
 		}
-		std::string::size_type const DotPos = index( String, '.' ); // Position of decimal point in original string
-		std::string::size_type const SLen = len( String ); // Length of String (w/o E part)
+		char const * const DotPtr( static_cast< char const * >( std::memchr( String, '.', SLen ) ) );
+		std::size_t const DotPos( DotPtr != nullptr ? DotPtr - String : SLen ); // Position of decimal point in original string
 		bool IncludeDot; // True when decimal point output
-		if ( SigDigits > 0 || EString != "" ) {
+		if ( SigDigits > 0 || ELen > 0u ) {
 			IncludeDot = true;
 		} else {
 			IncludeDot = false;
 		}
 		if ( IncludeDot ) {
-			String.erase( min( DotPos + SigDigits + 1, SLen ) );
-			String += EString;
+			SLen = min( DotPos + SigDigits + 1, SLen );
+			std::memcpy( String + SLen, EString, ELen );
+			SLen += ELen;
 		} else {
-			String.erase( DotPos );
+			SLen = DotPos;
 		}
-		return stripped( String );
+		return stripped_buffer( String, SLen );
 
 	}
 
@@ -1123,7 +1154,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 2002
-		//       MODIFIED       na
+		//       MODIFIED       Formats into a character buffer through NumericFormat
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1144,7 +1175,7 @@ namespace General {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static gio::Fmt fmtLD( "*" );
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1153,10 +1184,9 @@ namespace General {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		std::string String; // Working string
+		char String[ NumericFormat::BufferSize ]; // Working string
 
-		gio::write( String, fmtLD ) << IntegerValue;
-		return stripped( String );
+		return std::string( String, NumericFormat::format_integer( IntegerValue, String ) );
 	}
 
 	std::string
@@ -1169,7 +1199,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 2002
-		//       MODIFIED       na
+		//       MODIFIED       Formats into a character buffer through NumericFormat
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1178,7 +1208,7 @@ namespace General {
 		// that is appropriate.
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The list-directed field is rounded and truncated in place: Only the returned string is allocated.
 
 		// REFERENCES:
 		// na
@@ -1192,10 +1222,8 @@ namespace General {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static std::string const DigitChar( "01234567890" );
 		static std::string const NAN_string( "NAN" );
-		static std::string const ZEROOOO( "0.000000000000000000000000000" );
-		static gio::Fmt fmtLD( "*" );
+		static char const ZEROOOO[] = "0.000000000000000000000000000";
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1207,39 +1235,43 @@ namespace General {
 
 		if ( std::isnan( RealValue ) ) return NAN_string;
 
-		std::string String; // Working string
+		char String[ NumericFormat::BufferSize ]; // Working string
+		std::size_t SLen; // Length of String (w/o E part)
 		if ( RealValue != 0.0 ) {
-			gio::write( String, fmtLD ) << RealValue;
+			SLen = NumericFormat::format_list_directed( RealValue, String );
 		} else {
-			String = ZEROOOO;
+			SLen = sizeof( ZEROOOO ) - 1;
+			std::memcpy( String, ZEROOOO, sizeof( ZEROOOO ) );
 		}
 
-		std::string::size_type const EPos = index( String, 'E' ); // Position of E in original string format xxEyy
-		std::string EString; // E string retained from original string
-		if ( EPos != std::string::npos ) {
-			EString = String.substr( EPos );
-			String.erase( EPos );
+		char EString[ NumericFormat::BufferSize ]; // E string retained from original string
+		std::size_t ELen( 0u ); // Length of EString
+		char const * const EPtr( static_cast< char const * >( std::memchr( String, 'E', SLen ) ) ); // E in original string format xxEyy
+		if ( EPtr != nullptr ) {
+			std::size_t const EPos( EPtr - String ); // Position of E in original string format xxEyy
+			ELen = SLen - EPos;
+			std::memcpy( EString, EPtr, ELen );
+			SLen = EPos;
 		}
 
-		std::string::size_type const DotPos = index( String, '.' ); // Position of decimal point in original string
-		assert( DotPos != std::string::npos );
+		char const * const DotPtr( static_cast< char const * >( std::memchr( String, '.', SLen ) ) );
+		assert( DotPtr != nullptr );
+		std::size_t const DotPos( DotPtr - String ); // Position of decimal point in original string
 		assert( DotPos > 0 ); // Or SPos will not be valid
-		char TestChar( DotPos + SigDigits + 1 < String.length() ? String[ DotPos + SigDigits + 1 ] : ' ' ); // Test character (digit) for rounding, if position in digit string >= 5 (digit is 5 or greater) then will round
-		std::string::size_type const TPos = index( DigitChar, TestChar ); // Position of Testchar in Digit string
+		char TestChar( DotPos + SigDigits + 1 < SLen ? String[ DotPos + SigDigits + 1 ] : ' ' ); // Test character (digit) for rounding, if position in digit string >= 5 (digit is 5 or greater) then will round
 
-		std::string::size_type SPos; // Actual string position being replaced
+		std::size_t SPos; // Actual string position being replaced
 		if ( SigDigits == 0 ) {
 			SPos = DotPos - 1;
 		} else {
 			SPos = DotPos + SigDigits;
 		}
 
-		if ( ( TPos != std::string::npos ) && ( TPos >= 5 ) ) { // Must round to next Digit
-			char const Char2Rep = String[ SPos ]; // Character (digit) to be replaced
-			std::string::size_type NPos = index( DigitChar, Char2Rep ); // Position of "next" char in Digit String
-			std::string::size_type TPos1;
-			assert( NPos != std::string::npos );
-			String[ SPos ] = DigitChar[ NPos + 1 ];
+		if ( ( TestChar >= '5' ) && ( TestChar <= '9' ) ) { // Must round to next Digit
+			int NPos( String[ SPos ] - '0' ); // Value of the digit being replaced
+			int TPos1;
+			assert( ( NPos >= 0 ) && ( NPos <= 9 ) );
+			String[ SPos ] = next_digit( NPos );
 			while ( NPos == 9 ) { // Must change other char too
 				if ( SigDigits == 1 ) {
 					assert( SPos >= 2u );
@@ -1256,10 +1288,10 @@ namespace General {
 						String[ SPos - 3 ] = TestChar; // Shift sign left to avoid overwriting it
 						TestChar = '0'; // all 999s
 					}
-					TPos1 = index( DigitChar, TestChar );
-					assert( TPos1 != std::string::npos );
+					TPos1 = TestChar - '0';
+					assert( ( TPos1 >= 0 ) && ( TPos1 <= 9 ) );
 					assert( SPos >= 2u );
-					String[ SPos - 2 ] = DigitChar[ TPos1 + 1 ];
+					String[ SPos - 2 ] = next_digit( TPos1 );
 				} else {
 					assert( SPos >= 1u );
 					TestChar = String[ SPos - 1 ];
@@ -1275,10 +1307,10 @@ namespace General {
 						String[ SPos - 2 ] = TestChar; // Shift sign left to avoid overwriting it
 						TestChar = '0'; // all 999s
 					}
-					TPos1 = index( DigitChar, TestChar );
-					assert( TPos1 != std::string::npos );
+					TPos1 = TestChar - '0';
+					assert( ( TPos1 >= 0 ) && ( TPos1 <= 9 ) );
 					assert( SPos >= 1u );
-					String[ SPos - 1 ] = DigitChar[ TPos1 + 1 ];
+					String[ SPos - 1 ] = next_digit( TPos1 );
 				}
 				--SPos;
 				NPos = TPos1;
@@ -1286,19 +1318,20 @@ namespace General {
 		}
 
 		bool IncludeDot; // True when decimal point output
-		if ( SigDigits > 0 || EString != "" ) {
+		if ( SigDigits > 0 || ELen > 0u ) {
 			IncludeDot = true;
 		} else {
 			IncludeDot = false;
 		}
 		if ( IncludeDot ) {
-			String.erase( min( DotPos + SigDigits + 1, len( String ) ) );
-			String += EString;
+			SLen = min( DotPos + SigDigits + 1, SLen );
+			std::memcpy( String + SLen, EString, ELen );
+			SLen += ELen;
 		} else {
-			String.erase( DotPos );
+			SLen = DotPos;
 		}
 
-		return stripped( String );
+		return stripped_buffer( String, SLen );
 
 	}
 
@@ -1312,7 +1345,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 2002
-		//       MODIFIED       na
+		//       MODIFIED       Formats into a character buffer through NumericFormat
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1333,7 +1366,7 @@ namespace General {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static gio::Fmt fmtLD( "*" );
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1342,10 +1375,9 @@ namespace General {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		std::string String; // Working string
+		char String[ NumericFormat::BufferSize ]; // Working string
 
-		gio::write( String, fmtLD ) << IntegerValue;
-		return stripped( String );
+		return std::string( String, NumericFormat::format_integer( IntegerValue, String ) );
 	}
 
 	std::string
@@ -48,6 +48,7 @@
 #include <GlobalNames.hh>
 #include <DataPrecisionGlobals.hh>
 #include <InputProcessor.hh>
+#include <NameIndex.hh>
 #include <UtilityRoutines.hh>
 
 namespace EnergyPlus {
@@ -68,7 +69,8 @@ namespace GlobalNames {
 	// certain component names (esp. Chillers, Boilers)
 
 	// METHODOLOGY EMPLOYED:
-	// na
+	// Each list is shadowed by a hash index of its names so the uniqueness
+	// checks do not search the list.
 
 	// REFERENCES:
 	// na
@@ -79,7 +81,6 @@ namespace GlobalNames {
 	// Using/Aliasing
 	using namespace DataPrecisionGlobals;
 	using namespace DataGlobals;
-	using InputProcessor::FindItemInList;
 	using InputProcessor::MakeUPPERCase;
 
 	// Data
@@ -107,6 +108,29 @@ namespace GlobalNames {
 	Array1D< ComponentNameData > BaseboardNames;
 	Array1D< ComponentNameData > CoilNames;
 	Array1D< ComponentNameData > aDUNames;
+	namespace {
+		// Indexes of the CompName of the lists above
+		NameIndex ChillerNamesIndex;
+		NameIndex BoilerNamesIndex;
+		NameIndex BaseboardNamesIndex;
+		NameIndex CoilNamesIndex;
+		NameIndex aDUNamesIndex;
+
+		// Index of the CompName of items 1..NumNames of a list: Rebuilt if the list was reset outside this module
+		NameIndex &
+		SyncedIndex(
+			NameIndex & Index,
+			Array1D< ComponentNameData > const & Names,
+			int const NumNames
+		)
+		{
+			if ( Index.size() != NumNames ) {
+				Index.clear();
+				for ( int Loop = 1; Loop <= NumNames; ++Loop ) Index.add( Names( Loop ).CompName );
+			}
+			return Index;
+		}
+	}
 
 	// Functions
 
@@ -156,7 +180,7 @@ namespace GlobalNames {
 
 		ErrorFound = false;
 		int Found = 0;
-		if ( NumChillers > 0 ) Found = FindItemInList( NameToVerify, ChillerNames, &ComponentNameData::CompName, NumChillers );
+		Found = SyncedIndex( ChillerNamesIndex, ChillerNames, NumChillers ).find( NameToVerify );
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Chiller Type=\"" + ChillerNames( Found ).CompType + "\"." );
 			ShowContinueError( "...Current entry is Chiller Type=\"" + TypeToVerify + "\"." );
@@ -166,12 +190,13 @@ namespace GlobalNames {
 				CurMaxChillers = 4;
 				ChillerNames.allocate( CurMaxChillers );
 			} else if ( NumChillers == CurMaxChillers ) {
-				CurMaxChillers += 4;
+				CurMaxChillers *= 2;
 				ChillerNames.redimension( CurMaxChillers );
 			}
 			++NumChillers;
 			ChillerNames( NumChillers ).CompType = MakeUPPERCase( TypeToVerify );
 			ChillerNames( NumChillers ).CompName = NameToVerify;
+			ChillerNamesIndex.add( NameToVerify );
 		}
 	}
 
@@ -222,7 +247,7 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumBaseboards > 0 ) Found = FindItemInList( NameToVerify, BaseboardNames, &ComponentNameData::CompName, NumBaseboards );
+		Found = SyncedIndex( BaseboardNamesIndex, BaseboardNames, NumBaseboards ).find( NameToVerify );
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Baseboard Type=\"" + BaseboardNames( Found ).CompType + "\"." );
@@ -233,12 +258,13 @@ namespace GlobalNames {
 				CurMaxBaseboards = 4;
 				BaseboardNames.allocate( CurMaxBaseboards );
 			} else if ( NumBaseboards == CurMaxBaseboards ) {
-				CurMaxBaseboards += 4;
+				CurMaxBaseboards *= 2;
 				BaseboardNames.redimension( CurMaxBaseboards );
 			}
 			++NumBaseboards;
 			BaseboardNames( NumBaseboards ).CompType = TypeToVerify;
 			BaseboardNames( NumBaseboards ).CompName = NameToVerify;
+			BaseboardNamesIndex.add( NameToVerify );
 		}
 
 	}
@@ -290,7 +316,7 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumBoilers > 0 ) Found = FindItemInList( NameToVerify, BoilerNames, &ComponentNameData::CompName, NumBoilers );
+		Found = SyncedIndex( BoilerNamesIndex, BoilerNames, NumBoilers ).find( NameToVerify );
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Boiler Type=\"" + BoilerNames( Found ).CompType + "\"." );
@@ -301,12 +327,13 @@ namespace GlobalNames {
 				CurMaxBoilers = 4;
 				BoilerNames.allocate( CurMaxBoilers );
 			} else if ( NumBoilers == CurMaxBoilers ) {
-				CurMaxBoilers += 4;
+				CurMaxBoilers *= 2;
 				BoilerNames.redimension( CurMaxBoilers );
 			}
 			++NumBoilers;
 			BoilerNames( NumBoilers ).CompType = TypeToVerify;
 			BoilerNames( NumBoilers ).CompName = NameToVerify;
+			BoilerNamesIndex.add( NameToVerify );
 		}
 
 	}
@@ -358,7 +385,7 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( NumCoils > 0 ) Found = FindItemInList( NameToVerify, CoilNames, &ComponentNameData::CompName, NumCoils );
+		Found = SyncedIndex( CoilNamesIndex, CoilNames, NumCoils ).find( NameToVerify );
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", Coil Type=\"" + CoilNames( Found ).CompType + "\"" );
@@ -369,12 +396,13 @@ namespace GlobalNames {
 				CurMaxCoils = 4;
 				CoilNames.allocate( CurMaxCoils );
 			} else if ( NumCoils == CurMaxCoils ) {
-				CurMaxCoils += 4;
+				CurMaxCoils *= 2;
 				CoilNames.redimension( CurMaxCoils );
 			}
 			++NumCoils;
 			CoilNames( NumCoils ).CompType = MakeUPPERCase( TypeToVerify );
 			CoilNames( NumCoils ).CompName = NameToVerify;
+			CoilNamesIndex.add( NameToVerify );
 		}
 
 	}
@@ -392,7 +420,7 @@ namespace GlobalNames {
 		ErrorFound = false;
 		int Found = 0;
 
-		if ( numAirDistUnits > 0 ) Found = FindItemInList( NameToVerify, aDUNames, &ComponentNameData::CompName, numAirDistUnits );
+		Found = SyncedIndex( aDUNamesIndex, aDUNames, numAirDistUnits ).find( NameToVerify );
 
 		if ( Found != 0 ) {
 			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify + ", ADU Type=\"" + aDUNames( Found ).CompType + "\"" );
@@ -403,6 +431,7 @@ namespace GlobalNames {
 			aDUData.CompType = MakeUPPERCase( TypeToVerify );
 			aDUData.CompName = NameToVerify;
 			aDUNames.push_back( aDUData );
+			aDUNamesIndex.add( NameToVerify );
 		}
 
 	}
@@ -427,6 +456,11 @@ namespace GlobalNames {
 		BaseboardNames.deallocate();
 		CoilNames.deallocate();
 		aDUNames.deallocate();
+		ChillerNamesIndex.clear();
+		BoilerNamesIndex.clear();
+		BaseboardNamesIndex.clear();
+		CoilNamesIndex.clear();
+		aDUNamesIndex.clear();
 	}
 
 } // GlobalNames
@@ -57,6 +57,7 @@
 // EnergyPlus Headers
 #include <HVACManager.hh>
 #include <AirflowNetworkBalanceManager.hh>
+#include <ColumnarOutput.hh>
 //#include <CoolTower.hh>
 #include <DataAirflowNetwork.hh>
 #include <DataAirLoop.hh>
@@ -75,6 +76,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
@@ -333,6 +335,8 @@ namespace HVACManager {
 		static gio::Fmt Format_20( "(1x,I3,1x,F8.2,2(2x,F8.3),2x,F8.2,4(1x,F13.2),2x,F8.0,2x,F11.2,2x,F9.5,2x,A)" );
 		static gio::Fmt Format_30( "(1x,I3,5x,A)" );
 
+		EP_PROFILE_ZONE( "ManageHVAC" );
+
 		//SYSTEM INITIALIZATION
 		if ( TriggerGetAFN ) {
 			TriggerGetAFN = false;
@@ -533,6 +537,7 @@ namespace HVACManager {
 				}
 				if ( ! BeginDayFlag ) PrintEnvrnStampWarmupPrinted = false;
 				if ( PrintEnvrnStampWarmup ) {
+					OutputProcessor::FlushOutputWriter(); // The stamps follow any queued report lines
 					if ( PrintEndDataDictionary && DoOutputReporting && ! PrintedWarmup ) {
 						gio::write( OutputFileStandard, EndOfHeaderFormat );
 						gio::write( OutputFileMeters, EndOfHeaderFormat );
@@ -541,6 +546,7 @@ namespace HVACManager {
 					if ( DoOutputReporting && ! PrintedWarmup ) {
 						gio::write( OutputFileStandard, EnvironmentStampFormat ) << "1" << "Warmup {" + cWarmupDay + "} " + EnvironmentName << Latitude << Longitude << TimeZoneNumber << Elevation;
 						gio::write( OutputFileMeters, EnvironmentStampFormat ) << "1" << "Warmup {" + cWarmupDay + "} " + EnvironmentName << Latitude << Longitude << TimeZoneNumber << Elevation;
+						if ( ColumnarOutput::Active ) ColumnarOutput::BeginEnvironment( "Warmup {" + cWarmupDay + "} " + EnvironmentName, Latitude, Longitude, TimeZoneNumber, Elevation );
 						PrintEnvrnStampWarmup = false;
 					}
 					PrintedWarmup = true;
@@ -557,6 +563,7 @@ namespace HVACManager {
 				}
 				if ( ! BeginDayFlag ) PrintEnvrnStampWarmupPrinted = false;
 				if ( PrintEnvrnStampWarmup ) {
+					OutputProcessor::FlushOutputWriter(); // The stamps follow any queued report lines
 					if ( PrintEndDataDictionary && DoOutputReporting && ! PrintedWarmup ) {
 						gio::write( OutputFileStandard, EndOfHeaderFormat );
 						gio::write( OutputFileMeters, EndOfHeaderFormat );
@@ -565,6 +572,7 @@ namespace HVACManager {
 					if ( DoOutputReporting && ! PrintedWarmup ) {
 						gio::write( OutputFileStandard, EnvironmentStampFormat ) << "1" << "Warmup {" + cWarmupDay + "} " + EnvironmentName << Latitude << Longitude << TimeZoneNumber << Elevation;
 						gio::write( OutputFileMeters, EnvironmentStampFormat ) << "1" << "Warmup {" + cWarmupDay + "} " + EnvironmentName << Latitude << Longitude << TimeZoneNumber << Elevation;
+						if ( ColumnarOutput::Active ) ColumnarOutput::BeginEnvironment( "Warmup {" + cWarmupDay + "} " + EnvironmentName, Latitude, Longitude, TimeZoneNumber, Elevation );
 						PrintEnvrnStampWarmup = false;
 					}
 					PrintedWarmup = true;
@@ -718,6 +726,8 @@ namespace HVACManager {
 		bool MonotonicIncreaseFound;
 		bool MonotonicDecreaseFound;
 
+		EP_PROFILE_ZONE( "SimHVAC" );
+
 		// Initialize all of the simulation flags to true for the first iteration
 		SimZoneEquipmentFlag = true;
 		SimNonZoneEquipmentFlag = true;
@@ -171,6 +171,10 @@ namespace HeatBalFiniteDiffManager {
 	int const FullyImplicitFirstOrder( 2 ); // fully implicit scheme, first order in time.
 	Array1D_string const cCondFDSchemeType( 2, { "CrankNicholsonSecondOrder", "FullyImplicitFirstOrder" } );
 
+	int const GaussSeidelIteration( 1 ); // original CondFD solver.  node equations updated one at a time until converged
+	int const TridiagonalDirect( 2 ); // node equations of a surface solved together by tridiagonal elimination
+	Array1D_string const cCondFDSolutionType( 2, { "GaussSeidelIteration", "TridiagonalDirect" } );
+
 	Real64 const TempInitValue( 23.0 ); // Initialization value for Temperature
 	Real64 const RhovInitValue( 0.0115 ); // Initialization value for Rhov
 	Real64 const EnthInitValue( 100.0 ); // Initialization value for Enthalpy
@@ -205,6 +209,7 @@ namespace HeatBalFiniteDiffManager {
 	//                                                                 ! before CR 8280 -- Qdryout         !HeatFlux on Surface for reporting for Sensible only
 
 	int CondFDSchemeType( FullyImplicitFirstOrder ); // solution scheme for CondFD - default
+	int CondFDSolutionType( GaussSeidelIteration ); // solver for the node equations of CondFD - default
 	Real64 SpaceDescritConstant( 3.0 ); // spatial descritization constant,
 	Real64 MinTempLimit( -100.0 ); // lower limit check, degree C
 	Real64 MaxTempLimit( 100.0 ); // upper limit check, degree C
@@ -242,6 +247,7 @@ namespace HeatBalFiniteDiffManager {
 		QHeatInFlux.deallocate();
 		QHeatOutFlux.deallocate();
 		CondFDSchemeType = FullyImplicitFirstOrder;
+		CondFDSolutionType = GaussSeidelIteration;
 		SpaceDescritConstant = 3.0;
 		MinTempLimit = -100.0;
 		MaxTempLimit = 100.0;
@@ -404,6 +410,21 @@ namespace HeatBalFiniteDiffManager {
 				MaxAllowedDelTempCondFD = rNumericArgs( 3 );
 			}
 
+			if ( ( NumAlphas >= 2 ) && ! lAlphaFieldBlanks( 2 ) ) {
+
+				{ auto const SELECT_CASE_var( cAlphaArgs( 2 ) );
+
+				if ( SELECT_CASE_var == "GAUSSSEIDELITERATION" ) {
+					CondFDSolutionType = GaussSeidelIteration;
+				} else if ( SELECT_CASE_var == "TRIDIAGONALDIRECT" ) {
+					CondFDSolutionType = TridiagonalDirect;
+				} else {
+					ShowSevereError( cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered=" + cAlphaArgs( 2 ) + ", must match GaussSeidelIteration or TridiagonalDirect." );
+					ErrorsFound = true;
+				}}
+
+			}
+
 		} // settings object
 
 		pcMat = GetNumObjectsFound( "MaterialProperty:PhaseChange" );
@@ -1018,6 +1039,10 @@ namespace HeatBalFiniteDiffManager {
 			SurfaceFD( Surf ).CpDelXRhoS1.allocate( TotNodes + 1 );
 			SurfaceFD( Surf ).CpDelXRhoS2.allocate( TotNodes + 1 );
 			SurfaceFD( Surf ).TDpriortimestep.allocate( TotNodes + 1 );
+			SurfaceFD( Surf ).NodeLower.allocate( TotNodes + 1 );
+			SurfaceFD( Surf ).NodeDiag.allocate( TotNodes + 1 );
+			SurfaceFD( Surf ).NodeUpper.allocate( TotNodes + 1 );
+			SurfaceFD( Surf ).NodeRHS.allocate( TotNodes + 1 );
 
 			//Initialize the allocated arrays.
 			SurfaceFD( Surf ).T = TempInitValue;
@@ -1040,6 +1065,10 @@ namespace HeatBalFiniteDiffManager {
 			SurfaceFD( Surf ).CpDelXRhoS1 = 0.0;
 			SurfaceFD( Surf ).CpDelXRhoS2 = 0.0;
 			SurfaceFD( Surf ).TDpriortimestep = 0.0;
+			SurfaceFD( Surf ).NodeLower = 0.0;
+			SurfaceFD( Surf ).NodeDiag = 0.0;
+			SurfaceFD( Surf ).NodeUpper = 0.0;
+			SurfaceFD( Surf ).NodeRHS = 0.0;
 		}
 
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
@@ -1130,7 +1159,12 @@ namespace HeatBalFiniteDiffManager {
 		//      all building surface constructs.
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The node equations are either updated one at a time by Gauss-Seidel iteration, or, with the
+		// TridiagonalDirect solution method, assembled for the whole surface and solved by tridiagonal
+		// elimination.  Properties that depend on temperature (variable conductivity, phase change enthalpy,
+		// movable insulation) are lagged one iteration so the direct solve is repeated until converged.
+		// Interzone partitions and adiabatic surfaces couple to another surface's (or their own) inside face and
+		// always use the Gauss-Seidel update.
 
 		// REFERENCES:
 		// na
@@ -1154,8 +1188,6 @@ namespace HeatBalFiniteDiffManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 MaxDelTemp( 0.0 );
-
 		int const ConstrNum( Surface( Surf ).Construction );
 
 		int const TotNodes( ConstructFD( ConstrNum ).TotNodes );
@@ -1187,82 +1219,124 @@ namespace HeatBalFiniteDiffManager {
 		int RoughIndexMovInsul; // roughness  Movable insulation
 		Real64 AbsExt; // exterior absorptivity  movable insulation
 		EvalOutsideMovableInsulation( Surf, HMovInsul, RoughIndexMovInsul, AbsExt );
-		// Start stepping through the slab with time.
-		for ( int J = 1, J_end = nint( TimeStepZoneSec / Delt ); J <= J_end; ++J ) { //PT testing higher time steps
 
-			int GSiter; // iteration counter for implicit repeat calculation
-			for ( GSiter = 1; GSiter <= MaxGSiter; ++GSiter ) { //  Iterate implicit equations
-				TDTLast = TDT; // Save last iteration's TDT (New temperature) values
-				EnthLast = EnthNew; // Last iterations new enthalpy value
+		bool const DirectSolve( ( CondFDSolutionType == TridiagonalDirect ) && ( Surface( Surf ).ExtBoundCond <= 0 ) && ( Surface( Surf ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) );
+
+		// Update every node equation once, in order from outside to inside
+		auto NodeEqnsSweep = [&]( int const Iter ) {
+			int i( 1 ); //  Node counter
+			for ( int Lay = 1; Lay <= TotLayers; ++Lay ) { // Begin layer loop ...
+
+				// For the exterior surface node with a convective boundary condition
+				if ( ( i == 1 ) && ( Lay == 1 ) ) {
+					ExteriorBCEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TotNodes, HMovInsul );
+				}
 
-				// Original loop version
-				int i( 1 ); //  Node counter
-				for ( int Lay = 1; Lay <= TotLayers; ++Lay ) { // Begin layer loop ...
+				// For the Layer Interior nodes.  Arrive here after exterior surface node or interface node
 
-					// For the exterior surface node with a convective boundary condition
-					if ( ( i == 1 ) && ( Lay == 1 ) ) {
-						ExteriorBCEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TotNodes, HMovInsul );
+				if ( TotNodes != 1 ) {
+					for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
+						++i;
+						InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
 					}
+				}
+
+				if ( ( Lay < TotLayers ) && ( TotNodes != 1 ) ) { // Interface equations for 2 capactive materials
+					++i;
+					IntInterfaceNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, Iter );
+				} else if ( Lay == TotLayers ) { // For the Interior surface node with a convective boundary condition
+					++i;
+					InteriorBCEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TDreport );
+				}
+
+			} // layer loop
+		};
 
-					// For the Layer Interior nodes.  Arrive here after exterior surface node or interface node
+		// Start stepping through the slab with time.
+		for ( int J = 1, J_end = nint( TimeStepZoneSec / Delt ); J <= J_end; ++J ) { //PT testing higher time steps
+
+			int GSiter; // iteration counter for implicit repeat calculation
 
-					if ( TotNodes != 1 ) {
-						for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
-							++i;
-							InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+			if ( DirectSolve ) {
+				for ( GSiter = 1; GSiter <= MaxGSiter; ++GSiter ) { //  Iterate lagged properties
+					TDTLast = TDT;
+					EnthLast = EnthNew;
+
+					bool const Linear( AssembleNodeEqns( Delt, Surf, HMovInsul ) );
+					SolveTridiagonal( surfaceFD.NodeLower, surfaceFD.NodeDiag, surfaceFD.NodeUpper, surfaceFD.NodeRHS, TDT );
+					for ( int NodeNum = 1; NodeNum <= TotNodes + 1; ++NodeNum ) { // Limit clipping
+						if ( TDT( NodeNum ) < MinSurfaceTempLimit ) {
+							TDT( NodeNum ) = MinSurfaceTempLimit;
+						} else if ( TDT( NodeNum ) > MaxSurfaceTempLimit ) {
+							TDT( NodeNum ) = MaxSurfaceTempLimit;
 						}
 					}
 
-					if ( ( Lay < TotLayers ) && ( TotNodes != 1 ) ) { // Interface equations for 2 capactive materials
-						++i;
-						IntInterfaceNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, GSiter );
-					} else if ( Lay == TotLayers ) { // For the Interior surface node with a convective boundary condition
-						++i;
-						InteriorBCEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TDreport );
+					// Same relaxation as the Gauss-Seidel loop, for phase change stability
+					if ( GSiter > 15 ) {
+						relax_array( TDT, TDTLast, 0.9875 );
+					} else if ( GSiter > 10 ) {
+						relax_array( TDT, TDTLast, 0.875 );
+					} else if ( GSiter > 5 ) {
+						relax_array( TDT, TDTLast, 0.5 );
 					}
 
-				} // layer loop
-
-				// Apply Relaxation factor for stability, use current (TDT) and previous (TDTLast) iteration temperature values
-				// to obtain the actual temperature that is going to be used for next iteration. This would mostly happen with PCM
-				//Tuned Function call to eliminate array temporaries and multiple relaxation passes
-				if ( GSiter > 15 ) {
-					relax_array( TDT, TDTLast, 0.9875 );
-				} else if ( GSiter > 10 ) {
-					relax_array( TDT, TDTLast, 0.875 );
-				} else if ( GSiter > 5 ) {
-					relax_array( TDT, TDTLast, 0.5 );
+					if ( Linear ) break; // exact in one solve
+					if ( ( GSiter > 1 ) && ( std::abs( sum_array_diff( TDT, TDTLast ) / sum( TDT ) ) < 0.00001 ) ) break;
 				}
+				if ( GSiter > MaxGSiter ) GSiter = MaxGSiter;
+
+				// One pass of the node equations at the converged temperatures sets the face fluxes,
+				// half-node heat capacities, enthalpies and source node values
+				NodeEqnsSweep( GSiter );
+			} else {
+				for ( GSiter = 1; GSiter <= MaxGSiter; ++GSiter ) { //  Iterate implicit equations
+					TDTLast = TDT; // Save last iteration's TDT (New temperature) values
+					EnthLast = EnthNew; // Last iterations new enthalpy value
+
+					NodeEqnsSweep( GSiter );
+
+					// Apply Relaxation factor for stability, use current (TDT) and previous (TDTLast) iteration temperature values
+					// to obtain the actual temperature that is going to be used for next iteration. This would mostly happen with PCM
+					//Tuned Function call to eliminate array temporaries and multiple relaxation passes
+					if ( GSiter > 15 ) {
+						relax_array( TDT, TDTLast, 0.9875 );
+					} else if ( GSiter > 10 ) {
+						relax_array( TDT, TDTLast, 0.875 );
+					} else if ( GSiter > 5 ) {
+						relax_array( TDT, TDTLast, 0.5 );
+					}
 
-				// the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
-				//PT delete one zero and decrese number of minimum iterations, from 3 (which actually requires 4 iterations) to 2.
-
-				if ( ( GSiter > 2 ) && ( std::abs( sum_array_diff( TDT, TDTLast ) / sum( TDT ) ) < 0.00001 ) ) break;
-				//SurfaceFD(Surf)%GSloopCounter = Gsiter  !PT moved out of GSloop so it can actually count all iterations
-
-				//feb2012 the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
-				//feb2012      IF (Gsiter .gt. 3  .and.ABS(SUM(SurfaceFD(Surf)%TDT-SurfaceFD(Surf)%TDTLast)/SUM(SurfaceFD(Surf)%TDT)) < 0.000001d0 )  EXIT
-				//feb2012      SurfaceFD(Surf)%GSloopCounter = Gsiter
-				//      IF ((GSiter == MaxGSiter) .AND. (SolutionAlgo /= UseCondFDSimple)) THEN ! didn't ever converge
-				//        IF (.NOT. WarmupFlag .AND. (.NOT. KickOffSimulation)) THEN
-				//          ErrCount=ErrCount+1
-				//          ErrorSignal = ABS(SUM(SurfaceFD(Surf)%TDT-SurfaceFD(Surf)%TDTLast)/SUM(SurfaceFD(Surf)%TDT))
-				//          IF (ErrCount < 10) THEN
-				//            CALL ShowWarningError('ConductionFiniteDifference inner iteration loop did not converge for surface named ='// &
-				//                          TRIM(Surface(Surf)%Name) // &
-				//                          ', with error signal ='//TRIM(RoundSigDigits(ErrorSignal, 8)) // &
-				//                          ' vs criteria of 0.000001')
-				//            CALL ShowContinueErrorTimeStamp(' ')
-				//          ELSE
-				//            CALL ShowRecurringWarningErrorAtEnd('ConductionFiniteDifference convergence problem continues for surface named ='// &
-				//                                                TRIM(Surface(Surf)%Name) , &
-				//                                               SurfaceFD(Surf)%GSloopErrorCount,ReportMaxOf=ErrorSignal,ReportMinOf=ErrorSignal,  &
-				//                                               ReportMaxUnits='[ ]',ReportMinUnits='[ ]')
-				//          ENDIF
-				//        ENDIF
-				//      ENDIF
-
-			} // End of Gauss Seidell iteration loop
+					// the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
+					//PT delete one zero and decrese number of minimum iterations, from 3 (which actually requires 4 iterations) to 2.
+
+					if ( ( GSiter > 2 ) && ( std::abs( sum_array_diff( TDT, TDTLast ) / sum( TDT ) ) < 0.00001 ) ) break;
+					//SurfaceFD(Surf)%GSloopCounter = Gsiter  !PT moved out of GSloop so it can actually count all iterations
+
+					//feb2012 the following could blow up when all the node temps sum to less than 1.0.  seems poorly formulated for temperature in C.
+					//feb2012      IF (Gsiter .gt. 3  .and.ABS(SUM(SurfaceFD(Surf)%TDT-SurfaceFD(Surf)%TDTLast)/SUM(SurfaceFD(Surf)%TDT)) < 0.000001d0 )  EXIT
+					//feb2012      SurfaceFD(Surf)%GSloopCounter = Gsiter
+					//      IF ((GSiter == MaxGSiter) .AND. (SolutionAlgo /= UseCondFDSimple)) THEN ! didn't ever converge
+					//        IF (.NOT. WarmupFlag .AND. (.NOT. KickOffSimulation)) THEN
+					//          ErrCount=ErrCount+1
+					//          ErrorSignal = ABS(SUM(SurfaceFD(Surf)%TDT-SurfaceFD(Surf)%TDTLast)/SUM(SurfaceFD(Surf)%TDT))
+					//          IF (ErrCount < 10) THEN
+					//            CALL ShowWarningError('ConductionFiniteDifference inner iteration loop did not converge for surface named ='// &
+					//                          TRIM(Surface(Surf)%Name) // &
+					//                          ', with error signal ='//TRIM(RoundSigDigits(ErrorSignal, 8)) // &
+					//                          ' vs criteria of 0.000001')
+					//            CALL ShowContinueErrorTimeStamp(' ')
+					//          ELSE
+					//            CALL ShowRecurringWarningErrorAtEnd('ConductionFiniteDifference convergence problem continues for surface named ='// &
+					//                                                TRIM(Surface(Surf)%Name) , &
+					//                                               SurfaceFD(Surf)%GSloopErrorCount,ReportMaxOf=ErrorSignal,ReportMinOf=ErrorSignal,  &
+					//                                               ReportMaxUnits='[ ]',ReportMinUnits='[ ]')
+					//          ENDIF
+					//        ENDIF
+					//      ENDIF
+
+				} // End of Gauss Seidell iteration loop
+			}
 
 			GSloopCounter = GSiter; // outputs GSloop iterations, useful for pinpointing stability issues with condFD
 			if ( CondFDRelaxFactor != 1.0 ) {
@@ -1286,7 +1360,7 @@ namespace HeatBalFiniteDiffManager {
 		CalcNodeHeatFlux( Surf, TotNodes );
 
 		// Determine largest change in node temps
-		MaxDelTemp = 0.0;
+		Real64 MaxDelTemp( 0.0 );
 		for ( int NodeNum = 1; NodeNum <= TotNodes + 1; ++NodeNum ) { // need to consider all nodes
 			MaxDelTemp = max( std::abs( TDT( NodeNum ) - TDreport( NodeNum ) ), MaxDelTemp );
 		}
@@ -1297,6 +1371,389 @@ namespace HeatBalFiniteDiffManager {
 
 	}
 
+	bool
+	AssembleNodeEqns(
+		int const Delt, // Time Increment
+		int const Surf, // Surface number
+		Real64 const HMovInsul // Conductance of movable(transparent) insulation.
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Fill the tridiagonal node equations of a surface with a regular (non-partition) outside
+		// boundary for the TridiagonalDirect solution method.  Returns true if the equations do not
+		// depend on the node temperatures, in which case a single solve is exact.
+
+		// METHODOLOGY EMPLOYED:
+		// Row i reads NodeLower(i) * TDT(i-1) + NodeDiag(i) * TDT(i) + NodeUpper(i) * TDT(i+1) = NodeRHS(i).
+		// Each row is the same balance as ExteriorBCEqns, InteriorNodeEqns, IntInterfaceNodeEqns or
+		// InteriorBCEqns with the neighbor temperatures moved to the left hand side.  Conductivity, phase
+		// change heat capacity and the movable insulation face temperature are evaluated at the current TDT.
+
+		// Using/Aliasing
+		using DataHeatBalFanSys::MAT;
+		using DataHeatBalFanSys::QHTRadSysSurf;
+		using DataHeatBalFanSys::QHWBaseboardSurf;
+		using DataHeatBalFanSys::QSteamBaseboardSurf;
+		using DataHeatBalFanSys::QElecBaseboardSurf;
+		using DataHeatBalFanSys::QCoolingPanelSurf;
+		using DataSurfaces::OtherSideCondModeledExt;
+		using DataSurfaces::OSCM;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		auto const & surface( Surface( Surf ) );
+		int const ConstrNum( surface.Construction );
+		auto const & construct( Construct( ConstrNum ) );
+		int const TotNodes( ConstructFD( ConstrNum ).TotNodes );
+		int const TotLayers( construct.TotLayers );
+
+		auto & surfaceFD( SurfaceFD( Surf ) );
+		auto const & TD( surfaceFD.TD );
+		auto const & TDT( surfaceFD.TDT );
+		auto & Lower( surfaceFD.NodeLower );
+		auto & Diag( surfaceFD.NodeDiag );
+		auto & Upper( surfaceFD.NodeUpper );
+		auto & RHS( surfaceFD.NodeRHS );
+
+		bool Linear( HMovInsul <= 0.0 );
+
+		// Conductivity of a layer at temperature Tavg, as in the node equations
+		auto LayerConductivity = [&]( int const MatLay, Real64 const Tavg ) -> Real64 {
+			auto const & matFD_TempCond( MaterialFD( MatLay ).TempCond );
+			assert( matFD_TempCond.u2() >= 3 );
+			auto const lTC( matFD_TempCond.index( 2, 1 ) );
+			if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
+				Linear = false;
+				return terpld( matFD_TempCond, Tavg, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
+			}
+			Real64 kt( Material( MatLay ).Conductivity ); // 20C base conductivity
+			Real64 const kt1( MaterialFD( MatLay ).tk1 ); // linear coefficient (normally zero)
+			if ( kt1 != 0.0 ) {
+				Linear = false;
+				kt += kt1 * ( Tavg - 20.0 );
+			}
+			return kt;
+		};
+
+		// Sum of the first temperature/enthalpy entries: positive for a phase change material
+		auto TempEnthSum = []( int const MatLay ) -> Real64 {
+			auto const & matFD_TempEnth( MaterialFD( MatLay ).TempEnth );
+			assert( matFD_TempEnth.u2() >= 3 );
+			auto const lTE( matFD_TempEnth.index( 2, 1 ) );
+			return matFD_TempEnth[ lTE ] + matFD_TempEnth[ lTE+1 ] + matFD_TempEnth[ lTE+2 ];
+		};
+
+		// Phase change specific heat between TD and TDT at node i
+		auto PhaseChangeCp = [&]( int const MatLay, Real64 const Cpo, int const i, bool const CheckSmallDiff ) -> Real64 {
+			Linear = false;
+			auto const & matFD_TempEnth( MaterialFD( MatLay ).TempEnth );
+			Real64 const EnthOld( terpld( matFD_TempEnth, TD( i ), 1, 2 ) ); // 1: Temperature, 2: Enthalpy
+			Real64 const EnthNew( terpld( matFD_TempEnth, TDT( i ), 1, 2 ) ); // 1: Temperature, 2: Enthalpy
+			if ( CheckSmallDiff ) {
+				if ( ( std::abs( EnthNew - EnthOld ) > smalldiff ) && ( std::abs( TDT( i ) - TD( i ) ) > smalldiff ) ) {
+					return max( Cpo, ( EnthNew - EnthOld ) / ( TDT( i ) - TD( i ) ) );
+				}
+			} else if ( EnthNew != EnthOld ) {
+				return max( Cpo, ( EnthNew - EnthOld ) / ( TDT( i ) - TD( i ) ) );
+			}
+			return Cpo;
+		};
+
+		// Exterior surface node
+		auto ExteriorRow = [&]( int const i, int const Lay ) {
+			Lower( i ) = 0.0;
+			if ( surface.ExtBoundCond == Ground || IsRain ) {
+				Diag( i ) = 1.0;
+				Upper( i ) = 0.0;
+				RHS( i ) = TempOutsideAirFD( Surf );
+				return;
+			}
+
+			Real64 Tsky;
+			Real64 QRadSWOutFD; // Short wave radiation absorbed on outside of opaque surface
+			Real64 QRadSWOutMvInsulFD( 0.0 ); // SW radiation at outside of Movable Insulation
+			if ( surface.ExtBoundCond == OtherSideCondModeledExt ) {
+				Tsky = OSCM( surface.OSCMPtr ).TRad;
+				QRadSWOutFD = 0.0; // eliminate incident shortwave on underlying surface
+			} else {
+				QRadSWOutFD = QRadSWOutAbs( Surf );
+				QRadSWOutMvInsulFD = QRadSWOutMvIns( Surf );
+				Tsky = SkyTemp;
+			}
+			Real64 const hconvo( HConvExtFD( Surf ) );
+			Real64 const hrad( HAirFD( Surf ) );
+			Real64 const hsky( HSkyFD( Surf ) );
+			Real64 const hgnd( HGrndFD( Surf ) );
+			Real64 const Toa( TempOutsideAirFD( Surf ) );
+			Real64 const Tgnd( TempOutsideAirFD( Surf ) );
+			Real64 const QOut( QRadSWOutFD + hgnd * Tgnd + ( hconvo + hrad ) * Toa + hsky * Tsky );
+
+			int const MatLay( construct.LayerPoint( Lay ) );
+			auto const & mat( Material( MatLay ) );
+			if ( mat.ROnly || mat.Group == 1 ) { // R Layer or Air Layer
+				Real64 const Rlayer( mat.Resistance );
+				Diag( i ) = 1.0 + ( hconvo + hgnd + hrad + hsky ) * Rlayer;
+				Upper( i ) = -1.0;
+				RHS( i ) = QOut * Rlayer;
+				return;
+			}
+
+			auto const TDT_i( TDT( i ) );
+			auto const TD_i( TD( i ) );
+			Real64 kt( mat.Conductivity ); // 20C base conductivity
+			auto const & matFD( MaterialFD( MatLay ) );
+			auto const & matFD_TempCond( matFD.TempCond );
+			auto const lTC( matFD_TempCond.index( 2, 1 ) );
+			if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
+				Linear = false;
+				kt = terpld( matFD_TempCond, ( TDT_i + TDT( i + 1 ) ) / 2.0, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
+			} else if ( matFD.tk1 != 0.0 ) { // same expression as ExteriorBCEqns
+				Linear = false;
+				kt = matFD.tk1 * ( ( TDT_i + TDT( i + 1 ) ) / 2.0 - 20.0 );
+			}
+			Real64 const Cp( TempEnthSum( MatLay ) >= 0.0 ? PhaseChangeCp( MatLay, mat.SpecHeat, i, false ) : mat.SpecHeat );
+			Real64 const RhoS( mat.Density );
+			Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
+			Real64 const Two_Delt_DelX( 2.0 * Delt * DelX );
+			Real64 const Cp_DelX2_RhoS( Cp * pow_2( DelX ) * RhoS );
+			Real64 const Two_Delt_kt( 2.0 * Delt * kt );
+
+			if ( HMovInsul <= 0.0 ) { // Regular  case
+				if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Second Order equation
+					Real64 const Cp_DelX_RhoS_2Delt( Cp * DelX * RhoS / ( 2.0 * Delt ) );
+					Real64 const kt_2DelX( kt / ( 2.0 * DelX ) );
+					Real64 const hsum( 0.5 * ( hconvo + hgnd + hrad + hsky ) );
+					Diag( i ) = hsum + kt_2DelX + Cp_DelX_RhoS_2Delt;
+					Upper( i ) = -kt_2DelX;
+					RHS( i ) = QOut + Cp_DelX_RhoS_2Delt * TD_i + kt_2DelX * ( TD( i + 1 ) - TD_i ) - hsum * TD_i;
+				} else { // First Order
+					Diag( i ) = Two_Delt_DelX * ( hconvo + hgnd + hrad + hsky ) + Two_Delt_kt + Cp_DelX2_RhoS;
+					Upper( i ) = -Two_Delt_kt;
+					RHS( i ) = Two_Delt_DelX * QOut + Cp_DelX2_RhoS * TD_i;
+				}
+			} else { // Transparent insulation on outside, face temperature lagged
+				Real64 const TInsulOut( ( QRadSWOutMvInsulFD + hgnd * Tgnd + HMovInsul * TDT_i + ( hconvo + hrad ) * Toa + hsky * Tsky ) / ( hconvo + hgnd + HMovInsul + hrad + hsky ) );
+				Diag( i ) = Two_Delt_DelX * HMovInsul + Two_Delt_kt + Cp_DelX2_RhoS;
+				Upper( i ) = -Two_Delt_kt;
+				RHS( i ) = Two_Delt_DelX * ( QRadSWOutFD + HMovInsul * TInsulOut ) + Cp_DelX2_RhoS * TD_i;
+			}
+		};
+
+		// Node inside a layer
+		auto InteriorRow = [&]( int const i, int const Lay ) {
+			int const MatLay( construct.LayerPoint( Lay ) );
+			auto const & mat( Material( MatLay ) );
+			auto const TD_i( TD( i ) );
+			auto const TDT_i( TDT( i ) );
+			Real64 const ktA1( LayerConductivity( MatLay, ( TDT_i + TDT( i + 1 ) ) / 2.0 ) ); // Outer conductivity
+			Real64 const ktA2( LayerConductivity( MatLay, ( TDT( i - 1 ) + TDT_i ) / 2.0 ) ); // Inner conductivity
+			Real64 const Cp( TempEnthSum( MatLay ) >= 0.0 ? PhaseChangeCp( MatLay, mat.SpecHeat, i, false ) : mat.SpecHeat );
+			Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
+			Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * mat.Density / Delt );
+			if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
+				Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
+				Lower( i ) = -ktA2 * inv2DelX;
+				Diag( i ) = ( ktA1 + ktA2 ) * inv2DelX + Cp_DelX_RhoS_Delt;
+				Upper( i ) = -ktA1 * inv2DelX;
+				RHS( i ) = Cp_DelX_RhoS_Delt * TD_i + ( ktA1 * ( TD( i + 1 ) - TD_i ) + ktA2 * ( TD( i - 1 ) - TD_i ) ) * inv2DelX;
+			} else {
+				Real64 const invDelX( 1.0 / DelX );
+				Lower( i ) = -ktA2 * invDelX;
+				Diag( i ) = ( ktA1 + ktA2 ) * invDelX + Cp_DelX_RhoS_Delt;
+				Upper( i ) = -ktA1 * invDelX;
+				RHS( i ) = Cp_DelX_RhoS_Delt * TD_i;
+			}
+		};
+
+		// Node at the interface of layers Lay and Lay + 1
+		auto InterfaceRow = [&]( int const i, int const Lay ) {
+			int const MatLay( construct.LayerPoint( Lay ) );
+			auto const & mat( Material( MatLay ) );
+			int const MatLay2( construct.LayerPoint( Lay + 1 ) );
+			auto const & mat2( Material( MatLay2 ) );
+			bool const RLayerPresent( mat.ROnly || mat.Group == 1 );
+			bool const RLayer2Present( mat2.ROnly || mat2.Group == 1 );
+			Real64 const Rlayer( mat.Resistance );
+			Real64 const Rlayer2( mat2.Resistance );
+
+			if ( RLayerPresent && RLayer2Present ) { // Two adjacent R layers
+				Lower( i ) = -Rlayer2;
+				Diag( i ) = Rlayer + Rlayer2;
+				Upper( i ) = -Rlayer;
+				RHS( i ) = 0.0;
+				return;
+			}
+
+			auto const TD_i( TD( i ) );
+			auto const TDT_i( TDT( i ) );
+			Real64 const kt1( RLayerPresent ? 0.0 : LayerConductivity( MatLay, ( TDT_i + TDT( i - 1 ) ) / 2.0 ) );
+			Real64 const kt2( RLayer2Present ? 0.0 : LayerConductivity( MatLay2, ( TDT_i + TDT( i + 1 ) ) / 2.0 ) );
+			Real64 const matFD_sum( TempEnthSum( MatLay ) );
+			Real64 const matFD2_sum( TempEnthSum( MatLay2 ) );
+			Real64 const Delx1( ConstructFD( ConstrNum ).DelX( Lay ) );
+			Real64 const Delx2( ConstructFD( ConstrNum ).DelX( Lay + 1 ) );
+			Real64 const QSSFlux( ( surface.Area > 0.0 ) && ( construct.SourceSinkPresent && Lay == construct.SourceAfterLayer ) ? ( QRadSysSource( Surf ) + QPVSysSource( Surf ) ) / surface.Area : 0.0 ); // Source/Sink flux value at a layer interface // Includes QPV Source
+
+			if ( RLayerPresent ) { // R-layer first
+				Real64 const Cp2( ( matFD_sum < 0.0 ) && ( matFD2_sum > 0.0 ) ? PhaseChangeCp( MatLay2, mat2.SpecHeat, i, true ) : mat2.SpecHeat );
+				Real64 const Delt_Delx2( Delt * Delx2 );
+				Real64 const Cp2_fac( Cp2 * pow_2( Delx2 ) * mat2.Density * Rlayer );
+				Real64 const Delt_kt2_Rlayer( Delt * kt2 * Rlayer );
+				if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
+					Lower( i ) = -Delt_Delx2;
+					Diag( i ) = Delt_Delx2 + Delt_kt2_Rlayer + Cp2_fac;
+					Upper( i ) = -Delt_kt2_Rlayer;
+					RHS( i ) = 2.0 * Delt_Delx2 * QSSFlux * Rlayer + ( Cp2_fac - Delt_Delx2 - Delt_kt2_Rlayer ) * TD_i + Delt_Delx2 * TD( i - 1 ) + Delt_kt2_Rlayer * TD( i + 1 );
+				} else {
+					Lower( i ) = -2.0 * Delt_Delx2;
+					Diag( i ) = 2.0 * Delt_Delx2 + 2.0 * Delt_kt2_Rlayer + Cp2_fac;
+					Upper( i ) = -2.0 * Delt_kt2_Rlayer;
+					RHS( i ) = 2.0 * Delt_Delx2 * QSSFlux * Rlayer + Cp2_fac * TD_i;
+				}
+			} else if ( RLayer2Present ) { // R-layer second
+				Real64 const Cp1( ( matFD_sum > 0.0 ) && ( matFD2_sum < 0.0 ) ? PhaseChangeCp( MatLay, mat.SpecHeat, i, true ) : mat.SpecHeat );
+				Real64 const Delt_Delx1( Delt * Delx1 );
+				Real64 const Cp1_fac( Cp1 * pow_2( Delx1 ) * mat.Density * Rlayer2 );
+				Real64 const Delt_kt1_Rlayer2( Delt * kt1 * Rlayer2 );
+				if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
+					Lower( i ) = -Delt_kt1_Rlayer2;
+					Diag( i ) = Delt_Delx1 + Delt_kt1_Rlayer2 + Cp1_fac;
+					Upper( i ) = -Delt_Delx1;
+					RHS( i ) = 2.0 * Delt_Delx1 * QSSFlux * Rlayer2 + ( Cp1_fac - Delt_Delx1 - Delt_kt1_Rlayer2 ) * TD_i + Delt_Delx1 * TD( i + 1 ) + Delt_kt1_Rlayer2 * TD( i - 1 );
+				} else {
+					Lower( i ) = -2.0 * Delt_kt1_Rlayer2;
+					Diag( i ) = 2.0 * Delt_Delx1 + 2.0 * Delt_kt1_Rlayer2 + Cp1_fac;
+					Upper( i ) = -2.0 * Delt_Delx1;
+					RHS( i ) = 2.0 * Delt_Delx1 * QSSFlux * Rlayer2 + Cp1_fac * TD_i;
+				}
+			} else { // Regular or Phase Change on both sides of interface
+				Real64 const Cp1( ( matFD_sum > 0.0 ) && ( matFD2_sum != 0.0 ) ? PhaseChangeCp( MatLay, mat.SpecHeat, i, true ) : mat.SpecHeat );
+				Real64 const Cp2( ( matFD_sum != 0.0 ) && ( matFD2_sum > 0.0 ) ? PhaseChangeCp( MatLay2, mat2.SpecHeat, i, true ) : mat2.SpecHeat );
+				Real64 const Delt_Delx1( Delt * Delx1 );
+				Real64 const Delt_Delx1_kt2( Delt_Delx1 * kt2 );
+				Real64 const Delt_Delx2_kt1( Delt * Delx2 * kt1 );
+				Real64 const Delt_sum( Delt_Delx1_kt2 + Delt_Delx2_kt1 );
+				Real64 const Cp_fac( Cp1 * pow_2( Delx1 ) * Delx2 * mat.Density + Cp2 * Delx1 * pow_2( Delx2 ) * mat2.Density );
+				if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
+					Lower( i ) = -Delt_Delx2_kt1;
+					Diag( i ) = Delt_sum + Cp_fac;
+					Upper( i ) = -Delt_Delx1_kt2;
+					RHS( i ) = 2.0 * Delt_Delx1 * Delx2 * QSSFlux + ( Cp_fac - Delt_sum ) * TD_i + Delt_Delx1_kt2 * TD( i + 1 ) + Delt_Delx2_kt1 * TD( i - 1 );
+				} else {
+					Lower( i ) = -2.0 * Delt_Delx2_kt1;
+					Diag( i ) = 2.0 * ( Delt_Delx2_kt1 + Delt_Delx1_kt2 ) + Cp_fac;
+					Upper( i ) = -2.0 * Delt_Delx1_kt2;
+					RHS( i ) = 2.0 * Delt_Delx1 * Delx2 * QSSFlux + Cp_fac * TD_i;
+				}
+			}
+		};
+
+		// Inside surface node
+		auto InteriorBCRow = [&]( int const i, int const Lay ) {
+			Real64 const QFac( NetLWRadToSurf( Surf ) + QHTRadSysSurf( Surf ) + QHWBaseboardSurf( Surf ) + QSteamBaseboardSurf( Surf ) + QElecBaseboardSurf( Surf ) + QRadSWInAbs( Surf ) + QRadThermInAbs( Surf ) + QCoolingPanelSurf( Surf ) );
+			Real64 const hconvi( HConvInFD( Surf ) );
+			Real64 const Tia( MAT( surface.Zone ) );
+			Upper( i ) = 0.0;
+
+			int const MatLay( construct.LayerPoint( Lay ) );
+			auto const & mat( Material( MatLay ) );
+			if ( mat.ROnly || mat.Group == 1 ) { // R Layer or Air Layer
+				Real64 const IterDampConst( 5.0 ); // Damping constant for inside surface temperature iterations, as InteriorBCEqns
+				Real64 const Rlayer( mat.Resistance );
+				Lower( i ) = -1.0;
+				Diag( i ) = 1.0 + ( hconvi + IterDampConst ) * Rlayer;
+				RHS( i ) = ( QFac + hconvi * Tia + surfaceFD.TDreport( i ) * IterDampConst ) * Rlayer;
+				return;
+			}
+
+			auto const TD_i( TD( i ) );
+			auto const TDT_i( TDT( i ) );
+			Real64 kt( mat.Conductivity ); // 20C base conductivity
+			auto const & matFD( MaterialFD( MatLay ) );
+			auto const & matFD_TempCond( matFD.TempCond );
+			auto const lTC( matFD_TempCond.index( 2, 1 ) );
+			if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
+				Linear = false;
+				kt = terpld( matFD_TempCond, ( TDT_i + TDT( i - 1 ) ) / 2.0, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
+			} else if ( matFD.tk1 != 0.0 ) { // same expression as InteriorBCEqns
+				Linear = false;
+				kt = matFD.tk1 * ( ( TDT_i + TDT( i - 1 ) ) / 2.0 - 20.0 );
+			}
+			Real64 const Cp( TempEnthSum( MatLay ) >= 0.0 ? PhaseChangeCp( MatLay, mat.SpecHeat, i, true ) : mat.SpecHeat );
+			Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
+			Real64 const Delt_DelX( Delt * DelX );
+			Real64 const Two_Delt_DelX( 2.0 * Delt_DelX );
+			Real64 const Delt_kt( Delt * kt );
+			Real64 const Cp_DelX2_RhoS( Cp * pow_2( DelX ) * mat.Density );
+			if ( CondFDSchemeType == CrankNicholsonSecondOrder ) {
+				Lower( i ) = -Delt_kt;
+				Diag( i ) = Delt_DelX * hconvi + Delt_kt + Cp_DelX2_RhoS;
+				RHS( i ) = Two_Delt_DelX * ( QFac + hconvi * Tia ) + ( Cp_DelX2_RhoS - Delt_DelX * hconvi - Delt_kt ) * TD_i + Delt_kt * TD( i - 1 );
+			} else {
+				Real64 const Two_Delt_kt( 2.0 * Delt_kt );
+				Lower( i ) = -Two_Delt_kt;
+				Diag( i ) = Two_Delt_DelX * hconvi + Two_Delt_kt + Cp_DelX2_RhoS;
+				RHS( i ) = Two_Delt_DelX * ( QFac + hconvi * Tia ) + Cp_DelX2_RhoS * TD_i;
+			}
+		};
+
+		// Same node order as the Gauss-Seidel sweep in CalcHeatBalFiniteDiff
+		int i( 1 ); //  Node counter
+		for ( int Lay = 1; Lay <= TotLayers; ++Lay ) {
+			if ( ( i == 1 ) && ( Lay == 1 ) ) {
+				ExteriorRow( i, Lay );
+			}
+			if ( TotNodes != 1 ) {
+				for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
+					++i;
+					InteriorRow( i, Lay );
+				}
+			}
+			if ( ( Lay < TotLayers ) && ( TotNodes != 1 ) ) {
+				++i;
+				InterfaceRow( i, Lay );
+			} else if ( Lay == TotLayers ) {
+				++i;
+				InteriorBCRow( i, Lay );
+			}
+		}
+
+		return Linear;
+	}
+
+	void
+	SolveTridiagonal(
+		Array1< Real64 > const & Lower, // Coefficients of x(i-1), Lower(1) not used
+		Array1< Real64 > const & Diag, // Coefficients of x(i)
+		Array1< Real64 > & Upper, // Coefficients of x(i+1), Upper(n) not used; overwritten
+		Array1< Real64 > & RHS, // Right hand sides; overwritten
+		Array1< Real64 > & X // Solution
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solve a tridiagonal system by forward elimination and back substitution (Thomas algorithm).
+
+		// METHODOLOGY EMPLOYED:
+		// No pivoting: the node equations are diagonally dominant.
+
+		int const n( X.u() );
+		assert( X.l() == 1 );
+		assert( ( Lower.u() >= n ) && ( Diag.u() >= n ) && ( Upper.u() >= n ) && ( RHS.u() >= n ) );
+
+		Upper( 1 ) /= Diag( 1 );
+		RHS( 1 ) /= Diag( 1 );
+		for ( int i = 2; i <= n; ++i ) {
+			Real64 const m( 1.0 / ( Diag( i ) - Lower( i ) * Upper( i - 1 ) ) );
+			Upper( i ) *= m;
+			RHS( i ) = ( RHS( i ) - Lower( i ) * RHS( i - 1 ) ) * m;
+		}
+		X( n ) = RHS( n );
+		for ( int i = n - 1; i >= 1; --i ) {
+			X( i ) = RHS( i ) - Upper( i ) * X( i + 1 );
+		}
+	}
+
 	void
 	ReportFiniteDiffInits()
 	{
@@ -1353,8 +1810,8 @@ namespace HeatBalFiniteDiffManager {
 		static gio::Fmt Format_701( "(' Material CondFD Summary,',A,',',A,',',A,',',A,',',A,',',A)" );
 		static gio::Fmt Format_702( "(' ConductionFiniteDifference Node,',A,',',A,',',A,',',A,',',A)" );
 
-		gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference HeatBalanceSettings>,Scheme Type,Space Discretization Constant,Relaxation Factor,Inside Face Surface Temperature Convergence Criteria";
-		gio::write( OutputFileInits, fmtA ) << " ConductionFiniteDifference HeatBalanceSettings," + cCondFDSchemeType( CondFDSchemeType ) + ',' + RoundSigDigits( SpaceDescritConstant, 2 ) + ',' + RoundSigDigits( CondFDRelaxFactorInput, 2 ) + ',' + RoundSigDigits( MaxAllowedDelTempCondFD, 4 );
+		gio::write( OutputFileInits, fmtA ) << "! <ConductionFiniteDifference HeatBalanceSettings>,Scheme Type,Space Discretization Constant,Relaxation Factor,Inside Face Surface Temperature Convergence Criteria,Solution Method";
+		gio::write( OutputFileInits, fmtA ) << " ConductionFiniteDifference HeatBalanceSettings," + cCondFDSchemeType( CondFDSchemeType ) + ',' + RoundSigDigits( SpaceDescritConstant, 2 ) + ',' + RoundSigDigits( CondFDRelaxFactorInput, 2 ) + ',' + RoundSigDigits( MaxAllowedDelTempCondFD, 4 ) + ',' + cCondFDSolutionType( CondFDSolutionType );
 		ScanForReports( "Constructions", DoReport, "Constructions" );
 
 		if ( DoReport ) {
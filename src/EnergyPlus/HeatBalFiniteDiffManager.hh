@@ -70,6 +70,10 @@ namespace HeatBalFiniteDiffManager {
 	extern int const FullyImplicitFirstOrder; // fully implicit scheme, first order in time.
 	extern Array1D_string const cCondFDSchemeType;
 
+	extern int const GaussSeidelIteration; // original CondFD solver.  node equations updated one at a time until converged
+	extern int const TridiagonalDirect; // node equations of a surface solved together by tridiagonal elimination
+	extern Array1D_string const cCondFDSolutionType;
+
 	extern Real64 const TempInitValue; // Initialization value for Temperature
 	extern Real64 const RhovInitValue; // Initialization value for Rhov
 	extern Real64 const EnthInitValue; // Initialization value for Enthalpy
@@ -104,6 +108,7 @@ namespace HeatBalFiniteDiffManager {
 	//                                                                 ! before CR 8280 -- Qdryout         !HeatFlux on Surface for reporting for Sensible only
 
 	extern int CondFDSchemeType; // solution scheme for CondFD - default
+	extern int CondFDSolutionType; // solver for the node equations of CondFD - default
 	extern Real64 SpaceDescritConstant; // spatial descritization constant,
 	extern Real64 MinTempLimit; // lower limit check, degree C
 	extern Real64 MaxTempLimit; // upper limit check, degree C
@@ -170,6 +175,10 @@ namespace HeatBalFiniteDiffManager {
 		Array1D< Real64 > CpDelXRhoS1; // Current outer half-node Cp * DelX * RhoS / Delt
 		Array1D< Real64 > CpDelXRhoS2; // Current inner half-node Cp * DelX * RhoS / Delt
 		Array1D< Real64 > TDpriortimestep; // Node temperatures from previous timestep
+		Array1D< Real64 > NodeLower; // Node equation coefficient of the outer neighbor node temperature (TridiagonalDirect)
+		Array1D< Real64 > NodeDiag; // Node equation coefficient of the node temperature (TridiagonalDirect)
+		Array1D< Real64 > NodeUpper; // Node equation coefficient of the inner neighbor node temperature (TridiagonalDirect)
+		Array1D< Real64 > NodeRHS; // Node equation constant (TridiagonalDirect)
 		int SourceNodeNum; // Node number for internal source layer (zero if no source)
 		Real64 QSource; // Internal source flux [W/m2]
 		int GSloopCounter; // count of inner loop iterations
@@ -256,6 +265,22 @@ namespace HeatBalFiniteDiffManager {
 		Real64 & TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
 	);
 
+	bool
+	AssembleNodeEqns(
+		int const Delt, // Time Increment
+		int const Surf, // Surface number
+		Real64 const HMovInsul // Conductance of movable(transparent) insulation.
+	);
+
+	void
+	SolveTridiagonal(
+		Array1< Real64 > const & Lower, // Coefficients of x(i-1), Lower(1) not used
+		Array1< Real64 > const & Diag, // Coefficients of x(i)
+		Array1< Real64 > & Upper, // Coefficients of x(i+1), Upper(n) not used; overwritten
+		Array1< Real64 > & RHS, // Right hand sides; overwritten
+		Array1< Real64 > & X // Solution
+	);
+
 	// Beginning of Reporting subroutines
 	// *****************************************************************************
 
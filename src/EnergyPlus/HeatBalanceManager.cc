@@ -58,6 +58,7 @@
 
 // EnergyPlus Headers
 #include <HeatBalanceManager.hh>
+#include <ColumnarOutput.hh>
 #include <ConductionTransferFunctionCalc.hh>
 #include <DataBSDFWindow.hh>
 #include <DataComplexFenestration.hh>
@@ -75,6 +76,7 @@
 #include <DataStringGlobals.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataWindowEquivalentLayer.hh>
 #include <DaylightingDevices.hh>
 #include <DaylightingManager.hh>
@@ -85,12 +87,14 @@
 #include <HeatBalanceSurfaceManager.hh>
 #include <HVACSizingSimulationManager.hh>
 #include <InputProcessor.hh>
+#include <NameIndex.hh>
 #include <InternalHeatGains.hh>
 #include <MatrixDataManager.hh>
 #include <NodeInputManager.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportTabular.hh>
 #include <ScheduleManager.hh>
+#include <SimulationCheckpoint.hh>
 #include <SolarShading.hh>
 #include <SurfaceGeometry.hh>
 #include <SurfaceOctree.hh>
@@ -302,6 +306,8 @@ namespace HeatBalanceManager {
 		using namespace HeatBalanceSurfaceManager;
 		using EMSManager::ManageEMS;
 		using EMSManager::UpdateEMSTrendVariables;
+		using SimulationCheckpoint::RestoreCheckpoint;
+		using SimulationCheckpoint::SaveCheckpoint;
 		using DataGlobals::emsCallFromEndZoneTimestepBeforeZoneReporting;
 		using DataGlobals::emsCallFromEndZoneTimestepAfterZoneReporting;
 		using DataGlobals::emsCallFromBeginNewEvironmentAfterWarmUp;
@@ -326,6 +332,8 @@ namespace HeatBalanceManager {
 
 		// FLOW:
 
+		EP_PROFILE_ZONE( "ManageHeatBalance" );
+
 		// Get the heat balance input at the beginning of the simulation only
 		if ( ManageHeatBalanceGetInputFlag ) {
 			GetHeatBalanceInput(); // Obtains heat balance related parameters from input file
@@ -371,11 +379,16 @@ namespace HeatBalanceManager {
 
 		if ( WarmupFlag && EndDayFlag ) {
 
-			CheckWarmupConvergence();
+			if ( DayOfSim == 1 && RestoreCheckpoint() ) {
+				WarmupFlag = false; // Resume from the state saved at the end of an earlier warmup
+			} else {
+				CheckWarmupConvergence();
+			}
 			if ( ! WarmupFlag ) {
 				DayOfSim = 0; // Reset DayOfSim if Warmup converged
 				DayOfSimChr = "0";
 
+				SaveCheckpoint();
 				ManageEMS( emsCallFromBeginNewEvironmentAfterWarmUp, anyRan ); // calling point
 			}
 
@@ -521,6 +534,7 @@ namespace HeatBalanceManager {
 		int CNum;
 		int ONum;
 		bool InErrFlag; // Preserve (no current use) the input status of ErrorsFound
+		NameIndex const ConstructIndex( Construct, Construct.isize() ); // Index of the Construct names
 
 		InErrFlag = ErrorsFound;
 
@@ -530,9 +544,9 @@ namespace HeatBalanceManager {
 			for ( Loop = 1; Loop <= NumObjects; ++Loop ) {
 				GetObjectItem( ConstrObjects( ONum ), Loop, cAlphaArgs, NumAlphas, rNumericArgs, NumNumbers, Status );
 				if ( ONum != 5 ) {
-					CNum = FindItemInList( cAlphaArgs( 2 ), Construct );
+					CNum = ConstructIndex.find( cAlphaArgs( 2 ) );
 				} else {
-					CNum = FindItemInList( cAlphaArgs( 4 ), Construct );
+					CNum = ConstructIndex.find( cAlphaArgs( 4 ) );
 				}
 				if ( CNum == 0 ) continue;
 				Construct( CNum ).IsUsed = true;
@@ -3670,6 +3684,7 @@ namespace HeatBalanceManager {
 
 		int iMatGlass; // number of glass layers
 		Array1D_string WConstructNames;
+		NameIndex MaterialIndex; // Index of the Material names for the layer lookups
 
 		// FLOW:
 
@@ -3743,7 +3758,7 @@ namespace HeatBalanceManager {
 
 				//Find the material in the list of materials
 
-				Construct( ConstrNum ).LayerPoint( Layer ) = FindItemInList( ConstructAlphas( Layer ), Material );
+				Construct( ConstrNum ).LayerPoint( Layer ) = MaterialIndex.find( ConstructAlphas( Layer ), Material, Material.isize() );
 
 				// count number of glass layers
 				if ( Construct( ConstrNum ).LayerPoint( Layer ) > 0 ) {
@@ -3867,7 +3882,7 @@ namespace HeatBalanceManager {
 
 				//Find the material in the list of materials
 
-				Construct( TotRegConstructs + ConstrNum ).LayerPoint( Layer ) = FindItemInList( ConstructAlphas( Layer ), Material );
+				Construct( TotRegConstructs + ConstrNum ).LayerPoint( Layer ) = MaterialIndex.find( ConstructAlphas( Layer ), Material, Material.isize() );
 
 				if ( Construct( TotRegConstructs + ConstrNum ).LayerPoint( Layer ) == 0 ) {
 					ShowSevereError( "Did not find matching material for " + CurrentModuleObject + ' ' + Construct( ConstrNum ).Name + ", missing material = " + ConstructAlphas( Layer ) );
@@ -3923,7 +3938,7 @@ namespace HeatBalanceManager {
 			for ( Layer = 1; Layer <= ConstructNumAlpha - 1; ++Layer ) {
 
 				//Find the material in the list of materials
-				Construct( TotRegConstructs + ConstrNum ).LayerPoint( Layer ) = FindItemInList( ConstructAlphas( Layer ), Material );
+				Construct( TotRegConstructs + ConstrNum ).LayerPoint( Layer ) = MaterialIndex.find( ConstructAlphas( Layer ), Material, Material.isize() );
 
 				if ( Construct( TotRegConstructs + ConstrNum ).LayerPoint( Layer ) == 0 ) {
 					ShowSevereError( "Did not find matching material for " + CurrentModuleObject + ' ' + Construct( ConstrNum ).Name + ", missing material = " + ConstructAlphas( Layer ) );
@@ -4120,6 +4135,7 @@ namespace HeatBalanceManager {
 		int GroupNum;
 		bool ErrorInName;
 		bool IsBlank;
+		NameIndex ZoneIndex; // Index of the Zone names for the zone list lookups
 
 		cCurrentModuleObject = "Zone";
 		NumOfZones = GetNumObjectsFound( cCurrentModuleObject );
@@ -4190,7 +4206,7 @@ namespace HeatBalanceManager {
 				}
 
 				ZoneList( ListNum ).Name = cAlphaArgs( 1 );
-				if ( FindItemInList( ZoneList( ListNum ).Name, Zone ) > 0 ) {
+				if ( ZoneIndex.find( ZoneList( ListNum ).Name, Zone, Zone.isize() ) > 0 ) {
 					ShowWarningError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\":  is a duplicate of a zone name." );
 					ShowContinueError( "This could be a problem in places where either a Zone Name or a Zone List can be used." );
 				}
@@ -4208,7 +4224,7 @@ namespace HeatBalanceManager {
 					for ( ZoneNum = 1; ZoneNum <= ZoneList( ListNum ).NumOfZones; ++ZoneNum ) {
 						ZoneName = cAlphaArgs( ZoneNum + 1 );
 						ZoneList( ListNum ).MaxZoneNameLength = max( ZoneList( ListNum ).MaxZoneNameLength, len( ZoneName ) );
-						ZoneList( ListNum ).Zone( ZoneNum ) = FindItemInList( ZoneName, Zone );
+						ZoneList( ListNum ).Zone( ZoneNum ) = ZoneIndex.find( ZoneName, Zone, Zone.isize() );
 						if ( ZoneList( ListNum ).Zone( ZoneNum ) == 0 ) {
 							ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\":  " + cAlphaFieldNames( ZoneNum + 1 ) + ' ' + ZoneName + " not found." );
 							ErrorsFound = true;
@@ -5134,6 +5150,7 @@ namespace HeatBalanceManager {
 			}
 			if ( ! BeginDayFlag ) PrintEnvrnStampWarmupPrinted = false;
 			if ( PrintEnvrnStampWarmup ) {
+				OutputProcessor::FlushOutputWriter(); // The stamps follow any queued report lines
 				if ( PrintEndDataDictionary && DoOutputReporting ) {
 					gio::write( OutputFileStandard, EndOfHeaderFormat );
 					gio::write( OutputFileMeters, EndOfHeaderFormat );
@@ -5142,6 +5159,7 @@ namespace HeatBalanceManager {
 				if ( DoOutputReporting ) {
 					gio::write( OutputFileStandard, EnvironmentStampFormat ) << "1" << "Warmup {" + cWarmupDay + "} " + EnvironmentName << Latitude << Longitude << TimeZoneNumber << Elevation;
 					gio::write( OutputFileMeters, EnvironmentStampFormat ) << "1" << "Warmup {" + cWarmupDay + "} " + EnvironmentName << Latitude << Longitude << TimeZoneNumber << Elevation;
+					if ( ColumnarOutput::Active ) ColumnarOutput::BeginEnvironment( "Warmup {" + cWarmupDay + "} " + EnvironmentName, Latitude, Longitude, TimeZoneNumber, Elevation );
 					PrintEnvrnStampWarmup = false;
 				}
 			}
@@ -48,6 +48,8 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <memory>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -62,6 +64,7 @@
 #include <CommandLineInterface.hh>
 #include <ConvectionCoefficients.hh>
 #include <ChilledCeilingPanelSimple.hh>
+#include <CTFHistoryStore.hh>
 #include <DataAirflowNetwork.hh>
 #include <DataDaylighting.hh>
 #include <DataDaylightingDevices.hh>
@@ -113,6 +116,7 @@
 #include <SteamBaseboardRadiator.hh>
 #include <SwimmingPool.hh>
 #include <ThermalComfort.hh>
+#include <ThreadPool.hh>
 #include <UtilityRoutines.hh>
 #include <WindowEquivalentLayer.hh>
 #include <WindowManager.hh>
@@ -182,6 +186,24 @@ namespace HeatBalanceSurfaceManager {
 		bool UpdateThermalHistoriesFirstTimeFlag( true );
 		bool CalculateZoneMRTfirstTime( true ); // Flag for first time calculations
 		bool calcHeatBalanceInsideSurfFirstTime( true ); // Used for trapping errors or other problems
+		std::unique_ptr< ThreadPool > surfaceHeatBalancePool; // Threads for the concurrent zone surface heat balances
+		std::vector< std::vector< int > > ZoneOutsideFaces; // Outside faces of each zone that are done concurrently
+		std::vector< int > SerialOutsideFaces; // Outside faces done one at a time, in surface order, after the concurrent ones
+		std::vector< std::vector< int > > ZoneInsideFaces; // Inside faces of each zone that are done concurrently
+		std::vector< int > SerialInsideFaces; // Inside faces done one at a time, in surface order, after the concurrent ones
+		std::vector< int > ConcurrentCondFDFaces; // CondFD surfaces solved concurrently ahead of the serial inside face loop
+		Array1D_bool CondFDSolvedAhead; // True if the surface's CondFD solution of this iteration is already done
+		Array1D< Real64 > CondFDTempSurfOut; // Outside face temperature from the CondFD solution done ahead
+		CTFHistoryStore CTFHistories; // Packed CTF histories of the opaque surfaces without sources/sinks
+
+		// Threads for the concurrent zone surface heat balances (started on first use)
+		ThreadPool &
+		SurfaceHeatBalancePool()
+		{
+			using DataSystemVariables::NumberSurfaceHeatBalanceThreads;
+			if ( ! surfaceHeatBalancePool ) surfaceHeatBalancePool.reset( new ThreadPool( NumberSurfaceHeatBalanceThreads ) );
+			return *surfaceHeatBalancePool;
+		}
 	}
 	// DERIVED TYPE DEFINITIONS:
 	// na
@@ -216,6 +238,30 @@ namespace HeatBalanceSurfaceManager {
 		UpdateThermalHistoriesFirstTimeFlag = true;
 		CalculateZoneMRTfirstTime = true;
 		calcHeatBalanceInsideSurfFirstTime = true;
+		surfaceHeatBalancePool.reset();
+		ZoneOutsideFaces.clear();
+		SerialOutsideFaces.clear();
+		ZoneInsideFaces.clear();
+		SerialInsideFaces.clear();
+		ConcurrentCondFDFaces.clear();
+		CondFDSolvedAhead.deallocate();
+		CondFDTempSurfOut.deallocate();
+		CTFHistories.clear();
+	}
+
+	void
+	UnpackCTFHistories()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the packed CTF histories back to TH, QH, THM and QHM and drops the packing, so that
+		// the history arrays can be saved or replaced from outside (simulation checkpoints).
+
+		// METHODOLOGY EMPLOYED:
+		// The next call to CalcHeatBalanceOutsideSurf packs the histories again.
+
+		CTFHistories.unpack();
+		CTFHistories.clear();
 	}
 
 	void
@@ -263,6 +309,8 @@ namespace HeatBalanceSurfaceManager {
 		int ConstrNum;
 
 		// FLOW:
+		EP_PROFILE_ZONE( "ManageSurfaceHeatBalance" );
+
 		if ( ManageSurfaceHeatBalancefirstTime ) DisplayString( "Initializing Surfaces" );
 		InitSurfaceHeatBalance(); // Initialize all heat balance related parameters
 
@@ -699,12 +747,17 @@ namespace HeatBalanceSurfaceManager {
 			CTFTsrcConstPart = 0.0;
 			CTFTuserConstPart = 0.0;
 		}
+		if ( ! CTFHistories.built() || CTFHistories.stale() ) { // Pack (again after an EMS construction change)
+			CTFHistories.unpack();
+			CTFHistories.build();
+		}
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
 			auto const & surface( Surface( SurfNum ) );
 
 			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 			if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) continue;
 			if ( surface.Class == SurfaceClass_Window ) continue;
+			if ( CTFHistories.packed( SurfNum ) ) continue; // Summed by construction below
 			// Outside surface temp of "normal" windows not needed in Window5 calculation approach
 			// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
 
@@ -773,6 +826,7 @@ namespace HeatBalanceSurfaceManager {
 			}
 
 		} // ...end of surfaces DO loop for initializing temperature history terms for the surface heat balances
+		CTFHistories.sumConstParts( CTFConstOutPart, CTFConstInPart );
 
 		// Zero out all of the radiant system heat balance coefficient arrays
 		RadSysTiHBConstCoef = 0.0;
@@ -1729,6 +1783,8 @@ namespace HeatBalanceSurfaceManager {
 			}
 		}
 
+		CTFHistories.clear(); // Packed again from the new histories
+
 	}
 
 	void
@@ -4079,6 +4135,7 @@ namespace HeatBalanceSurfaceManager {
 
 			if ( surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome || ! surface.HeatTransSurf ) continue;
 			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_TDD ) ) continue;
+			if ( CTFHistories.packed( SurfNum ) ) continue; // Shifted by construction below
 
 			int const ConstrNum( surface.Construction );
 			auto const & construct( Construct( ConstrNum ) );
@@ -4217,6 +4274,7 @@ namespace HeatBalanceSurfaceManager {
 			}
 
 		} // ...end of loop over all (heat transfer) surfaces
+		CTFHistories.updateHistories( TempExt1, TempInt1, QExt1, QInt1 );
 
 	}
 
@@ -4541,25 +4599,13 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 	using ScheduleManager::GetScheduleIndex;
 	using namespace Psychrometrics;
 	using EcoRoofManager::CalcEcoRoof;
+	using ConvectionCoefficients::GetUserSuppliedConvectionCoeffs;
+	using DataSystemVariables::NumberSurfaceHeatBalanceThreads;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
 
 	// SUBROUTINE PARAMETER DEFINITIONS:
-	static std::string const RoutineName( "CalcHeatBalanceOutsideSurf" );
-	static std::string const RoutineNameGroundTemp( "CalcHeatBalanceOutsideSurf:GroundTemp" );
-	static std::string const RoutineNameGroundTempFC( "CalcHeatBalanceOutsideSurf:GroundTempFC" );
-	static std::string const RoutineNameOtherSideCoefNoCalcExt( "CalcHeatBalanceOutsideSurf:OtherSideCoefNoCalcExt" );
-	static std::string const RoutineNameOtherSideCoefCalcExt( "CalcHeatBalanceOutsideSurf:OtherSideCoefCalcExt" );
-	static std::string const RoutineNameOSCM( "CalcHeatBalanceOutsideSurf:OSCM" );
-	static std::string const RoutineNameExtEnvWetSurf( "CalcHeatBalanceOutsideSurf:extEnvWetSurf" );
-	static std::string const RoutineNameExtEnvDrySurf( "CalcHeatBalanceOutsideSurf:extEnvDrySurf" );
-	static std::string const RoutineNameNoWind( "CalcHeatBalanceOutsideSurf:nowind" );
-	static std::string const RoutineNameOther( "CalcHeatBalanceOutsideSurf:interior/other" );
-	static std::string const RoutineNameIZPart( "CalcHeatBalanceOutsideSurf:IZPart" );
-	static std::string const HBSurfManGroundHAMT( "HBSurfMan:Ground:HAMT" );
-	static std::string const HBSurfManRainHAMT( "HBSurfMan:Rain:HAMT" );
-	static std::string const HBSurfManDrySurfCondFD( "HBSurfMan:DrySurf:CondFD" );
 	static std::string const Outside( "Outside" );
 	static std::string const BlankString;
 
@@ -4570,27 +4616,13 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	Real64 AbsThermSurf; // Thermal absoptance of the exterior surface
-	int ConstrNum; // Construction index for the current surface
-	Real64 HGround; // "Convection" coefficient from ground to surface
-	Real64 HMovInsul; // "Convection" coefficient of movable insulation
-	Real64 HSky; // "Convection" coefficient from sky to surface
-	Real64 HAir; // "Convection" coefficient from air to surface (radiation)
-	Real64 ConstantTempCoef; // Temperature Coefficient as input or modified using sine wave  COP mod
-	int RoughSurf; // Roughness index of the exterior surface
 	int SurfNum; // Surface number DO loop counter
-	Real64 TempExt; // Exterior temperature boundary condition
 	int ZoneNum; // Zone number the current surface is attached to
-	int OPtr;
-	Real64 RhoVaporSat; // Local temporary saturated vapor density for checking
-	bool MovInsulErrorFlag; // Movable Insulation error flag
 
 	// FUNCTION DEFINITIONS:
 	// na
 
 	// FLOW:
-	MovInsulErrorFlag = false;
-
 	if ( AnyConstructInternalSourceInInput ) {
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			// Need to transfer any source/sink for a surface to the local array.  Note that
@@ -4609,6 +4641,15 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 		CalcInteriorRadExchange( TH( 2, 1, _ ), 0, NetLWRadToSurf, _, Outside );
 	}
 
+	// Zones run concurrently: surfaces whose outside face only involves their own data are shared out by zone
+	// and the others are done afterwards in surface order, which gives the same results as the serial loop
+	bool const RunZonesConcurrently( ( NumberSurfaceHeatBalanceThreads > 1 ) && ( ! present( ZoneToResimulate ) ) && ( ! GetUserSuppliedConvectionCoeffs ) );
+	if ( RunZonesConcurrently ) {
+		ZoneOutsideFaces.resize( NumOfZones );
+		for ( auto & faces : ZoneOutsideFaces ) faces.clear();
+		SerialOutsideFaces.clear();
+	}
+
 	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
 
 		ZoneNum = Surface( SurfNum ).Zone;
@@ -4626,307 +4667,383 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 		// For rest, Outside surface temp of windows not needed in Window5 calculation approach.
 		// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
 
-		// Initializations for this surface
-		ConstrNum = Surface( SurfNum ).Construction;
-		HMovInsul = 0.0;
-		HSky = 0.0;
-		HGround = 0.0;
-		HAir = 0.0;
-		HcExtSurf( SurfNum ) = 0.0;
-		HAirExtSurf( SurfNum ) = 0.0;
-		HSkyExtSurf( SurfNum ) = 0.0;
-		HGrdExtSurf( SurfNum ) = 0.0;
-
-		// Calculate the current outside surface temperature TH(SurfNum,1,1) for the
-		// various different boundary conditions
-		{ auto const SELECT_CASE_var( Surface( SurfNum ).ExtBoundCond );
+		if ( RunZonesConcurrently ) {
+			if ( ConcurrentOutsideFace( SurfNum ) ) {
+				ZoneOutsideFaces[ ZoneNum - 1 ].push_back( SurfNum );
+			} else {
+				SerialOutsideFaces.push_back( SurfNum );
+			}
+		} else {
+			CalcHeatBalanceOutsideSurfFace( SurfNum );
+		}
 
-		if ( SELECT_CASE_var == Ground ) { // Surface in contact with ground
+	} // ...end of DO loop over all surface (actually heat transfer surfaces)
 
-			TH( 1, 1, SurfNum ) = GroundTemp;
+	if ( RunZonesConcurrently ) {
+		SurfaceHeatBalancePool().run( NumOfZones, []( ThreadPool::size_type const iZone ){
+			for ( int const SurfNum : ZoneOutsideFaces[ iZone ] ) CalcHeatBalanceOutsideSurfFace( SurfNum );
+		} );
+		for ( int const SurfNum : SerialOutsideFaces ) CalcHeatBalanceOutsideSurfFace( SurfNum );
+	}
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
+}
 
-			// start HAMT
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the HAMT moisture balance
-				TempOutsideAirFD( SurfNum ) = GroundTemp;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTemp, 1.0, HBSurfManGroundHAMT );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
+void
+CalcHeatBalanceOutsideSurfFace( int const SurfNum ) // Surface number
+{
 
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTemp, PsyWFnTdbRhPb( GroundTemp, 1.0, OutBaroPress, RoutineNameGroundTemp ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTemp ) );
+	// PURPOSE OF THIS SUBROUTINE:
+	// This subroutine performs the heat balance on the outside face of one
+	// heat transfer surface (other than a window) for CalcHeatBalanceOutsideSurf.
 
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
-			// end HAMT
-
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
-				// Set variables used in the FD moisture balance
-				TempOutsideAirFD( SurfNum ) = GroundTemp;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTemp, 1.0 );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTemp, PsyWFnTdbRhPb( GroundTemp, 1.0, OutBaroPress, RoutineNameGroundTemp ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTemp ) );
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
+	// METHODOLOGY EMPLOYED:
+	// This is the body of the surface loop of CalcHeatBalanceOutsideSurf.  It
+	// only writes the entries of SurfNum and of its other side coefficient or
+	// exterior vented cavity objects, so surfaces accepted by ConcurrentOutsideFace
+	// may be done at the same time.
 
-			// Added for FCfactor grounds
-		} else if ( SELECT_CASE_var == GroundFCfactorMethod ) { // Surface in contact with ground
+	// Using/Aliasing
+	using namespace DataPrecisionGlobals;
+	using namespace DataGlobals;
+	using namespace DataEnvironment;
+	using namespace DataHeatBalFanSys;
+	using namespace DataHeatBalance;
+	using namespace DataHeatBalSurface;
+	using namespace DataSurfaces;
+	using DataMoistureBalance::TempOutsideAirFD;
+	using DataMoistureBalance::RhoVaporAirOut;
+	using DataMoistureBalance::RhoVaporAirIn;
+	using DataMoistureBalance::HConvExtFD;
+	using DataMoistureBalance::HMassConvExtFD;
+	using DataMoistureBalance::HConvInFD;
+	using DataMoistureBalance::HMassConvInFD;
+	using DataMoistureBalance::RhoVaporSurfIn;
+	using DataMoistureBalance::HSkyFD;
+	using DataMoistureBalance::HGrndFD;
+	using DataMoistureBalance::HAirFD;
+	using HeatBalanceMovableInsulation::EvalOutsideMovableInsulation;
+	using ConvectionCoefficients::InitExteriorConvectionCoeff;
+	using ConvectionCoefficients::SetExtConvectionCoeff;
+	using ConvectionCoefficients::SetIntConvectionCoeff;
+	using HeatBalanceIntRadExchange::CalcInteriorRadExchange;
+	using ScheduleManager::GetCurrentScheduleValue;
+	using ScheduleManager::GetScheduleIndex;
+	using namespace Psychrometrics;
+	using EcoRoofManager::CalcEcoRoof;
 
-			TH( 1, 1, SurfNum ) = GroundTempFC;
+	// Locals
+	// SUBROUTINE ARGUMENT DEFINITIONS:
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
+	// SUBROUTINE PARAMETER DEFINITIONS:
+	static std::string const RoutineName( "CalcHeatBalanceOutsideSurf" );
+	static std::string const RoutineNameGroundTemp( "CalcHeatBalanceOutsideSurf:GroundTemp" );
+	static std::string const RoutineNameGroundTempFC( "CalcHeatBalanceOutsideSurf:GroundTempFC" );
+	static std::string const RoutineNameOtherSideCoefNoCalcExt( "CalcHeatBalanceOutsideSurf:OtherSideCoefNoCalcExt" );
+	static std::string const RoutineNameOtherSideCoefCalcExt( "CalcHeatBalanceOutsideSurf:OtherSideCoefCalcExt" );
+	static std::string const RoutineNameOSCM( "CalcHeatBalanceOutsideSurf:OSCM" );
+	static std::string const RoutineNameExtEnvWetSurf( "CalcHeatBalanceOutsideSurf:extEnvWetSurf" );
+	static std::string const RoutineNameExtEnvDrySurf( "CalcHeatBalanceOutsideSurf:extEnvDrySurf" );
+	static std::string const RoutineNameNoWind( "CalcHeatBalanceOutsideSurf:nowind" );
+	static std::string const RoutineNameOther( "CalcHeatBalanceOutsideSurf:interior/other" );
+	static std::string const RoutineNameIZPart( "CalcHeatBalanceOutsideSurf:IZPart" );
+	static std::string const HBSurfManGroundHAMT( "HBSurfMan:Ground:HAMT" );
+	static std::string const HBSurfManRainHAMT( "HBSurfMan:Rain:HAMT" );
+	static std::string const HBSurfManDrySurfCondFD( "HBSurfMan:DrySurf:CondFD" );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the HAMT moisture balance
-				TempOutsideAirFD( SurfNum ) = GroundTempFC;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTempFC, 1.0, HBSurfManGroundHAMT );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
+	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+	Real64 AbsThermSurf; // Thermal absoptance of the exterior surface
+	int ConstrNum; // Construction index for the current surface
+	Real64 HGround; // "Convection" coefficient from ground to surface
+	Real64 HMovInsul; // "Convection" coefficient of movable insulation
+	Real64 HSky; // "Convection" coefficient from sky to surface
+	Real64 HAir; // "Convection" coefficient from air to surface (radiation)
+	Real64 ConstantTempCoef; // Temperature Coefficient as input or modified using sine wave  COP mod
+	int RoughSurf; // Roughness index of the exterior surface
+	Real64 TempExt; // Exterior temperature boundary condition
+	int const ZoneNum( Surface( SurfNum ).Zone ); // Zone number the current surface is attached to
+	int OPtr;
+	Real64 RhoVaporSat; // Local temporary saturated vapor density for checking
+	bool MovInsulErrorFlag( false ); // Movable Insulation error flag
 
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTempFC, PsyWFnTdbRhPb( GroundTempFC, 1.0, OutBaroPress, RoutineNameGroundTempFC ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTempFC ) );
+	// FLOW:
+	// Initializations for this surface
+	ConstrNum = Surface( SurfNum ).Construction;
+	HMovInsul = 0.0;
+	HSky = 0.0;
+	HGround = 0.0;
+	HAir = 0.0;
+	HcExtSurf( SurfNum ) = 0.0;
+	HAirExtSurf( SurfNum ) = 0.0;
+	HSkyExtSurf( SurfNum ) = 0.0;
+	HGrdExtSurf( SurfNum ) = 0.0;
+
+	// Calculate the current outside surface temperature TH(SurfNum,1,1) for the
+	// various different boundary conditions
+	{ auto const SELECT_CASE_var( Surface( SurfNum ).ExtBoundCond );
+
+	if ( SELECT_CASE_var == Ground ) { // Surface in contact with ground
+
+		TH( 1, 1, SurfNum ) = GroundTemp;
+
+		// Set the only radiant system heat balance coefficient that is non-zero for this case
+		if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
+
+		// start HAMT
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			// Set variables used in the HAMT moisture balance
+			TempOutsideAirFD( SurfNum ) = GroundTemp;
+			RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTemp, 1.0, HBSurfManGroundHAMT );
+			HConvExtFD( SurfNum ) = HighHConvLimit;
+
+			HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTemp, PsyWFnTdbRhPb( GroundTemp, 1.0, OutBaroPress, RoutineNameGroundTemp ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTemp ) );
+
+			HSkyFD( SurfNum ) = HSky;
+			HGrndFD( SurfNum ) = HGround;
+			HAirFD( SurfNum ) = HAir;
+		}
+		// end HAMT
+
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+			// Set variables used in the FD moisture balance
+			TempOutsideAirFD( SurfNum ) = GroundTemp;
+			RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTemp, 1.0 );
+			HConvExtFD( SurfNum ) = HighHConvLimit;
+			HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTemp, PsyWFnTdbRhPb( GroundTemp, 1.0, OutBaroPress, RoutineNameGroundTemp ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTemp ) );
+			HSkyFD( SurfNum ) = HSky;
+			HGrndFD( SurfNum ) = HGround;
+			HAirFD( SurfNum ) = HAir;
+		}
 
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
+		// Added for FCfactor grounds
+	} else if ( SELECT_CASE_var == GroundFCfactorMethod ) { // Surface in contact with ground
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
-				// Set variables used in the FD moisture balance
-				TempOutsideAirFD( SurfNum ) = GroundTempFC;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTempFC, 1.0 );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTempFC, PsyWFnTdbRhPb( GroundTempFC, 1.0, OutBaroPress, RoutineNameGroundTempFC ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTempFC ) );
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
+		TH( 1, 1, SurfNum ) = GroundTempFC;
 
-		} else if ( SELECT_CASE_var == OtherSideCoefNoCalcExt ) {
-			// Use Other Side Coefficients to determine the surface film coefficient and
-			// the exterior boundary condition temperature
+		// Set the only radiant system heat balance coefficient that is non-zero for this case
+		if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
 
-			OPtr = Surface( SurfNum ).OSCPtr;
-			// Set surface temp from previous timestep
-			if ( BeginTimeStepFlag ) {
-				OSC( OPtr ).TOutsideSurfPast = TH( 1, 1, SurfNum );
-			}
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			// Set variables used in the HAMT moisture balance
+			TempOutsideAirFD( SurfNum ) = GroundTempFC;
+			RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTempFC, 1.0, HBSurfManGroundHAMT );
+			HConvExtFD( SurfNum ) = HighHConvLimit;
 
-			if ( OSC( OPtr ).ConstTempScheduleIndex != 0 ) { // Determine outside temperature from schedule
-				OSC( OPtr ).ConstTemp = GetCurrentScheduleValue( OSC( OPtr ).ConstTempScheduleIndex );
-			}
+			HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTempFC, PsyWFnTdbRhPb( GroundTempFC, 1.0, OutBaroPress, RoutineNameGroundTempFC ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTempFC ) );
 
-			//  Allow for modification of TemperatureCoefficient with unitary sine wave.
-			if ( OSC( OPtr ).SinusoidalConstTempCoef ) { // Sine wave C4
-				ConstantTempCoef = std::sin( 2 * Pi * CurrentTime / OSC( OPtr ).SinusoidPeriod );
-			} else {
-				ConstantTempCoef = OSC( OPtr ).ConstTempCoef;
-			}
+			HSkyFD( SurfNum ) = HSky;
+			HGrndFD( SurfNum ) = HGround;
+			HAirFD( SurfNum ) = HAir;
+		}
 
-			OSC( OPtr ).OSCTempCalc = ( OSC( OPtr ).ZoneAirTempCoef * MAT( ZoneNum ) + OSC( OPtr ).ExtDryBulbCoef * Surface( SurfNum ).OutDryBulbTemp + ConstantTempCoef * OSC( OPtr ).ConstTemp + OSC( OPtr ).GroundTempCoef * GroundTemp + OSC( OPtr ).WindSpeedCoef * Surface( SurfNum ).WindSpeed * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).TPreviousCoef * OSC( OPtr ).TOutsideSurfPast );
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+			// Set variables used in the FD moisture balance
+			TempOutsideAirFD( SurfNum ) = GroundTempFC;
+			RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTempFC, 1.0 );
+			HConvExtFD( SurfNum ) = HighHConvLimit;
+			HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, GroundTempFC, PsyWFnTdbRhPb( GroundTempFC, 1.0, OutBaroPress, RoutineNameGroundTempFC ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, GroundTempFC ) );
+			HSkyFD( SurfNum ) = HSky;
+			HGrndFD( SurfNum ) = HGround;
+			HAirFD( SurfNum ) = HAir;
+		}
 
-			// Enforce max/min limits if applicable
-			if ( OSC( OPtr ).MinLimitPresent ) OSC( OPtr ).OSCTempCalc = max( OSC( OPtr ).MinTempLimit, OSC( OPtr ).OSCTempCalc );
-			if ( OSC( OPtr ).MaxLimitPresent ) OSC( OPtr ).OSCTempCalc = min( OSC( OPtr ).MaxTempLimit, OSC( OPtr ).OSCTempCalc );
+	} else if ( SELECT_CASE_var == OtherSideCoefNoCalcExt ) {
+		// Use Other Side Coefficients to determine the surface film coefficient and
+		// the exterior boundary condition temperature
 
-			TH( 1, 1, SurfNum ) = OSC( OPtr ).OSCTempCalc;
+		OPtr = Surface( SurfNum ).OSCPtr;
+		// Set surface temp from previous timestep
+		if ( BeginTimeStepFlag ) {
+			OSC( OPtr ).TOutsideSurfPast = TH( 1, 1, SurfNum );
+		}
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
+		if ( OSC( OPtr ).ConstTempScheduleIndex != 0 ) { // Determine outside temperature from schedule
+			OSC( OPtr ).ConstTemp = GetCurrentScheduleValue( OSC( OPtr ).ConstTempScheduleIndex );
+		}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the FD moisture balance and HAMT
-				TempOutsideAirFD( SurfNum ) = TH( 1, 1, SurfNum );
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
-				HConvExtFD( SurfNum ) = HighHConvLimit;
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOtherSideCoefNoCalcExt ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-				HSkyFD( SurfNum ) = HSky;
-				HGrndFD( SurfNum ) = HGround;
-				HAirFD( SurfNum ) = HAir;
-			}
+		//  Allow for modification of TemperatureCoefficient with unitary sine wave.
+		if ( OSC( OPtr ).SinusoidalConstTempCoef ) { // Sine wave C4
+			ConstantTempCoef = std::sin( 2 * Pi * CurrentTime / OSC( OPtr ).SinusoidPeriod );
+		} else {
+			ConstantTempCoef = OSC( OPtr ).ConstTempCoef;
+		}
 
-			// This ends the calculations for this surface and goes on to the next SurfNum
+		OSC( OPtr ).OSCTempCalc = ( OSC( OPtr ).ZoneAirTempCoef * MAT( ZoneNum ) + OSC( OPtr ).ExtDryBulbCoef * Surface( SurfNum ).OutDryBulbTemp + ConstantTempCoef * OSC( OPtr ).ConstTemp + OSC( OPtr ).GroundTempCoef * GroundTemp + OSC( OPtr ).WindSpeedCoef * Surface( SurfNum ).WindSpeed * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).TPreviousCoef * OSC( OPtr ).TOutsideSurfPast );
 
-		} else if ( SELECT_CASE_var == OtherSideCoefCalcExt ) { // A surface with other side coefficients that define the outside environment
+		// Enforce max/min limits if applicable
+		if ( OSC( OPtr ).MinLimitPresent ) OSC( OPtr ).OSCTempCalc = max( OSC( OPtr ).MinTempLimit, OSC( OPtr ).OSCTempCalc );
+		if ( OSC( OPtr ).MaxLimitPresent ) OSC( OPtr ).OSCTempCalc = min( OSC( OPtr ).MaxTempLimit, OSC( OPtr ).OSCTempCalc );
 
-			// First, set up the outside convection coefficient and the exterior temperature
-			// boundary condition for the surface
-			OPtr = Surface( SurfNum ).OSCPtr;
-			// Set surface temp from previous timestep
-			if ( BeginTimeStepFlag ) {
-				OSC( OPtr ).TOutsideSurfPast = TH( 1, 1, SurfNum );
-			}
+		TH( 1, 1, SurfNum ) = OSC( OPtr ).OSCTempCalc;
 
-			if ( OSC( OPtr ).ConstTempScheduleIndex != 0 ) { // Determine outside temperature from schedule
-				OSC( OPtr ).ConstTemp = GetCurrentScheduleValue( OSC( OPtr ).ConstTempScheduleIndex );
-			}
+		// Set the only radiant system heat balance coefficient that is non-zero for this case
+		if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
 
-			HcExtSurf( SurfNum ) = OSC( OPtr ).SurfFilmCoef;
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			// Set variables used in the FD moisture balance and HAMT
+			TempOutsideAirFD( SurfNum ) = TH( 1, 1, SurfNum );
+			RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
+			HConvExtFD( SurfNum ) = HighHConvLimit;
+			HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOtherSideCoefNoCalcExt ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+			HSkyFD( SurfNum ) = HSky;
+			HGrndFD( SurfNum ) = HGround;
+			HAirFD( SurfNum ) = HAir;
+		}
 
-			OSC( OPtr ).OSCTempCalc = ( OSC( OPtr ).ZoneAirTempCoef * MAT( ZoneNum ) + OSC( OPtr ).ExtDryBulbCoef * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).ConstTempCoef * OSC( OPtr ).ConstTemp + OSC( OPtr ).GroundTempCoef * GroundTemp + OSC( OPtr ).WindSpeedCoef * Surface( SurfNum ).WindSpeed * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).TPreviousCoef * OSC( OPtr ).TOutsideSurfPast );
+		// This ends the calculations for this surface and goes on to the next SurfNum
 
-			// Enforce max/min limits if applicable
-			if ( OSC( OPtr ).MinLimitPresent ) OSC( OPtr ).OSCTempCalc = max( OSC( OPtr ).MinTempLimit, OSC( OPtr ).OSCTempCalc );
-			if ( OSC( OPtr ).MaxLimitPresent ) OSC( OPtr ).OSCTempCalc = min( OSC( OPtr ).MaxTempLimit, OSC( OPtr ).OSCTempCalc );
+	} else if ( SELECT_CASE_var == OtherSideCoefCalcExt ) { // A surface with other side coefficients that define the outside environment
 
-			TempExt = OSC( OPtr ).OSCTempCalc;
+		// First, set up the outside convection coefficient and the exterior temperature
+		// boundary condition for the surface
+		OPtr = Surface( SurfNum ).OSCPtr;
+		// Set surface temp from previous timestep
+		if ( BeginTimeStepFlag ) {
+			OSC( OPtr ).TOutsideSurfPast = TH( 1, 1, SurfNum );
+		}
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
+		if ( OSC( OPtr ).ConstTempScheduleIndex != 0 ) { // Determine outside temperature from schedule
+			OSC( OPtr ).ConstTemp = GetCurrentScheduleValue( OSC( OPtr ).ConstTempScheduleIndex );
+		}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the FD moisture balance and HAMT
-				TempOutsideAirFD( SurfNum ) = TempExt;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
-				HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOtherSideCoefCalcExt ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-				HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
-				HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
-				HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
-			}
+		HcExtSurf( SurfNum ) = OSC( OPtr ).SurfFilmCoef;
 
-			// Call the outside surface temp calculation and pass the necessary terms
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
-				CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt, MovInsulErrorFlag );
-				if (MovInsulErrorFlag) ShowFatalError( "CalcOutsideSurfTemp: Program terminates due to preceding conditions." );
-			}
+		OSC( OPtr ).OSCTempCalc = ( OSC( OPtr ).ZoneAirTempCoef * MAT( ZoneNum ) + OSC( OPtr ).ExtDryBulbCoef * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).ConstTempCoef * OSC( OPtr ).ConstTemp + OSC( OPtr ).GroundTempCoef * GroundTemp + OSC( OPtr ).WindSpeedCoef * Surface( SurfNum ).WindSpeed * Surface( SurfNum ).OutDryBulbTemp + OSC( OPtr ).TPreviousCoef * OSC( OPtr ).TOutsideSurfPast );
 
-			// This ends the calculations for this surface and goes on to the next SurfNum
+		// Enforce max/min limits if applicable
+		if ( OSC( OPtr ).MinLimitPresent ) OSC( OPtr ).OSCTempCalc = max( OSC( OPtr ).MinTempLimit, OSC( OPtr ).OSCTempCalc );
+		if ( OSC( OPtr ).MaxLimitPresent ) OSC( OPtr ).OSCTempCalc = min( OSC( OPtr ).MaxTempLimit, OSC( OPtr ).OSCTempCalc );
 
-		} else if ( SELECT_CASE_var == OtherSideCondModeledExt ) { // A surface with other side conditions determined from seperate, dynamic component
-			//                               modeling that defines the "outside environment"
+		TempExt = OSC( OPtr ).OSCTempCalc;
 
-			// First, set up the outside convection coefficient and the exterior temperature
-			// boundary condition for the surface
-			OPtr = Surface( SurfNum ).OSCMPtr;
-			// EMS overrides
-			if ( OSCM( OPtr ).EMSOverrideOnTConv ) OSCM( OPtr ).TConv = OSCM( OPtr ).EMSOverrideTConvValue;
-			if ( OSCM( OPtr ).EMSOverrideOnHConv ) OSCM( OPtr ).HConv = OSCM( OPtr ).EMSOverrideHConvValue;
-			if ( OSCM( OPtr ).EMSOverrideOnTRad ) OSCM( OPtr ).TRad = OSCM( OPtr ).EMSOverrideTRadValue;
-			if ( OSCM( OPtr ).EMSOverrideOnHrad ) OSCM( OPtr ).HRad = OSCM( OPtr ).EMSOverrideHradValue;
-			HcExtSurf( SurfNum ) = OSCM( OPtr ).HConv;
+		// Set the only radiant system heat balance coefficient that is non-zero for this case
+		if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
 
-			TempExt = OSCM( OPtr ).TConv;
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			// Set variables used in the FD moisture balance and HAMT
+			TempOutsideAirFD( SurfNum ) = TempExt;
+			RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
+			HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+			HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOtherSideCoefCalcExt ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+			HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
+			HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
+			HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
+		}
 
-			// Set the only radiant system heat balance coefficient that is non-zero for this case
-			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
+		// Call the outside surface temp calculation and pass the necessary terms
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+			CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt, MovInsulErrorFlag );
+			if (MovInsulErrorFlag) ShowFatalError( "CalcOutsideSurfTemp: Program terminates due to preceding conditions." );
+		}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				// Set variables used in the FD moisture balance and HAMT
-				TempOutsideAirFD( SurfNum ) = TempExt;
-				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
-				HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOSCM ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-				HSkyFD( SurfNum ) = OSCM( OPtr ).HRad; //CR 8046, use sky term for surface to baffle IR
-				HGrndFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
-				HAirFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
-			}
+		// This ends the calculations for this surface and goes on to the next SurfNum
+
+	} else if ( SELECT_CASE_var == OtherSideCondModeledExt ) { // A surface with other side conditions determined from seperate, dynamic component
+		//                               modeling that defines the "outside environment"
+
+		// First, set up the outside convection coefficient and the exterior temperature
+		// boundary condition for the surface
+		OPtr = Surface( SurfNum ).OSCMPtr;
+		// EMS overrides
+		if ( OSCM( OPtr ).EMSOverrideOnTConv ) OSCM( OPtr ).TConv = OSCM( OPtr ).EMSOverrideTConvValue;
+		if ( OSCM( OPtr ).EMSOverrideOnHConv ) OSCM( OPtr ).HConv = OSCM( OPtr ).EMSOverrideHConvValue;
+		if ( OSCM( OPtr ).EMSOverrideOnTRad ) OSCM( OPtr ).TRad = OSCM( OPtr ).EMSOverrideTRadValue;
+		if ( OSCM( OPtr ).EMSOverrideOnHrad ) OSCM( OPtr ).HRad = OSCM( OPtr ).EMSOverrideHradValue;
+		HcExtSurf( SurfNum ) = OSCM( OPtr ).HConv;
+
+		TempExt = OSCM( OPtr ).TConv;
+
+		// Set the only radiant system heat balance coefficient that is non-zero for this case
+		if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
+
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			// Set variables used in the FD moisture balance and HAMT
+			TempOutsideAirFD( SurfNum ) = TempExt;
+			RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
+			HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+			HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOSCM ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+			HSkyFD( SurfNum ) = OSCM( OPtr ).HRad; //CR 8046, use sky term for surface to baffle IR
+			HGrndFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
+			HAirFD( SurfNum ) = 0.0; //CR 8046, null out and use only sky term for surface to baffle IR
+		}
 
-			// Call the outside surface temp calculation and pass the necessary terms
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+		// Call the outside surface temp calculation and pass the necessary terms
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
 
-				if ( Surface( SurfNum ).ExtCavityPresent ) {
-					CalcExteriorVentedCavity( SurfNum );
-				}
+			if ( Surface( SurfNum ).ExtCavityPresent ) {
+				CalcExteriorVentedCavity( SurfNum );
+			}
 
-				CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt, MovInsulErrorFlag );
-				if (MovInsulErrorFlag) ShowFatalError( "CalcOutsideSurfTemp: Program terminates due to preceding conditions." );
+			CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt, MovInsulErrorFlag );
+			if (MovInsulErrorFlag) ShowFatalError( "CalcOutsideSurfTemp: Program terminates due to preceding conditions." );
 
-			} else if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-				if ( Surface( SurfNum ).ExtCavityPresent ) {
-					CalcExteriorVentedCavity( SurfNum );
-				}
+		} else if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( Surface( SurfNum ).ExtCavityPresent ) {
+				CalcExteriorVentedCavity( SurfNum );
 			}
+		}
 
-			// This ends the calculations for this surface and goes on to the next SurfNum
-		} else if ( SELECT_CASE_var == ExternalEnvironment ) {
+		// This ends the calculations for this surface and goes on to the next SurfNum
+	} else if ( SELECT_CASE_var == ExternalEnvironment ) {
 
-			//checking the EcoRoof presented in the external environment
-			// recompute each load by calling ecoroof
+		//checking the EcoRoof presented in the external environment
+		// recompute each load by calling ecoroof
 
-			if ( Surface( SurfNum ).ExtEcoRoof ) {
-				CalcEcoRoof( SurfNum, ZoneNum, ConstrNum, TempExt );
-				continue;
-			}
-
-			if ( SurfaceWindow( SurfNum ).StormWinFlag == 1 ) ConstrNum = Surface( SurfNum ).StormWinConstruction;
-			RoughSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Roughness;
-			AbsThermSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpThermal;
+		if ( Surface( SurfNum ).ExtEcoRoof ) {
+			CalcEcoRoof( SurfNum, ZoneNum, ConstrNum, TempExt );
+			return;
+		}
 
-			// Check for outside movable insulation
-			if ( Surface( SurfNum ).MaterialMovInsulExt > 0 ) {
-				EvalOutsideMovableInsulation( SurfNum, HMovInsul, RoughSurf, AbsThermSurf );
-				if ( HMovInsul > 0 ) AbsThermSurf = Material( Surface( SurfNum ).MaterialMovInsulExt ).AbsorpThermal; // Movable outside insulation present
-			}
+		if ( SurfaceWindow( SurfNum ).StormWinFlag == 1 ) ConstrNum = Surface( SurfNum ).StormWinConstruction;
+		RoughSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).Roughness;
+		AbsThermSurf = Material( Construct( ConstrNum ).LayerPoint( 1 ) ).AbsorpThermal;
 
-			// Check for exposure to wind (exterior environment)
-			if ( Surface( SurfNum ).ExtWind ) {
+		// Check for outside movable insulation
+		if ( Surface( SurfNum ).MaterialMovInsulExt > 0 ) {
+			EvalOutsideMovableInsulation( SurfNum, HMovInsul, RoughSurf, AbsThermSurf );
+			if ( HMovInsul > 0 ) AbsThermSurf = Material( Surface( SurfNum ).MaterialMovInsulExt ).AbsorpThermal; // Movable outside insulation present
+		}
 
-				// Calculate exterior heat transfer coefficients with windspeed (windspeed is calculated internally in subroutine)
-				InitExteriorConvectionCoeff( SurfNum, HMovInsul, RoughSurf, AbsThermSurf, TH( 1, 1, SurfNum ), HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
+		// Check for exposure to wind (exterior environment)
+		if ( Surface( SurfNum ).ExtWind ) {
 
-				if ( IsRain ) { // Raining: since wind exposed, outside surface gets wet
+			// Calculate exterior heat transfer coefficients with windspeed (windspeed is calculated internally in subroutine)
+			InitExteriorConvectionCoeff( SurfNum, HMovInsul, RoughSurf, AbsThermSurf, TH( 1, 1, SurfNum ), HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
 
-					if ( Surface( SurfNum ).ExtConvCoeff <= 0 ) { // Reset HcExtSurf because of wetness
-						HcExtSurf( SurfNum ) = 1000.0;
-					} else { // User set
-						HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
-					}
+			if ( IsRain ) { // Raining: since wind exposed, outside surface gets wet
 
-					TempExt = Surface( SurfNum ).OutWetBulbTemp;
-
-					// start HAMT
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-						// Set variables used in the HAMT moisture balance
-						TempOutsideAirFD( SurfNum ) = TempExt;
-						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManRainHAMT );
-						HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvWetSurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-						HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
-						HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
-						HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
-					}
-					// end HAMT
-
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
-						// Set variables used in the FD moisture balance
-						TempOutsideAirFD( SurfNum ) = TempExt;
-						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( TempOutsideAirFD( SurfNum ), 1.0 );
-						HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvWetSurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-						HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
-						HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
-						HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
-					}
+				if ( Surface( SurfNum ).ExtConvCoeff <= 0 ) { // Reset HcExtSurf because of wetness
+					HcExtSurf( SurfNum ) = 1000.0;
+				} else { // User set
+					HcExtSurf( SurfNum ) = SetExtConvectionCoeff( SurfNum );
+				}
 
-				} else { // Surface is dry, use the normal correlation
-
-					TempExt = Surface( SurfNum ).OutDryBulbTemp;
-
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-						// Set variables used in the FD moisture balance and HAMT
-						TempOutsideAirFD( SurfNum ) = TempExt;
-						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
-						HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-						HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvDrySurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-						//  check for saturation conditions of air
-						RhoVaporSat = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManDrySurfCondFD );
-						if ( RhoVaporAirOut( SurfNum ) > RhoVaporSat ) RhoVaporAirOut( SurfNum ) = RhoVaporSat;
-						HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
-						HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
-						HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
-					}
+				TempExt = Surface( SurfNum ).OutWetBulbTemp;
 
+				// start HAMT
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					// Set variables used in the HAMT moisture balance
+					TempOutsideAirFD( SurfNum ) = TempExt;
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManRainHAMT );
+					HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvWetSurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+					HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
+					HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
+					HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
 				}
+				// end HAMT
 
-			} else { // No wind
+				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+					// Set variables used in the FD moisture balance
+					TempOutsideAirFD( SurfNum ) = TempExt;
+					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( TempOutsideAirFD( SurfNum ), 1.0 );
+					HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvWetSurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+					HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
+					HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
+					HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
+				}
 
-				// Calculate exterior heat transfer coefficients for windspeed = 0
-				InitExteriorConvectionCoeff( SurfNum, HMovInsul, RoughSurf, AbsThermSurf, TH( 1, 1, SurfNum ), HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
+			} else { // Surface is dry, use the normal correlation
 
 				TempExt = Surface( SurfNum ).OutDryBulbTemp;
 
@@ -4935,7 +5052,10 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 					TempOutsideAirFD( SurfNum ) = TempExt;
 					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
 					HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
-					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameNoWind ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameExtEnvDrySurf ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+					//  check for saturation conditions of air
+					RhoVaporSat = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManDrySurfCondFD );
+					if ( RhoVaporAirOut( SurfNum ) > RhoVaporSat ) RhoVaporAirOut( SurfNum ) = RhoVaporSat;
 					HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
 					HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
 					HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
@@ -4943,69 +5063,177 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 			}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+		} else { // No wind
 
-				CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt, MovInsulErrorFlag );
-				if (MovInsulErrorFlag) ShowFatalError( "CalcOutsideSurfTemp: Program terminates due to preceding conditions." );
-			}
+			// Calculate exterior heat transfer coefficients for windspeed = 0
+			InitExteriorConvectionCoeff( SurfNum, HMovInsul, RoughSurf, AbsThermSurf, TH( 1, 1, SurfNum ), HcExtSurf( SurfNum ), HSkyExtSurf( SurfNum ), HGrdExtSurf( SurfNum ), HAirExtSurf( SurfNum ) );
 
-		} else { // for interior or other zone surfaces
+			TempExt = Surface( SurfNum ).OutDryBulbTemp;
 
-			if ( Surface( SurfNum ).ExtBoundCond == SurfNum ) { // Regular partition/internal mass
+			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				// Set variables used in the FD moisture balance and HAMT
+				TempOutsideAirFD( SurfNum ) = TempExt;
+				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
+				HConvExtFD( SurfNum ) = HcExtSurf( SurfNum );
+				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameNoWind ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+				HSkyFD( SurfNum ) = HSkyExtSurf( SurfNum );
+				HGrndFD( SurfNum ) = HGrdExtSurf( SurfNum );
+				HAirFD( SurfNum ) = HAirExtSurf( SurfNum );
+			}
 
-				TH( 1, 1, SurfNum ) = TempSurfIn( SurfNum );
+		}
 
-				// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
+		if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-					// Set variables used in the FD moisture balance HAMT
-					TempOutsideAirFD( SurfNum ) = TempSurfIn( SurfNum );
-					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( SurfNum );
-					HConvExtFD( SurfNum ) = HConvIn( SurfNum );
-					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOther ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-					HSkyFD( SurfNum ) = 0.0;
-					HGrndFD( SurfNum ) = 0.0;
-					HAirFD( SurfNum ) = 0.0;
-				}
+			CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt, MovInsulErrorFlag );
+			if (MovInsulErrorFlag) ShowFatalError( "CalcOutsideSurfTemp: Program terminates due to preceding conditions." );
+		}
 
-			} else { // Interzone partition
+	} else { // for interior or other zone surfaces
 
-				TH( 1, 1, SurfNum ) = TH( 2, 1, Surface( SurfNum ).ExtBoundCond );
+		if ( Surface( SurfNum ).ExtBoundCond == SurfNum ) { // Regular partition/internal mass
 
-				// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
+			TH( 1, 1, SurfNum ) = TempSurfIn( SurfNum );
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
-					// Set variables used in the FD moisture balance and HAMT
-					TempOutsideAirFD( SurfNum ) = TH( 2, 1, Surface( SurfNum ).ExtBoundCond );
-					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( Surface( SurfNum ).ExtBoundCond );
-					HConvExtFD( SurfNum ) = HConvIn( Surface( SurfNum ).ExtBoundCond );
-					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameIZPart ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
-					HSkyFD( SurfNum ) = 0.0;
-					HGrndFD( SurfNum ) = 0.0;
-					HAirFD( SurfNum ) = 0.0;
-				}
+			// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
 
+			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				// Set variables used in the FD moisture balance HAMT
+				TempOutsideAirFD( SurfNum ) = TempSurfIn( SurfNum );
+				RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( SurfNum );
+				HConvExtFD( SurfNum ) = HConvIn( SurfNum );
+				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameOther ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+				HSkyFD( SurfNum ) = 0.0;
+				HGrndFD( SurfNum ) = 0.0;
+				HAirFD( SurfNum ) = 0.0;
 			}
 
-			// This ends the calculations for this surface and goes on to the next SurfNum
-		}}
+		} else { // Interzone partition
 
-		//fill in reporting values for outside face
-		QdotConvOutRep( SurfNum ) = -Surface( SurfNum ).Area * HcExtSurf( SurfNum ) * ( TH( 1, 1, SurfNum ) - Surface( SurfNum ).OutDryBulbTemp );
+			TH( 1, 1, SurfNum ) = TH( 2, 1, Surface( SurfNum ).ExtBoundCond );
+
+			// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
+
+			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				// Set variables used in the FD moisture balance and HAMT
+				TempOutsideAirFD( SurfNum ) = TH( 2, 1, Surface( SurfNum ).ExtBoundCond );
+				RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( Surface( SurfNum ).ExtBoundCond );
+				HConvExtFD( SurfNum ) = HConvIn( Surface( SurfNum ).ExtBoundCond );
+				HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameIZPart ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
+				HSkyFD( SurfNum ) = 0.0;
+				HGrndFD( SurfNum ) = 0.0;
+				HAirFD( SurfNum ) = 0.0;
+			}
 
-		if ( Surface( SurfNum ).OSCMPtr > 0 ) { //Optr is set above in this case, use OSCM boundary data
-			QdotConvOutRepPerArea( SurfNum ) = -OSCM( OPtr ).HConv * ( TH( 1, 1, SurfNum ) - OSCM( OPtr ).TConv );
-		} else {
-			QdotConvOutRepPerArea( SurfNum ) = -HcExtSurf( SurfNum ) * ( TH( 1, 1, SurfNum ) - Surface( SurfNum ).OutDryBulbTemp );
 		}
 
-		QConvOutReport( SurfNum ) = QdotConvOutRep( SurfNum ) * TimeStepZoneSec;
+		// This ends the calculations for this surface and goes on to the next SurfNum
+	}}
 
-	} // ...end of DO loop over all surface (actually heat transfer surfaces)
+	//fill in reporting values for outside face
+	QdotConvOutRep( SurfNum ) = -Surface( SurfNum ).Area * HcExtSurf( SurfNum ) * ( TH( 1, 1, SurfNum ) - Surface( SurfNum ).OutDryBulbTemp );
+
+	if ( Surface( SurfNum ).OSCMPtr > 0 ) { //Optr is set above in this case, use OSCM boundary data
+		QdotConvOutRepPerArea( SurfNum ) = -OSCM( OPtr ).HConv * ( TH( 1, 1, SurfNum ) - OSCM( OPtr ).TConv );
+	} else {
+		QdotConvOutRepPerArea( SurfNum ) = -HcExtSurf( SurfNum ) * ( TH( 1, 1, SurfNum ) - Surface( SurfNum ).OutDryBulbTemp );
+	}
+
+	QConvOutReport( SurfNum ) = QdotConvOutRep( SurfNum ) * TimeStepZoneSec;
+
+}
+
+
+
+bool
+ConcurrentOutsideFace( int const SurfNum ) // Surface number
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Returns true if the outside face heat balance of a (non-window) heat transfer
+	// surface can be done concurrently with the surfaces of other zones.
+
+	// METHODOLOGY EMPLOYED:
+	// CTF surfaces facing the ground, a zone or the outdoors only write their own
+	// entries in CalcHeatBalanceOutsideSurfFace.  Other side coefficients and models,
+	// ecoroofs, movable insulation, TDD domes and the outside convection models that
+	// use curves, schedules or the adaptive algorithm are left to the serial pass.
+
+	// Using/Aliasing
+	using namespace DataHeatBalance;
+	using namespace DataSurfaces;
+
+	auto const & surface( Surface( SurfNum ) );
+	if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) return false;
+	if ( surface.Class == SurfaceClass_TDD_Dome ) return false;
+
+	int const ExtBoundCond( surface.ExtBoundCond );
+	if ( ( ExtBoundCond > 0 ) || ( ExtBoundCond == Ground ) || ( ExtBoundCond == GroundFCfactorMethod ) ) return true;
+	if ( ExtBoundCond != ExternalEnvironment ) return false;
+	if ( surface.ExtEcoRoof || ( surface.MaterialMovInsulExt > 0 ) ) return false;
+
+	int ConvAlgo; // Outside convection algorithm
+	if ( surface.ExtConvCoeff <= -1 ) {
+		ConvAlgo = std::abs( surface.ExtConvCoeff );
+	} else if ( surface.ExtConvCoeff == 0 ) {
+		ConvAlgo = Zone( surface.Zone ).OutsideConvectionAlgo;
+	} else { // User value or schedule
+		return false;
+	}
+	return ( ConvAlgo == ASHRAESimple ) || ( ConvAlgo == ASHRAETARP ) || ( ConvAlgo == BLASTHcOutside ) || ( ConvAlgo == TarpHcOutside ) || ( ConvAlgo == MoWiTTHcOutside ) || ( ConvAlgo == DOE2HcOutside );
+
+}
+
+bool
+ConcurrentInsideFace( int const SurfNum ) // Surface number
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Returns true if the inside face heat balance of a heat transfer surface can be
+	// done concurrently with the surfaces of other zones.
+
+	// METHODOLOGY EMPLOYED:
+	// Opaque CTF surfaces (including pools) without internal sources or inside movable
+	// insulation only use their own entries in an inside iteration.  Windows, TDDs and the
+	// other heat transfer algorithms share module data and are left to the serial pass.
+
+	// Using/Aliasing
+	using namespace DataHeatBalance;
+	using namespace DataSurfaces;
+
+	auto const & surface( Surface( SurfNum ) );
+	if ( ( surface.Zone == 0 ) || ! surface.HeatTransSurf ) return false;
+	if ( ( surface.Class == SurfaceClass_Window ) || ( surface.Class == SurfaceClass_TDD_Dome ) ) return false;
+	if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) return false;
+	if ( surface.MaterialMovInsulInt > 0 ) return false;
+	return ! Construct( surface.Construction ).SourceSinkPresent;
 
 }
 
+bool
+ConcurrentCondFD( int const SurfNum ) // Surface number
+{
+
+	// PURPOSE OF THIS FUNCTION:
+	// Returns true if the conduction finite difference solution of a heat transfer surface
+	// can be done concurrently with those of other surfaces.
+
+	// METHODOLOGY EMPLOYED:
+	// A CondFD surface only uses its own node data unless it is an interzone partition, whose
+	// outside face is the inside face of the other surface.  Movable insulation is excluded since
+	// the inside case does not call CondFD and the outside case may set the material resistance.
+
+	// Using/Aliasing
+	using namespace DataSurfaces;
 
+	auto const & surface( Surface( SurfNum ) );
+	if ( ( surface.Zone == 0 ) || ! surface.HeatTransSurf ) return false;
+	if ( ( surface.Class == SurfaceClass_Window ) || ( surface.Class == SurfaceClass_TDD_Dome ) ) return false;
+	if ( surface.HeatTransferAlgorithm != HeatTransferModel_CondFD ) return false;
+	if ( ( surface.ExtBoundCond > 0 ) && ( surface.ExtBoundCond != SurfNum ) ) return false;
+	return ( surface.MaterialMovInsulInt == 0 ) && ( surface.MaterialMovInsulExt == 0 );
+
+}
 
 void
 CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in, then only calculate surfaces that have this zone
@@ -5092,6 +5320,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using namespace DataTimings;
 	using WindowEquivalentLayer::EQLWindowOutsideEffectiveEmiss;
 	using SwimmingPool::SimSwimmingPool;
+	using DataSystemVariables::NumberSurfaceHeatBalanceThreads;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -5315,6 +5544,110 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	}
 
 	bool const useCondFDHTalg( any_eq( HeatTransferAlgosUsed, UseCondFD ) );
+
+	// Zones run concurrently: opaque CTF surfaces without sources or inside movable insulation only involve
+	// their own data within an iteration, so they are shared out by zone and the other surfaces are done
+	// afterwards in surface order, which gives the same results as the serial loop
+	bool const RunZonesConcurrently( ( NumberSurfaceHeatBalanceThreads > 1 ) && ( ! PartialResimulate ) );
+	Array1D< Real64 > ZoneRhoVaporAirIn; // Zone air vapor density for the concurrent surfaces
+	Array1D< Real64 > ZoneRhoCpAir; // Zone air density * specific heat for the concurrent surfaces
+	if ( RunZonesConcurrently ) {
+		ZoneInsideFaces.resize( NumOfZones );
+		for ( auto & faces : ZoneInsideFaces ) faces.clear();
+		SerialInsideFaces.clear();
+		for ( int const iSurf : HTSurfToResimulate ) {
+			if ( ConcurrentInsideFace( iSurf ) ) {
+				ZoneInsideFaces[ Surface( iSurf ).Zone - 1 ].push_back( iSurf );
+			} else {
+				SerialInsideFaces.push_back( iSurf );
+			}
+		}
+
+		// The psychrometric caches are not thread safe so the zone air properties are evaluated here
+		ZoneRhoVaporAirIn.dimension( NumOfZones, 0.0 );
+		ZoneRhoCpAir.dimension( NumOfZones, 0.0 );
+		for ( int iZone = 1; iZone <= NumOfZones; ++iZone ) {
+			if ( ZoneInsideFaces[ iZone - 1 ].empty() ) continue;
+			Real64 const MAT_zone( MAT( iZone ) );
+			Real64 const ZoneAirHumRat_zone( max( ZoneAirHumRat( iZone ), 1.0e-5 ) );
+			ZoneRhoVaporAirIn( iZone ) = min( PsyRhovFnTdbWPb_fast( MAT_zone, ZoneAirHumRat_zone, OutBaroPress ), PsyRhovFnTdbRh( MAT_zone, 1.0, HBSurfManInsideSurf ) );
+			ZoneRhoCpAir( iZone ) = PsyRhoAirFnPbTdbW_fast( OutBaroPress, MAT_zone, ZoneAirHumRat_zone ) * PsyCpAirFnWTdb_fast( ZoneAirHumRat_zone, MAT_zone );
+		}
+	}
+	std::vector< int > const & SerialHTSurfs( RunZonesConcurrently ? SerialInsideFaces : HTSurfToResimulate ); // Surfaces for the serial loop
+	auto const nSerialHTSurfs( SerialHTSurfs.size() );
+
+	// CondFD surfaces are independent within an iteration (apart from interzone partitions), so with
+	// threads they are solved together before the serial loop, which then picks up their results
+	bool const RunCondFDConcurrently( ( NumberSurfaceHeatBalanceThreads > 1 ) && useCondFDHTalg && ( ! HeatBalFiniteDiffManager::GetHBFiniteDiffInputFlag ) );
+	if ( RunCondFDConcurrently ) {
+		ConcurrentCondFDFaces.clear();
+		CondFDSolvedAhead.dimension( TotSurfaces, false );
+		CondFDTempSurfOut.dimension( TotSurfaces, 0.0 );
+		for ( int const iSurf : SerialHTSurfs ) {
+			if ( ConcurrentCondFD( iSurf ) ) {
+				ConcurrentCondFDFaces.push_back( iSurf );
+				CondFDSolvedAhead( iSurf ) = true;
+			}
+		}
+	}
+
+	// Inside face heat balance of the concurrent surfaces of one zone: the CTF cases of the serial loop below
+	auto const ZoneInsideFaceHeatBalance = [ & ]( ThreadPool::size_type const iZone ){
+		int const ZoneNum( iZone + 1 );
+		for ( int const SurfNum : ZoneInsideFaces[ iZone ] ) {
+			auto const & surface( Surface( SurfNum ) );
+			auto const & construct( Construct( surface.Construction ) );
+			Real64 & TH11( TH( 1, 1, SurfNum ) );
+			Real64 & TH12( TH( 2, 1, SurfNum ) );
+
+			Real64 const HConvIn_surf( HConvInFD( SurfNum ) = HConvIn( SurfNum ) );
+			RhoVaporAirIn( SurfNum ) = ZoneRhoVaporAirIn( ZoneNum );
+			HMassConvInFD( SurfNum ) = HConvIn_surf / ZoneRhoCpAir( ZoneNum );
+
+			Real64 const TempTerm( CTFConstInPart( SurfNum ) + QRadThermInAbs( SurfNum ) + QRadSWInAbs( SurfNum ) + HConvIn_surf * RefAirTemp( SurfNum ) + QHTRadSysSurf( SurfNum ) + QCoolingPanelSurf( SurfNum ) + QHWBaseboardSurf( SurfNum ) + QSteamBaseboardSurf( SurfNum ) + QElecBaseboardSurf( SurfNum ) + NetLWRadToSurf( SurfNum ) );
+			bool const Pool( surface.IsPool && ! ( ( abs( QPoolSurfNumerator( SurfNum ) ) < SmallNumber ) && ( abs( PoolHeatTransCoefs( SurfNum ) ) < SmallNumber ) ) ); // Pool simulated this time step
+			if ( surface.ExtBoundCond == SurfNum ) { // Partition
+				if ( ! Pool ) {
+					Real64 const TempDiv( 1.0 / ( construct.CTFInside( 0 ) - construct.CTFCross( 0 ) + HConvIn_surf + IterDampConst ) );
+					TempSurfInTmp( SurfNum ) = ( TempTerm + IterDampConst * TempInsOld( SurfNum ) ) * TempDiv;
+				} else {
+					TempSurfInTmp( SurfNum ) = ( CTFConstInPart( SurfNum ) + QPoolSurfNumerator( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) ) / ( construct.CTFInside( 0 ) - construct.CTFCross( 0 ) + PoolHeatTransCoefs( SurfNum ) + IterDampConst );
+				}
+			} else { // Standard or interzone surface
+				if ( ! Pool ) {
+					Real64 const TempDiv( 1.0 / ( construct.CTFInside( 0 ) + HConvIn_surf + IterDampConst ) );
+					TempSurfInTmp( SurfNum ) = ( TempTerm + IterDampConst * TempInsOld( SurfNum ) + construct.CTFCross( 0 ) * TH11 ) * TempDiv;
+				} else {
+					TempSurfInTmp( SurfNum ) = ( CTFConstInPart( SurfNum ) + QPoolSurfNumerator( SurfNum ) + IterDampConst * TempInsOld( SurfNum ) + construct.CTFCross( 0 ) * TH11 ) / ( construct.CTFInside( 0 ) + PoolHeatTransCoefs( SurfNum ) + IterDampConst );
+				}
+			}
+			// if any mixed heat transfer models in zone, apply limits to CTF result
+			if ( any_surface_ConFD_or_HAMT( ZoneNum ) ) TempSurfInTmp( SurfNum ) = max( MinSurfaceTempLimit, min( MaxSurfaceTempLimit, TempSurfInTmp( SurfNum ) ) ); // Limit Check
+			TempSurfIn( SurfNum ) = TempSurfInTmp( SurfNum );
+
+			TH12 = TempSurfInRep( SurfNum ) = TempSurfIn( SurfNum );
+			TempSurfOut( SurfNum ) = TH11; // For reporting
+
+			auto const HConvInTemp_fac( -HConvIn_surf * ( TempSurfIn( SurfNum ) - RefAirTemp( SurfNum ) ) );
+			QdotConvInRep( SurfNum ) = surface.Area * HConvInTemp_fac;
+			QdotConvInRepPerArea( SurfNum ) = HConvInTemp_fac;
+			QConvInReport( SurfNum ) = QdotConvInRep( SurfNum ) * TimeStepZoneSec;
+
+			if ( ZoneSizingCalc && CompLoadReportIsReq ) {
+				if ( ! WarmupFlag ) {
+					int const TimeStepInDay( ( HourOfDay - 1 ) * NumOfTimeStepInHour + TimeStep );
+					if ( isPulseZoneSizing ) {
+						loadConvectedWithPulse( CurOverallSimDay, TimeStepInDay, SurfNum ) = QdotConvInRep( SurfNum );
+					} else {
+						loadConvectedNormal( CurOverallSimDay, TimeStepInDay, SurfNum ) = QdotConvInRep( SurfNum );
+						netSurfRadSeq( CurOverallSimDay, TimeStepInDay, SurfNum ) = QdotRadNetSurfInRep( SurfNum );
+					}
+				}
+			}
+		}
+	};
+
 	Converged = false;
 	while ( ! Converged ) { // Start of main inside heat balance DO loop...
 
@@ -5332,8 +5665,28 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			InitInteriorConvectionCoeffs( TempSurfIn, ZoneToResimulate );
 		}
 
-		for ( std::vector< int >::size_type iHTSurfToResimulate = 0u; iHTSurfToResimulate < nHTSurfToResimulate; ++iHTSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
-			SurfNum = HTSurfToResimulate[ iHTSurfToResimulate ]; // Heat transfer surfaces only
+		if ( RunZonesConcurrently ) {
+			SurfaceHeatBalancePool().run( NumOfZones, ZoneInsideFaceHeatBalance );
+			for ( auto const & faces : ZoneInsideFaces ) { // Out of range messages are written here since they are not thread safe
+				for ( int const iSurf : faces ) {
+					Real64 const TH12( TH( 2, 1, iSurf ) );
+					if ( ( TH12 > MaxSurfaceTempLimit ) || ( TH12 < MinSurfaceTempLimit ) ) {
+						TestSurfTempCalcHeatBalanceInsideSurf( TH12, Surface( iSurf ), Zone( Surface( iSurf ).Zone ), WarmupSurfTemp );
+					}
+				}
+			}
+		}
+
+		if ( RunCondFDConcurrently && ( ! ConcurrentCondFDFaces.empty() ) ) {
+			SurfaceHeatBalancePool().run( ConcurrentCondFDFaces.size(), []( ThreadPool::size_type const iFace ){
+				int const iSurf( ConcurrentCondFDFaces[ iFace ] );
+				HConvInFD( iSurf ) = HConvIn( iSurf );
+				ManageHeatBalFiniteDiff( iSurf, TempSurfInTmp( iSurf ), CondFDTempSurfOut( iSurf ) );
+			} );
+		}
+
+		for ( std::vector< int >::size_type iHTSurfToResimulate = 0u; iHTSurfToResimulate < nSerialHTSurfs; ++iHTSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
+			SurfNum = SerialHTSurfs[ iHTSurfToResimulate ]; // Heat transfer surfaces only
 			auto & surface( Surface( SurfNum ) );
 			if ( surface.Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
 			if ( ( ZoneNum = surface.Zone ) == 0 ) continue; // Skip non-heat transfer surfaces
@@ -5412,7 +5765,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 					if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+						if ( RunCondFDConcurrently && CondFDSolvedAhead( SurfNum ) ) {
+							TempSurfOutTmp = CondFDTempSurfOut( SurfNum );
+						} else {
+							ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+						}
+					}
 
 					TH11 = TempSurfOutTmp;
 
@@ -5495,7 +5854,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 								ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 							}
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+							if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+								if ( RunCondFDConcurrently && CondFDSolvedAhead( SurfNum ) ) {
+									TempSurfOutTmp = CondFDTempSurfOut( SurfNum );
+								} else {
+									ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+								}
+							}
 
 							TH11 = TempSurfOutTmp;
 
@@ -92,6 +92,9 @@ namespace HeatBalanceSurfaceManager {
 	void
 	clear_state();
 
+	void
+	UnpackCTFHistories();
+
 	void
 	ManageSurfaceHeatBalance();
 
@@ -173,6 +176,18 @@ namespace HeatBalanceSurfaceManager {
 void
 CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate = _ ); // if passed in, then only calculate surfaces that have this zone
 
+void
+CalcHeatBalanceOutsideSurfFace( int const SurfNum ); // Surface number
+
+bool
+ConcurrentOutsideFace( int const SurfNum ); // Surface number
+
+bool
+ConcurrentInsideFace( int const SurfNum ); // Surface number
+
+bool
+ConcurrentCondFD( int const SurfNum ); // Surface number
+
 void
 CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate = _ ); // if passed in, then only calculate surfaces that have this zone
 
@@ -46,7 +46,15 @@
 
 // C++ Headers
 #include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <istream>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Backspace.hh>
@@ -57,6 +65,7 @@
 #include <ObjexxFCL/string.functions.hh>
 
 // EnergyPlus Headers
+#include <BinaryPayload.hh>
 #include <CommandLineInterface.hh>
 #include <InputProcessor.hh>
 #include <DataIPShortCuts.hh>
@@ -65,7 +74,9 @@
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DisplayRoutines.hh>
+#include <FileSystem.hh>
 #include <SortAndStringUtilities.hh>
 
 namespace EnergyPlus {
@@ -111,6 +122,7 @@ namespace InputProcessor {
 	using DataSizing::AutoSize;
 	using namespace DataIPShortCuts;
 	using DataSystemVariables::SortedIDD;
+	using DataSystemVariables::UseCompiledIDD;
 	using DataSystemVariables::iASCII_CR;
 	using DataSystemVariables::iUnicode_end;
 	using DataGlobals::DisplayInputInAudit;
@@ -128,6 +140,7 @@ namespace InputProcessor {
 	// when max is reached
 	int const ObjectsIDFAllocInc( 500 ); // Initial number of Objects allowed in IDF as well as the increment
 	// when max is reached
+	int const CompiledIDDFormatVersion( 2 ); // Bumped whenever the layout of the compiled IDD file changes
 	std::string::size_type const MaxObjectNameLength( MaxNameLength ); // Maximum number of characters in an Object Name
 	std::string::size_type const MaxSectionNameLength( MaxNameLength ); // Maximum number of characters in a Section Name
 	std::string::size_type const MaxAlphaArgLength( MaxNameLength ); // Maximum number of characters in an Alpha Argument
@@ -158,6 +171,138 @@ namespace InputProcessor {
 		Array1D< Real64 > NumberArgs;
 		Array1D_bool AlphaArgsBlank;
 		Array1D_bool NumberArgsBlank;
+		Array1D< std::vector< int > > ObjectRecords; // IDFRecords numbers of the objects of each definition, in input order
+		Array1D< std::unordered_map< std::string, int > > ObjectItemNums; // Item number of each object name (first alpha), by definition
+		Array1D_bool ObjectItemNumsIndexed; // True once ObjectItemNums has been filled for the definition
+		int LineItemAlphasUsed( -1 ); // Leading LineItem alpha fields that may hold values from earlier objects (-1: any)
+		int LineItemNumbersUsed( -1 ); // Leading LineItem numeric fields that may hold values from earlier objects (-1: any)
+	}
+
+	namespace {
+		char const CompiledIDDMagic[ 8 ] = { 'E', 'P', 'L', 'U', 'S', 'I', 'D', 'D' };
+		std::uint32_t const CompiledIDDByteOrder( 0x01020304u ); // Stored as written, read back to detect a foreign byte order
+
+		// 64-bit FNV-1a checksum of a compiled IDD payload
+		std::uint64_t
+		CompiledIDDChecksum(
+			char const * data,
+			std::size_t const n
+		)
+		{
+			BinaryPayload::KeyHash Hash;
+			Hash.add( data, n );
+			return Hash.value();
+		}
+
+		// Appends the object and section definitions to a compiled IDD image: flags, strings and
+		// range checks on top of the raw values of the shared payload writer
+		class CompiledIDDWriter : public BinaryPayload::PayloadWriter
+		{
+
+		public: // Methods
+
+			using PayloadWriter::put;
+
+			void
+			put( bool const v )
+			{
+				PayloadWriter::put( static_cast< char >( v ? 1 : 0 ) );
+			}
+
+			void
+			put( std::string const & s )
+			{
+				put_string( s );
+			}
+
+			// Min/max and default entries are only stored when set: most numeric fields have neither
+			void
+			put( RangeCheckDef const & r )
+			{
+				put( r.MinMaxChk );
+				put( r.FieldNumber );
+				put( r.FieldName );
+				if ( r.MinMaxChk ) {
+					put( r.MinMaxString( 1 ) );
+					put( r.MinMaxString( 2 ) );
+					put( r.MinMaxValue( 1 ) );
+					put( r.MinMaxValue( 2 ) );
+					put( r.WhichMinMax( 1 ) );
+					put( r.WhichMinMax( 2 ) );
+				}
+				put( r.DefaultChk );
+				if ( r.DefaultChk ) put( r.Default );
+				put( r.DefAutoSize );
+				put( r.AutoSizable );
+				put( r.AutoSizeValue );
+				put( r.DefAutoCalculate );
+				put( r.AutoCalculatable );
+				put( r.AutoCalculateValue );
+			}
+
+			// Element by element, for arrays of flags, strings and range checks
+			template< typename A >
+			void
+			put_list( A const & a )
+			{
+				PayloadWriter::put( static_cast< std::uint64_t >( a.size() ) );
+				for ( int i = 1, e = a.isize(); i <= e; ++i ) put( a( i ) );
+			}
+
+		};
+
+		// Reads the definitions back from a compiled IDD image, failing on any overrun
+		class CompiledIDDReader : public BinaryPayload::PayloadReader
+		{
+
+		public: // Creation
+
+			CompiledIDDReader( char const * begin, char const * end ) :
+				PayloadReader( begin, end )
+			{}
+
+		public: // Methods
+
+			using PayloadReader::get;
+
+			bool
+			get( bool & v )
+			{
+				char c( 0 );
+				if ( ! PayloadReader::get( c ) ) return false;
+				v = ( c != 0 );
+				return true;
+			}
+
+			bool
+			get( std::string & s )
+			{
+				return get_string( s );
+			}
+
+			bool
+			get( RangeCheckDef & r )
+			{
+				if ( ! get( r.MinMaxChk ) || ! get( r.FieldNumber ) || ! get( r.FieldName ) ) return false;
+				if ( r.MinMaxChk && ! ( get( r.MinMaxString( 1 ) ) && get( r.MinMaxString( 2 ) ) && get( r.MinMaxValue( 1 ) ) && get( r.MinMaxValue( 2 ) ) && get( r.WhichMinMax( 1 ) ) && get( r.WhichMinMax( 2 ) ) ) ) return false;
+				if ( ! get( r.DefaultChk ) || ( r.DefaultChk && ! get( r.Default ) ) ) return false;
+				return get( r.DefAutoSize ) && get( r.AutoSizable ) && get( r.AutoSizeValue ) && get( r.DefAutoCalculate ) && get( r.AutoCalculatable ) && get( r.AutoCalculateValue );
+			}
+
+			template< typename A >
+			bool
+			get_list( A & a )
+			{
+				std::uint64_t n( 0 );
+				if ( ! PayloadReader::get( n ) || remaining() < n ) return false; // Every element takes at least one byte
+				a.allocate( static_cast< int >( n ) );
+				for ( int i = 1, e = a.isize(); i <= e; ++i ) {
+					if ( ! get( a( i ) ) ) return false;
+				}
+				return true;
+			}
+
+		};
 	}
 
 	//Integer Variables for the Module
@@ -301,6 +446,11 @@ namespace InputProcessor {
 		NumberArgs.deallocate();
 		AlphaArgsBlank.deallocate();
 		NumberArgsBlank.deallocate();
+		ObjectRecords.deallocate();
+		ObjectItemNums.deallocate();
+		ObjectItemNumsIndexed.deallocate();
+		LineItemAlphasUsed = -1;
+		LineItemNumbersUsed = -1;
 
 		echo_stream = nullptr;
 	}
@@ -361,6 +511,8 @@ namespace InputProcessor {
 		int write_stat;
 		int read_stat;
 
+		EP_PROFILE_ZONE( "ProcessInput" );
+
 		InitSecretObjects();
 
 		EchoInputFile = GetNewUnitNumber();
@@ -402,8 +554,22 @@ namespace InputProcessor {
 		gio::write( EchoInputFile, fmtLD ) << " Processing Data Dictionary -- Start";
 		DisplayString( "Processing Data Dictionary" );
 		ProcessingIDD = true;
-		ProcessDataDicFile( idd_stream, ErrorsInIDD );
-		idd_stream.close();
+		if ( UseCompiledIDD ) {
+			// Definitions compiled by an earlier run from the same IDD are loaded instead of parsing it again
+			std::string const IDDContents( ( std::istreambuf_iterator< char >( idd_stream ) ), std::istreambuf_iterator< char >() );
+			idd_stream.close();
+			std::uint64_t const IDDKey( CompiledIDDKey( IDDContents ) );
+			std::string const CompiledIDDFileName( inputIddFileName + 'c' );
+			if ( ! LoadCompiledIDD( CompiledIDDFileName, IDDKey ) ) {
+				std::istringstream idd_contents_stream( IDDContents );
+				ProcessDataDicFile( idd_contents_stream, ErrorsInIDD );
+				// Not being able to write next to the IDD (e.g. a read-only install) only costs the speedup
+				if ( ! ErrorsInIDD && NumObjectDefs > 0 ) SaveCompiledIDD( CompiledIDDFileName, IDDKey );
+			}
+		} else {
+			ProcessDataDicFile( idd_stream, ErrorsInIDD );
+			idd_stream.close();
+		}
 
 		ListOfObjects.allocate( NumObjectDefs );
 		for ( int i = 1; i <= NumObjectDefs; ++i ) ListOfObjects( i ) = ObjectDef( i ).Name;
@@ -1208,6 +1374,174 @@ namespace InputProcessor {
 
 	}
 
+	std::uint64_t
+	CompiledIDDKey( std::string const & IDDContents ) // Full text of the IDD
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Forms the key that ties a compiled IDD file to the text of the IDD it was compiled from.
+
+		// METHODOLOGY EMPLOYED:
+		// FNV-1a hash of the compiled format version, the program version (so a rebuilt parser never
+		// trusts definitions made by an older one) and every byte of the IDD.
+
+		BinaryPayload::KeyHash Key;
+		Key.add( CompiledIDDFormatVersion );
+		Key.add( VerString.data(), VerString.size() );
+		Key.add( IDDContents.data(), IDDContents.size() );
+		return Key.value();
+	}
+
+	bool
+	LoadCompiledIDD(
+		std::string const & FileName, // Compiled IDD file to read
+		std::uint64_t const IDDKey // Key of the IDD the file must have been compiled from
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Fills SectionDef, ObjectDef and the IDD counts from a compiled IDD file in place of
+		// ProcessDataDicFile.  Returns false, leaving the definitions untouched, when the file is
+		// missing, was compiled from a different IDD or program version, or is damaged.
+
+		// METHODOLOGY EMPLOYED:
+		// The file is read in one go and checked (header, key, byte order, payload checksum) before
+		// anything is decoded.  The definitions are decoded into local arrays and only moved into the
+		// module data once the whole payload has been read.
+
+		if ( ! FileSystem::fileExists( FileName ) ) return false;
+		std::ifstream CompiledFile( FileName, std::ios::binary );
+		if ( ! CompiledFile ) return false;
+		std::string const Contents( ( std::istreambuf_iterator< char >( CompiledFile ) ), std::istreambuf_iterator< char >() );
+
+		// Header
+		CompiledIDDReader Header( Contents.data(), Contents.data() + Contents.size() );
+		char Magic[ sizeof( CompiledIDDMagic ) ];
+		int Version( 0 );
+		std::uint32_t ByteOrder( 0 );
+		std::uint64_t Key( 0 );
+		std::uint64_t PayloadSize( 0 );
+		std::uint64_t PayloadChecksum( 0 );
+		if ( ! Header.get( Magic ) || std::memcmp( Magic, CompiledIDDMagic, sizeof( CompiledIDDMagic ) ) != 0 ) return false;
+		if ( ! Header.get( Version ) || Version != CompiledIDDFormatVersion ) return false;
+		if ( ! Header.get( ByteOrder ) || ByteOrder != CompiledIDDByteOrder ) return false;
+		if ( ! Header.get( Key ) || Key != IDDKey ) return false;
+		if ( ! Header.get( PayloadSize ) || ! Header.get( PayloadChecksum ) ) return false;
+		std::size_t const HeaderSize( sizeof( CompiledIDDMagic ) + sizeof( int ) + sizeof( std::uint32_t ) + 3 * sizeof( std::uint64_t ) );
+		if ( Contents.size() != HeaderSize + PayloadSize ) return false;
+		char const * const Payload( Contents.data() + HeaderSize );
+		if ( CompiledIDDChecksum( Payload, PayloadSize ) != PayloadChecksum ) return false;
+
+		// Payload
+		CompiledIDDReader Reader( Payload, Payload + PayloadSize );
+		std::string VersionLine;
+		int NumObjects( 0 );
+		int NumSections( 0 );
+		int NumObsolete( 0 );
+		int MaxAlphas( 0 );
+		int MaxNumerics( 0 );
+		int NumAlphas( 0 );
+		int NumNumerics( 0 );
+		Array1D_string ObsoleteNames;
+		bool Ok( Reader.get( VersionLine ) && Reader.get( NumObjects ) && Reader.get( NumSections ) && Reader.get( NumObsolete ) && Reader.get( MaxAlphas ) && Reader.get( MaxNumerics ) && Reader.get( NumAlphas ) && Reader.get( NumNumerics ) && Reader.get_list( ObsoleteNames ) );
+		Ok = Ok && NumObjects > 0 && NumSections >= 0 && NumObsolete == ObsoleteNames.isize();
+		if ( ! Ok ) return false;
+
+		// Keep the spare allocation ProcessDataDicFile would have left, since the counts may grow later
+		int const MaxSections( ( NumSections / SectionDefAllocInc + 1 ) * SectionDefAllocInc );
+		int const MaxObjects( ( NumObjects / ObjectDefAllocInc + 1 ) * ObjectDefAllocInc );
+		Array1D< SectionsDefinition > Sections( MaxSections );
+		Array1D< ObjectsDefinition > Objects( MaxObjects );
+		for ( int Loop = 1; Ok && Loop <= NumSections; ++Loop ) {
+			Ok = Reader.get( Sections( Loop ).Name );
+		}
+		for ( int Loop = 1; Ok && Loop <= NumObjects; ++Loop ) {
+			auto & Object( Objects( Loop ) );
+			Ok = Reader.get( Object.Name ) && Reader.get( Object.NumParams ) && Reader.get( Object.NumAlpha ) && Reader.get( Object.NumNumeric ) && Reader.get( Object.MinNumFields ) && Reader.get( Object.NameAlpha1 ) && Reader.get( Object.UniqueObject ) && Reader.get( Object.RequiredObject ) && Reader.get( Object.ExtensibleObject ) && Reader.get( Object.ExtensibleNum ) && Reader.get( Object.LastExtendAlpha ) && Reader.get( Object.LastExtendNum ) && Reader.get( Object.ObsPtr );
+			Ok = Ok && Reader.get_list( Object.AlphaOrNumeric ) && Reader.get_list( Object.ReqField ) && Reader.get_list( Object.AlphRetainCase ) && Reader.get_list( Object.AlphFieldChks ) && Reader.get_list( Object.AlphFieldDefs ) && Reader.get_list( Object.NumRangeChks );
+		}
+		if ( ! Ok || ! Reader.at_end() ) return false;
+
+		SectionDef = std::move( Sections );
+		ObjectDef = std::move( Objects );
+		ObsoleteObjectsRepNames = std::move( ObsoleteNames );
+		IDDVerString = VersionLine;
+		NumSectionDefs = NumSections;
+		NumObjectDefs = NumObjects;
+		MaxSectionDefs = MaxSections;
+		MaxObjectDefs = MaxObjects;
+		NumObsoleteObjects = NumObsolete;
+		MaxAlphaArgsFound = MaxAlphas;
+		MaxNumericArgsFound = MaxNumerics;
+		NumAlphaArgsFound = NumAlphas;
+		NumNumericArgsFound = NumNumerics;
+		return true;
+	}
+
+	bool
+	SaveCompiledIDD(
+		std::string const & FileName, // Compiled IDD file to write
+		std::uint64_t const IDDKey // Key of the IDD the current definitions were read from
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the definitions just read by ProcessDataDicFile to a compiled IDD file so that later
+		// runs with the same IDD can use LoadCompiledIDD.  Returns false if the file could not be written.
+
+		// METHODOLOGY EMPLOYED:
+		// Must be called straight after ProcessDataDicFile, before any object is auto-extended while
+		// reading the IDF.  The file is written through BinaryPayload::write_file, so concurrent runs
+		// sharing an IDD never read a partial file.
+
+		CompiledIDDWriter Writer;
+		Writer.put( IDDVerString );
+		Writer.put( NumObjectDefs );
+		Writer.put( NumSectionDefs );
+		Writer.put( NumObsoleteObjects );
+		Writer.put( MaxAlphaArgsFound );
+		Writer.put( MaxNumericArgsFound );
+		Writer.put( NumAlphaArgsFound );
+		Writer.put( NumNumericArgsFound );
+		Writer.put_list( ObsoleteObjectsRepNames );
+		for ( int Loop = 1; Loop <= NumSectionDefs; ++Loop ) {
+			Writer.put( SectionDef( Loop ).Name );
+		}
+		for ( int Loop = 1; Loop <= NumObjectDefs; ++Loop ) {
+			auto const & Object( ObjectDef( Loop ) );
+			Writer.put( Object.Name );
+			Writer.put( Object.NumParams );
+			Writer.put( Object.NumAlpha );
+			Writer.put( Object.NumNumeric );
+			Writer.put( Object.MinNumFields );
+			Writer.put( Object.NameAlpha1 );
+			Writer.put( Object.UniqueObject );
+			Writer.put( Object.RequiredObject );
+			Writer.put( Object.ExtensibleObject );
+			Writer.put( Object.ExtensibleNum );
+			Writer.put( Object.LastExtendAlpha );
+			Writer.put( Object.LastExtendNum );
+			Writer.put( Object.ObsPtr );
+			Writer.put_list( Object.AlphaOrNumeric );
+			Writer.put_list( Object.ReqField );
+			Writer.put_list( Object.AlphRetainCase );
+			Writer.put_list( Object.AlphFieldChks );
+			Writer.put_list( Object.AlphFieldDefs );
+			Writer.put_list( Object.NumRangeChks );
+		}
+
+		CompiledIDDWriter Header;
+		Header.put( CompiledIDDMagic );
+		Header.put( CompiledIDDFormatVersion );
+		Header.put( CompiledIDDByteOrder );
+		Header.put( IDDKey );
+		Header.put( static_cast< std::uint64_t >( Writer.buffer.size() ) );
+		Header.put( CompiledIDDChecksum( Writer.buffer.data(), Writer.buffer.size() ) );
+
+		Header.buffer.append( Writer.buffer );
+		return BinaryPayload::write_file( FileName, Header.buffer );
+	}
+
 	void
 	ProcessInputDataFile( std::istream & idf_stream )
 	{
@@ -1258,6 +1592,8 @@ namespace InputProcessor {
 		LineItem.NumBlank.allocate( MaxNumericArgsFound );
 		LineItem.Alphas.allocate( MaxAlphaArgsFound );
 		LineItem.AlphBlank.allocate( MaxAlphaArgsFound );
+		LineItemAlphasUsed = -1;
+		LineItemNumbersUsed = -1;
 
 		// Check file
 		cross_platform_get_line( idf_stream, InputLine );
@@ -1283,8 +1619,8 @@ namespace InputProcessor {
 					}
 				} else {
 					ValidateObjectandParse( idf_stream, InputLine.substr( 0, Pos ), Pos, EndofFile );
-					if ( NumIDFRecords == MaxIDFRecords ) {
-						IDFRecords.redimension( MaxIDFRecords += ObjectsIDFAllocInc );
+					if ( NumIDFRecords == MaxIDFRecords ) { // Grow geometrically: each redimension moves every record read so far
+						IDFRecords.redimension( MaxIDFRecords += max( ObjectsIDFAllocInc, MaxIDFRecords / 2 ) );
 					}
 				}
 			} else { // Error condition, no , or ; on first line
@@ -1306,6 +1642,44 @@ namespace InputProcessor {
 			}
 		}
 
+		BuildObjectRecordIndex();
+
+	}
+
+	void
+	BuildObjectRecordIndex()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Lists the IDF records of each object definition so that GetObjectItem, GetObjectItemNum and
+		// TellMeHowManyObjectItemArgs go straight to the records of the requested type instead of
+		// scanning IDFRecords on every call.
+
+		// METHODOLOGY EMPLOYED:
+		// Records are filed under the definition whose name they carry.  That is normally ObjectDefPtr,
+		// but deferred transitions rename the record after it is validated, so the name is looked up
+		// when the two disagree.
+
+		ObjectRecords.deallocate();
+		ObjectRecords.allocate( NumObjectDefs );
+		ObjectItemNums.deallocate();
+		ObjectItemNums.allocate( NumObjectDefs );
+		ObjectItemNumsIndexed.dimension( NumObjectDefs, false );
+		for ( int Loop = 1; Loop <= NumIDFRecords; ++Loop ) {
+			auto const & Record( IDFRecords( Loop ) );
+			int Which( Record.ObjectDefPtr );
+			if ( Which < 1 || Which > NumObjectDefs || ObjectDef( Which ).Name != Record.Name ) {
+				if ( SortedIDD ) {
+					Which = FindItemInSortedList( Record.Name, ListOfObjects, NumObjectDefs );
+					if ( Which != 0 ) Which = iListOfObjects( Which );
+				} else {
+					Which = FindItemInList( Record.Name, ListOfObjects, NumObjectDefs );
+				}
+				if ( Which == 0 ) continue;
+			}
+			ObjectRecords( Which ).push_back( Loop );
+		}
+
 	}
 
 	void
@@ -1580,12 +1954,29 @@ namespace InputProcessor {
 
 				errFlag = false;
 				LineItem.Name = SqueezedObject;
-				LineItem.Alphas = BlankString;
-				LineItem.AlphBlank = false;
+				// The LineItem arrays are sized for the largest definition in the IDD: only reset the fields earlier objects used
+				if ( LineItemAlphasUsed < 0 ) {
+					LineItem.Alphas = BlankString;
+					LineItem.AlphBlank = false;
+				} else {
+					for ( int i = 1; i <= LineItemAlphasUsed; ++i ) {
+						LineItem.Alphas( i ).clear();
+						LineItem.AlphBlank( i ) = false;
+					}
+				}
+				LineItemAlphasUsed = 0;
 				LineItem.NumAlphas = 0;
-				LineItem.Numbers = 0.0;
+				if ( LineItemNumbersUsed < 0 ) {
+					LineItem.Numbers = 0.0;
+					LineItem.NumBlank = false;
+				} else {
+					for ( int i = 1; i <= LineItemNumbersUsed; ++i ) {
+						LineItem.Numbers( i ) = 0.0;
+						LineItem.NumBlank( i ) = false;
+					}
+				}
+				LineItemNumbersUsed = 0;
 				LineItem.NumNumbers = 0;
-				LineItem.NumBlank = false;
 				LineItem.ObjectDefPtr = Found;
 				NumArgExpected = ObjectDef( Found ).NumParams;
 				++ObjectDef( Found ).NumFound;
@@ -1640,7 +2031,8 @@ namespace InputProcessor {
 				CurLines = NumLines;
 			}
 			if ( CurPos < static_cast< std::string::size_type >( InputLineLength ) ) {
-				Pos = scan( InputLine.substr( CurPos, InputLineLength - CurPos ), ",;" );
+				Pos = InputLine.find_first_of( ",;", CurPos );
+				Pos = ( Pos < static_cast< std::string::size_type >( InputLineLength ) ? Pos - CurPos : std::string::npos );
 				if ( Pos == std::string::npos ) {
 					if ( InputLine[ InputLineLength - 1 ] == '!' ) {
 						LenLeft = len_trim( InputLine.substr( CurPos, InputLineLength - CurPos - 1 ) );
@@ -1669,8 +2061,10 @@ namespace InputProcessor {
 			if ( Pos != std::string::npos ) {
 				if ( ! errFlag ) {
 					if ( Pos > 0 ) {
-						SqueezedArg = MakeUPPERCase( stripped( InputLine.substr( CurPos, Pos ) ) );
-						if ( len( stripped( InputLine.substr( CurPos, Pos ) ) ) > static_cast< std::string::size_type >( MaxAlphaArgLength ) ) {
+						SqueezedArg.assign( InputLine, CurPos, Pos );
+						strip( SqueezedArg );
+						SqueezedArg = MakeUPPERCase( SqueezedArg );
+						if ( len( SqueezedArg ) > static_cast< std::string::size_type >( MaxAlphaArgLength ) ) {
 							DumpCurrentLineBuffer( StartLine, cStartLine, cStartName, NumLines, NumConxLines, LineBuf, CurQPtr );
 							ShowWarningError( "IP: IDF line~" + IPTrimSigDigits( NumLines ) + " Alpha Argument length exceeds maximum, will be truncated=" + InputLine.substr( CurPos, Pos - 1 ), EchoInputFile );
 							ShowContinueError( "Will be processed as Alpha=" + SqueezedArg, EchoInputFile );
@@ -1890,6 +2284,9 @@ namespace InputProcessor {
 			}
 		}
 
+		if ( LineItemAlphasUsed >= 0 ) LineItemAlphasUsed = max( LineItemAlphasUsed, LineItem.NumAlphas );
+		if ( LineItemNumbersUsed >= 0 ) LineItemNumbersUsed = max( LineItemNumbersUsed, LineItem.NumNumbers );
+
 		if ( ! errFlag && ! IDidntMeanIt ) {
 			if ( TransitionDefer ) {
 				MakeTransition( Found );
@@ -2289,7 +2686,6 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Count;
 		int LoopIndex;
 		std::string ObjectWord;
 		std::string UCObject;
@@ -2302,7 +2698,6 @@ namespace InputProcessor {
 		int MaxAlphas;
 		int MaxNumbers;
 		int Found;
-		int StartRecord;
 		std::string cfld1;
 		std::string cfld2;
 		bool GoodItem;
@@ -2325,7 +2720,6 @@ namespace InputProcessor {
 			AlphaArgsBlank.allocate( MaxAlphaArgsFound );
 		}
 
-		Count = 0;
 		Status = -1;
 		UCObject = MakeUPPERCase( Object );
 		if ( SortedIDD ) {
@@ -2355,11 +2749,11 @@ namespace InputProcessor {
 			Numbers( {1,ObjectDef( Found ).NumNumeric} ) = 0.0;
 		}
 
-		StartRecord = ObjectStartRecord( Found );
-		if ( StartRecord == 0 ) {
+		if ( ObjectRecords.isize() != NumObjectDefs ) BuildObjectRecordIndex(); // IDD processed without an IDF
+		auto const & Records( ObjectRecords( Found ) );
+		if ( Records.empty() ) {
 			ShowWarningError( "IP: GetObjectItem: Requested object=" + UCObject + ", not found in IDF." );
 			Status = -1;
-			StartRecord = NumIDFRecords + 1;
 		}
 
 		if ( ObjectGotCount( Found ) == 0 ) {
@@ -2367,43 +2761,38 @@ namespace InputProcessor {
 		}
 		++ObjectGotCount( Found );
 
-		for ( LoopIndex = StartRecord; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
-			if ( IDFRecords( LoopIndex ).Name == UCObject ) {
-				++Count;
-				if ( Count == Number ) {
-					IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
-					// Read this one
-					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
-					if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
-						ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
-					}
-					NumAlphas = min( MaxAlphas, NumAlphas );
-					NumNumbers = min( MaxNumbers, NumNumbers );
-					GoodItem = true;
-					if ( NumAlphas > 0 ) {
-						Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
-					}
-					if ( NumNumbers > 0 ) {
-						Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
-					}
-					if ( present( NumBlank ) ) {
-						NumBlank = true;
-						if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
-					}
-					if ( present( AlphaBlank ) ) {
-						AlphaBlank = true;
-						if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
-					}
-					if ( present( AlphaFieldNames ) ) {
-						AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
-					}
-					if ( present( NumericFieldNames ) ) {
-						for ( int i = 1, e = ObjectDef( Found ).NumNumeric; i <= e; ++i ) NumericFieldNames()( i ) = ObjectDef( Found ).NumRangeChks( i ).FieldName;
-					}
-					Status = 1;
-					break;
-				}
+		if ( Number >= 1 && Number <= int( Records.size() ) ) {
+			LoopIndex = Records[ Number - 1 ];
+			IDFRecordsGotten( LoopIndex ) = true; // only object level "gets" recorded
+			// Read this one
+			GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlphas, NumNumbers, AlphaArgs, NumberArgs, AlphaArgsBlank, NumberArgsBlank );
+			if ( NumAlphas > MaxAlphas || NumNumbers > MaxNumbers ) {
+				ShowFatalError( "IP: GetObjectItem: Too many actual arguments for those expected on Object: " + ObjectWord, EchoInputFile );
+			}
+			NumAlphas = min( MaxAlphas, NumAlphas );
+			NumNumbers = min( MaxNumbers, NumNumbers );
+			GoodItem = true;
+			if ( NumAlphas > 0 ) {
+				Alphas( {1,NumAlphas} ) = AlphaArgs( {1,NumAlphas} );
 			}
+			if ( NumNumbers > 0 ) {
+				Numbers( {1,NumNumbers} ) = NumberArgs( {1,NumNumbers} );
+			}
+			if ( present( NumBlank ) ) {
+				NumBlank = true;
+				if ( NumNumbers > 0 ) NumBlank()( {1,NumNumbers} ) = NumberArgsBlank( {1,NumNumbers} );
+			}
+			if ( present( AlphaBlank ) ) {
+				AlphaBlank = true;
+				if ( NumAlphas > 0 ) AlphaBlank()( {1,NumAlphas} ) = AlphaArgsBlank( {1,NumAlphas} );
+			}
+			if ( present( AlphaFieldNames ) ) {
+				AlphaFieldNames()( {1,ObjectDef( Found ).NumAlpha} ) = ObjectDef( Found ).AlphFieldChks( {1,ObjectDef( Found ).NumAlpha} );
+			}
+			if ( present( NumericFieldNames ) ) {
+				for ( int i = 1, e = ObjectDef( Found ).NumNumeric; i <= e; ++i ) NumericFieldNames()( i ) = ObjectDef( Found ).NumRangeChks( i ).FieldName;
+			}
+			Status = 1;
 		}
 
 #ifdef IDDTEST
@@ -2480,7 +2869,8 @@ namespace InputProcessor {
 
 		// METHODOLOGY EMPLOYED:
 		// Use internal IDF record structure for each object occurrence
-		// and compare the name with ObjName.
+		// and compare the name with ObjName.  The names of each object type
+		// are indexed on the first request for that type.
 
 		// REFERENCES:
 		// na
@@ -2501,14 +2891,11 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DEFINITIONS
-		int NumObjOfType; // Total number of Object Type in IDF
-		int ObjNum; // Loop index variable
 		int ItemNum; // Item number for Object Name
 		int Found; // Indicator for Object Type in list of Valid Objects
 		std::string UCObjType; // Upper Case for ObjType
 		bool ItemFound; // Set to true if item found
 		bool ObjectFound; // Set to true if object found
-		int StartRecord; // Start record for objects
 
 		ItemNum = 0;
 		ItemFound = false;
@@ -2524,20 +2911,22 @@ namespace InputProcessor {
 		if ( Found != 0 ) {
 
 			ObjectFound = true;
-			NumObjOfType = ObjectDef( Found ).NumFound;
-			ItemNum = 0;
-			StartRecord = ObjectStartRecord( Found );
-
-			if ( StartRecord > 0 ) {
-				for ( ObjNum = StartRecord; ObjNum <= NumIDFRecords; ++ObjNum ) {
-					if ( IDFRecords( ObjNum ).Name != UCObjType ) continue;
-					++ItemNum;
-					if ( ItemNum > NumObjOfType ) break;
-					if ( IDFRecords( ObjNum ).Alphas( 1 ) == ObjName ) {
-						ItemFound = true;
-						break;
-					}
+			if ( ObjectRecords.isize() != NumObjectDefs ) BuildObjectRecordIndex(); // IDD processed without an IDF
+			auto & ItemNums( ObjectItemNums( Found ) );
+			if ( ! ObjectItemNumsIndexed( Found ) ) {
+				auto const & Records( ObjectRecords( Found ) );
+				int const NumObjOfType( min( ObjectDef( Found ).NumFound, int( Records.size() ) ) ); // Total number of Object Type in IDF
+				for ( int Item = 1; Item <= NumObjOfType; ++Item ) {
+					auto const & Record( IDFRecords( Records[ Item - 1 ] ) );
+					if ( Record.Alphas.empty() ) continue;
+					ItemNums.emplace( Record.Alphas( 1 ), Item ); // First occurrence of a name wins
 				}
+				ObjectItemNumsIndexed( Found ) = true;
+			}
+			auto const ItemNumIt( ItemNums.find( ObjName ) );
+			if ( ItemNumIt != ItemNums.end() ) {
+				ItemNum = ItemNumIt->second;
+				ItemFound = true;
 			}
 		}
 
@@ -2595,22 +2984,21 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Count;
-		int LoopIndex;
+		int Found;
 		std::string ObjectWord;
 
-		Count = 0;
 		Status = -1;
-		for ( LoopIndex = 1; LoopIndex <= NumIDFRecords; ++LoopIndex ) {
-			if ( SameString( IDFRecords( LoopIndex ).Name, Object ) ) {
-				++Count;
-				if ( Count == Number ) {
-					// Read this one
-					GetObjectItemfromFile( LoopIndex, ObjectWord, NumAlpha, NumNumbers );
-					Status = 1;
-					break;
-				}
-			}
+		if ( SortedIDD ) {
+			Found = FindItemInSortedList( MakeUPPERCase( Object ), ListOfObjects, NumObjectDefs );
+			if ( Found != 0 ) Found = iListOfObjects( Found );
+		} else {
+			Found = FindItemInList( MakeUPPERCase( Object ), ListOfObjects, NumObjectDefs );
+		}
+		if ( ObjectRecords.isize() != NumObjectDefs ) BuildObjectRecordIndex(); // IDD processed without an IDF
+		if ( Found != 0 && Number >= 1 && Number <= int( ObjectRecords( Found ).size() ) ) {
+			// Read this one
+			GetObjectItemfromFile( ObjectRecords( Found )[ Number - 1 ], ObjectWord, NumAlpha, NumNumbers );
+			Status = 1;
 		}
 
 	}
@@ -2661,12 +3049,10 @@ namespace InputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-
-		// Object Data
-		LineDefinition xLineItem; // Description of current record
+		// na
 
 		if ( Which > 0 && Which <= NumIDFRecords ) {
-			xLineItem = IDFRecords( Which );
+			auto const & xLineItem( IDFRecords( Which ) ); // Description of current record
 			ObjectWord = xLineItem.Name;
 			NumAlpha = xLineItem.NumAlphas;
 			NumNumeric = xLineItem.NumNumbers;
@@ -2772,7 +3158,7 @@ namespace InputProcessor {
 				Slash = ( ProcessingIDD ? InputLine.find( '\\' ) : std::string::npos );
 				InputLineLength = static_cast< int >( Pos + 1 );
 				if ( Pos > 0 ) {
-					if ( is_blank( InputLine.substr( 0, Pos ) ) ) {
+					if ( InputLine.find_first_not_of( ' ' ) >= Pos ) { // Only a comment
 						BlankLine = true;
 					}
 				} else {
@@ -2953,7 +3339,7 @@ namespace InputProcessor {
 				Slash = ( ProcessingIDD ? InputLine.find( '\\' ) : std::string::npos );
 				InputLineLength = static_cast< int >( Pos + 1 );
 				if ( Pos > 0 ) {
-					if ( is_blank( InputLine.substr( 0, Pos ) ) ) {
+					if ( InputLine.find_first_not_of( ' ' ) >= Pos ) { // Only a comment
 						BlankLine = true;
 					}
 				} else {
@@ -3219,6 +3605,7 @@ namespace InputProcessor {
 				LineItem.Alphas.redimension( ObjectDef( ObjectNum ).NumAlpha + NumNewAlphas );
 
 				LineItem.AlphBlank.redimension( ObjectDef( ObjectNum ).NumAlpha + NumNewAlphas, true );
+				LineItemAlphasUsed = -1;
 
 				MaxAlphaArgsFound = ObjectDef( ObjectNum ).NumAlpha + NumNewAlphas;
 				//      MaxArgsChanged=.TRUE.
@@ -3240,6 +3627,7 @@ namespace InputProcessor {
 				LineItem.Numbers.redimension( ObjectDef( ObjectNum ).NumNumeric + NumNewNumerics, 0.0 );
 
 				LineItem.NumBlank.redimension( ObjectDef( ObjectNum ).NumNumeric + NumNewNumerics, true );
+				LineItemNumbersUsed = -1;
 
 				MaxNumericArgsFound = ObjectDef( ObjectNum ).NumNumeric + NumNewNumerics;
 				//      MaxArgsChanged=.TRUE.
@@ -3311,7 +3699,15 @@ namespace InputProcessor {
 		if ( StringLen == 0 ) return rProcessNumber;
 		int IoStatus( 0 );
 		if ( PString.find_first_not_of( ValidNumerics ) == std::string::npos ) {
-			{ IOFlags flags; gio::read( PString, fmtLD, flags ) >> rProcessNumber; IoStatus = flags.ios(); }
+			// A plain decimal converts with strtod exactly as the list-directed read does: only fall back to it otherwise
+			char const * const Start( PString.c_str() );
+			char * End( nullptr );
+			errno = 0;
+			rProcessNumber = std::strtod( Start, &End );
+			if ( ( End != Start + StringLen ) || ( errno == ERANGE ) ) {
+				rProcessNumber = 0.0;
+				{ IOFlags flags; gio::read( PString, fmtLD, flags ) >> rProcessNumber; IoStatus = flags.ios(); }
+			}
 			ErrorFlag = false;
 		} else {
 			rProcessNumber = 0.0;
@@ -3937,6 +4333,43 @@ namespace InputProcessor {
 
 	}
 
+	void
+	VerifyName(
+		std::string const & NameToVerify,
+		NameIndex & NamesIndex,
+		bool & ErrorFound,
+		bool & IsBlank,
+		std::string const & StringToDisplay
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine verifys that a new name can be added to the
+		// list of names indexed by NamesIndex (i.e., that there isn't one of that
+		// name already and that this name is not blank).
+
+		// METHODOLOGY EMPLOYED:
+		// The name is looked up in the index of the names already verified and then
+		// added to it, even if it is in error, so the index item numbers stay those
+		// of the list being built.  Callers verify every name of the list in order.
+
+		ErrorFound = false;
+		if ( NamesIndex.find_caseless( NameToVerify ) != 0 ) {
+			ShowSevereError( StringToDisplay + ", duplicate name=" + NameToVerify );
+			ErrorFound = true;
+		}
+		NamesIndex.add( NameToVerify );
+
+		if ( NameToVerify.empty() ) {
+			ShowSevereError( StringToDisplay + ", cannot be blank" );
+			ErrorFound = true;
+			IsBlank = true;
+		} else {
+			IsBlank = false;
+		}
+
+	}
+
 	void
 	RangeCheck(
 		bool & ErrorsFound, // Set to true if error detected
@@ -4937,6 +5370,8 @@ namespace InputProcessor {
 		LineItem.NumNumbers = 0;
 		LineItem.NumBlank = false;
 		LineItem.ObjectDefPtr = Which;
+		LineItemAlphasUsed = -1;
+		LineItemNumbersUsed = -1;
 
 		++ObjectDef( Which ).NumFound;
 
@@ -48,6 +48,7 @@
 #define InputProcessor_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <iosfwd>
 #include <type_traits>
 #include <memory>
@@ -62,6 +63,7 @@
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataGlobals.hh>
+#include <NameIndex.hh>
 #include <UtilityRoutines.hh>
 
 namespace EnergyPlus {
@@ -81,6 +83,7 @@ namespace InputProcessor {
 	// when max is reached
 	extern int const ObjectsIDFAllocInc; // Initial number of Objects allowed in IDF as well as the increment
 	// when max is reached
+	extern int const CompiledIDDFormatVersion; // Bumped whenever the layout of the compiled IDD file changes
 	extern std::string::size_type const MaxObjectNameLength; // Maximum number of characters in an Object Name
 	extern std::string::size_type const MaxSectionNameLength; // Maximum number of characters in a Section Name
 	extern std::string::size_type const MaxAlphaArgLength; // Maximum number of characters in an Alpha Argument
@@ -356,9 +359,27 @@ namespace InputProcessor {
 		bool & ErrorsFound // set to true if errors found here
 	);
 
+	std::uint64_t
+	CompiledIDDKey( std::string const & IDDContents ); // Full text of the IDD
+
+	bool
+	LoadCompiledIDD(
+		std::string const & FileName, // Compiled IDD file to read
+		std::uint64_t const IDDKey // Key of the IDD the file must have been compiled from
+	);
+
+	bool
+	SaveCompiledIDD(
+		std::string const & FileName, // Compiled IDD file to write
+		std::uint64_t const IDDKey // Key of the IDD the current definitions were read from
+	);
+
 	void
 	ProcessInputDataFile( std::istream & idf_stream );
 
+	void
+	BuildObjectRecordIndex();
+
 	void
 	ValidateSection(
 		std::string const & ProposedSection,
@@ -925,6 +946,15 @@ namespace InputProcessor {
 		std::string const & StringToDisplay
 	);
 
+	void
+	VerifyName(
+		std::string const & NameToVerify,
+		NameIndex & NamesIndex,
+		bool & ErrorFound,
+		bool & IsBlank,
+		std::string const & StringToDisplay
+	);
+
 	template< typename A >
 	inline
 	void
@@ -0,0 +1,190 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus Headers
+#include <EnergyPlus/NameIndex.hh>
+#include <EnergyPlus/BinaryPayload.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/string.functions.hh>
+
+namespace EnergyPlus {
+
+	using ObjexxFCL::equali;
+
+	// Add the name of the next item: Returns its item number
+	int
+	NameIndex::add( std::string const & name )
+	{
+		int const item( ++n_ );
+		std::uint64_t const h( hash( name ) );
+		Entry const * found( lookup( name, h ) );
+		if ( found == nullptr ) {
+			if ( 2u * ( entries_.size() + 1u ) > slots_.size() ) rehash( entries_.size() + 1u );
+			entries_.emplace_back();
+			Entry & entry( entries_.back() );
+			entry.hash = h;
+			entry.name = name;
+			entry.item = item;
+			place( h, int( entries_.size() - 1u ) );
+		} else if ( found->name != name ) { // Another spelling
+			Entry & entry( entries_[ found - entries_.data() ] );
+			bool known( false );
+			for ( auto const & spelling : entry.spellings ) {
+				if ( spelling.first == name ) {
+					known = true;
+					break;
+				}
+			}
+			if ( ! known ) entry.spellings.emplace_back( name, item );
+		}
+		return item;
+	}
+
+	// Item number of the first item named exactly name, or 0: FindItemInList
+	int
+	NameIndex::find( std::string const & name ) const
+	{
+		Entry const * entry( lookup( name, hash( name ) ) );
+		if ( entry == nullptr ) return 0;
+		if ( entry->name == name ) return entry->item;
+		for ( auto const & spelling : entry->spellings ) {
+			if ( spelling.first == name ) return spelling.second;
+		}
+		return 0;
+	}
+
+	// Item number of the first item named exactly name, else of the first named name ignoring case, or 0: FindItem
+	int
+	NameIndex::find_caseless( std::string const & name ) const
+	{
+		Entry const * entry( lookup( name, hash( name ) ) );
+		if ( entry == nullptr ) return 0;
+		if ( entry->name == name ) return entry->item;
+		for ( auto const & spelling : entry->spellings ) {
+			if ( spelling.first == name ) return spelling.second;
+		}
+		return entry->item;
+	}
+
+	// Remove all names
+	void
+	NameIndex::clear()
+	{
+		n_ = 0;
+		entries_.clear();
+		slots_.clear();
+	}
+
+	// Room for n names without rehashing
+	void
+	NameIndex::reserve( int const n )
+	{
+		if ( n <= 0 ) return;
+		entries_.reserve( size_type( n ) );
+		if ( 2u * size_type( n ) > slots_.size() ) rehash( size_type( n ) );
+	}
+
+	// Names equal ignoring case?
+	bool
+	NameIndex::same(
+	 std::string const & a,
+	 std::string const & b
+	)
+	{
+		return equali( a, b );
+	}
+
+	// Hash of the case-insensitive form of a name: 64-bit FNV-1a of the lowercased characters
+	std::uint64_t
+	NameIndex::hash( std::string const & name )
+	{
+		BinaryPayload::KeyHash h;
+		h.add_lower( name );
+		return h.value();
+	}
+
+	// Entry of a name ignoring case, or nullptr
+	NameIndex::Entry const *
+	NameIndex::lookup(
+	 std::string const & name,
+	 std::uint64_t const h
+	) const
+	{
+		if ( slots_.empty() ) return nullptr;
+		size_type const mask( slots_.size() - 1u );
+		for ( size_type i = size_type( h ) & mask; slots_[ i ] != 0; i = ( i + 1u ) & mask ) {
+			Entry const & entry( entries_[ slots_[ i ] - 1 ] );
+			if ( ( entry.hash == h ) && same( entry.name, name ) ) return &entry;
+		}
+		return nullptr;
+	}
+
+	// Place an entry number in the slot table
+	void
+	NameIndex::place(
+	 std::uint64_t const h,
+	 int const e
+	)
+	{
+		size_type const mask( slots_.size() - 1u );
+		size_type i( size_type( h ) & mask );
+		while ( slots_[ i ] != 0 ) i = ( i + 1u ) & mask;
+		slots_[ i ] = e + 1;
+	}
+
+	// Grow the slot table to hold n entries at no more than half load
+	void
+	NameIndex::rehash( size_type const n )
+	{
+		size_type size( 16u );
+		while ( size < 2u * n ) size *= 2u;
+		if ( size <= slots_.size() ) return;
+		slots_.assign( size, 0 );
+		for ( size_type e = 0; e < entries_.size(); ++e ) place( entries_[ e ].hash, int( e ) );
+	}
+
+} // EnergyPlus
@@ -0,0 +1,274 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EnergyPlus_NameIndex_hh_INCLUDED
+#define EnergyPlus_NameIndex_hh_INCLUDED
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace EnergyPlus {
+
+// Package: Name Index
+//
+// Purpose: Hash index of the names of a 1-based list (objects, nodes, schedules, curves, ...) that
+//  answers InputProcessor::FindItemInList and FindItem lookups in constant time instead of a scan
+//
+// Notes:
+//  Names are added in item order: the n-th name added is item n
+//  Names are hashed on their case-insensitive form into an open addressing table (linear probing)
+//   so both the exact and the case-insensitive lookups probe the same slot chain
+//  Where a list holds names that differ only in case each spelling keeps its first item, so the
+//   lookups return exactly what the linear scans return
+//  The name-only lookups do not see changes made to the list after the names were added: renaming
+//   or removing items needs a clear() and a rebuild
+//  The list-aware lookups reindex the list when its size differs from the names added or when a hit
+//   is past its end or names another item, so a list that only grows or shrinks needs no upkeep
+//  A miss in a list of unchanged size is not checked against the list, so it stays a hash probe:
+//   owners that rename items in place must clear() the index (debug builds assert that they did)
+
+class NameIndex
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+
+public: // Creation
+
+	// Default Constructor
+	NameIndex() = default;
+
+	// Names of items 1..n of a list
+	template< typename Container >
+	NameIndex(
+	 Container const & items,
+	 int const n
+	)
+	{
+		build( items, n );
+	}
+
+public: // Properties
+
+	// Number of names added
+	int
+	size() const
+	{
+		return n_;
+	}
+
+	// Empty?
+	bool
+	empty() const
+	{
+		return n_ == 0;
+	}
+
+public: // Methods
+
+	// Add the name of the next item: Returns its item number
+	int
+	add( std::string const & name );
+
+	// Item number of the first item named exactly name, or 0: FindItemInList
+	int
+	find( std::string const & name ) const;
+
+	// Item number of the first item named exactly name, else of the first named name ignoring case, or 0: FindItem
+	int
+	find_caseless( std::string const & name ) const;
+
+	// Remove all names
+	void
+	clear();
+
+	// Item number of the first of items 1..n of a list named exactly name, or 0: FindItemInList
+	//  Reindexes the list on a hit past its end or renamed, or on a miss if it changed size
+	template< typename Container >
+	int
+	find(
+	 std::string const & name,
+	 Container const & items,
+	 int const n
+	)
+	{
+		int item( find( name ) );
+		if ( ( item == 0 ) ? ( n != n_ ) : ( ( item > n ) || ( name_of( items( item ) ) != name ) ) ) { // Stale
+			build( items, n );
+			item = find( name );
+		}
+		assert( ( item != 0 ) || ! holds( name, items, n, false ) ); // Renamed without a clear()
+		return item;
+	}
+
+	// Item number of the first of items 1..n of a list named name, exactly else ignoring case, or 0: FindItem
+	//  Reindexes the list on a hit past its end or renamed, or on a miss if it changed size
+	template< typename Container >
+	int
+	find_caseless(
+	 std::string const & name,
+	 Container const & items,
+	 int const n
+	)
+	{
+		int item( find_caseless( name ) );
+		if ( ( item == 0 ) ? ( n != n_ ) : ( ( item > n ) || ( ! same( name_of( items( item ) ), name ) ) ) ) { // Stale
+			build( items, n );
+			item = find_caseless( name );
+		}
+		assert( ( item != 0 ) || ! holds( name, items, n, true ) ); // Renamed without a clear()
+		return item;
+	}
+
+	// Index the names of items 1..n of a list of names or of elements with a Name
+	template< typename Container >
+	void
+	build(
+	 Container const & items,
+	 int const n
+	)
+	{
+		clear();
+		reserve( n );
+		for ( int i = 1; i <= n; ++i ) add( name_of( items( i ) ) );
+	}
+
+	// Room for n names without rehashing
+	void
+	reserve( int const n );
+
+private: // Types
+
+	// Names equal ignoring case
+	struct Entry
+	{
+		std::uint64_t hash = 0u;
+		std::string name; // Spelling of the first item
+		int item = 0; // First item
+		std::vector< std::pair< std::string, int > > spellings; // Other spellings and their first items
+	};
+
+private: // Static Methods
+
+	// Name of a list element
+	static
+	std::string const &
+	name_of( std::string const & name )
+	{
+		return name;
+	}
+
+	// Name of a list element
+	template< typename T >
+	static
+	std::string const &
+	name_of( T const & item )
+	{
+		return item.Name;
+	}
+
+	// Names equal ignoring case?
+	static
+	bool
+	same( std::string const & a, std::string const & b );
+
+	// Items 1..n of a list hold name, exactly or ignoring case? (Debug check of a miss)
+	template< typename Container >
+	static
+	bool
+	holds(
+	 std::string const & name,
+	 Container const & items,
+	 int const n,
+	 bool const caseless
+	)
+	{
+		for ( int i = 1; i <= n; ++i ) {
+			std::string const & item_name( name_of( items( i ) ) );
+			if ( caseless ? same( item_name, name ) : ( item_name == name ) ) return true;
+		}
+		return false;
+	}
+
+	// Hash of the case-insensitive form of a name
+	static
+	std::uint64_t
+	hash( std::string const & name );
+
+private: // Methods
+
+	// Entry of a name ignoring case, or nullptr
+	Entry const *
+	lookup( std::string const & name, std::uint64_t const h ) const;
+
+	// Place an entry number in the slot table
+	void
+	place( std::uint64_t const h, int const e );
+
+	// Grow the slot table to hold n entries at no more than half load
+	void
+	rehash( size_type const n );
+
+private: // Data
+
+	int n_ = 0; // Names added
+	std::vector< Entry > entries_;
+	std::vector< int > slots_; // Entry number + 1 in each slot, 0 if free: size is a power of 2
+
+};
+
+} // EnergyPlus
+
+#endif
@@ -62,6 +62,7 @@
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
+#include <NameIndex.hh>
 #include <OutputProcessor.hh>
 #include <Psychrometrics.hh>
 #include <ScheduleManager.hh>
@@ -133,6 +134,9 @@ namespace NodeInputManager {
 	Array1D< NodeListDef > NodeLists; // Node Lists
 	namespace {
 		bool CalcMoreNodeInfoMyOneTimeFlag( true ); // one time flag
+		NameIndex NodeListsIndex; // Index of the NodeLists names
+		NameIndex NodeIDIndex; // Index of NodeID( 1:NumOfUniqueNodeNames )
+		NameIndex UniqueNodeNamesIndex; // Index of UniqueNodeNames( 1:NumCheckNodes )
 	}
 	// MODULE SUBROUTINES:
 	//*************************************************************************
@@ -156,6 +160,9 @@ namespace NodeInputManager {
 		MaxCheckNodes = 0;
 		NodeVarsSetup = false;
 		NodeLists.deallocate();
+		NodeListsIndex.clear();
+		NodeIDIndex.clear();
+		UniqueNodeNamesIndex.clear();
 	}
 
 	void
@@ -235,7 +242,7 @@ namespace NodeInputManager {
 		}
 
 		if ( not_blank( Name ) ) {
-			ThisOne = FindItemInList( Name, NodeLists );
+			ThisOne = NodeListsIndex.find( Name, NodeLists, NodeLists.isize() );
 			if ( ThisOne != 0 ) {
 				NumNodes = NodeLists( ThisOne ).NumOfNodesInList;
 				NodeNumbers( {1,NumNodes} ) = NodeLists( ThisOne ).NodeNumbers( {1,NumNodes} );
@@ -348,7 +355,7 @@ namespace NodeInputManager {
 
 		Try = 0;
 		if ( NumOfNodeLists > 0 ) {
-			Try = FindItemInList( Name, NodeLists );
+			Try = NodeListsIndex.find( Name, NodeLists, NodeLists.isize() );
 		}
 
 		if ( Try != 0 ) {
@@ -677,7 +684,8 @@ namespace NodeInputManager {
 
 		// METHODOLOGY EMPLOYED:
 		// Look to see if a name has already been entered.  Use the index of
-		// the array as the node number, if there.
+		// the array as the node number, if there.  Names are looked up in a hash
+		// index of NodeID and the node arrays grow geometrically.
 
 		// REFERENCES:
 		// na
@@ -714,7 +722,7 @@ namespace NodeInputManager {
 
 		NumNode = 0;
 		if ( NumOfUniqueNodeNames > 0 ) {
-			NumNode = FindItemInList( Name, NodeID( {1,NumOfUniqueNodeNames} ), NumOfUniqueNodeNames );
+			NumNode = NodeIDIndex.find( Name );
 			if ( NumNode > 0 ) {
 				AssignNodeNumber = NumNode;
 				++NodeRef( NumNode );
@@ -732,6 +740,13 @@ namespace NodeInputManager {
 				++NumOfUniqueNodeNames;
 				NumOfNodes = NumOfUniqueNodeNames;
 
+				if ( Node.size() == Node.capacity() ) { // Grow geometrically so the redimensions below stay in place
+					auto const Capacity( 2 * Node.capacity() );
+					Node.reserve( Capacity );
+					NodeID.reserve( Capacity + 1 );
+					NodeRef.reserve( Capacity );
+					MarkedNode.reserve( Capacity );
+				}
 				Node.redimension( NumOfNodes );
 				NodeID.redimension( {0,NumOfNodes} );
 				NodeRef.redimension( NumOfNodes );
@@ -740,6 +755,7 @@ namespace NodeInputManager {
 				Node( NumOfNodes ).FluidType = NodeFluidType;
 				NodeRef( NumOfNodes ) = 0;
 				NodeID( NumOfUniqueNodeNames ) = Name;
+				NodeIDIndex.add( Name );
 
 				AssignNodeNumber = NumOfUniqueNodeNames;
 			}
@@ -755,6 +771,8 @@ namespace NodeInputManager {
 			NumOfUniqueNodeNames = 1;
 			NodeID( 0 ) = "Undefined";
 			NodeID( NumOfUniqueNodeNames ) = Name;
+			NodeIDIndex.clear();
+			NodeIDIndex.add( Name );
 			AssignNodeNumber = 1;
 			NodeRef( 1 ) = 0;
 		}
@@ -977,7 +995,7 @@ namespace NodeInputManager {
 				ShowFatalError( "Routine CheckUniqueNodes called with Nodetypes=NodeName, but did not include CheckName argument." );
 			}
 			if ( ! CheckName().empty() ) {
-				Found = FindItemInList( CheckName, UniqueNodeNames, NumCheckNodes );
+				Found = UniqueNodeNamesIndex.find( CheckName );
 				if ( Found != 0 ) {
 					ShowSevereError( CurCheckContextName + "=\"" + ObjectName + "\", duplicate node names found." );
 					ShowContinueError( "...for Node Type(s)=" + NodeTypes + ", duplicate node name=\"" + CheckName + "\"." );
@@ -991,6 +1009,7 @@ namespace NodeInputManager {
 						UniqueNodeNames.redimension( MaxCheckNodes += 100 );
 					}
 					UniqueNodeNames( NumCheckNodes ) = CheckName;
+					UniqueNodeNamesIndex.add( CheckName );
 				}
 			}
 
@@ -999,7 +1018,7 @@ namespace NodeInputManager {
 				ShowFatalError( "Routine CheckUniqueNodes called with Nodetypes=NodeNumber, but did not include CheckNumber argument." );
 			}
 			if ( CheckNumber != 0 ) {
-				Found = FindItemInList( NodeID( CheckNumber ), UniqueNodeNames, NumCheckNodes );
+				Found = UniqueNodeNamesIndex.find( NodeID( CheckNumber ) );
 				if ( Found != 0 ) {
 					ShowSevereError( CurCheckContextName + "=\"" + ObjectName + "\", duplicate node names found." );
 					ShowContinueError( "...for Node Type(s)=" + NodeTypes + ", duplicate node name=\"" + NodeID( CheckNumber ) + "\"." );
@@ -1013,6 +1032,7 @@ namespace NodeInputManager {
 						UniqueNodeNames.redimension( MaxCheckNodes += 100 );
 					}
 					UniqueNodeNames( NumCheckNodes ) = NodeID( CheckNumber );
+					UniqueNodeNamesIndex.add( NodeID( CheckNumber ) );
 				}
 			}
 
@@ -1071,6 +1091,7 @@ namespace NodeInputManager {
 		if ( allocated( UniqueNodeNames ) ) {
 			UniqueNodeNames.deallocate();
 		}
+		UniqueNodeNamesIndex.clear();
 
 	}
 
@@ -0,0 +1,411 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// Third-party Headers
+#include <milo/dtoa.hpp>
+#include <milo/itoa.hpp>
+
+// EnergyPlus Headers
+#include <NumericFormat.hh>
+
+namespace EnergyPlus {
+
+namespace NumericFormat {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Formats numbers for the eso, mtr, eio and tabular output files into caller buffers without
+	// the string streams, locales and std::string temporaries of the gio formatting.
+
+	// METHODOLOGY EMPLOYED:
+	// The shortest round trip representation uses the Grisu2 digit generation of the milo dtoa.
+	// The list-directed and fixed formatters follow the ObjexxFCL G, F and E editing step by step
+	// (field widths, the choice between F and E editing, the exponent scaling and its rounding
+	// adjustment).  The fixed point digits the stream insertions of gio get from printf are made
+	// from the exact binary value in 128 bit integer arithmetic with the same round to nearest,
+	// ties to even, and by printf itself where there is no 128 bit integer or the value is 2^53 or
+	// more.  Values the fast path does not cover (infinities, NaNs and exponents below -308) are
+	// handed to gio so every value formats as before.
+
+	// REFERENCES:
+	// ObjexxFCL fmt.hh G, F and E editing and its Exponent_num_put.
+
+	// OTHER NOTES:
+	// na
+
+	namespace {
+
+		// List-directed Real64 editing parameters of ObjexxFCL TraitsLD< double >
+		int const LD_w( 24 ); // Field width
+		int const LD_d( 15 ); // Fraction width
+		int const LD_e( 3 ); // Exponent width
+
+		// Copy a gio formatted string into the buffer
+		std::size_t
+		copy_string(
+			std::string const & s,
+			char * buf
+		)
+		{
+			std::size_t const l( std::min( s.length(), BufferSize - 1u ) );
+			std::memcpy( buf, s.c_str(), l );
+			buf[ l ] = '\0';
+			return l;
+		}
+
+		// Fixed point digits of a value with d decimals, rounded exactly as printf rounds them (to nearest, ties to even)
+		// point: Decimal point written when d is 0
+		std::size_t
+		fixed_digits(
+			Real64 const value,
+			int const d,
+			bool const point,
+			char * buf
+		)
+		{
+#ifdef __SIZEOF_INT128__
+			__extension__ typedef unsigned __int128 uint128;
+			static std::uint64_t const pow10[] = { 1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull };
+			if ( ( 0 <= d ) && ( d <= 15 ) && std::isfinite( value ) ) {
+				// value = m 2^e exactly
+				std::uint64_t bits;
+				std::memcpy( &bits, &value, sizeof( bits ) );
+				bool const negative( ( bits >> 63 ) != 0u );
+				int const biased_e( static_cast< int >( ( bits >> 52 ) & 0x7FFu ) );
+				std::uint64_t m( bits & ( ( std::uint64_t( 1 ) << 52 ) - 1u ) );
+				int e;
+				if ( biased_e == 0 ) { // Subnormal
+					e = -1074;
+				} else {
+					m |= std::uint64_t( 1 ) << 52;
+					e = biased_e - 1075;
+				}
+				if ( e <= 0 ) { // |value| < 2^53: m 10^d < 2^103 and the integer part fits 64 bits
+					uint128 const p( static_cast< uint128 >( m ) * pow10[ d ] );
+					uint128 q( 0u ); // Rounded value in units of 10^-d
+					int const s( -e );
+					if ( s == 0 ) {
+						q = p;
+					} else if ( s < 104 ) { // Otherwise p < 2^(s-1) rounds to 0
+						uint128 const one( 1u );
+						q = p >> s;
+						uint128 const r( p & ( ( one << s ) - 1u ) );
+						uint128 const half( one << ( s - 1 ) );
+						if ( ( r > half ) || ( ( r == half ) && ( ( q & 1u ) != 0u ) ) ) ++q;
+					}
+					std::uint64_t const i( static_cast< std::uint64_t >( q / pow10[ d ] ) ); // Integer part
+					std::uint64_t f( static_cast< std::uint64_t >( q % pow10[ d ] ) ); // Fraction digits
+					char * b( buf );
+					if ( negative ) *b++ = '-';
+					u64toa( i, b );
+					b += std::strlen( b );
+					if ( ( d > 0 ) || point ) *b++ = '.';
+					for ( int k = d; k > 0; --k ) {
+						b[ k - 1 ] = char( '0' + f % 10u );
+						f /= 10u;
+					}
+					b += d;
+					*b = '\0';
+					return b - buf;
+				}
+			}
+#endif
+			int const l( std::snprintf( buf, BufferSize, ( point ? "%#.*f" : "%.*f" ), d, value ) );
+			return ( ( 0 <= l ) && ( l < int( BufferSize ) ) ? std::size_t( l ) : 0u ); // 0: Too long for the buffer
+		}
+
+		// Fortran Fw.d field as ObjexxFCL F editing produces it
+		std::size_t
+		fixed_field(
+			Real64 const value,
+			int const w,
+			int const d,
+			char * buf
+		)
+		{
+			char s[ BufferSize ];
+			std::size_t l( fixed_digits( value, d, true, s ) );
+			char const * b( s );
+			if ( l == 0u ) { // Wider than any field
+				std::memset( buf, '*', w );
+				buf[ w ] = '\0';
+				return w;
+			}
+			if ( l > std::size_t( w ) ) { // Exceeded field width
+				if ( s[ 0 ] == '0' ) { // Trim lead zero
+					++b;
+					--l;
+				} else if ( ( s[ 0 ] == '-' ) && ( s[ 1 ] == '0' ) ) { // Trim lead zero
+					s[ 1 ] = '-';
+					++b;
+					--l;
+				}
+			}
+			if ( l > std::size_t( w ) ) { // Fortran *-fills when output is too wide
+				std::memset( buf, '*', w );
+				buf[ w ] = '\0';
+				return w;
+			}
+			std::memset( buf, ' ', w - l );
+			std::memcpy( buf + ( w - l ), b, l + 1 );
+			return w;
+		}
+
+		// List-directed E editing (scale factor 1) as ObjexxFCL Exponent_num_put produces it: Returns 0 if not handled
+		std::size_t
+		list_directed_exponent_field(
+			Real64 const value,
+			char * buf
+		)
+		{
+			bool const negative( value < 0.0 );
+			Real64 v( std::abs( value ) );
+			int vexp( static_cast< int >( std::floor( std::log10( v ) ) ) ); // Scale factor 1: One digit before the point
+			if ( -vexp >= 309 ) return 0u; // gio scales these in long double
+			v *= std::pow( 10.0, Real64( -vexp ) );
+			char s[ BufferSize ];
+			fixed_digits( v, 6, false, s );
+			if ( std::strncmp( s, "10.", 3 ) == 0 ) { // Rounding adjustment
+				v /= 10.0;
+				++vexp;
+			}
+			int l( static_cast< int >( fixed_digits( v, LD_d, false, s ) ) );
+			if ( ( vexp != 0 ) && ( static_cast< int >( std::log10( std::abs( vexp ) ) ) + 1 > LD_e ) ) { // Compact exponent
+				l += std::snprintf( s + l, sizeof( s ) - l, "%+0*d", LD_e + 2, vexp );
+			} else { // E, sign and LD_e digits
+				int x( std::abs( vexp ) );
+				s[ l++ ] = 'E';
+				s[ l++ ] = ( vexp < 0 ? '-' : '+' );
+				for ( int k = LD_e; k > 0; --k ) {
+					s[ l + k - 1 ] = char( '0' + x % 10 );
+					x /= 10;
+				}
+				l += LD_e;
+				s[ l ] = '\0';
+			}
+			char const * b( s );
+			int wid( l + ( negative ? 1 : 0 ) );
+			if ( ( wid > LD_w ) && ( s[ 0 ] == '0' ) && ( s[ 1 ] == '.' ) ) { // Drop leading 0 to narrow output
+				++b;
+				--l;
+				--wid;
+			}
+			if ( wid > LD_w ) { // Fortran *-fills when output is too wide
+				std::memset( buf, '*', LD_w );
+				buf[ LD_w ] = '\0';
+				return LD_w;
+			}
+			char * p( buf );
+			std::memset( p, ' ', LD_w - wid );
+			p += LD_w - wid;
+			if ( negative ) *p++ = '-';
+			std::memcpy( p, b, l );
+			p[ l ] = '\0';
+			return LD_w;
+		}
+
+	} // namespace
+
+	std::size_t
+	format_shortest(
+		Real64 const value,
+		char * buf
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the shortest decimal representation that reads back as the same value, as the eso
+		// and mtr report lines show it.
+
+		dtoa( value, buf );
+		return std::strlen( buf );
+	}
+
+	std::size_t
+	format_list_directed(
+		Real64 const value,
+		char * buf
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the field gio::write( String, "*" ) << value produces, including its leading and
+		// trailing blanks.
+
+		// METHODOLOGY EMPLOYED:
+		// ObjexxFCL G editing with the list-directed width, fraction width and exponent width:
+		// F editing into the width less the exponent field when the decimal exponent is in range,
+		// followed by blanks for the exponent field, E editing with a scale factor of 1 otherwise.
+
+		Real64 const m( std::abs( value ) );
+		if ( m == 0.0 ) {
+			std::size_t const l( fixed_field( value, LD_w - ( LD_e + 2 ), LD_d - 1, buf ) );
+			std::memset( buf + l, ' ', LD_e + 2 );
+			buf[ l + LD_e + 2 ] = '\0';
+			return l + LD_e + 2;
+		} else if ( std::isfinite( m ) ) {
+			int const p( static_cast< int >( std::floor( std::log10( m ) + 1.0 ) ) ); // Decimal exponent as G editing computes it
+			if ( ( 0 <= p ) && ( p <= LD_d + 2 ) ) { // F editing
+				std::size_t const l( fixed_field( value, LD_w - ( LD_e + 2 ), LD_d - std::min( p, LD_d ), buf ) );
+				std::memset( buf + l, ' ', LD_e + 2 );
+				buf[ l + LD_e + 2 ] = '\0';
+				return l + LD_e + 2;
+			} else { // E editing
+				std::size_t const l( list_directed_exponent_field( value, buf ) );
+				if ( l > 0u ) return l;
+			}
+		}
+
+		// Values outside the fast path
+		static gio::Fmt fmtLD( "*" );
+		std::string String;
+		gio::write( String, fmtLD ) << value;
+		return copy_string( String, buf );
+	}
+
+	std::size_t
+	format_list_directed(
+		std::int64_t const value,
+		char * buf
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the field gio::write( String, "*" ) << value produces for an integer: right
+		// justified in 12 columns, wider when the digits need it.
+
+		char s[ BufferSize ];
+		int const l( static_cast< int >( format_integer( value, s ) ) );
+		int const w( std::max( l, 12 ) );
+		std::memset( buf, ' ', w - l );
+		std::memcpy( buf + ( w - l ), s, l + 1 );
+		return w;
+	}
+
+	std::size_t
+	format_fixed(
+		Real64 const value,
+		int const w,
+		int const d,
+		char * buf
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the field a gio Fw.d format produces: Right justified, a leading zero dropped if
+		// that makes it fit and *-filled if it still does not.
+
+		assert( ( 0 < w ) && ( w < int( BufferSize ) ) );
+		assert( d >= 0 );
+
+		if ( ! std::isfinite( value ) ) {
+			std::string const f( "(F" + std::to_string( w ) + '.' + std::to_string( d ) + ')' );
+			gio::Fmt fmtF( f );
+			std::string String;
+			gio::write( String, fmtF ) << value;
+			return copy_string( String, buf );
+		}
+		return fixed_field( value, w, d, buf );
+	}
+
+	std::size_t
+	format_integer(
+		std::int64_t const value,
+		char * buf
+	)
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Writes the decimal digits of an integer with its sign.
+
+		i64toa( value, buf );
+		return std::strlen( buf );
+	}
+
+} // NumericFormat
+
+} // EnergyPlus
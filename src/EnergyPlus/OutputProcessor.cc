@@ -51,6 +51,7 @@
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <unordered_set>
@@ -64,6 +65,8 @@
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <OutputProcessor.hh>
+#include <ColumnarOutput.hh>
+#include <ColumnarOutputFormat.hh>
 #include <DataEnvironment.hh>
 #include <DataGlobalConstants.hh>
 #include <DataHeatBalance.hh>
@@ -72,16 +75,17 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
+#include <NumericFormat.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <OutputWriter.hh>
 #include <ScheduleManager.hh>
 #include <SortAndStringUtilities.hh>
 #include <SQLiteProcedures.hh>
 #include <UtilityRoutines.hh>
-#include <milo/dtoa.hpp>
-#include <milo/itoa.hpp>
 
 namespace EnergyPlus {
 
@@ -251,6 +255,8 @@ namespace OutputProcessor {
 
 	int MaxNumSubcategories( 1 );
 	bool isFinalYear( false );
+	bool ReportingListsCurrent( false ); // False when ReportingLists must be rebuilt before the next update
+	bool AccumulateAllVariables( false ); // True when unreported variables are read at the zone time step (external interface)
 
 	namespace {
 		// These were static variables within different functions. They were pulled out into the namespace
@@ -264,6 +270,7 @@ namespace OutputProcessor {
 		Real64 LEndMin( -1.0 ); // Helps set minutes for timestamp output
 		bool GetMeterIndexFirstCall( true ); //trigger setup in GetMeterIndex
 		bool InitFlag( true );
+		std::unique_ptr< OutputWriter > AsyncWriter; // Background writer of the eso/mtr lines (null: written as reported)
 	}
 
 	// All routines should be listed here whether private or not
@@ -283,6 +290,8 @@ namespace OutputProcessor {
 	Array1D< MeterArrayType > VarMeterArrays;
 	Array1D< MeterType > EnergyMeters;
 	Array1D< EndUseCategoryType > EndUseCategory;
+	Array1D< ReportingListType > ReportingLists; // (IndexType) dense variable lists for UpdateDataandReport
+	MeterMapType MeterMap; // Variable to meter map used by UpdateMeters (built with ReportingLists)
 
 	// Routines tagged on the end of this module:
 	//  AddToOutputVariableList
@@ -367,6 +376,7 @@ namespace OutputProcessor {
 		LEndMin = -1.0;
 		GetMeterIndexFirstCall = true ;
 		InitFlag = true;
+		AsyncWriter.reset();
 		TimeValue.deallocate();
 		RVariableTypes.deallocate();
 		IVariableTypes.deallocate();
@@ -379,6 +389,10 @@ namespace OutputProcessor {
 		VarMeterArrays.deallocate();
 		EnergyMeters.deallocate();
 		EndUseCategory.deallocate();
+		ReportingLists.deallocate();
+		MeterMap = MeterMapType();
+		ReportingListsCurrent = false;
+		AccumulateAllVariables = false;
 	}
 
 	void
@@ -1473,6 +1487,156 @@ namespace OutputProcessor {
 
 	}
 
+	void
+	BuildReportingLists()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine partitions the real and integer variables by index type (Zone, HVAC)
+		// and reporting frequency into the dense lists walked by UpdateDataandReport, and
+		// builds the variable to meter map (MeterMap) used by UpdateMeters.
+
+		// METHODOLOGY EMPLOYED:
+		// A variable that is neither reported nor metered has its zone time step sum discarded,
+		// so it is left out of every list unless an external interface reads its EITSValue.
+		// The lists keep the RVariableTypes/IVariableTypes order, so records are written to the
+		// output files in the same order as before.  They are rebuilt (ReportingListsCurrent = false)
+		// whenever a variable is set up or attached to a custom meter, or a meter is added.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop; // Loop Variable
+
+		if ( ! ReportingLists.allocated() ) ReportingLists.allocate( 2 );
+		for ( Loop = 1; Loop <= 2; ++Loop ) {
+			auto & list( ReportingLists( Loop ) );
+			list.RActive.clear();
+			list.RReported.clear();
+			list.RDaily.clear();
+			list.RMonthly.clear();
+			list.RSim.clear();
+			list.IActive.clear();
+			list.IReported.clear();
+			list.IDaily.clear();
+			list.IMonthly.clear();
+			list.ISim.clear();
+		}
+
+		for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+			auto & rVar( RVariableTypes( Loop ).VarPtr() );
+			if ( ! rVar.Report && rVar.MeterArrayPtr == 0 && ! AccumulateAllVariables ) continue;
+			auto & list( ReportingLists( RVariableTypes( Loop ).IndexType ) );
+			list.RActive.push_back( &rVar );
+			if ( ! rVar.Report ) continue;
+			list.RReported.push_back( &rVar );
+			if ( rVar.ReportFreq == ReportDaily ) {
+				list.RDaily.push_back( &rVar );
+			} else if ( rVar.ReportFreq == ReportMonthly ) {
+				list.RMonthly.push_back( &rVar );
+			} else if ( rVar.ReportFreq == ReportSim ) {
+				list.RSim.push_back( &rVar );
+			}
+		}
+
+		for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
+			auto & iVar( IVariableTypes( Loop ).VarPtr() );
+			if ( ! iVar.Report && ! AccumulateAllVariables ) continue;
+			auto & list( ReportingLists( IVariableTypes( Loop ).IndexType ) );
+			list.IActive.push_back( &iVar );
+			if ( ! iVar.Report ) continue;
+			list.IReported.push_back( &iVar );
+			if ( iVar.ReportFreq == ReportDaily ) {
+				list.IDaily.push_back( &iVar );
+			} else if ( iVar.ReportFreq == ReportMonthly ) {
+				list.IMonthly.push_back( &iVar );
+			} else if ( iVar.ReportFreq == ReportSim ) {
+				list.ISim.push_back( &iVar );
+			}
+		}
+
+		// Meter map: each meter's entries follow the order in which UpdateDataandReport visits the
+		// variables (zone, then HVAC), so every meter sums its variables in the same order as before
+		MeterMap.RowStart.assign( NumEnergyMeters + 1, 0 );
+		MeterMap.VarValue.assign( NumVarMeterArrays, 0.0 );
+		for ( Loop = 1; Loop <= 2; ++Loop ) {
+			for ( auto const pVar : ReportingLists( Loop ).RActive ) {
+				if ( pVar->MeterArrayPtr == 0 ) continue;
+				auto const & varMeters( VarMeterArrays( pVar->MeterArrayPtr ) );
+				for ( int Meter = 1; Meter <= varMeters.NumOnMeters; ++Meter ) {
+					++MeterMap.RowStart[ varMeters.OnMeters( Meter ) ];
+				}
+				for ( int Meter = 1; Meter <= varMeters.NumOnCustomMeters; ++Meter ) {
+					++MeterMap.RowStart[ varMeters.OnCustomMeters( Meter ) ];
+				}
+			}
+		}
+		for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			MeterMap.RowStart[ Meter ] += MeterMap.RowStart[ Meter - 1 ];
+		}
+		MeterMap.VarMeterArray.resize( MeterMap.RowStart[ NumEnergyMeters ] );
+		std::vector< int > NextEntry( MeterMap.RowStart.begin(), MeterMap.RowStart.end() - 1 );
+		for ( Loop = 1; Loop <= 2; ++Loop ) {
+			for ( auto const pVar : ReportingLists( Loop ).RActive ) {
+				if ( pVar->MeterArrayPtr == 0 ) continue;
+				auto const & varMeters( VarMeterArrays( pVar->MeterArrayPtr ) );
+				for ( int Meter = 1; Meter <= varMeters.NumOnMeters; ++Meter ) {
+					MeterMap.VarMeterArray[ NextEntry[ varMeters.OnMeters( Meter ) - 1 ]++ ] = pVar->MeterArrayPtr - 1;
+				}
+				for ( int Meter = 1; Meter <= varMeters.NumOnCustomMeters; ++Meter ) {
+					MeterMap.VarMeterArray[ NextEntry[ varMeters.OnCustomMeters( Meter ) - 1 ]++ ] = pVar->MeterArrayPtr - 1;
+				}
+			}
+		}
+
+		ReportingListsCurrent = true;
+
+	}
+
+	void
+	RequestAllVariablesAccumulated()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Callers that read variables through GetInternalVariableValueExternalInterface need the
+		// zone time step value (EITSValue) of variables that are not reported; this subroutine
+		// puts every variable back on the lists accumulated by UpdateDataandReport.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		AccumulateAllVariables = true;
+		ReportingListsCurrent = false;
+
+	}
+
 	// *****************************************************************************
 	// The following routines implement Energy Meters in EnergyPlus.
 	// *****************************************************************************
@@ -2298,6 +2462,7 @@ namespace OutputProcessor {
 
 		if ( Found == 0 ) {
 			EnergyMeters.redimension( ++NumEnergyMeters );
+			ReportingListsCurrent = false; // MeterMap needs a row for this meter
 			EnergyMeters( NumEnergyMeters ).Name = Name;
 			EnergyMeters( NumEnergyMeters ).ResourceType = ResourceType;
 			EnergyMeters( NumEnergyMeters ).EndUse = EndUse;
@@ -2552,6 +2717,7 @@ namespace OutputProcessor {
 			VarMeterArrays( MeterArrayPtr ).OnCustomMeters.redimension( ++VarMeterArrays( MeterArrayPtr ).NumOnCustomMeters );
 		}
 		VarMeterArrays( MeterArrayPtr ).OnCustomMeters( VarMeterArrays( MeterArrayPtr ).NumOnCustomMeters ) = MeterIndex;
+		ReportingListsCurrent = false; // Variable may not have been metered before
 
 	}
 
@@ -3010,7 +3176,8 @@ namespace OutputProcessor {
 
 		// METHODOLOGY EMPLOYED:
 		// Goes thru the number of meters, setting min/max as appropriate.  Uses timestamp
-		// from calling program.
+		// from calling program.  The time step value of each meter is the sum of its row of
+		// MeterMap over the metered variable values stored by UpdateDataandReport.
 
 		// REFERENCES:
 		// na
@@ -3033,7 +3200,15 @@ namespace OutputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Meter; // Loop Control
 
+		if ( ! ReportingListsCurrent ) BuildReportingLists();
+
 		for ( Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			Real64 MeterSum( 0.0 );
+			for ( int Entry = MeterMap.RowStart[ Meter - 1 ], EntryEnd = MeterMap.RowStart[ Meter ]; Entry < EntryEnd; ++Entry ) {
+				MeterSum += MeterMap.VarValue[ MeterMap.VarMeterArray[ Entry ] ];
+			}
+			MeterValue( Meter ) += MeterSum;
+
 			if ( EnergyMeters( Meter ).TypeOfMeter != MeterType_CustomDec && EnergyMeters( Meter ).TypeOfMeter != MeterType_CustomDiff ) {
 				EnergyMeters( Meter ).TSValue += MeterValue( Meter );
 				EnergyMeters( Meter ).HRValue += MeterValue( Meter );
@@ -4007,6 +4182,244 @@ namespace OutputProcessor {
 
 	}
 
+	void
+	StartOutputWriter()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine starts the background output writer: from now on the report lines
+		// for the eso and mtr files are queued and formatted off the simulation thread.
+
+		// METHODOLOGY EMPLOYED:
+		// The SQLite records and the record counts are still produced as the data is reported.
+		// Anything else writing to the eso or mtr file must call FlushOutputWriter first.
+
+		if ( ! AsyncWriter ) AsyncWriter.reset( new OutputWriter( WriteOutputRecord ) );
+
+	}
+
+	void
+	FlushOutputWriter()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine waits until the output writer has written every queued report line, so
+		// the caller can write to the eso and mtr files directly.
+
+		if ( AsyncWriter ) AsyncWriter->flush();
+
+	}
+
+	void
+	StopOutputWriter()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine writes the queued report lines and stops the output writer; later lines
+		// are written as they are reported.
+
+		AsyncWriter.reset();
+
+	}
+
+	void
+	SubmitOutputRecord( OutputRecord & record )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine queues a report line for the output writer, or writes it now when the
+		// writer is not running.  A record with only an echo stream is written to that stream.
+
+		if ( ! record.stream ) {
+			record.stream = record.echoStream;
+			record.echoStream = nullptr;
+		}
+		if ( ! record.stream ) return;
+
+		if ( AsyncWriter ) {
+			AsyncWriter->push( record );
+		} else {
+			WriteOutputRecord( record );
+		}
+
+	}
+
+	void
+	SubmitValueRecord(
+		int const kind, // OutputRecord::Value (0.0 for zero) or OutputRecord::Numeric
+		std::ostream * stream, // Stream the line is written to
+		std::ostream * echoStream, // Second stream given the same line (or nullptr)
+		std::string const & reportID, // Report id in characters
+		Real64 const value // Value
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine submits a "reportID,value" line with the value still unformatted.
+
+		assert( reportID.length() < OutputRecord::IDSize );
+		OutputRecord record;
+		record.kind = OutputRecord::Kind( kind );
+		record.stream = stream;
+		record.echoStream = echoStream;
+		std::strncpy( record.reportID, reportID.c_str(), OutputRecord::IDSize - 1 );
+		record.reportID[ OutputRecord::IDSize - 1 ] = '\0';
+		record.value = value;
+		SubmitOutputRecord( record );
+
+	}
+
+	void
+	SubmitIntegerRecord(
+		std::ostream * stream, // Stream the line is written to
+		std::string const & reportID, // Report id in characters
+		std::int64_t const value // Value
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine submits a "reportID,integer" line with the integer still unformatted.
+
+		assert( reportID.length() < OutputRecord::IDSize );
+		OutputRecord record;
+		record.kind = OutputRecord::Integer;
+		record.stream = stream;
+		record.echoStream = nullptr;
+		std::strncpy( record.reportID, reportID.c_str(), OutputRecord::IDSize - 1 );
+		record.reportID[ OutputRecord::IDSize - 1 ] = '\0';
+		record.integer = value;
+		SubmitOutputRecord( record );
+
+	}
+
+	void
+	SubmitOutputLine(
+		std::ostream * stream, // Stream the line is written to
+		std::ostream * echoStream, // Second stream given the same line (or nullptr)
+		std::string const & line // Line without the newline
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine submits a preformatted report line.  Lines too long for a record are
+		// written directly once the queued lines are out.
+
+		if ( line.length() < OutputRecord::TextSize ) {
+			OutputRecord record;
+			record.kind = OutputRecord::Text;
+			record.stream = stream;
+			record.echoStream = echoStream;
+			std::memcpy( record.text, line.c_str(), line.length() + 1 );
+			SubmitOutputRecord( record );
+		} else {
+			FlushOutputWriter();
+			if ( stream ) *stream << line << DataStringGlobals::NL;
+			if ( echoStream ) *echoStream << line << DataStringGlobals::NL;
+		}
+
+	}
+
+	void
+	WriteOutputRecord( OutputRecord const & record )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine formats and writes one report line to the eso or mtr file.  It runs on
+		// the output writer thread when the writer is started, so it must only use the record.
+
+		// METHODOLOGY EMPLOYED:
+		// The formats are those the Write* routines used when they wrote the lines themselves.
+
+		char s[ 129 ]; // Formatted value or time stamp
+
+		switch ( record.kind ) {
+		case OutputRecord::Value:
+			if ( record.value == 0.0 ) {
+				std::strcpy( s, "0.0" );
+			} else {
+				NumericFormat::format_shortest( record.value, s );
+			}
+			break;
+		case OutputRecord::Numeric:
+			NumericFormat::format_shortest( record.value, s );
+			break;
+		case OutputRecord::Integer:
+			NumericFormat::format_integer( record.integer, s );
+			break;
+		case OutputRecord::TimeStamp:
+			if ( ! *record.stream ) return; // Stream
+			if ( ( record.interval == ReportEach ) || ( record.interval == ReportTimeStep ) ) {
+				std::sprintf( s, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", record.reportID, record.dayOfSim, record.month, record.dayOfMonth, record.dst, record.hour, record.startMinute, record.endMinute, record.dayType );
+			} else if ( record.interval == ReportHourly ) {
+				std::sprintf( s, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", record.reportID, record.dayOfSim, record.month, record.dayOfMonth, record.dst, record.hour, 0.0, 60.0, record.dayType );
+			} else if ( record.interval == ReportDaily ) {
+				std::sprintf( s, "%s,%s,%2d,%2d,%2d,%s", record.reportID, record.dayOfSim, record.month, record.dayOfMonth, record.dst, record.dayType );
+			} else if ( record.interval == ReportMonthly ) {
+				std::sprintf( s, "%s,%s,%2d", record.reportID, record.dayOfSim, record.month );
+			} else {
+				std::sprintf( s, "%s,%s", record.reportID, record.dayOfSim );
+			}
+			*record.stream << s << DataStringGlobals::NL;
+			return;
+		case OutputRecord::Text:
+			*record.stream << record.text << DataStringGlobals::NL;
+			if ( record.echoStream ) *record.echoStream << record.text << DataStringGlobals::NL;
+			return;
+		}
+
+		*record.stream << record.reportID << ',' << s << DataStringGlobals::NL;
+		if ( record.echoStream ) *record.echoStream << record.reportID << ',' << s << DataStringGlobals::NL;
+
+	}
+
 	void
 	WriteTimeStampFormatData(
 		std::ostream * out_stream_p, // Output stream pointer
@@ -4046,7 +4459,6 @@ namespace OutputProcessor {
 
 		// Using/Aliasing
 		using namespace DataPrecisionGlobals;
-		using DataStringGlobals::NL;
 
 		// Locals
 		// FUNCTION ARGUMENT DEFINITIONS:
@@ -4061,32 +4473,54 @@ namespace OutputProcessor {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int const N( 100 );
-		static char stamp[ N ];
-		assert( reportIDString.length() + DayOfSimChr.length() + ( DayType.present() ? DayType().length() : 0u ) + 26 < N ); // Check will fit in stamp size
+		assert( reportIDString.length() < OutputRecord::IDSize && DayOfSimChr.length() < OutputRecord::IDSize );
+		OutputRecord record; // Time stamp line, formatted by WriteOutputRecord
+
+		if ( ! out_stream_p ) return; // Stream
+		if ( ! AsyncWriter && ! *out_stream_p ) return; // The writer thread owns the stream state while it runs
+
+		record.kind = OutputRecord::TimeStamp;
+		record.stream = out_stream_p;
+		record.echoStream = nullptr;
+		record.interval = reportingInterval;
+		std::strncpy( record.reportID, reportIDString.c_str(), OutputRecord::IDSize - 1 );
+		record.reportID[ OutputRecord::IDSize - 1 ] = '\0';
+		std::strncpy( record.dayOfSim, DayOfSimChr.c_str(), OutputRecord::IDSize - 1 );
+		record.dayOfSim[ OutputRecord::IDSize - 1 ] = '\0';
+		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) || ( reportingInterval == ReportDaily ) ) {
+			record.month = Month();
+			record.dayOfMonth = DayOfMonth();
+			record.dst = DST();
+			std::strncpy( record.dayType, DayType().c_str(), OutputRecord::DayTypeSize - 1 );
+			record.dayType[ OutputRecord::DayTypeSize - 1 ] = '\0';
+			if ( reportingInterval != ReportDaily ) record.hour = Hour();
+			if ( reportingInterval != ReportHourly && reportingInterval != ReportDaily ) {
+				record.startMinute = StartMinute();
+				record.endMinute = EndMinute();
+			}
+		} else if ( reportingInterval == ReportMonthly ) {
+			record.month = Month();
+		}
 
-		if ( ( ! out_stream_p ) || ( ! *out_stream_p ) ) return; // Stream
+		if ( writeToSQL && ColumnarOutput::Active && ( reportingInterval >= ReportEach ) && ( reportingInterval <= ReportSim ) ) { // A row per time stamp, as in the SQLite time index
+			static std::string const NoDayType;
+			ColumnarOutput::AddTimeStamp( reportingInterval, DayOfSim, Month.present() ? Month() : 0, DayOfMonth.present() ? DayOfMonth() : 0, Hour.present() ? Hour() : 0, EndMinute.present() ? EndMinute() : 0.0, StartMinute.present() ? StartMinute() : 0.0, DST.present() ? DST() : 0, DayType.present() ? DayType() : NoDayType, DataGlobals::WarmupFlag );
+		}
 
-		std::ostream & out_stream( *out_stream_p );
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
-			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), Hour(), StartMinute(), EndMinute(), DayType().c_str() );
-			out_stream << stamp << NL;
+			SubmitOutputRecord( record );
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, Hour, EndMinute, StartMinute, DST, DayType, DataGlobals::WarmupFlag );
 		} else if ( reportingInterval == ReportHourly ) {
-			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), Hour(), 0.0, 60.0, DayType().c_str() );
-			out_stream << stamp << NL;
+			SubmitOutputRecord( record );
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, Hour, _, _, DST, DayType, DataGlobals::WarmupFlag );
 		} else if ( reportingInterval == ReportDaily ) {
-			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), DayType().c_str() );
-			out_stream << stamp << NL;
+			SubmitOutputRecord( record );
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, _, _, _, DST, DayType, DataGlobals::WarmupFlag );
 		} else if ( reportingInterval == ReportMonthly ) {
-			std::sprintf( stamp, "%s,%s,%2d", reportIDString.c_str(), DayOfSimChr.c_str(), Month() );
-			out_stream << stamp << NL;
+			SubmitOutputRecord( record );
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( ReportMonthly, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month );
 		} else if ( reportingInterval == ReportSim ) {
-			std::sprintf( stamp, "%s,%s", reportIDString.c_str(), DayOfSimChr.c_str() );
-			out_stream << stamp << NL;
+			SubmitOutputRecord( record );
 			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum );
 		} else {
 			std::ostringstream ss;
@@ -4153,6 +4587,8 @@ namespace OutputProcessor {
 			FreqString += "," + ScheduleName;
 		}
 
+		FlushOutputWriter(); // Written directly, after any queued report lines
+
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
 			if ( eso_stream ) *eso_stream << reportIDChr << ",1," << keyedValue << ',' << variableName << " [" << UnitsString << ']' << FreqString << NL;
 		} else if ( reportingInterval == ReportHourly ) {
@@ -4173,6 +4609,10 @@ namespace OutputProcessor {
 			sqlite->createSQLiteReportDictionaryRecord( reportID, storeType, indexGroup, keyedValue, variableName, indexType, UnitsString, reportingInterval, false, ScheduleName );
 		}
 
+		if ( ColumnarOutput::Active ) {
+			ColumnarOutput::AddVariable( reportID, reportingInterval, ColumnarOutputFormat::KindVariable, storeType, false, indexType, indexGroup, keyedValue, variableName, UnitsString, present( ScheduleName ) ? ScheduleName() : std::string() );
+		}
+
 	}
 
 	void
@@ -4230,6 +4670,8 @@ namespace OutputProcessor {
 
 		std::string const FreqString( FreqNotice( storeType, reportingInterval ) );
 
+		FlushOutputWriter(); // Written directly, after any queued report lines
+
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
 			if ( ! cumulativeMeterFlag ) {
 				if ( mtr_stream ) *mtr_stream << reportIDChr << ",1," << meterName << " [" << UnitsString << ']' << FreqString << NL;
@@ -4303,6 +4745,10 @@ namespace OutputProcessor {
 			sqlite->createSQLiteReportDictionaryRecord( reportID, storeType, indexGroup, keyedValueString, meterName, 1, UnitsString, reportingInterval, true );
 		}
 
+		if ( ColumnarOutput::Active ) {
+			ColumnarOutput::AddVariable( reportID, reportingInterval, cumulativeMeterFlag ? ColumnarOutputFormat::KindCumulativeMeter : ColumnarOutputFormat::KindMeter, storeType, meterFileOnlyFlag, 1, indexGroup, std::string(), meterName, UnitsString, std::string() );
+		}
+
 	}
 
 	void
@@ -4392,39 +4838,48 @@ namespace OutputProcessor {
 
 		static char s[ 129 ];
 
-		std::string NumberOut; // Character for producing "number out"
 		Real64 repVal( repValue ); // The variable's value
 
 		if ( storeType == AveragedVar ) repVal /= numOfItemsStored;
-		if ( repVal == 0.0 ) {
-			NumberOut = "0.0";
-		} else {
-			dtoa( repVal, s );
-			NumberOut = std::string( s );
-		}
 
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate );
 		}
 
+		if ( ColumnarOutput::Active ) {
+			if ( reportingInterval >= ReportDaily ) {
+				ColumnarOutput::AddValue( reportID, repVal, minValue, minValueDate, MaxValue, maxValueDate );
+			} else {
+				ColumnarOutput::AddValue( reportID, repVal );
+			}
+		}
+
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
-			if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
+			SubmitValueRecord( OutputRecord::Value, DataGlobals::eso_stream, nullptr, creportID, repVal ); // Formatted by the output writer
 
 		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
+			std::string NumberOut; // Character for producing "number out"
 			std::string MaxOut; // Character for Max out string
 			std::string MinOut; // Character for Min out string
 
+			if ( repVal == 0.0 ) {
+				NumberOut = "0.0";
+			} else {
+				NumericFormat::format_shortest( repVal, s );
+				NumberOut = std::string( s );
+			}
+
 			if ( MaxValue == 0.0 ) {
 				MaxOut = "0.0";
 			} else {
-				dtoa( MaxValue, s );
+				NumericFormat::format_shortest( MaxValue, s );
 				MaxOut = std::string( s );
 			}
 
 			if ( minValue == 0.0 ) {
 				MinOut = "0.0";
 			} else {
-				dtoa( minValue, s );
+				NumericFormat::format_shortest( minValue, s );
 				MinOut = std::string( s );
 			}
 
@@ -4432,7 +4887,7 @@ namespace OutputProcessor {
 			ProduceMinMaxString( MinOut, minValueDate, reportingInterval );
 			ProduceMinMaxString( MaxOut, maxValueDate, reportingInterval );
 
-			if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << DataStringGlobals::NL;
+			SubmitOutputLine( DataGlobals::eso_stream, nullptr, creportID + ',' + NumberOut + ',' + MinOut + ',' + MaxOut );
 
 		}
 
@@ -4457,27 +4912,15 @@ namespace OutputProcessor {
 		// This subroutine writes the cumulative meter data to the output files and
 		// SQL database.
 
-		static char s[ 129 ];
-		std::string NumberOut; // Character for producing "number out"
-
-		if ( repValue == 0.0 ) {
-			NumberOut = "0.0";
-		} else {
-			dtoa( repValue, s );
-			NumberOut = std::string( s );
-		}
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
-		if ( DataGlobals::mtr_stream ) *DataGlobals::mtr_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
-		++DataGlobals::StdMeterRecordCount;
+		if ( ColumnarOutput::Active ) ColumnarOutput::AddValue( reportID, repValue );
 
-		if ( ! meterOnlyFlag ) {
-			if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
-			++DataGlobals::StdOutputRecordCount;
-		}
+		SubmitValueRecord( OutputRecord::Value, DataGlobals::mtr_stream, meterOnlyFlag ? nullptr : DataGlobals::eso_stream, creportID, repValue );
+		++DataGlobals::StdMeterRecordCount;
+		if ( ! meterOnlyFlag ) ++DataGlobals::StdOutputRecordCount;
 
 	}
 
@@ -4518,41 +4961,46 @@ namespace OutputProcessor {
 		using DataGlobals::StdMeterRecordCount;
 
 		static char s[ 129 ];
-		std::string NumberOut; // Character for producing "number out"
-
-		if ( repValue == 0.0 ) {
-			NumberOut = "0.0";
-		} else {
-			dtoa( repValue, s );
-			NumberOut = std::string( s );
-		}
 
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate, MinutesPerTimeStep );
 		}
 
+		if ( ColumnarOutput::Active ) {
+			if ( reportingInterval >= ReportDaily ) {
+				ColumnarOutput::AddValue( reportID, repValue, minValue, minValueDate, MaxValue, maxValueDate );
+			} else {
+				ColumnarOutput::AddValue( reportID, repValue );
+			}
+		}
+
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
-			if ( mtr_stream ) *mtr_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
+			SubmitValueRecord( OutputRecord::Value, mtr_stream, meterOnlyFlag ? nullptr : eso_stream, creportID, repValue ); // Formatted by the output writer
 			++StdMeterRecordCount;
-			if ( eso_stream && ! meterOnlyFlag ) {
-				*eso_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
-				++StdOutputRecordCount;
-			}
+			if ( eso_stream && ! meterOnlyFlag ) ++StdOutputRecordCount;
 		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
+			std::string NumberOut; // Character for producing "number out"
 			std::string MaxOut; // Character for Max out string
 			std::string MinOut; // Character for Min out string
 
+			if ( repValue == 0.0 ) {
+				NumberOut = "0.0";
+			} else {
+				NumericFormat::format_shortest( repValue, s );
+				NumberOut = std::string( s );
+			}
+
 			if ( MaxValue == 0.0 ) {
 				MaxOut = "0.0";
 			} else {
-				dtoa( MaxValue, s );
+				NumericFormat::format_shortest( MaxValue, s );
 				MaxOut = std::string( s );
 			}
 
 			if ( minValue == 0.0 ) {
 				MinOut = "0.0";
 			} else {
-				dtoa( minValue, s );
+				NumericFormat::format_shortest( minValue, s );
 				MinOut = std::string( s );
 			}
 
@@ -4560,12 +5008,9 @@ namespace OutputProcessor {
 			ProduceMinMaxString( MinOut, minValueDate, reportingInterval );
 			ProduceMinMaxString( MaxOut, maxValueDate, reportingInterval );
 
-			if ( mtr_stream ) *mtr_stream << creportID << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << DataStringGlobals::NL;
+			SubmitOutputLine( mtr_stream, meterOnlyFlag ? nullptr : eso_stream, creportID + ',' + NumberOut + ',' + MinOut + ',' + MaxOut );
 			++StdMeterRecordCount;
-			if ( eso_stream && ! meterOnlyFlag ) {
-				*eso_stream << creportID << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << DataStringGlobals::NL;
-				++StdOutputRecordCount;
-			}
+			if ( eso_stream && ! meterOnlyFlag ) ++StdOutputRecordCount;
 		}
 
 	}
@@ -4631,19 +5076,17 @@ namespace OutputProcessor {
 		// of the UpdateDataandReport subroutine. The code was moved to facilitate
 		// easier maintenance and writing of data to the SQL database.
 
-		static char s[ 129 ];
-
 		if ( DataSystemVariables::UpdateDataDuringWarmupExternalInterface &&
 			! DataSystemVariables::ReportDuringWarmup )
 			return;
 
-		dtoa( repValue, s );
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
-		if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
+		if ( ColumnarOutput::Active ) ColumnarOutput::AddValue( reportID, repValue );
+
+		SubmitValueRecord( OutputRecord::Numeric, DataGlobals::eso_stream, nullptr, creportID, repValue ); // Formatted by the output writer
 	}
 
 	void
@@ -4668,15 +5111,13 @@ namespace OutputProcessor {
 		// of the UpdateDataandReport subroutine. The code was moved to facilitate
 		// easier maintenance and writing of data to the SQL database.
 
-		static char s[ 129 ];
-
-		i32toa( repValue, s );
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
-		if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
+		if ( ColumnarOutput::Active ) ColumnarOutput::AddValue( reportID, repValue );
+
+		SubmitIntegerRecord( DataGlobals::eso_stream, creportID, repValue ); // Formatted by the output writer
 
 	}
 
@@ -4702,15 +5143,13 @@ namespace OutputProcessor {
 		// of the UpdateDataandReport subroutine. The code was moved to facilitate
 		// easier maintenance and writing of data to the SQL database.
 
-		static char s[ 129 ];
-
-		i64toa( repValue, s );
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
-		if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
+		if ( ColumnarOutput::Active ) ColumnarOutput::AddValue( reportID, repValue );
+
+		SubmitIntegerRecord( DataGlobals::eso_stream, creportID, repValue ); // Formatted by the output writer
 
 	}
 
@@ -4812,7 +5251,6 @@ namespace OutputProcessor {
 		// Using/Aliasing
 		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
-		using DataStringGlobals::NL;
 		using General::strip_trailing_zeros;
 
 		// Locals
@@ -4856,10 +5294,18 @@ namespace OutputProcessor {
 			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, rminValue, minValueDate, rmaxValue, maxValueDate );
 		}
 
+		if ( ColumnarOutput::Active ) {
+			if ( reportingInterval >= ReportDaily ) {
+				ColumnarOutput::AddValue( reportID, repVal, rminValue, minValueDate, rmaxValue, maxValueDate );
+			} else {
+				ColumnarOutput::AddValue( reportID, repVal );
+			}
+		}
+
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
-			if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << NL;
+			SubmitOutputLine( eso_stream, nullptr, reportIDString + ',' + NumberOut );
 		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
-			if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << NL;
+			SubmitOutputLine( eso_stream, nullptr, reportIDString + ',' + NumberOut + ',' + MinOut + ',' + MaxOut );
 		}
 
 	}
@@ -5236,6 +5682,7 @@ SetupOutputVariable(
 		if ( ! OnMeter && ! ThisOneOnTheList ) continue;
 
 		++NumOfRVariable;
+		ReportingListsCurrent = false;
 		if ( Loop == 1 && VariableType == SummedVar ) {
 			++NumOfRVariable_Sum;
 			if ( present( ResourceTypeKey ) ) {
@@ -5464,6 +5911,7 @@ SetupOutputVariable(
 		if ( ! ThisOneOnTheList ) continue;
 
 		++NumOfIVariable;
+		ReportingListsCurrent = false;
 		if ( Loop == 1 && VariableType == SummedVar ) {
 			++NumOfIVariable_Sum;
 		}
@@ -5642,7 +6090,6 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop; // Loop Variable
 	int IndexType; // Translate Zone=>1, HVAC=>2
 	Real64 CurVal; // Current value for real variables
 	Real64 ICurVal; // Current value for integer variables
@@ -5660,6 +6107,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	static bool EndTimeStepFlag( false ); // True when it's the end of the Zone Time Step
 	Real64 rxTime; // (MinuteNow-StartMinute)/REAL(MinutesPerTimeStep,r64) - for execution time
 
+	EP_PROFILE_ZONE( "UpdateDataandReport" );
+
 	IndexType = IndexTypeKey;
 	if ( IndexType != ZoneTSReporting && IndexType != HVACTSReporting ) {
 		ShowFatalError( "Invalid reporting requested -- UpdateDataAndReport" );
@@ -5686,42 +6135,35 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		rxTime = ( MinuteNow - StartMinute ) / double( MinutesPerTimeStep );
 
 		// Main "Record Keeping" Loops for R and I variables
-		for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-			if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+		// Only variables that are reported, metered or read externally are on the lists (see BuildReportingLists)
+		if ( ! ReportingListsCurrent ) BuildReportingLists();
+		auto & list( ReportingLists( IndexType ) );
 
-			// Act on the RVariables variable using the RVar structure
-			RVar >>= RVariableTypes( Loop ).VarPtr;
-			auto & rVar( RVar() );
+		for ( auto const pVar : list.RActive ) {
+			auto & rVar( *pVar );
+			Real64 const Which( rVar.Which );
 			rVar.Stored = true;
+			//        CALL SetMinMax(RVar%Which,MDHM,RVar%MaxValue,RVar%maxValueDate,RVar%MinValue,RVar%minValueDate)
+			if ( Which > rVar.MaxValue ) {
+				rVar.MaxValue = Which;
+				rVar.maxValueDate = MDHM;
+			}
+			if ( Which < rVar.MinValue ) {
+				rVar.MinValue = Which;
+				rVar.minValueDate = MDHM;
+			}
 			if ( rVar.StoreType == AveragedVar ) {
-				CurVal = rVar.Which * rxTime;
-				//        CALL SetMinMax(RVar%Which,MDHM,RVar%MaxValue,RVar%maxValueDate,RVar%MinValue,RVar%minValueDate)
-				if ( rVar.Which > rVar.MaxValue ) {
-					rVar.MaxValue = rVar.Which;
-					rVar.maxValueDate = MDHM;
-				}
-				if ( rVar.Which < rVar.MinValue ) {
-					rVar.MinValue = rVar.Which;
-					rVar.minValueDate = MDHM;
-				}
+				CurVal = Which * rxTime;
 				rVar.TSValue += CurVal;
-				rVar.EITSValue = rVar.TSValue; //CR - 8481 fix - 09/06/2011
 			} else {
-				//        CurVal=RVar%Which
-				if ( rVar.Which > rVar.MaxValue ) {
-					rVar.MaxValue = rVar.Which;
-					rVar.maxValueDate = MDHM;
-				}
-				if ( rVar.Which < rVar.MinValue ) {
-					rVar.MinValue = rVar.Which;
-					rVar.minValueDate = MDHM;
-				}
-				rVar.TSValue += rVar.Which;
-				rVar.EITSValue = rVar.TSValue; //CR - 8481 fix - 09/06/2011
+				rVar.TSValue += Which;
 			}
+			rVar.EITSValue = rVar.TSValue; //CR - 8481 fix - 09/06/2011
+		}
 
-			// End of "record keeping"  Report if applicable
-			if ( ! rVar.Report ) continue;
+		// End of "record keeping"  Report if applicable
+		for ( auto const pVar : list.RReported ) {
+			auto & rVar( *pVar );
 			ReportNow = true;
 			if ( rVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( rVar.SchedPtr ) != 0.0 ); // SetReportNow(RVar%SchedPtr)
 			if ( ! ReportNow ) continue;
@@ -5752,12 +6194,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			}
 		}
 
-		for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-			if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
-
-			// Act on the IVariables variable using the IVar structure
-			IVar >>= IVariableTypes( Loop ).VarPtr;
-			auto & iVar( IVar() );
+		for ( auto const pVar : list.IActive ) {
+			auto & iVar( *pVar );
 			iVar.Stored = true;
 			//      ICurVal=IVar%Which
 			if ( iVar.StoreType == AveragedVar ) {
@@ -5784,8 +6222,10 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				iVar.TSValue += iVar.Which;
 				iVar.EITSValue = iVar.TSValue; //CR - 8481 fix - 09/06/2011
 			}
+		}
 
-			if ( ! iVar.Report ) continue;
+		for ( auto const pVar : list.IReported ) {
+			auto & iVar( *pVar );
 			ReportNow = true;
 			if ( iVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( iVar.SchedPtr ) != 0.0 ); //SetReportNow(IVar%SchedPtr)
 			if ( ! ReportNow ) continue;
@@ -5826,17 +6266,12 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	if ( EndTimeStepFlag ) {
 
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) {
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
-				RVar >>= RVariableTypes( Loop ).VarPtr;
-				auto & rVar( RVar() );
-				// Update meters on the TimeStep  (Zone)
+			auto & list( ReportingLists( IndexType ) );
+			for ( auto const pVar : list.RActive ) {
+				auto & rVar( *pVar );
+				// Update meters on the TimeStep  (Zone) -- summed onto the meters in UpdateMeters
 				if ( rVar.MeterArrayPtr != 0 ) {
-					if ( VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters <= 0 ) {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters );
-					} else {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters, VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnCustomMeters );
-					}
+					MeterMap.VarValue[ rVar.MeterArrayPtr - 1 ] = rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult;
 				}
 				ReportNow = true;
 				if ( rVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( rVar.SchedPtr ) != 0.0 ); //SetReportNow(RVar%SchedPtr)
@@ -5873,10 +6308,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.thisTSStored = false;
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
-				IVar >>= IVariableTypes( Loop ).VarPtr;
-				auto & iVar( IVar() );
+			for ( auto const pVar : list.IActive ) {
+				auto & iVar( *pVar );
 				ReportNow = true;
 				if ( iVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( iVar.SchedPtr ) != 0.0 ); // SetReportNow(IVar%SchedPtr)
 				if ( ! ReportNow ) {
@@ -5932,10 +6365,9 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
 			TimeValue( IndexType ).CurMinute = 0.0;
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
-				RVar >>= RVariableTypes( Loop ).VarPtr;
-				auto & rVar( RVar() );
+			auto & list( ReportingLists( IndexType ) );
+			for ( auto const pVar : list.RActive ) {
+				auto & rVar( *pVar );
 				//        ReportNow=.TRUE.
 				//        IF (RVar%SchedPtr > 0) &
 				//          ReportNow=(GetCurrentScheduleValue(RVar%SchedPtr) /= 0.0)  !SetReportNow(RVar%SchedPtr)
@@ -5959,10 +6391,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.Value = 0.0;
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
-				IVar >>= IVariableTypes( Loop ).VarPtr;
-				auto & iVar( IVar() );
+			for ( auto const pVar : list.IActive ) {
+				auto & iVar( *pVar );
 				//        ReportNow=.TRUE.
 				//        IF (IVar%SchedPtr > 0) &
 				//          ReportNow=(GetCurrentScheduleValue(IVar%SchedPtr) /= 0.0)  !SetReportNow(IVar%SchedPtr)
@@ -6004,18 +6434,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		}
 		NumHoursInMonth += 24;
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) {
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportDaily );
-				}
+			for ( auto const pVar : ReportingLists( IndexType ).RDaily ) {
+				RVar >>= *pVar;
+				WriteRealVariableOutput( ReportDaily );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportDaily );
-				}
+			for ( auto const pVar : ReportingLists( IndexType ).IDaily ) {
+				IVar >>= *pVar;
+				WriteIntegerVariableOutput( ReportDaily );
 			} // Number of I Variables
 		} // Index type (Zone or HVAC)
 
@@ -6035,18 +6461,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		NumHoursInSim += NumHoursInMonth;
 		EndMonthFlag = false;
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportMonthly );
-				}
+			for ( auto const pVar : ReportingLists( IndexType ).RMonthly ) {
+				RVar >>= *pVar;
+				WriteRealVariableOutput( ReportMonthly );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportMonthly );
-				}
+			for ( auto const pVar : ReportingLists( IndexType ).IMonthly ) {
+				IVar >>= *pVar;
+				WriteIntegerVariableOutput( ReportMonthly );
 			} // Number of I Variables
 		} // IndexType (Zone, HVAC)
 
@@ -6062,18 +6484,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			TimePrint = false;
 		}
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportSim );
-				}
+			for ( auto const pVar : ReportingLists( IndexType ).RSim ) {
+				RVar >>= *pVar;
+				WriteRealVariableOutput( ReportSim );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportSim );
-				}
+			for ( auto const pVar : ReportingLists( IndexType ).ISim ) {
+				IVar >>= *pVar;
+				WriteIntegerVariableOutput( ReportSim );
 			} // Number of I Variables
 		} // Index Type (Zone, HVAC)
 
@@ -48,7 +48,9 @@
 #define OutputProcessor_hh_INCLUDED
 
 // C++ Headers
+#include <cstdint>
 #include <iosfwd>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -63,6 +65,9 @@
 
 namespace EnergyPlus {
 
+	// Forward Declarations
+	struct OutputRecord;
+
 namespace OutputProcessor {
 
 	// Using/Aliasing
@@ -184,6 +189,8 @@ namespace OutputProcessor {
 
 	extern int MaxNumSubcategories;
 	extern bool isFinalYear;
+	extern bool ReportingListsCurrent; // False when ReportingLists must be rebuilt before the next update
+	extern bool AccumulateAllVariables; // True when unreported variables are read at the zone time step (external interface)
 
 	// All routines should be listed here whether private or not
 	//PUBLIC  ReallocateTVar
@@ -579,6 +586,39 @@ namespace OutputProcessor {
 
 	};
 
+	struct ReportingListType // Variables visited by UpdateDataandReport for one index type (Zone or HVAC)
+	{
+		// Members
+		std::vector< RealVariables * > RActive; // Accumulated every call: reported, metered or externally read
+		std::vector< RealVariables * > RReported; // Subset of RActive requested in the IDF (any frequency)
+		std::vector< RealVariables * > RDaily; // Subset of RReported written at the end of the day
+		std::vector< RealVariables * > RMonthly; // Subset of RReported written at the end of the month
+		std::vector< RealVariables * > RSim; // Subset of RReported written at the end of the environment
+		std::vector< IntegerVariables * > IActive; // Accumulated every call: reported or externally read
+		std::vector< IntegerVariables * > IReported; // Subset of IActive requested in the IDF (any frequency)
+		std::vector< IntegerVariables * > IDaily; // Subset of IReported written at the end of the day
+		std::vector< IntegerVariables * > IMonthly; // Subset of IReported written at the end of the month
+		std::vector< IntegerVariables * > ISim; // Subset of IReported written at the end of the environment
+
+		// Default Constructor
+		ReportingListType()
+		{}
+
+	};
+
+	struct MeterMapType // Variable to meter map in compressed sparse row form, one row per meter
+	{
+		// Members
+		std::vector< int > RowStart; // (0:NumEnergyMeters) Start of each meter's entries in VarMeterArray
+		std::vector< int > VarMeterArray; // VarMeterArrays index (zero based) of each entry, in reporting order
+		std::vector< Real64 > VarValue; // (0:NumVarMeterArrays-1) Time step value of each metered variable with multipliers
+
+		// Default Constructor
+		MeterMapType()
+		{}
+
+	};
+
 	// Object Data
 	extern Array1D< TimeSteps > TimeValue; // Pointers to the actual TimeStep variables
 	extern Array1D< RealVariableType > RVariableTypes; // Variable Types structure (use NumOfRVariables to traverse)
@@ -592,6 +632,8 @@ namespace OutputProcessor {
 	extern Array1D< MeterArrayType > VarMeterArrays;
 	extern Array1D< MeterType > EnergyMeters;
 	extern Array1D< EndUseCategoryType > EndUseCategory;
+	extern Array1D< ReportingListType > ReportingLists; // (IndexType) dense variable lists for UpdateDataandReport
+	extern MeterMapType MeterMap; // Variable to meter map used by UpdateMeters (built with ReportingLists)
 
 	// Functions
 
@@ -696,6 +738,12 @@ namespace OutputProcessor {
 	std::string
 	GetVariableUnitsString( std::string const & VariableName );
 
+	void
+	BuildReportingLists();
+
+	void
+	RequestAllVariablesAccumulated();
+
 	// *****************************************************************************
 	// The following routines implement Energy Meters in EnergyPlus.
 	// *****************************************************************************
@@ -837,6 +885,44 @@ namespace OutputProcessor {
 		std::string const & EndUseSubName
 	);
 
+	void
+	StartOutputWriter();
+
+	void
+	FlushOutputWriter();
+
+	void
+	StopOutputWriter();
+
+	void
+	SubmitOutputRecord( OutputRecord & record );
+
+	void
+	SubmitValueRecord(
+		int const kind, // OutputRecord::Value (0.0 for zero) or OutputRecord::Numeric
+		std::ostream * stream, // Stream the line is written to
+		std::ostream * echoStream, // Second stream given the same line (or nullptr)
+		std::string const & reportID, // Report id in characters
+		Real64 const value // Value
+	);
+
+	void
+	SubmitIntegerRecord(
+		std::ostream * stream, // Stream the line is written to
+		std::string const & reportID, // Report id in characters
+		std::int64_t const value // Value
+	);
+
+	void
+	SubmitOutputLine(
+		std::ostream * stream, // Stream the line is written to
+		std::ostream * echoStream, // Second stream given the same line (or nullptr)
+		std::string const & line // Line without the newline
+	);
+
+	void
+	WriteOutputRecord( OutputRecord const & record );
+
 	void
 	WriteTimeStampFormatData(
 		std::ostream * out_stream_p, // Output stream pointer
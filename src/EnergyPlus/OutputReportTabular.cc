@@ -88,6 +88,7 @@
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <LowTempRadiantSystem.hh>
+#include <NumericFormat.hh>
 #include <ElectricPowerServiceManager.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
@@ -14164,6 +14165,7 @@ namespace OutputReportTabular {
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
 		//       MODIFIED       November 2008; LKL - prevent errors
+		//                      Fixed point fields formatted through NumericFormat
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -14185,7 +14187,6 @@ namespace OutputReportTabular {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static Array1D< gio::Fmt > formDigits( {0,9}, { "(F12.0)", "(F12.1)", "(F12.2)", "(F12.3)", "(F12.4)", "(F12.5)", "(F12.6)", "(F12.7)", "(F12.8)", "(F12.9)" } ); // formDigits(0) | formDigits(1) | formDigits(2) | formDigits(3) | formDigits(4) | formDigits(5) | formDigits(6) | formDigits(7) | formDigits(8) | formDigits(9)
 		static Array1D< Real64 > const maxvalDigits( {0,9}, { 9999999999.0, 999999999.0, 99999999.0, 9999999.0, 999999.0, 99999.0, 9999.0, 999.0, 99.0, 9.0 } ); // maxvalDigits(0) | maxvalDigits(1) | maxvalDigits(2) | maxvalDigits(3) | maxvalDigits(4) | maxvalDigits(5) | maxvalDigits(6) | maxvalDigits(7) | maxvalDigits(8) | maxvalDigits(9)
 		static gio::Fmt fmtd( "(E12.6)" );
 
@@ -14197,6 +14198,7 @@ namespace OutputReportTabular {
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		int nDigits;
+		char s[ NumericFormat::BufferSize ]; // Formatted field
 
 		nDigits = numDigits;
 		if ( RealIn < 0.0 ) --nDigits;
@@ -14205,8 +14207,8 @@ namespace OutputReportTabular {
 
 		if ( std::abs( RealIn ) > maxvalDigits( nDigits ) ) {
 			gio::write( StringOut, fmtd ) << RealIn;
-		} else {
-			gio::write( StringOut, formDigits( nDigits ) ) << RealIn;
+		} else { // F12.nDigits
+			StringOut.assign( s, NumericFormat::format_fixed( RealIn, 12, nDigits, s ) );
 		}
 		//  WRITE(FMT=, UNIT=stringOut) RealIn
 		// check if it did not fit
@@ -14224,17 +14226,15 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       Formatted through NumericFormat
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		//   Abstract away the internal write concept
 
-		// Return value
-		std::string StringOut;
+		char s[ NumericFormat::BufferSize ]; // Formatted field
 
-		gio::write( StringOut, fmtLD ) << intIn;
-		return StringOut;
+		return std::string( s, NumericFormat::format_list_directed( std::int64_t( intIn ), s ) );
 	}
 
 	Real64
@@ -0,0 +1,130 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus Headers
+#include <EnergyPlus/OutputWriter.hh>
+
+namespace EnergyPlus {
+
+	// Constructor: Starts the writer thread, which passes each record to write
+	OutputWriter::
+	OutputWriter(
+		Write const write,
+		size_type const capacity // Ring size: rounded up to a power of 2
+	) :
+		write_( write )
+	{
+		size_type size( 2u );
+		while ( size < capacity ) size <<= 1;
+		ring_.resize( size );
+		mask_ = size - 1u;
+		thread_ = std::thread( &OutputWriter::work, this );
+	}
+
+	// Destructor: Writes the remaining records and joins the writer thread
+	OutputWriter::
+	~OutputWriter()
+	{
+		{
+			std::lock_guard< std::mutex > lock( mutex_ );
+			stop_ = true;
+		}
+		wake_.notify_one();
+		thread_.join();
+	}
+
+	// Queue a record, waiting while the ring is full
+	void
+	OutputWriter::
+	push( OutputRecord const & record )
+	{
+		size_type const head( head_.load( std::memory_order_relaxed ) );
+		while ( head - tail_.load( std::memory_order_acquire ) > mask_ ) { // Full: let the writer catch up
+			std::this_thread::yield();
+		}
+		ring_[ head & mask_ ] = record;
+		head_.store( head + 1u ); // Sequentially consistent with the sleeping_ check below
+		if ( sleeping_.load() ) {
+			std::lock_guard< std::mutex > lock( mutex_ ); // Writer is waiting or about to check head_
+			wake_.notify_one();
+		}
+	}
+
+	// Return once every queued record has been written
+	void
+	OutputWriter::
+	flush()
+	{
+		size_type const head( head_.load( std::memory_order_relaxed ) );
+		while ( tail_.load( std::memory_order_acquire ) != head ) {
+			std::this_thread::yield();
+		}
+	}
+
+	// Writer thread loop
+	void
+	OutputWriter::
+	work()
+	{
+		size_type tail( tail_.load( std::memory_order_relaxed ) );
+		while ( true ) {
+			size_type const head( head_.load( std::memory_order_acquire ) );
+			if ( tail != head ) {
+				for ( ; tail != head; ++tail ) {
+					write_( ring_[ tail & mask_ ] );
+					tail_.store( tail + 1u, std::memory_order_release ); // Hand the slot back
+				}
+			} else { // Nothing queued: sleep until a push or shutdown
+				std::unique_lock< std::mutex > lock( mutex_ );
+				sleeping_.store( true );
+				wake_.wait( lock, [ this, tail ]{ return stop_ || head_.load() != tail; } );
+				sleeping_.store( false );
+				if ( stop_ && head_.load() == tail ) return;
+			}
+		}
+	}
+
+} // EnergyPlus
@@ -0,0 +1,173 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EnergyPlus_OutputWriter_hh_INCLUDED
+#define EnergyPlus_OutputWriter_hh_INCLUDED
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+// C++ Headers
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EnergyPlus {
+
+// Package: Output Writer
+//
+// Purpose: Background thread that formats and writes the eso/mtr report lines queued by the
+//  simulation thread, so that number formatting and stream output overlap the simulation
+//
+// Notes:
+//  One producer (the simulation thread) and one consumer (the writer thread) share a ring of
+//   fixed size records without locking: the producer owns the slots from head_ on, the writer
+//   the slots from tail_ to head_
+//  Records are written in the order they are pushed; push waits while the ring is full
+//  Anything else writing to the same streams must call flush first, so its output lands after
+//   the queued lines
+//  The writer sleeps on a condition variable when the ring is empty and is only woken when
+//   it has gone to sleep, so a busy simulation does not lock a mutex per record
+
+// Report line queued for the output writer: the raw values, formatted by the writer
+struct OutputRecord
+{
+
+	enum Kind : int {
+		Value, // reportID,value with 0.0 for zero
+		Numeric, // reportID,value
+		Integer, // reportID,integer
+		TimeStamp, // Time stamp line of the given reporting interval
+		Text // Preformatted line
+	};
+
+	static std::size_t const IDSize = 16u; // Report ids are at most 15 characters
+	static std::size_t const DayTypeSize = 24u;
+	static std::size_t const TextSize = 192u;
+
+	Kind kind;
+	std::ostream * stream; // Stream the line is written to
+	std::ostream * echoStream; // Second stream given the same line (meters also reported to the eso) or nullptr
+	char reportID[ IDSize ]; // Report id or time stamp id
+	Real64 value; // Value and Numeric
+	std::int64_t integer; // Integer
+	int interval; // TimeStamp: reporting interval
+	int month; // TimeStamp
+	int dayOfMonth; // TimeStamp
+	int dst; // TimeStamp
+	int hour; // TimeStamp
+	Real64 startMinute; // TimeStamp
+	Real64 endMinute; // TimeStamp
+	char dayOfSim[ IDSize ]; // TimeStamp
+	char dayType[ DayTypeSize ]; // TimeStamp
+	char text[ TextSize ]; // Text
+
+};
+
+class OutputWriter
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Write = void (*)( OutputRecord const & );
+
+public: // Creation
+
+	// Constructor: Starts the writer thread, which passes each record to write
+	explicit
+	OutputWriter(
+		Write const write,
+		size_type const capacity = 4096u // Ring size: rounded up to a power of 2
+	);
+
+	// Destructor: Writes the remaining records and joins the writer thread
+	~OutputWriter();
+
+	// Not copyable
+	OutputWriter( OutputWriter const & ) = delete;
+	OutputWriter &
+	operator =( OutputWriter const & ) = delete;
+
+public: // Methods
+
+	// Queue a record, waiting while the ring is full
+	void
+	push( OutputRecord const & record );
+
+	// Return once every queued record has been written
+	void
+	flush();
+
+private: // Methods
+
+	// Writer thread loop
+	void
+	work();
+
+private: // Data
+
+	std::vector< OutputRecord > ring_;
+	size_type mask_; // Ring size - 1
+	Write write_;
+	std::atomic< size_type > head_{ 0u }; // Records pushed
+	std::atomic< size_type > tail_{ 0u }; // Records written
+	std::atomic< bool > sleeping_{ false }; // Writer is (about to be) waiting on wake_
+	std::mutex mutex_;
+	std::condition_variable wake_; // Signals new records or shutdown to a sleeping writer
+	bool stop_ = false; // Shutdown requested
+	std::thread thread_;
+
+};
+
+} // EnergyPlus
+
+#endif
@@ -65,6 +65,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataTimings.hh>
 #include <EMSManager.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -223,6 +224,8 @@ namespace PlantManager {
 		int HalfLoopNum;
 		int CurntMinPlantSubIterations;
 
+		EP_PROFILE_ZONE( "ManagePlantLoops" );
+
 		if ( std::any_of( PlantLoop.begin(), PlantLoop.end(), []( DataPlant::PlantLoopData const & e ){ return ( e.CommonPipeType == DataPlant::CommonPipe_Single ) || ( e.CommonPipeType == DataPlant::CommonPipe_TwoWay ); } ) ) {
 			CurntMinPlantSubIterations = max( 7, MinPlantSubIterations );
 		} else {
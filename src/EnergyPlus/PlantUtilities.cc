@@ -1568,7 +1568,6 @@ namespace PlantUtilities {
 		using DataPlant::PlantLoop;
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using DataLoopNode::Node;
-		using FluidProperties::GetSpecificHeatGlycol;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1614,7 +1613,7 @@ namespace PlantUtilities {
 			// use current mass flow rate and inlet temp from Node and recalculate outlet temp
 			if ( Node( InletNodeNum ).MassFlowRate > MassFlowTolerance ) {
 				// update node outlet conditions
-				Cp = GetSpecificHeatGlycol( PlantLoop( LoopNum ).FluidName, ModelInletTemp, PlantLoop( LoopNum ).FluidIndex, RoutineName );
+				Cp = PlantLoop( LoopNum ).glycol().cp( ModelInletTemp, RoutineName );
 				Node( OutletNodeNum ).Temp = Node( InletNodeNum ).Temp + ModelCondenserHeatRate / ( Node( InletNodeNum ).MassFlowRate * Cp );
 
 			}
@@ -1675,7 +1674,6 @@ namespace PlantUtilities {
 		using DataPlant::PlantLoop;
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using DataLoopNode::Node;
-		using FluidProperties::GetSpecificHeatGlycol;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1721,7 +1719,7 @@ namespace PlantUtilities {
 			// use current mass flow rate and inlet temp from Node and recalculate outlet temp
 			if ( Node( InletNodeNum ).MassFlowRate > MassFlowTolerance ) {
 				// update node outlet conditions
-				Cp = GetSpecificHeatGlycol( PlantLoop( LoopNum ).FluidName, ModelInletTemp, PlantLoop( LoopNum ).FluidIndex, RoutineName );
+				Cp = PlantLoop( LoopNum ).glycol().cp( ModelInletTemp, RoutineName );
 				Node( OutletNodeNum ).Temp = Node( InletNodeNum ).Temp + ModelRecoveryHeatRate / ( Node( InletNodeNum ).MassFlowRate * Cp );
 
 			}
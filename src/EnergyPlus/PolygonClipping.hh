@@ -0,0 +1,230 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EnergyPlus_PolygonClipping_hh_INCLUDED
+#define EnergyPlus_PolygonClipping_hh_INCLUDED
+
+// Purpose: Vertex loop kernels for the homogeneous coordinate polygon overlap calculations in SolarShading
+//
+// Notes:
+//  The kernels work on structure-of-arrays vertex data: one contiguous array per coordinate, as in the
+//   SolarShading HC arrays (a row per figure) and the XTEMP/YTEMP/ATEMP/BTEMP/CTEMP overlap arrays
+//  The floating point kernels are vectorized with AVX2 or SSE2 when the build targets them and otherwise
+//   fall back to scalar loops: each lane does the same operations in the same order as the scalar loop
+//   (no fused multiply-add) so the results are identical to the scalar versions
+//  The Int64 kernels are plain loops: integer arithmetic keeps the sign tests of INCLOS and INTCPT exact
+//   and there is no 64-bit multiply before AVX-512, where compilers vectorize these loops themselves
+//  The _scalar variants are the reference versions used for testing and benchmarking
+//  These are performance critical: validate any change with the polygon clipping benchmarks
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+#include <Platform.hh>
+
+// C++ Headers
+#include <cassert>
+
+#if defined(__AVX2__)
+#define EP_POLYGON_CLIPPING_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && ( _M_IX86_FP >= 2 ) )
+#define EP_POLYGON_CLIPPING_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace EnergyPlus {
+
+namespace PolygonClipping {
+
+	// Name of the instruction set used by the floating point kernels
+	inline
+	char const *
+	instruction_set()
+	{
+#if defined(EP_POLYGON_CLIPPING_AVX2)
+		return "AVX2";
+#elif defined(EP_POLYGON_CLIPPING_SSE2)
+		return "SSE2";
+#else
+		return "Scalar";
+#endif
+	}
+
+	// Values of the line ( a, b, c ) at the vertices: h[ i ] = x[ i ] * a + y[ i ] * b + c
+	//  h > 0 left of the directed line, h < 0 right of it
+	inline
+	void
+	edge_values_scalar(
+		Real64 const * const x, // Vertex x coordinates
+		Real64 const * const y, // Vertex y coordinates
+		int const n, // Number of vertices
+		Real64 const a, // Line 'A' coefficient
+		Real64 const b, // Line 'B' coefficient
+		Real64 const c, // Line 'C' coefficient
+		Real64 * const h // Line values at the vertices
+	)
+	{
+		for ( int i = 0; i < n; ++i ) {
+			h[ i ] = x[ i ] * a + y[ i ] * b + c;
+		}
+	}
+
+	inline
+	void
+	edge_values(
+		Real64 const * const x, // Vertex x coordinates
+		Real64 const * const y, // Vertex y coordinates
+		int const n, // Number of vertices
+		Real64 const a, // Line 'A' coefficient
+		Real64 const b, // Line 'B' coefficient
+		Real64 const c, // Line 'C' coefficient
+		Real64 * const h // Line values at the vertices
+	)
+	{
+		int i( 0 );
+#if defined(EP_POLYGON_CLIPPING_AVX2)
+		__m256d const av( _mm256_set1_pd( a ) );
+		__m256d const bv( _mm256_set1_pd( b ) );
+		__m256d const cv( _mm256_set1_pd( c ) );
+		for ( ; i + 4 <= n; i += 4 ) {
+			__m256d const xa( _mm256_mul_pd( _mm256_loadu_pd( x + i ), av ) );
+			__m256d const yb( _mm256_mul_pd( _mm256_loadu_pd( y + i ), bv ) );
+			_mm256_storeu_pd( h + i, _mm256_add_pd( _mm256_add_pd( xa, yb ), cv ) );
+		}
+#elif defined(EP_POLYGON_CLIPPING_SSE2)
+		__m128d const av( _mm_set1_pd( a ) );
+		__m128d const bv( _mm_set1_pd( b ) );
+		__m128d const cv( _mm_set1_pd( c ) );
+		for ( ; i + 2 <= n; i += 2 ) {
+			__m128d const xa( _mm_mul_pd( _mm_loadu_pd( x + i ), av ) );
+			__m128d const yb( _mm_mul_pd( _mm_loadu_pd( y + i ), bv ) );
+			_mm_storeu_pd( h + i, _mm_add_pd( _mm_add_pd( xa, yb ), cv ) );
+		}
+#endif
+		edge_values_scalar( x + i, y + i, n - i, a, b, c, h + i );
+	}
+
+	// Lines through the edges of a closed polygon: edge i runs from vertex i to vertex i+1 (wrapping to 0)
+	//  a[ i ] = y[ i ] - y[ i+1 ], b[ i ] = x[ i+1 ] - x[ i ], c[ i ] = x[ i ] * y[ i+1 ] - y[ i ] * x[ i+1 ]
+	inline
+	void
+	edge_lines_scalar(
+		Real64 const * const x, // Vertex x coordinates
+		Real64 const * const y, // Vertex y coordinates
+		int const n, // Number of vertices
+		Real64 * const a, // Line 'A' coefficients
+		Real64 * const b, // Line 'B' coefficients
+		Real64 * const c, // Line 'C' coefficients
+		int const first = 0 // First edge to compute
+	)
+	{
+		for ( int i = first; i < n; ++i ) {
+			int const j( i + 1 < n ? i + 1 : 0 );
+			a[ i ] = y[ i ] - y[ j ];
+			b[ i ] = x[ j ] - x[ i ];
+			c[ i ] = x[ i ] * y[ j ] - y[ i ] * x[ j ];
+		}
+	}
+
+	inline
+	void
+	edge_lines(
+		Real64 const * const x, // Vertex x coordinates
+		Real64 const * const y, // Vertex y coordinates
+		int const n, // Number of vertices
+		Real64 * const a, // Line 'A' coefficients
+		Real64 * const b, // Line 'B' coefficients
+		Real64 * const c // Line 'C' coefficients
+	)
+	{
+		int i( 0 );
+#if defined(EP_POLYGON_CLIPPING_AVX2)
+		for ( ; i + 4 < n; i += 4 ) { // Next vertices i+1..i+4 are all in range: last edge wraps in the scalar loop
+			__m256d const xi( _mm256_loadu_pd( x + i ) );
+			__m256d const yi( _mm256_loadu_pd( y + i ) );
+			__m256d const xj( _mm256_loadu_pd( x + i + 1 ) );
+			__m256d const yj( _mm256_loadu_pd( y + i + 1 ) );
+			_mm256_storeu_pd( a + i, _mm256_sub_pd( yi, yj ) );
+			_mm256_storeu_pd( b + i, _mm256_sub_pd( xj, xi ) );
+			_mm256_storeu_pd( c + i, _mm256_sub_pd( _mm256_mul_pd( xi, yj ), _mm256_mul_pd( yi, xj ) ) );
+		}
+#elif defined(EP_POLYGON_CLIPPING_SSE2)
+		for ( ; i + 2 < n; i += 2 ) { // Next vertices i+1..i+2 are all in range: last edge wraps in the scalar loop
+			__m128d const xi( _mm_loadu_pd( x + i ) );
+			__m128d const yi( _mm_loadu_pd( y + i ) );
+			__m128d const xj( _mm_loadu_pd( x + i + 1 ) );
+			__m128d const yj( _mm_loadu_pd( y + i + 1 ) );
+			_mm_storeu_pd( a + i, _mm_sub_pd( yi, yj ) );
+			_mm_storeu_pd( b + i, _mm_sub_pd( xj, xi ) );
+			_mm_storeu_pd( c + i, _mm_sub_pd( _mm_mul_pd( xi, yj ), _mm_mul_pd( yi, xj ) ) );
+		}
+#endif
+		edge_lines_scalar( x, y, n, a, b, c, i );
+	}
+
+	// Values of the integer line ( a, b, c ) at the vertices: h[ i ] = a * x[ i ] + b * y[ i ] + c
+	inline
+	void
+	side_values(
+		Int64 const * const x, // Vertex x coordinates
+		Int64 const * const y, // Vertex y coordinates
+		int const n, // Number of vertices
+		Int64 const a, // Line 'A' coefficient
+		Int64 const b, // Line 'B' coefficient
+		Int64 const c, // Line 'C' coefficient
+		Int64 * const h // Line values at the vertices
+	)
+	{
+		for ( int i = 0; i < n; ++i ) {
+			h[ i ] = a * x[ i ] + b * y[ i ] + c;
+		}
+	}
+
+} // PolygonClipping
+
+} // EnergyPlus
+
+#endif
@@ -1215,7 +1215,7 @@ namespace Pumps {
 				PumpEquip( PumpNum ).MassFlowRateMin = PumpEquip( PumpNum ).MinVolFlowRate * SteamDensity;
 
 			} else {
-				TempWaterDensity = GetDensityGlycol( PlantLoop( PumpEquip( PumpNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( PumpEquip( PumpNum ).LoopNum ).FluidIndex, RoutineName );
+				TempWaterDensity = PlantLoop( PumpEquip( PumpNum ).LoopNum ).glycol().rho( DataGlobals::InitConvTemp, RoutineName );
 				mdotMax = PumpEquip( PumpNum ).NomVolFlowRate * TempWaterDensity;
 				//mdotMin = PumpEquip(PumpNum)%MinVolFlowRate * TempWaterDensity
 				//see note above
@@ -1292,7 +1292,6 @@ namespace Pumps {
 
 		// Using/Aliasing
 		using ScheduleManager::GetCurrentScheduleValue;
-		using FluidProperties::GetDensityGlycol;
 		using DataPlant::PlantLoop;
 		using DataPlant::Press_FlowCorrection;
 		using DataPlant::PlantAvailMgr;
@@ -1468,8 +1467,6 @@ namespace Pumps {
 
 		// Using/Aliasing
 		using PlantUtilities::SetComponentFlowRate;
-		using FluidProperties::GetDensityGlycol;
-		using FluidProperties::GetSpecificHeatGlycol;
 		using DataPlant::PlantLoop;
 		using DataBranchAirLoopPlant::MassFlowTolerance;
 		using General::RoundSigDigits;
@@ -1600,7 +1597,7 @@ namespace Pumps {
 		}
 
 		// density used for volumetric flow calculations
-		LoopDensity = GetDensityGlycol( PlantLoop( PumpEquip( PumpNum ).LoopNum ).FluidName, Node( InletNode ).Temp, PlantLoop( PumpEquip( PumpNum ).LoopNum ).FluidIndex, RoutineName );
+		LoopDensity = PlantLoop( PumpEquip( PumpNum ).LoopNum ).glycol().rho( Node( InletNode ).Temp, RoutineName );
 
 		//****************************!
 		//***** CALCULATE POWER (1) **!
@@ -1760,7 +1757,7 @@ namespace Pumps {
 
 		// Calculate density at InitConvTemp once here, to remove RhoH2O calls littered throughout
 		if ( PumpEquip( PumpNum ).LoopNum > 0 ) {
-			TempWaterDensity = GetDensityGlycol( PlantLoop( PumpEquip( PumpNum ).LoopNum ).FluidName, DataGlobals::InitConvTemp, PlantLoop( PumpEquip( PumpNum ).LoopNum ).FluidIndex, RoutineName );
+			TempWaterDensity = PlantLoop( PumpEquip( PumpNum ).LoopNum ).glycol().rho( DataGlobals::InitConvTemp, RoutineName );
 		} else {
 			TempWaterDensity = GetDensityGlycol( fluidNameWater, DataGlobals::InitConvTemp, DummyWaterIndex, RoutineName );
 		}
@@ -2086,8 +2083,6 @@ namespace Pumps {
 
 		// Using/Aliasing
 		using PlantUtilities::SetComponentFlowRate;
-		using FluidProperties::GetDensityGlycol;
-		using FluidProperties::GetSpecificHeatGlycol;
 		using DataPlant::Press_FlowCorrection;
 		using DataPlant::PlantLoop;
 		using General::RoundSigDigits;
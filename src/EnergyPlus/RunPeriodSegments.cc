@@ -0,0 +1,888 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Fmath.hh>
+#include <ObjexxFCL/string.functions.hh>
+
+// EnergyPlus Headers
+#include <RunPeriodSegments.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <DataTimings.hh>
+#include <DisplayRoutines.hh>
+#include <FileSystem.hh>
+#include <General.hh>
+#include <NumericFormat.hh>
+#include <OutputProcessor.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace RunPeriodSegments {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Splits the weather file run periods of an annual simulation into segments that are simulated
+	// side by side in separate EnergyPlus processes, and stitches the output of the segments back into
+	// the standard and meter output files a single run would have produced.
+
+	// METHODOLOGY EMPLOYED:
+	// The driver process (--segments N) launches one copy of the program per segment (--segment K),
+	// each writing into its own output directory.  A segment narrows every RunPeriod to its share of
+	// the months and begins OverlapDays early; the overlap days are simulated with output reporting
+	// off so that the building, ground and plant histories have settled when the reported days
+	// begin.  Every segment also does its own sizing and warmup; only the first one simulates the
+	// design days.  When a segment finishes it writes a manifest naming its run periods, the overlap
+	// and reported days of each and the report ids of its averaged variables.
+	// The driver then copies the data dictionary and the non run period environments of the first
+	// segment, follows each run period of the first segment with the same run period of the others
+	// (renumbering the day of simulation and carrying the cumulative meters across), and merges the
+	// run period values of all the segments into one record: sums are added, averages are weighted
+	// by the reported days and the minimum and maximum keep the extreme with its time stamp.
+	// Optionally the stitched output is compared variable by variable with that of a serial run.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// Segments are whole months so that monthly reports never straddle two segments.  The SQLite and
+	// tabular output stay in the segment directories.
+
+	// Using/Aliasing
+	using namespace DataGlobals;
+	using DataStringGlobals::pathChar;
+	using General::JulianDay;
+	using General::InvJulianDay;
+
+	// Data
+	namespace {
+		// Ids of the time stamp records of a standard or meter output file
+		struct StampIDs
+		{
+			std::string Environment;
+			std::string TimeStep; // Also used by hourly records
+			std::string Daily;
+			std::string Monthly;
+			std::string RunPeriod;
+		};
+
+		// An output file being read a line at a time
+		struct SegmentFile
+		{
+			std::ifstream Stream;
+			std::string Line; // Current line
+			bool AtEnd = false; // True once "End of Data" or the end of the file has been reached
+		};
+
+		// Run period value of one variable merged over the segments
+		struct RunPeriodValue
+		{
+			std::string ID;
+			Real64 Value = 0.0; // Sum of the values (weighted by the reported days for averaged variables)
+			bool HasMinMax = false;
+			Real64 MinValue = 0.0;
+			std::string MinText; // Minimum with its time stamp, as written by the segment
+			Real64 MaxValue = 0.0;
+			std::string MaxText; // Maximum with its time stamp, as written by the segment
+		};
+
+		std::string const EndOfDictionary( "End of Data Dictionary" );
+		std::string const EndOfData( "End of Data" );
+		std::string const RecordsWritten( "Number of Records Written=" );
+
+		bool
+		ReadLine(
+			std::istream & Stream,
+			std::string & Line
+		)
+		{
+			if ( ! std::getline( Stream, Line ) ) return false;
+			if ( ! Line.empty() && Line.back() == '\r' ) Line.pop_back();
+			return true;
+		}
+
+		std::string
+		FirstField( std::string const & Line )
+		{
+			return Line.substr( 0, Line.find( ',' ) );
+		}
+
+		std::vector< std::string >
+		SplitFields( std::string const & Line )
+		{
+			std::vector< std::string > Fields;
+			std::string::size_type Start( 0 );
+			while ( true ) {
+				std::string::size_type const Comma( Line.find( ',', Start ) );
+				if ( Comma == std::string::npos ) {
+					Fields.push_back( Line.substr( Start ) );
+					break;
+				}
+				Fields.push_back( Line.substr( Start, Comma - Start ) );
+				Start = Comma + 1;
+			}
+			return Fields;
+		}
+
+		std::string
+		JoinFields(
+			std::vector< std::string > const & Fields,
+			std::size_t const First,
+			std::size_t const Last // One past the last field joined
+		)
+		{
+			std::string Joined( Fields[ First ] );
+			for ( std::size_t Field = First + 1; Field < Last; ++Field ) {
+				Joined += ',';
+				Joined += Fields[ Field ];
+			}
+			return Joined;
+		}
+
+		std::string
+		FormatValue( Real64 const Value )
+		{
+			// Same form as OutputProcessor uses for the records
+			if ( Value == 0.0 ) return "0.0";
+			char s[ 129 ];
+			NumericFormat::format_shortest( Value, s );
+			return std::string( s );
+		}
+
+		// Reads the data dictionary, noting the time stamp ids and the cumulative meters
+		bool
+		ReadDictionary(
+			std::istream & Stream,
+			std::vector< std::string > & Dictionary,
+			StampIDs & Stamps,
+			std::unordered_set< std::string > & CumulativeIDs
+		)
+		{
+			std::string Line;
+			while ( ReadLine( Stream, Line ) ) {
+				Dictionary.push_back( Line );
+				if ( Line == EndOfDictionary ) return true;
+				std::vector< std::string > const Fields( SplitFields( Line ) );
+				if ( Fields.size() < 3 ) continue;
+				std::string const & Descriptor( Fields[ 2 ] );
+				if ( Descriptor == "Environment Title[]" ) {
+					Stamps.Environment = Fields[ 0 ];
+				} else if ( Descriptor == "Day of Simulation[]" ) {
+					Stamps.TimeStep = Fields[ 0 ];
+				} else if ( Descriptor == "Cumulative Day of Simulation[]" ) {
+					Stamps.Daily = Fields[ 0 ];
+				} else if ( has_prefix( Descriptor, "Cumulative Days of Simulation[]" ) ) {
+					if ( Fields[ 1 ] == "2" ) {
+						Stamps.Monthly = Fields[ 0 ];
+					} else {
+						Stamps.RunPeriod = Fields[ 0 ];
+					}
+				} else if ( Fields[ 1 ] == "1" && has_prefix( Descriptor, "Cumulative " ) ) {
+					CumulativeIDs.insert( Fields[ 0 ] );
+				}
+			}
+			return false;
+		}
+
+		// Moves to the next line of the data section
+		bool
+		Advance( SegmentFile & File )
+		{
+			if ( File.AtEnd ) return false;
+			if ( ! ReadLine( File.Stream, File.Line ) || File.Line == EndOfData ) {
+				File.AtEnd = true;
+				return false;
+			}
+			return true;
+		}
+
+		// Moves past the current environment to the stamp of the next one
+		void
+		SkipEnvironment(
+			SegmentFile & File,
+			StampIDs const & Stamps
+		)
+		{
+			while ( Advance( File ) && FirstField( File.Line ) != Stamps.Environment ) {}
+		}
+
+		// Number of environments in an output file
+		int
+		CountEnvironments( std::string const & FileName )
+		{
+			SegmentFile File;
+			File.Stream.open( FileName );
+			std::vector< std::string > Dictionary;
+			StampIDs Stamps;
+			std::unordered_set< std::string > CumulativeIDs;
+			if ( ! File.Stream || ! ReadDictionary( File.Stream, Dictionary, Stamps, CumulativeIDs ) ) return -1;
+			int Count( 0 );
+			while ( Advance( File ) ) {
+				if ( FirstField( File.Line ) == Stamps.Environment ) ++Count;
+			}
+			return Count;
+		}
+
+		// Copies one run period of one segment, leaving its run period records in Merged
+		void
+		StitchEnvironment(
+			SegmentFile & File,
+			StampIDs const & Stamps,
+			std::unordered_set< std::string > const & CumulativeIDs,
+			std::unordered_set< std::string > const & AveragedIDs,
+			int const DayShift, // Added to the day of simulation of the time stamps
+			Real64 const Days, // Days reported by the segment
+			std::unordered_map< std::string, Real64 > & CumulativeValues, // Last cumulative meter values written
+			std::vector< RunPeriodValue > & Merged,
+			std::unordered_map< std::string, std::size_t > & MergedIndex,
+			std::ostream & Out,
+			long & RecordCount
+		)
+		{
+			// The cumulative meters of a segment start from zero; continue them from the previous segment
+			std::unordered_map< std::string, Real64 > const CumulativeOffsets( CumulativeValues );
+			bool InRunPeriod( false );
+			while ( Advance( File ) ) {
+				std::string const & Line( File.Line );
+				std::string const ID( FirstField( Line ) );
+				if ( ID == Stamps.Environment ) break;
+				if ( ID == Stamps.TimeStep || ID == Stamps.Daily || ID == Stamps.Monthly ) {
+					InRunPeriod = false;
+					std::string::size_type const DayStart( ID.size() + 1 );
+					std::string::size_type const DayEnd( Line.find( ',', DayStart ) );
+					int const Day( std::atoi( Line.substr( DayStart, DayEnd - DayStart ).c_str() ) );
+					Out << ID << ',' << Day + DayShift;
+					if ( DayEnd != std::string::npos ) Out << Line.substr( DayEnd );
+					Out << '\n';
+				} else if ( ID == Stamps.RunPeriod ) {
+					InRunPeriod = true;
+				} else if ( InRunPeriod ) {
+					std::vector< std::string > const Fields( SplitFields( Line ) );
+					auto const Found( MergedIndex.find( ID ) );
+					if ( Found == MergedIndex.end() ) {
+						MergedIndex[ ID ] = Merged.size();
+						Merged.emplace_back();
+						Merged.back().ID = ID;
+					}
+					RunPeriodValue & Record( Merged[ Found == MergedIndex.end() ? Merged.size() - 1 : Found->second ] );
+					Real64 const Value( std::atof( Fields[ 1 ].c_str() ) );
+					Record.Value += ( AveragedIDs.count( ID ) ? Value * Days : Value );
+					if ( Fields.size() > 2 ) {
+						std::size_t const GroupSize( ( Fields.size() - 2 ) / 2 );
+						Real64 const MinValue( std::atof( Fields[ 2 ].c_str() ) );
+						Real64 const MaxValue( std::atof( Fields[ 2 + GroupSize ].c_str() ) );
+						if ( ! Record.HasMinMax || MinValue < Record.MinValue ) {
+							Record.MinValue = MinValue;
+							Record.MinText = JoinFields( Fields, 2, 2 + GroupSize );
+						}
+						if ( ! Record.HasMinMax || MaxValue > Record.MaxValue ) {
+							Record.MaxValue = MaxValue;
+							Record.MaxText = JoinFields( Fields, 2 + GroupSize, Fields.size() );
+						}
+						Record.HasMinMax = true;
+					}
+				} else if ( CumulativeIDs.count( ID ) ) {
+					auto const Offset( CumulativeOffsets.find( ID ) );
+					if ( Offset == CumulativeOffsets.end() || Offset->second == 0.0 ) {
+						CumulativeValues[ ID ] = std::atof( Line.c_str() + ID.size() + 1 );
+						Out << Line << '\n';
+					} else {
+						Real64 const Value( std::atof( Line.c_str() + ID.size() + 1 ) + Offset->second );
+						CumulativeValues[ ID ] = Value;
+						Out << ID << ',' << FormatValue( Value ) << '\n';
+					}
+					++RecordCount;
+				} else {
+					Out << Line << '\n';
+					++RecordCount;
+				}
+			}
+		}
+
+		// Reads every variable of an output file as the series of its reported values
+		bool
+		ReadSeries(
+			std::string const & FileName,
+			std::vector< std::string > & Names,
+			std::vector< std::vector< Real64 > > & Series
+		)
+		{
+			std::ifstream Stream( FileName );
+			std::vector< std::string > Dictionary;
+			StampIDs Stamps;
+			std::unordered_set< std::string > CumulativeIDs;
+			if ( ! Stream || ! ReadDictionary( Stream, Dictionary, Stamps, CumulativeIDs ) ) return false;
+
+			std::unordered_map< std::string, std::size_t > Index;
+			for ( std::size_t Entry = 1; Entry + 1 < Dictionary.size(); ++Entry ) {
+				std::string const & Line( Dictionary[ Entry ] );
+				std::string const ID( FirstField( Line ) );
+				if ( ID == Stamps.Environment || ID == Stamps.TimeStep || ID == Stamps.Daily || ID == Stamps.Monthly || ID == Stamps.RunPeriod ) continue;
+				std::string::size_type const NameStart( Line.find( ',', ID.size() + 1 ) );
+				if ( NameStart == std::string::npos ) continue;
+				Index[ ID ] = Names.size();
+				Names.push_back( Line.substr( NameStart + 1 ) );
+				Series.emplace_back();
+			}
+
+			std::string Line;
+			while ( ReadLine( Stream, Line ) && Line != EndOfData ) {
+				std::string::size_type const Comma( Line.find( ',' ) );
+				if ( Comma == std::string::npos ) continue;
+				auto const Found( Index.find( Line.substr( 0, Comma ) ) );
+				if ( Found != Index.end() ) Series[ Found->second ].push_back( std::atof( Line.c_str() + Comma + 1 ) );
+			}
+			return true;
+		}
+
+		std::string
+		QuotedName( std::string const & Name )
+		{
+			return '"' + Name + '"';
+		}
+	}
+
+	// MODULE VARIABLE DECLARATIONS:
+	int NumSegments( 1 ); // Number of segments each weather file run period is split into
+	int SegmentNum( 0 ); // Segment simulated by this process (0 when this process is not a segment)
+	int OverlapDays( 0 ); // Days simulated ahead of each segment to condition the building, not reported
+	int CurrentOverlapDays( 0 ); // Overlap days at the start of the current environment
+	std::string ReferenceEsoFileName; // Serial run output the stitched output is compared with (blank for none)
+	std::string SegmentDirectoryPrefix; // Output directory and prefix the segment directories are named after
+	std::string OutputPrefixName( "eplus" ); // Output file name prefix handed to the segment processes
+	std::string OutputSuffixStyle( "L" ); // Output file suffix style handed to the segment processes
+	std::vector< SegmentEnvironment > Environments; // Weather file run periods reported by this segment
+
+	// Functions
+
+	void
+	clear_state()
+	{
+		NumSegments = 1;
+		SegmentNum = 0;
+		OverlapDays = 0;
+		CurrentOverlapDays = 0;
+		ReferenceEsoFileName.clear();
+		SegmentDirectoryPrefix.clear();
+		OutputPrefixName = "eplus";
+		OutputSuffixStyle = "L";
+		Environments.clear();
+	}
+
+	bool
+	IsDriver()
+	{
+		return NumSegments > 1 && SegmentNum == 0;
+	}
+
+	void
+	SegmentMonths(
+		int const FirstMonth, // First month of the run period
+		int const LastMonth, // Last month of the run period
+		int const NumSegments, // Number of segments the run period is split into
+		int const SegmentNum, // Segment (1..NumSegments)
+		int & SegFirstMonth, // First month of the segment
+		int & SegLastMonth // Last month of the segment
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Shares the months of a run period out among the segments as evenly as possible.
+
+		int const NumMonths( LastMonth - FirstMonth + 1 );
+		SegFirstMonth = FirstMonth + ( ( SegmentNum - 1 ) * NumMonths ) / NumSegments;
+		SegLastMonth = FirstMonth + ( SegmentNum * NumMonths ) / NumSegments - 1;
+	}
+
+	void
+	SplitRunPeriod(
+		WeatherManager::RunPeriodData & RunPeriod,
+		int const LeapYearValue, // 1 if leap year indicated, 0 if not
+		bool & ErrorsFound
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Narrows a RunPeriod to the months simulated by this segment, starting up to OverlapDays
+		// earlier when the run period has days to spare ahead of the segment.
+
+		// METHODOLOGY EMPLOYED:
+		// A day of week given for the start of the run period is moved forward by the days skipped so
+		// that every date keeps the day of week it has in the full run period.
+
+		std::string const Context( "RunPeriod=\"" + RunPeriod.Title + "\"" );
+
+		if ( RunPeriod.NumSimYears > 1 ) {
+			ShowSevereError( Context + " is repeated; a repeated run period cannot be split into segments." );
+			ErrorsFound = true;
+			return;
+		}
+
+		int const StartDate( JulianDay( RunPeriod.StartMonth, RunPeriod.StartDay, LeapYearValue ) );
+		int const EndDate( JulianDay( RunPeriod.EndMonth, RunPeriod.EndDay, LeapYearValue ) );
+		if ( StartDate > EndDate ) {
+			ShowSevereError( Context + " runs through the end of the year; it cannot be split into segments." );
+			ErrorsFound = true;
+			return;
+		}
+
+		int const NumMonths( RunPeriod.EndMonth - RunPeriod.StartMonth + 1 );
+		if ( NumSegments > NumMonths ) {
+			ShowSevereError( Context + " spans " + General::TrimSigDigits( NumMonths ) + " month(s); it cannot be split into " + General::TrimSigDigits( NumSegments ) + " segments." );
+			ShowContinueError( "Segments are whole months; use fewer segments." );
+			ErrorsFound = true;
+			return;
+		}
+
+		int SegFirstMonth;
+		int SegLastMonth;
+		SegmentMonths( RunPeriod.StartMonth, RunPeriod.EndMonth, NumSegments, SegmentNum, SegFirstMonth, SegLastMonth );
+		int SegStartDate( SegFirstMonth == RunPeriod.StartMonth ? StartDate : JulianDay( SegFirstMonth, 1, LeapYearValue ) );
+		int const SegEndDate( SegLastMonth == RunPeriod.EndMonth ? EndDate : JulianDay( SegLastMonth + 1, 1, LeapYearValue ) - 1 );
+		int const Overlap( std::min( OverlapDays, SegStartDate - StartDate ) );
+		SegStartDate -= Overlap;
+
+		InvJulianDay( SegStartDate, RunPeriod.StartMonth, RunPeriod.StartDay, LeapYearValue );
+		InvJulianDay( SegEndDate, RunPeriod.EndMonth, RunPeriod.EndDay, LeapYearValue );
+		if ( RunPeriod.DayOfWeek != 0 ) {
+			RunPeriod.DayOfWeek = mod( RunPeriod.DayOfWeek - 1 + SegStartDate - StartDate, 7 ) + 1;
+		}
+		RunPeriod.SegmentOverlapDays = Overlap;
+	}
+
+	void
+	BeginEnvironment()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Notes the overlap days of a new environment and records the run periods of a segment for
+		// its manifest.
+
+		CurrentOverlapDays = 0;
+		if ( SegmentNum == 0 || KindOfSim != ksRunPeriodWeather ) return;
+
+		CurrentOverlapDays = WeatherManager::Environment( WeatherManager::Envrn ).SegmentOverlapDays;
+		Environments.emplace_back( DataEnvironment::EnvironmentName, CurrentOverlapDays, NumOfDayInEnvrn - CurrentOverlapDays );
+	}
+
+	void
+	ManageOverlapDays()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keeps the overlap days ahead of a segment out of the output; they belong to the previous
+		// segment and only condition the building for this one.
+
+		if ( CurrentOverlapDays == 0 || WarmupFlag ) return;
+
+		DoOutputReporting = ( DayOfSim > CurrentOverlapDays );
+		if ( DayOfSim == CurrentOverlapDays + 1 ) OutputProcessor::ResetAccumulationWhenWarmupComplete();
+	}
+
+	void
+	WriteManifest( std::string const & FileName )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Tells the driver which run periods this segment reported, how many days of each were
+		// overlap and which of its report variables are averages.
+
+		using OutputProcessor::AveragedVar;
+		using OutputProcessor::IVariableTypes;
+		using OutputProcessor::NumOfIVariable;
+		using OutputProcessor::NumOfRVariable;
+		using OutputProcessor::RVariableTypes;
+
+		std::ofstream Stream( FileName, std::ios_base::out | std::ios_base::trunc );
+		if ( ! Stream ) {
+			ShowSevereError( "Could not write the run period segment manifest \"" + FileName + "\"." );
+			return;
+		}
+
+		Stream << "Segment," << SegmentNum << ',' << NumSegments << '\n';
+		for ( auto const & Environment : Environments ) {
+			Stream << "Environment," << Environment.OverlapDays << ',' << Environment.ReportedDays << ',' << Environment.Title << '\n';
+		}
+		Stream << "Averaged";
+		for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+			if ( RVariableTypes( Loop ).StoreType == AveragedVar ) Stream << ',' << RVariableTypes( Loop ).ReportID;
+		}
+		for ( int Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
+			if ( IVariableTypes( Loop ).StoreType == AveragedVar ) Stream << ',' << IVariableTypes( Loop ).ReportID;
+		}
+		Stream << '\n';
+	}
+
+	bool
+	ReadManifest(
+		std::string const & FileName,
+		SegmentManifest & Manifest
+	)
+	{
+		std::ifstream Stream( FileName );
+		if ( ! Stream ) return false;
+
+		Manifest = SegmentManifest();
+		std::string Line;
+		bool Found( false );
+		while ( ReadLine( Stream, Line ) ) {
+			std::vector< std::string > const Fields( SplitFields( Line ) );
+			if ( Fields[ 0 ] == "Segment" ) {
+				Found = true;
+			} else if ( Fields[ 0 ] == "Environment" && Fields.size() >= 4 ) {
+				std::string::size_type const TitleStart( Fields[ 0 ].size() + Fields[ 1 ].size() + Fields[ 2 ].size() + 3 );
+				Manifest.Environments.emplace_back( Line.substr( TitleStart ), std::atoi( Fields[ 1 ].c_str() ), std::atoi( Fields[ 2 ].c_str() ) );
+			} else if ( Fields[ 0 ] == "Averaged" ) {
+				for ( std::size_t Field = 1; Field < Fields.size(); ++Field ) {
+					Manifest.AveragedReportIDs.push_back( std::atoi( Fields[ Field ].c_str() ) );
+				}
+			}
+		}
+		return Found;
+	}
+
+	bool
+	StitchOutputFiles(
+		std::vector< std::string > const & SegmentFiles, // Output file of each segment, in order
+		std::vector< SegmentManifest > const & Manifests, // Manifest of each segment, in order
+		std::string const & FileName, // Stitched output file
+		std::string & ErrorMessage
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Stitches the standard or meter output files of the segments into the file a single run
+		// would have written.
+
+		// METHODOLOGY EMPLOYED:
+		// The run periods are the last environments of every segment, after the design days and the
+		// HVAC sizing passes, which only the first segment reports.  The dictionary and the leading
+		// environments are copied from the first segment; each run period is then written from all
+		// of the segments in turn.
+
+		std::size_t const NumFiles( SegmentFiles.size() );
+		std::size_t const NumRunPeriods( Manifests[ 0 ].Environments.size() );
+
+		std::vector< std::unique_ptr< SegmentFile > > Files;
+		std::vector< int > FirstRunPeriod;
+		StampIDs Stamps;
+		std::unordered_set< std::string > CumulativeIDs;
+		std::vector< std::string > Dictionary;
+		for ( std::size_t Segment = 0; Segment < NumFiles; ++Segment ) {
+			int const NumEnvironments( CountEnvironments( SegmentFiles[ Segment ] ) );
+			if ( NumEnvironments < 0 ) {
+				ErrorMessage = "Could not read \"" + SegmentFiles[ Segment ] + "\".";
+				return false;
+			}
+			if ( Manifests[ Segment ].Environments.size() != NumRunPeriods || NumEnvironments < int( NumRunPeriods ) ) {
+				ErrorMessage = "The run periods in \"" + SegmentFiles[ Segment ] + "\" do not match those of the first segment.";
+				return false;
+			}
+			FirstRunPeriod.push_back( NumEnvironments - int( NumRunPeriods ) );
+
+			Files.emplace_back( new SegmentFile );
+			SegmentFile & File( *Files.back() );
+			File.Stream.open( SegmentFiles[ Segment ] );
+			StampIDs SegmentStamps;
+			std::unordered_set< std::string > SegmentCumulativeIDs;
+			std::vector< std::string > SegmentDictionary;
+			ReadDictionary( File.Stream, SegmentDictionary, SegmentStamps, SegmentCumulativeIDs );
+			if ( Segment == 0 ) {
+				Stamps = SegmentStamps;
+				CumulativeIDs.swap( SegmentCumulativeIDs );
+				Dictionary.swap( SegmentDictionary );
+			}
+			Advance( File ); // Onto the first environment stamp
+			for ( int Environment = 0; Segment > 0 && Environment < FirstRunPeriod.back(); ++Environment ) {
+				SkipEnvironment( File, Stamps );
+			}
+		}
+
+		std::unordered_set< std::string > AveragedIDs;
+		for ( int const ReportID : Manifests[ 0 ].AveragedReportIDs ) {
+			AveragedIDs.insert( std::to_string( ReportID ) );
+		}
+
+		std::ofstream Out( FileName, std::ios_base::out | std::ios_base::trunc );
+		if ( ! Out ) {
+			ErrorMessage = "Could not open \"" + FileName + "\" for output (write).";
+			return false;
+		}
+		for ( auto const & Line : Dictionary ) {
+			Out << Line << '\n';
+		}
+
+		long RecordCount( 0 );
+		SegmentFile & First( *Files[ 0 ] );
+		int Environment( 0 );
+		while ( ! First.AtEnd ) {
+			Out << First.Line << '\n'; // Environment stamp
+			if ( Environment < FirstRunPeriod[ 0 ] ) {
+				while ( Advance( First ) && FirstField( First.Line ) != Stamps.Environment ) {
+					Out << First.Line << '\n';
+					if ( FirstField( First.Line ) != Stamps.TimeStep && FirstField( First.Line ) != Stamps.Daily && FirstField( First.Line ) != Stamps.Monthly && FirstField( First.Line ) != Stamps.RunPeriod ) ++RecordCount;
+				}
+			} else {
+				std::size_t const RunPeriod( Environment - FirstRunPeriod[ 0 ] );
+				std::unordered_map< std::string, Real64 > CumulativeValues;
+				std::vector< RunPeriodValue > Merged;
+				std::unordered_map< std::string, std::size_t > MergedIndex;
+				int DayOffset( 0 );
+				for ( std::size_t Segment = 0; Segment < NumFiles; ++Segment ) {
+					SegmentEnvironment const & Period( Manifests[ Segment ].Environments[ RunPeriod ] );
+					StitchEnvironment( *Files[ Segment ], Stamps, CumulativeIDs, AveragedIDs, DayOffset - Period.OverlapDays, Period.ReportedDays, CumulativeValues, Merged, MergedIndex, Out, RecordCount );
+					DayOffset += Period.ReportedDays;
+				}
+				if ( ! Merged.empty() ) {
+					Out << Stamps.RunPeriod << ',' << DayOffset << '\n';
+					for ( auto const & Record : Merged ) {
+						Real64 const Value( AveragedIDs.count( Record.ID ) ? Record.Value / std::max( DayOffset, 1 ) : Record.Value );
+						Out << Record.ID << ',' << FormatValue( Value );
+						if ( Record.HasMinMax ) Out << ',' << Record.MinText << ',' << Record.MaxText;
+						Out << '\n';
+						++RecordCount;
+					}
+				}
+			}
+			++Environment;
+		}
+
+		// Keep the layout of the record count line written by the first segment
+		std::string CountLine( ' ' + RecordsWritten );
+		std::size_t CountWidth( 0 );
+		std::string Line;
+		if ( ReadLine( First.Stream, Line ) ) {
+			std::string::size_type const Equals( Line.find( RecordsWritten ) );
+			if ( Equals != std::string::npos ) {
+				CountLine = Line.substr( 0, Equals + RecordsWritten.size() );
+				CountWidth = Line.size() - CountLine.size();
+			}
+		}
+		Out << EndOfData << '\n';
+		Out << CountLine << std::setw( CountWidth ) << RecordCount << '\n';
+		return bool( Out );
+	}
+
+	bool
+	CompareOutputFiles(
+		std::string const & FileName, // Stitched output file
+		std::string const & ReferenceFileName, // Output file of the serial run
+		std::vector< VariableDifference > & Differences
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Measures how far each variable of the stitched output is from the serial run.
+
+		// METHODOLOGY EMPLOYED:
+		// Variables are matched by their dictionary entry and compared record by record.
+
+		std::vector< std::string > Names;
+		std::vector< std::vector< Real64 > > Series;
+		std::vector< std::string > ReferenceNames;
+		std::vector< std::vector< Real64 > > ReferenceSeries;
+		if ( ! ReadSeries( FileName, Names, Series ) ) return false;
+		if ( ! ReadSeries( ReferenceFileName, ReferenceNames, ReferenceSeries ) ) return false;
+
+		std::unordered_map< std::string, std::size_t > ReferenceIndex;
+		for ( std::size_t Variable = 0; Variable < ReferenceNames.size(); ++Variable ) {
+			ReferenceIndex[ ReferenceNames[ Variable ] ] = Variable;
+		}
+
+		Differences.clear();
+		for ( std::size_t Variable = 0; Variable < Names.size(); ++Variable ) {
+			auto const Found( ReferenceIndex.find( Names[ Variable ] ) );
+			if ( Found == ReferenceIndex.end() ) continue;
+			std::vector< Real64 > const & Values( Series[ Variable ] );
+			std::vector< Real64 > const & ReferenceValues( ReferenceSeries[ Found->second ] );
+
+			VariableDifference Difference;
+			Difference.Name = Names[ Variable ];
+			Difference.Count = int( std::min( Values.size(), ReferenceValues.size() ) );
+			Difference.ReferenceCount = int( ReferenceValues.size() );
+			for ( int Record = 0; Record < Difference.Count; ++Record ) {
+				Real64 const AbsDiff( std::abs( Values[ Record ] - ReferenceValues[ Record ] ) );
+				Difference.MaxAbsDiff = std::max( Difference.MaxAbsDiff, AbsDiff );
+				if ( ReferenceValues[ Record ] != 0.0 ) Difference.MaxRelDiff = std::max( Difference.MaxRelDiff, AbsDiff / std::abs( ReferenceValues[ Record ] ) );
+				Difference.SumSqDiff += AbsDiff * AbsDiff;
+			}
+			Differences.push_back( Difference );
+		}
+		return true;
+	}
+
+	void
+	ManageSegments()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Runs the segments of the simulation side by side and stitches their output together.
+
+		// METHODOLOGY EMPLOYED:
+		// Each segment is a separate process, so the module state of the simulation is never shared;
+		// one thread per segment waits on its process.
+
+		using namespace DataStringGlobals;
+		using FileSystem::fileExists;
+		using FileSystem::getAbsolutePath;
+		using FileSystem::getFileName;
+		using FileSystem::getProgramPath;
+		using FileSystem::makeDirectory;
+		using FileSystem::systemCall;
+		using General::TrimSigDigits;
+
+		std::string const ProgramPath( getAbsolutePath( getProgramPath() ) );
+		std::vector< std::string > Directories;
+		std::vector< std::string > Commands;
+		for ( int Segment = 1; Segment <= NumSegments; ++Segment ) {
+			std::string const Directory( SegmentDirectoryPrefix + "-segment" + TrimSigDigits( Segment ) + pathChar );
+			makeDirectory( Directory );
+			std::string Command( "\"" + ProgramPath + "\" --segments " + TrimSigDigits( NumSegments ) + " --segment " + TrimSigDigits( Segment ) );
+			if ( OverlapDays > 0 ) Command += " --segment-overlap " + TrimSigDigits( OverlapDays );
+			if ( AnnualSimulation ) Command += " -a";
+			if ( DataTimings::ProfilingEnabled ) Command += " --profile";
+			if ( DataSystemVariables::WriteColumnarOutput ) Command += " --columnar";
+			Command += " -d \"" + Directory + "\" -p \"" + OutputPrefixName + "\" -s " + OutputSuffixStyle;
+			Command += " -i \"" + getAbsolutePath( inputIddFileName ) + "\"";
+			if ( fileExists( inputWeatherFileName ) ) Command += " -w \"" + getAbsolutePath( inputWeatherFileName ) + "\"";
+			Command += " \"" + getAbsolutePath( inputIdfFileName ) + "\"";
+			Command += " > \"" + Directory + "segment.log\" 2>&1";
+			Directories.push_back( Directory );
+			Commands.push_back( Command );
+		}
+
+		DisplayString( "Simulating " + TrimSigDigits( NumSegments ) + " run period segments" );
+		std::vector< int > ExitStatus( NumSegments, 0 );
+		{
+			std::vector< std::thread > Workers;
+			for ( int Segment = 0; Segment < NumSegments; ++Segment ) {
+				Workers.emplace_back( [ &Commands, &ExitStatus, Segment ]() { ExitStatus[ Segment ] = systemCall( Commands[ Segment ] ); } );
+			}
+			for ( auto & Worker : Workers ) {
+				Worker.join();
+			}
+		}
+
+		bool ErrorsFound( false );
+		std::vector< SegmentManifest > Manifests( NumSegments );
+		for ( int Segment = 0; Segment < NumSegments; ++Segment ) {
+			std::string const & Directory( Directories[ Segment ] );
+			if ( ExitStatus[ Segment ] != 0 || ! ReadManifest( Directory + getFileName( outputSegFileName ), Manifests[ Segment ] ) ) {
+				ShowSevereError( "Run period segment " + TrimSigDigits( Segment + 1 ) + " did not complete." );
+				ShowContinueError( "See " + Directory + getFileName( outputErrFileName ) + " and " + Directory + "segment.log" );
+				ErrorsFound = true;
+			}
+		}
+		if ( ErrorsFound ) {
+			ShowFatalError( "Run period segments failed; their output was not stitched." );
+		}
+
+		DisplayString( "Stitching run period segment output" );
+		for ( std::string const & OutputFileName : { outputEsoFileName, outputMtrFileName } ) {
+			std::vector< std::string > SegmentFiles;
+			for ( auto const & Directory : Directories ) {
+				SegmentFiles.push_back( Directory + getFileName( OutputFileName ) );
+			}
+			if ( ! fileExists( SegmentFiles[ 0 ] ) ) continue; // Nothing was reported
+			std::string ErrorMessage;
+			if ( ! StitchOutputFiles( SegmentFiles, Manifests, OutputFileName, ErrorMessage ) ) {
+				ShowSevereError( "Run period segment output could not be stitched into \"" + OutputFileName + "\"." );
+				ShowContinueError( ErrorMessage );
+				ErrorsFound = true;
+			}
+		}
+		if ( ErrorsFound ) {
+			ShowFatalError( "Preceding errors cause termination." );
+		}
+
+		if ( ReferenceEsoFileName.empty() ) return;
+
+		std::vector< VariableDifference > Differences;
+		if ( ! CompareOutputFiles( outputEsoFileName, ReferenceEsoFileName, Differences ) ) {
+			ShowWarningError( "Could not compare the stitched output with \"" + ReferenceEsoFileName + "\"." );
+			return;
+		}
+		std::ofstream Report( outputSegCsvFileName, std::ios_base::out | std::ios_base::trunc );
+		if ( ! Report ) {
+			ShowWarningError( "Could not open \"" + outputSegCsvFileName + "\" for output (write)." );
+			return;
+		}
+		Report << "Variable,Records,Reference Records,Max Absolute Difference,Max Relative Difference,RMS Difference\n";
+		VariableDifference const * Worst( nullptr );
+		for ( auto const & Difference : Differences ) {
+			Real64 const RMS( Difference.Count > 0 ? std::sqrt( Difference.SumSqDiff / Difference.Count ) : 0.0 );
+			Report << QuotedName( Difference.Name ) << ',' << Difference.Count << ',' << Difference.ReferenceCount << ',' << FormatValue( Difference.MaxAbsDiff ) << ',' << FormatValue( Difference.MaxRelDiff ) << ',' << FormatValue( RMS ) << '\n';
+			if ( Worst == nullptr || Difference.MaxRelDiff > Worst->MaxRelDiff ) Worst = &Difference;
+		}
+		ShowMessage( "Run period segments: " + TrimSigDigits( int( Differences.size() ) ) + " variables compared with " + ReferenceEsoFileName + ", see " + outputSegCsvFileName );
+		if ( Worst != nullptr ) {
+			ShowContinueError( "Largest relative difference " + FormatValue( Worst->MaxRelDiff ) + " in " + Worst->Name );
+		}
+	}
+
+} // RunPeriodSegments
+
+} // EnergyPlus
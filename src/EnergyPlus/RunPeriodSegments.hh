@@ -0,0 +1,196 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef RunPeriodSegments_hh_INCLUDED
+#define RunPeriodSegments_hh_INCLUDED
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+#include <WeatherManager.hh>
+
+namespace EnergyPlus {
+
+namespace RunPeriodSegments {
+
+	// Data
+	// MODULE VARIABLE DECLARATIONS:
+	extern int NumSegments; // Number of segments each weather file run period is split into
+	extern int SegmentNum; // Segment simulated by this process (0 when this process is not a segment)
+	extern int OverlapDays; // Days simulated ahead of each segment to condition the building, not reported
+	extern int CurrentOverlapDays; // Overlap days at the start of the current environment
+	extern std::string ReferenceEsoFileName; // Serial run output the stitched output is compared with (blank for none)
+	extern std::string SegmentDirectoryPrefix; // Output directory and prefix the segment directories are named after
+	extern std::string OutputPrefixName; // Output file name prefix handed to the segment processes
+	extern std::string OutputSuffixStyle; // Output file suffix style handed to the segment processes
+
+	// Types
+
+	struct SegmentEnvironment // A weather file run period as reported by one segment
+	{
+		// Members
+		std::string Title; // Environment name written to the environment stamp
+		int OverlapDays; // Days simulated ahead of the reported days
+		int ReportedDays; // Days written to the output files
+
+		// Default Constructor
+		SegmentEnvironment() :
+			OverlapDays( 0 ),
+			ReportedDays( 0 )
+		{}
+
+		// Member Constructor
+		SegmentEnvironment(
+			std::string const & Title,
+			int const OverlapDays,
+			int const ReportedDays
+		) :
+			Title( Title ),
+			OverlapDays( OverlapDays ),
+			ReportedDays( ReportedDays )
+		{}
+
+	};
+
+	struct SegmentManifest // What a segment process tells the driver about its output files
+	{
+		// Members
+		std::vector< SegmentEnvironment > Environments; // Weather file run periods in simulation order
+		std::vector< int > AveragedReportIDs; // Report ids whose run period value is an average rather than a sum
+	};
+
+	struct VariableDifference // Agreement of one output variable with the serial run
+	{
+		// Members
+		std::string Name; // Dictionary entry of the variable
+		int Count; // Records compared
+		int ReferenceCount; // Records in the serial run output
+		Real64 MaxAbsDiff; // Largest absolute difference
+		Real64 MaxRelDiff; // Largest difference relative to the serial run value
+		Real64 SumSqDiff; // Sum of the squared differences
+
+		// Default Constructor
+		VariableDifference() :
+			Count( 0 ),
+			ReferenceCount( 0 ),
+			MaxAbsDiff( 0.0 ),
+			MaxRelDiff( 0.0 ),
+			SumSqDiff( 0.0 )
+		{}
+
+	};
+
+	extern std::vector< SegmentEnvironment > Environments; // Weather file run periods reported by this segment
+
+	// Functions
+
+	void
+	clear_state();
+
+	bool
+	IsDriver();
+
+	void
+	SegmentMonths(
+		int const FirstMonth, // First month of the run period
+		int const LastMonth, // Last month of the run period
+		int const NumSegments, // Number of segments the run period is split into
+		int const SegmentNum, // Segment (1..NumSegments)
+		int & SegFirstMonth, // First month of the segment
+		int & SegLastMonth // Last month of the segment
+	);
+
+	void
+	SplitRunPeriod(
+		WeatherManager::RunPeriodData & RunPeriod,
+		int const LeapYearValue, // 1 if leap year indicated, 0 if not
+		bool & ErrorsFound
+	);
+
+	void
+	BeginEnvironment();
+
+	void
+	ManageOverlapDays();
+
+	void
+	WriteManifest( std::string const & FileName );
+
+	bool
+	ReadManifest(
+		std::string const & FileName,
+		SegmentManifest & Manifest
+	);
+
+	bool
+	StitchOutputFiles(
+		std::vector< std::string > const & SegmentFiles, // Output file of each segment, in order
+		std::vector< SegmentManifest > const & Manifests, // Manifest of each segment, in order
+		std::string const & FileName, // Stitched output file
+		std::string & ErrorMessage
+	);
+
+	bool
+	CompareOutputFiles(
+		std::string const & FileName, // Stitched output file
+		std::string const & ReferenceFileName, // Output file of the serial run
+		std::vector< VariableDifference > & Differences
+	);
+
+	void
+	ManageSegments();
+
+} // RunPeriodSegments
+
+} // EnergyPlus
+
+#endif
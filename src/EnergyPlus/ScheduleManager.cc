@@ -62,6 +62,7 @@
 #include <EMSManager.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
+#include <NameIndex.hh>
 #include <OutputProcessor.hh>
 #include <UtilityRoutines.hh>
 
@@ -148,6 +149,9 @@ namespace ScheduleManager {
 	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
 	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
 		bool CheckScheduleValueMinMaxRunOnceOnly (true );
+		NameIndex DayScheduleIndex; // Index of the DaySchedule names
+		NameIndex WeekScheduleIndex; // Index of the WeekSchedule names
+		NameIndex ScheduleIndex; // Index of the Schedule names
 	}
 
 	//Derived Types Variables
@@ -182,6 +186,9 @@ namespace ScheduleManager {
 		DaySchedule.deallocate();
 		WeekSchedule.deallocate();
 		Schedule.deallocate();
+		DayScheduleIndex.clear();
+		WeekScheduleIndex.clear();
+		ScheduleIndex.clear();
 	}
 
 	void
@@ -879,7 +886,7 @@ namespace ScheduleManager {
 			WeekSchedule( LoopIndex ).Name = Alphas( 1 );
 			// Rest of Alphas are processed into Pointers
 			for ( InLoopIndex = 1; InLoopIndex <= MaxDayTypes; ++InLoopIndex ) {
-				DayIndex = FindItemInList( Alphas( InLoopIndex + 1 ), DaySchedule( {1,NumRegDaySchedules} ) );
+				DayIndex = DayScheduleIndex.find( Alphas( InLoopIndex + 1 ), DaySchedule, NumRegDaySchedules );
 				if ( DayIndex == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( InLoopIndex + 1 ) + " \"" + Alphas( InLoopIndex + 1 ) + "\" not Found", UnitNumber );
 					ErrorsFound = true;
@@ -908,7 +915,7 @@ namespace ScheduleManager {
 			AllDays = false;
 			// Rest of Alphas are processed into Pointers
 			for ( InLoopIndex = 2; InLoopIndex <= NumAlphas; InLoopIndex += 2 ) {
-				DayIndex = FindItemInList( Alphas( InLoopIndex + 1 ), DaySchedule( {1,NumRegDaySchedules} ) );
+				DayIndex = DayScheduleIndex.find( Alphas( InLoopIndex + 1 ), DaySchedule, NumRegDaySchedules );
 				if ( DayIndex == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( InLoopIndex + 1 ) + " \"" + Alphas( InLoopIndex + 1 ) + "\" not Found", UnitNumber );
 					ShowContinueError( "ref: " + cAlphaFields( InLoopIndex ) + " \"" + Alphas( InLoopIndex ) + "\"" );
@@ -970,7 +977,7 @@ namespace ScheduleManager {
 			DaysInYear = 0;
 			// Rest of Alphas (Weekschedules) are processed into Pointers
 			for ( InLoopIndex = 3; InLoopIndex <= NumAlphas; ++InLoopIndex ) {
-				WeekIndex = FindItemInList( Alphas( InLoopIndex ), WeekSchedule( {1,NumRegWeekSchedules} ) );
+				WeekIndex = WeekScheduleIndex.find( Alphas( InLoopIndex ), WeekSchedule, NumRegWeekSchedules );
 				if ( WeekIndex == 0 ) {
 					ShowSevereError( RoutineName + CurrentModuleObject + "=\"" + Alphas( 1 ) + "\", " + cAlphaFields( InLoopIndex ) + "=\"" + Alphas( InLoopIndex ) + "\" not found.", UnitNumber );
 					ErrorsFound = true;
@@ -2553,14 +2560,11 @@ namespace ScheduleManager {
 		// This function returns the internal pointer to Schedule "ScheduleName".
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Looks the name up in a hash index of the schedule names.
 
 		// REFERENCES:
 		// na
 
-		// Using/Aliasing
-		using InputProcessor::FindItemInList;
-
 		// Return value
 		int GetScheduleIndex;
 
@@ -2586,7 +2590,7 @@ namespace ScheduleManager {
 		}
 
 		if ( NumSchedules > 0 ) {
-			GetScheduleIndex = FindItemInList( ScheduleName, Schedule( {1,NumSchedules} ) );
+			GetScheduleIndex = ScheduleIndex.find( ScheduleName, Schedule, NumSchedules );
 			if ( GetScheduleIndex > 0 ) {
 				if ( ! Schedule( GetScheduleIndex ).Used ) {
 					Schedule( GetScheduleIndex ).Used = true;
@@ -2679,14 +2683,11 @@ namespace ScheduleManager {
 		// This function returns the internal pointer to Day Schedule "ScheduleName".
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// Looks the name up in a hash index of the schedule names.
 
 		// REFERENCES:
 		// na
 
-		// Using/Aliasing
-		using InputProcessor::FindItemInList;
-
 		// Return value
 		int GetDayScheduleIndex;
 
@@ -2711,7 +2712,7 @@ namespace ScheduleManager {
 		}
 
 		if ( NumDaySchedules > 0 ) {
-			GetDayScheduleIndex = FindItemInList( ScheduleName, DaySchedule( {1,NumDaySchedules} ) );
+			GetDayScheduleIndex = DayScheduleIndex.find( ScheduleName, DaySchedule, NumDaySchedules );
 			if ( GetDayScheduleIndex > 0 ) {
 				DaySchedule( GetDayScheduleIndex ).Used = true;
 			}
@@ -0,0 +1,456 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <ShadingCache.hh>
+#include <BinaryPayload.hh>
+#include <DataBSDFWindow.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataShadowingCombinations.hh>
+#include <DataStringGlobals.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <FileSystem.hh>
+#include <ScheduleManager.hh>
+#include <SolarShading.hh>
+#include <UtilityRoutines.hh>
+
+namespace EnergyPlus {
+
+namespace ShadingCache {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Keeps the beam solar multipliers of each shadowing period in an optional cache on disk so that
+	// repeated runs of an unchanged building (parametric studies, sizing iterations, reruns) can skip
+	// the polygon clipping in CalcPerSolarBeam.
+
+	// METHODOLOGY EMPLOYED:
+	// The cache is enabled by pointing the ShadingCacheDirectory environment variable at a directory.
+	// Each shadowing period is stored in its own file named after a 64-bit FNV-1a hash of everything
+	// that goes into the calculation: the program version, the surface geometry and the properties
+	// the shadowing routines look at, the shadowing settings, the site location, the sun position
+	// cosines for the period and the values of the shading surface transmittance schedules.  A file is
+	// only used when the key stored in its header matches and the payload checksum is intact; anything
+	// else falls back to the full calculation.  Files are written to a temporary name and renamed so
+	// that concurrent runs sharing a directory never see a partial file.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// Only the once-per-period path is cached; DetailedSolarTimestepIntegration always recomputes.
+
+	// Using/Aliasing
+	using namespace DataHeatBalance;
+	using namespace DataSurfaces;
+	using DataGlobals::NumOfTimeStepInHour;
+	using DataBSDFWindow::MaxBkSurf;
+	using DataBSDFWindow::SUNCOSTS;
+	using BinaryPayload::KeyHash;
+	using BinaryPayload::PayloadReader;
+	using BinaryPayload::PayloadWriter;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const CacheFormatVersion( 1 );
+
+	namespace {
+		char const CacheMagic[ 8 ] = { 'E', 'P', 'L', 'U', 'S', 'S', 'H', 'D' };
+		int const FlagDiffuseRatios( 1 ); // Timestep sky diffuse shading ratios are stored
+		int const FlagBackSurfaces( 2 ); // Interior solar overlaps are stored
+
+		int
+		CacheFlags()
+		{
+			int Flags( 0 );
+			if ( DataSystemVariables::DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) Flags |= FlagDiffuseRatios;
+			if ( SolarDistribution == FullInteriorExterior ) Flags |= FlagBackSurfaces;
+			return Flags;
+		}
+
+		std::uint64_t
+		PayloadHash( std::string const & Payload )
+		{
+			KeyHash Hash;
+			Hash.add( Payload.data(), Payload.size() );
+			return Hash.value();
+		}
+	}
+
+	// MODULE VARIABLE DECLARATIONS:
+	bool GeometryKeyComputed( false ); // True once GeometryKey has been formed for this run
+	std::uint64_t GeometryKey( 0 ); // Hash of the surface geometry, location and shadowing settings
+	std::uint64_t PeriodKey( 0 ); // Hash of GeometryKey plus the inputs of the current shadowing period
+	bool WriteWarningIssued( false ); // True once a failure to write the cache has been reported
+
+	// Functions
+
+	void
+	clear_state()
+	{
+		GeometryKeyComputed = false;
+		GeometryKey = 0;
+		PeriodKey = 0;
+		WriteWarningIssued = false;
+	}
+
+	bool
+	CacheEnabled()
+	{
+		return ! DataSystemVariables::ShadingCacheDirectory.empty();
+	}
+
+	std::uint64_t
+	ComputeGeometryKey()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Hashes everything that stays fixed for the run and affects the beam solar multipliers.
+
+		// METHODOLOGY EMPLOYED:
+		// Surface properties derived from the vertices (normals, azimuth, tilt) are covered by the
+		// vertices themselves and are not hashed separately.
+
+		KeyHash Hash;
+		Hash.add( CacheFormatVersion );
+		Hash.add( DataStringGlobals::VerString );
+
+		Hash.add( TotSurfaces );
+		Hash.add( NumOfTimeStepInHour );
+		Hash.add( MaxBkSurf );
+		Hash.add( SolarDistribution );
+		Hash.add( SolarShading::ShadowingCalcFrequency );
+		Hash.add( SolarShading::MaxHCS );
+		Hash.add( SolarShading::MaxHCV );
+		Hash.add( CalcSolRefl );
+		Hash.add( ShadingTransmittanceVaries );
+		Hash.add( DataSystemVariables::SutherlandHodgman );
+		Hash.add( DataSystemVariables::DetailedSkyDiffuseAlgorithm );
+
+		Hash.add( DataEnvironment::Latitude );
+		Hash.add( DataEnvironment::Longitude );
+		Hash.add( DataEnvironment::TimeZoneMeridian );
+		Hash.add( DataEnvironment::TS1TimeOffset );
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			Hash.add( surface.Name );
+			Hash.add( surface.Class );
+			Hash.add( surface.Sides );
+			for ( auto const & v : surface.Vertex ) {
+				Hash.add( v.x );
+				Hash.add( v.y );
+				Hash.add( v.z );
+			}
+			Hash.add( surface.BaseSurf );
+			Hash.add( surface.Zone );
+			Hash.add( surface.ExtBoundCond );
+			Hash.add( surface.HeatTransSurf );
+			Hash.add( surface.ShadowingSurf );
+			Hash.add( surface.ExtSolar );
+			Hash.add( surface.IsTransparent );
+			Hash.add( surface.MirroredSurf );
+			Hash.add( surface.SchedShadowSurfIndex );
+			Hash.add( surface.SchedMinValue );
+			Hash.add( surface.Area );
+			Hash.add( surface.NetAreaShadowCalc );
+			Hash.add( surface.Reveal );
+			Hash.add( surface.FrameDivider );
+			Hash.add( surface.Construction > 0 ? Construct( surface.Construction ).TransDiff : 0.0 );
+			Hash.add( SurfaceWindow.isize() >= SurfNum ? SurfaceWindow( SurfNum ).GlazedFrac : 0.0 );
+			if ( surface.FrameDivider > 0 ) {
+				auto const & frdiv( FrameDivider( surface.FrameDivider ) );
+				Hash.add( frdiv.FrameWidth );
+				Hash.add( frdiv.FrameProjectionOut );
+				Hash.add( frdiv.FrameProjectionIn );
+				Hash.add( frdiv.DividerWidth );
+				Hash.add( frdiv.DividerProjectionOut );
+				Hash.add( frdiv.DividerProjectionIn );
+				Hash.add( frdiv.HorDividers );
+				Hash.add( frdiv.VertDividers );
+			}
+			if ( DataShadowingCombinations::ShadowComb.isize() >= SurfNum ) {
+				auto const & comb( DataShadowingCombinations::ShadowComb( SurfNum ) );
+				Hash.add( comb.UseThisSurf );
+				Hash.add( comb.NumGenSurf );
+				if ( comb.NumGenSurf > 0 ) Hash.add( comb.GenSurf.data(), comb.NumGenSurf * sizeof( int ) );
+				Hash.add( comb.NumBackSurf );
+				if ( comb.NumBackSurf > 0 ) Hash.add( comb.BackSurf.data(), comb.NumBackSurf * sizeof( int ) );
+				Hash.add( comb.NumSubSurf );
+				if ( comb.NumSubSurf > 0 ) Hash.add( comb.SubSurf.data(), comb.NumSubSurf * sizeof( int ) );
+			}
+		}
+
+		return Hash.value();
+	}
+
+	std::uint64_t
+	ComputePeriodKey(
+		Real64 const AvgEqOfTime, // Average value of Equation of Time for period
+		Real64 const AvgSinSolarDeclin, // Average value of Sine of Solar Declination for period
+		Real64 const AvgCosSolarDeclin // Average value of Cosine of Solar Declination for period
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Extends the geometry key with the inputs that change from one shadowing period to the next:
+		// the sun position cosines and the shading surface transmittance schedule values.
+
+		using ScheduleManager::LookUpScheduleValue;
+
+		if ( ! GeometryKeyComputed ) {
+			GeometryKey = ComputeGeometryKey();
+			GeometryKeyComputed = true;
+		}
+
+		KeyHash Hash;
+		Hash.add( GeometryKey );
+		Hash.add( AvgEqOfTime );
+		Hash.add( AvgSinSolarDeclin );
+		Hash.add( AvgCosSolarDeclin );
+		Hash.add_array( SUNCOSTS );
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			int const SchedIndex( Surface( SurfNum ).SchedShadowSurfIndex );
+			if ( SchedIndex <= 0 ) continue;
+			for ( int iHour = 1; iHour <= 24; ++iHour ) {
+				Hash.add( LookUpScheduleValue( SchedIndex, iHour ) );
+				for ( int TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+					Hash.add( LookUpScheduleValue( SchedIndex, iHour, TS ) );
+				}
+			}
+		}
+
+		return Hash.value();
+	}
+
+	std::string
+	CacheFilePath( std::uint64_t const Key )
+	{
+		std::string Directory( DataSystemVariables::ShadingCacheDirectory );
+		if ( Directory.back() != DataStringGlobals::pathChar && Directory.back() != DataStringGlobals::altpathChar ) Directory += DataStringGlobals::pathChar;
+		std::ostringstream Name;
+		Name << "eplusshd-" << std::hex << std::setw( 16 ) << std::setfill( '0' ) << Key << ".bin";
+		return Directory + Name.str();
+	}
+
+	bool
+	LoadSolarBeam(
+		Real64 const AvgEqOfTime, // Average value of Equation of Time for period
+		Real64 const AvgSinSolarDeclin, // Average value of Sine of Solar Declination for period
+		Real64 const AvgCosSolarDeclin // Average value of Cosine of Solar Declination for period
+	)
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Fills the beam solar multipliers for the current shadowing period from the cache.
+		// Returns false, leaving the multipliers untouched, when there is no usable cache file.
+
+		// METHODOLOGY EMPLOYED:
+		// Called from CalcPerSolarBeam once the sun position cosines for the period are known.  The
+		// header and checksum are validated before anything is copied out, so a stale or damaged file
+		// can only ever cause a recalculation.
+
+		if ( ! CacheEnabled() ) return false;
+		PeriodKey = ComputePeriodKey( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin );
+
+		std::string const FilePath( CacheFilePath( PeriodKey ) );
+		if ( ! FileSystem::fileExists( FilePath ) ) return false;
+		std::ifstream CacheFile( FilePath, std::ios::binary );
+		if ( ! CacheFile ) return false;
+		std::string const Contents( ( std::istreambuf_iterator< char >( CacheFile ) ), std::istreambuf_iterator< char >() );
+
+		// Header
+		PayloadReader Header( Contents.data(), Contents.data() + Contents.size() );
+		char Magic[ sizeof( CacheMagic ) ];
+		int Version( 0 );
+		std::uint64_t Key( 0 );
+		int NumSurfaces( 0 );
+		int NumTimeSteps( 0 );
+		int NumBkSurf( 0 );
+		int Flags( 0 );
+		std::uint64_t PayloadSize( 0 );
+		std::uint64_t PayloadChecksum( 0 );
+		if ( ! Header.get( Magic ) || std::memcmp( Magic, CacheMagic, sizeof( CacheMagic ) ) != 0 ) return false;
+		if ( ! Header.get( Version ) || Version != CacheFormatVersion ) return false;
+		if ( ! Header.get( Key ) || Key != PeriodKey ) return false;
+		if ( ! Header.get( NumSurfaces ) || NumSurfaces != TotSurfaces ) return false;
+		if ( ! Header.get( NumTimeSteps ) || NumTimeSteps != NumOfTimeStepInHour ) return false;
+		if ( ! Header.get( NumBkSurf ) || NumBkSurf != MaxBkSurf ) return false;
+		if ( ! Header.get( Flags ) || Flags != CacheFlags() ) return false;
+		if ( ! Header.get( PayloadSize ) || ! Header.get( PayloadChecksum ) ) return false;
+		std::size_t const HeaderSize( sizeof( CacheMagic ) + 5 * sizeof( int ) + 3 * sizeof( std::uint64_t ) );
+		if ( Contents.size() != HeaderSize + PayloadSize ) return false;
+		std::string const Payload( Contents, HeaderSize );
+		if ( PayloadHash( Payload ) != PayloadChecksum ) return false;
+
+		// Payload
+		PayloadReader Reader( Payload.data(), Payload.data() + Payload.size() );
+		bool Ok( Reader.get_array( SunlitFracHR ) && Reader.get_array( CosIncAngHR ) && Reader.get_array( SunlitFrac ) && Reader.get_array( SunlitFracWithoutReveal ) && Reader.get_array( CosIncAng ) );
+		if ( Ok && ( Flags & FlagDiffuseRatios ) ) {
+			Ok = Reader.get_array( DifShdgRatioIsoSkyHRTS ) && Reader.get_array( DifShdgRatioHorizHRTS );
+		}
+		for ( int SurfNum = 1; Ok && SurfNum <= TotSurfaces; ++SurfNum ) {
+			Ok = Reader.get_array( SurfaceWindow( SurfNum ).OutProjSLFracMult ) && Reader.get_array( SurfaceWindow( SurfNum ).InOutProjSLFracMult );
+		}
+		if ( Ok && ( Flags & FlagBackSurfaces ) ) {
+			std::uint64_t NumOverlaps( 0 );
+			Ok = Reader.get( NumOverlaps );
+			for ( std::uint64_t i = 0; Ok && i < NumOverlaps; ++i ) {
+				std::uint64_t Index( 0 );
+				int BackSurfNum( 0 );
+				Real64 Area( 0.0 );
+				Ok = Reader.get( Index ) && Reader.get( BackSurfNum ) && Reader.get( Area ) && Index < BackSurfaces.size();
+				if ( Ok ) {
+					BackSurfaces[ Index ] = BackSurfNum;
+					OverlapAreas[ Index ] = Area;
+				}
+			}
+		}
+		if ( Ok ) Ok = Reader.at_end();
+
+		if ( ! Ok ) { // Layout changed without a version bump: undo the partial copy and recompute
+			SunlitFracHR = 0.0;
+			CosIncAngHR = 0.0;
+			SunlitFrac = 0.0;
+			SunlitFracWithoutReveal = 0.0;
+			CosIncAng = 0.0;
+			BackSurfaces = 0;
+			OverlapAreas = 0.0;
+			for ( auto & e : SurfaceWindow ) {
+				e.OutProjSLFracMult = 1.0;
+				e.InOutProjSLFracMult = 1.0;
+			}
+		}
+		return Ok;
+	}
+
+	void
+	SaveSolarBeam()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the beam solar multipliers just computed for the current shadowing period to the cache.
+
+		// METHODOLOGY EMPLOYED:
+		// Must follow a LoadSolarBeam call for the same period, which formed PeriodKey.  An existing
+		// file for the key is left alone.  A failure to write is reported once and otherwise ignored.
+
+		if ( ! CacheEnabled() ) return;
+
+		std::string const FilePath( CacheFilePath( PeriodKey ) );
+		if ( FileSystem::fileExists( FilePath ) ) return;
+
+		int const Flags( CacheFlags() );
+		PayloadWriter Writer;
+		Writer.put_array( SunlitFracHR );
+		Writer.put_array( CosIncAngHR );
+		Writer.put_array( SunlitFrac );
+		Writer.put_array( SunlitFracWithoutReveal );
+		Writer.put_array( CosIncAng );
+		if ( Flags & FlagDiffuseRatios ) {
+			Writer.put_array( DifShdgRatioIsoSkyHRTS );
+			Writer.put_array( DifShdgRatioHorizHRTS );
+		}
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			Writer.put_array( SurfaceWindow( SurfNum ).OutProjSLFracMult );
+			Writer.put_array( SurfaceWindow( SurfNum ).InOutProjSLFracMult );
+		}
+		if ( Flags & FlagBackSurfaces ) { // Mostly empty: store the nonzero entries only
+			std::uint64_t NumOverlaps( 0 );
+			for ( std::size_t i = 0, e = BackSurfaces.size(); i < e; ++i ) {
+				if ( BackSurfaces[ i ] != 0 ) ++NumOverlaps;
+			}
+			Writer.put( NumOverlaps );
+			for ( std::size_t i = 0, e = BackSurfaces.size(); i < e; ++i ) {
+				if ( BackSurfaces[ i ] == 0 ) continue;
+				Writer.put( static_cast< std::uint64_t >( i ) );
+				Writer.put( BackSurfaces[ i ] );
+				Writer.put( OverlapAreas[ i ] );
+			}
+		}
+
+		PayloadWriter Header;
+		Header.put( CacheMagic );
+		Header.put( CacheFormatVersion );
+		Header.put( PeriodKey );
+		Header.put( TotSurfaces );
+		Header.put( NumOfTimeStepInHour );
+		Header.put( MaxBkSurf );
+		Header.put( Flags );
+		Header.put( static_cast< std::uint64_t >( Writer.buffer.size() ) );
+		Header.put( PayloadHash( Writer.buffer ) );
+
+		FileSystem::makeDirectory( DataSystemVariables::ShadingCacheDirectory );
+		Header.buffer.append( Writer.buffer );
+		bool const Written( BinaryPayload::write_file( FilePath, Header.buffer ) );
+		if ( ! Written && ! WriteWarningIssued ) {
+			ShowWarningError( "Could not write the shading cache file \"" + FilePath + "\"." );
+			ShowContinueError( "Shadowing will be calculated without the cache; check the ShadingCacheDirectory environment variable." );
+			WriteWarningIssued = true;
+		}
+	}
+
+} // ShadingCache
+
+} // EnergyPlus
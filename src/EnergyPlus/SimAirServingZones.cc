@@ -72,6 +72,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DesiccantDehumidifiers.hh>
 #include <EMSManager.hh>
@@ -280,6 +281,8 @@ namespace SimAirServingZones {
 
 		// FLOW:
 
+		EP_PROFILE_ZONE( "ManageAirLoops" );
+
 		if ( GetAirLoopInputFlag ) { //First time subroutine has been entered
 			GetAirPathData(); // Get air loop descriptions from input file
 			GetAirLoopInputFlag = false;
@@ -0,0 +1,826 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <cstring>
+#include <fstream>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/string.functions.hh>
+
+// EnergyPlus Headers
+#include <SimulationCheckpoint.hh>
+#include <BinaryPayload.hh>
+#include <DataAirLoop.hh>
+#include <DataContaminantBalance.hh>
+#include <DataEnvironment.hh>
+#include <DataGlobals.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataHeatBalSurface.hh>
+#include <DataLoopNode.hh>
+#include <DataPlant.hh>
+#include <DataReportingFlags.hh>
+#include <DataRuntimeLanguage.hh>
+#include <DataStringGlobals.hh>
+#include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
+#include <FileSystem.hh>
+#include <HeatBalanceSurfaceManager.hh>
+#include <HeatBalFiniteDiffManager.hh>
+#include <IceThermalStorage.hh>
+#include <InputProcessor.hh>
+#include <ScheduleManager.hh>
+#include <UtilityRoutines.hh>
+#include <WaterThermalTanks.hh>
+
+namespace EnergyPlus {
+
+namespace SimulationCheckpoint {
+
+	// MODULE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS MODULE:
+	// Saves the dynamic state of each environment at the end of its warmup to a checkpoint file and
+	// restores it in a later run, so that reruns which only change late-stage settings (output
+	// requests, tariffs, reports) do not have to converge the warmup again.
+
+	// METHODOLOGY EMPLOYED:
+	// The SimulationCheckpointFile environment variable names the file written by a run and the
+	// SimulationRestartFile environment variable the file read back; the two should differ.  The
+	// file holds one record per environment, keyed by a 64-bit FNV-1a hash of the program version, the
+	// environment, the weather file and the processed input (less the output-only objects), with a
+	// checksummed payload of the state that carries from one day to the next: surface temperature and
+	// flux histories (CTF and CondFD), zone air temperature and humidity histories, node data, air loop
+	// flow and control state, plant loop side, branch and component state, availability manager
+	// status, water heater and ice storage states, schedule and EMS actuated values, and Erl variables
+	// and trends.  One template,
+	// TransferState, lists the state for both directions.  A record is read twice: a dry pass checks
+	// that every section and array size matches the model, and only then is the state copied in, so a
+	// stale record can only ever cause a normal warmup.
+
+	// REFERENCES:
+	// na
+
+	// OTHER NOTES:
+	// The restored environment still runs its first warmup day, which initializes everything that is
+	// not part of the checkpoint (weather, solar, sizing results, component set-up), and is then
+	// declared converged with the saved state in place.  Sizing is not skipped: sizing results are
+	// spread over too many modules to be captured this way, and sizing periods are never checkpointed.
+	// Components that keep their own history in their modules (ground heat exchangers, pipes with heat
+	// transfer, ground domains, electric and coil thermal storage, room air models, contaminants, ...)
+	// are not part of the checkpoint: models with any of them are neither checkpointed nor restored.
+
+	// Using/Aliasing
+	using BinaryPayload::KeyHash;
+	using BinaryPayload::PayloadReader;
+	using BinaryPayload::PayloadWriter;
+
+	// Data
+	// MODULE PARAMETER DEFINITIONS:
+	int const CheckpointFormatVersion( 2 );
+
+	namespace {
+		char const CheckpointMagic[ 8 ] = { 'E', 'P', 'L', 'U', 'S', 'C', 'K', 'P' };
+
+		// Objects that only request or post-process results: they are left out of the input hash so that
+		// a rerun changing them can use the checkpoint
+		char const * const OutputOnlyObjectPrefixes[] = { "Output:", "OutputControl:", "UtilityCost:", "LifeCycleCost:", "ComponentCost:", "CurrencyType" };
+
+		// Objects whose day to day state is kept in their own modules and is not in the checkpoint
+		char const * const UnsavedStateObjectPrefixes[] = { "GroundHeatExchanger:", "Pipe:Indoor", "Pipe:Outdoor", "Pipe:Underground", "PipingSystem:Underground:", "Site:GroundDomain:", "ElectricLoadCenter:Storage:", "Coil:Cooling:DX:SingleSpeed:ThermalStorage", "SolarCollector:IntegralCollectorStorage", "SolarCollector:FlatPlate:PhotovoltaicThermal", "WaterUse:Storage", "Refrigeration:Case", "RoomAirSettings:" };
+
+		bool InputScanned( false ); // True once the input has been hashed and checked
+		std::uint64_t InputHash( 0 ); // Hash of the processed input less the output-only objects
+		std::string UnsavedObject; // First object found whose state is not saved (empty if none)
+
+		bool
+		HasAnyPrefix(
+			std::string const & ObjectName,
+			char const * const * Prefixes,
+			std::size_t const NumPrefixes
+		)
+		{
+			for ( std::size_t i = 0; i < NumPrefixes; ++i ) {
+				if ( has_prefixi( ObjectName, Prefixes[ i ] ) ) return true;
+			}
+			return false;
+		}
+
+		// Hashes the processed input and the weather file and looks for objects whose state is not saved
+		void
+		ScanInput()
+		{
+			using InputProcessor::IDFRecords;
+			using InputProcessor::NumIDFRecords;
+
+			if ( InputScanned ) return;
+			std::size_t const NumOutputOnly( sizeof( OutputOnlyObjectPrefixes ) / sizeof( OutputOnlyObjectPrefixes[ 0 ] ) );
+			std::size_t const NumUnsaved( sizeof( UnsavedStateObjectPrefixes ) / sizeof( UnsavedStateObjectPrefixes[ 0 ] ) );
+			KeyHash Hash;
+			UnsavedObject.clear();
+			for ( int Loop = 1; Loop <= NumIDFRecords; ++Loop ) {
+				auto const & Record( IDFRecords( Loop ) );
+				if ( HasAnyPrefix( Record.Name, OutputOnlyObjectPrefixes, NumOutputOnly ) ) continue;
+				if ( UnsavedObject.empty() && HasAnyPrefix( Record.Name, UnsavedStateObjectPrefixes, NumUnsaved ) ) UnsavedObject = Record.Name;
+				Hash.add( Record.Name );
+				Hash.add( Record.NumAlphas );
+				for ( int Arg = 1; Arg <= Record.NumAlphas; ++Arg ) {
+					Hash.add( Record.Alphas( Arg ) );
+					Hash.add( bool( Record.AlphBlank( Arg ) ) );
+				}
+				Hash.add( Record.NumNumbers );
+				for ( int Arg = 1; Arg <= Record.NumNumbers; ++Arg ) {
+					Hash.add( Record.Numbers( Arg ) );
+					Hash.add( bool( Record.NumBlank( Arg ) ) );
+				}
+			}
+			std::string const & WeatherFilePath( DataStringGlobals::inputWeatherFileName );
+			if ( ! WeatherFilePath.empty() && FileSystem::fileExists( WeatherFilePath ) ) {
+				std::ifstream WeatherFile( WeatherFilePath, std::ios::binary );
+				std::string const Contents( ( std::istreambuf_iterator< char >( WeatherFile ) ), std::istreambuf_iterator< char >() );
+				Hash.add( Contents );
+			}
+			InputHash = Hash.value();
+			InputScanned = true;
+		}
+
+		std::uint64_t
+		PayloadHash( std::string const & Payload )
+		{
+			KeyHash Hash;
+			Hash.add( Payload.data(), Payload.size() );
+			return Hash.value();
+		}
+
+		// Finds the record for Key among the records in Contents and returns its validated payload
+		bool
+		FindRecord(
+			std::string const & Contents,
+			std::uint64_t const Key,
+			std::string & Payload
+		)
+		{
+			std::size_t const HeaderSize( sizeof( CheckpointMagic ) + sizeof( int ) + 3 * sizeof( std::uint64_t ) );
+			std::size_t Offset( 0 );
+			while ( Offset < Contents.size() ) {
+				PayloadReader Header( Contents.data() + Offset, Contents.data() + Contents.size() );
+				char Magic[ sizeof( CheckpointMagic ) ];
+				int Version( 0 );
+				std::uint64_t RecordKey( 0 );
+				std::uint64_t PayloadSize( 0 );
+				std::uint64_t PayloadChecksum( 0 );
+				if ( ! Header.get( Magic ) || std::memcmp( Magic, CheckpointMagic, sizeof( CheckpointMagic ) ) != 0 ) return false;
+				if ( ! Header.get( Version ) || Version != CheckpointFormatVersion ) return false;
+				if ( ! Header.get( RecordKey ) || ! Header.get( PayloadSize ) || ! Header.get( PayloadChecksum ) ) return false;
+				Offset += HeaderSize;
+				if ( Contents.size() - Offset < PayloadSize ) return false;
+				if ( RecordKey == Key ) {
+					Payload.assign( Contents, Offset, std::size_t( PayloadSize ) );
+					return PayloadHash( Payload ) == PayloadChecksum;
+				}
+				Offset += PayloadSize;
+			}
+			return false;
+		}
+
+		// Archive that appends the state to a payload
+		class StateWriter
+		{
+
+		public: // Methods
+
+			void
+			section( std::string const & Name )
+			{
+				Writer.put_string( Name );
+			}
+
+			template< typename T >
+			void
+			value( T & v )
+			{
+				Writer.put( v );
+			}
+
+			template< typename A >
+			void
+			array( A & a )
+			{
+				Writer.put_array( a );
+			}
+
+			bool
+			count( int const n )
+			{
+				Writer.put( n );
+				return true;
+			}
+
+		public: // Data
+
+			PayloadWriter Writer;
+
+		};
+
+		// Archive that checks a payload against the model and, when Apply is set, copies it into the state
+		class StateReader
+		{
+
+		public: // Creation
+
+			StateReader( std::string const & Payload, bool const Apply ) :
+				Reader( Payload.data(), Payload.data() + Payload.size() ),
+				Apply_( Apply )
+			{}
+
+		public: // Methods
+
+			void
+			section( std::string const & Name )
+			{
+				if ( ! Ok ) return;
+				std::string Stored;
+				Ok = Reader.get_string( Stored ) && Stored == Name;
+				Section = Name;
+			}
+
+			template< typename T >
+			void
+			value( T & v )
+			{
+				if ( ! Ok ) return;
+				T Stored;
+				Ok = Reader.get( Stored );
+				if ( Ok && Apply_ ) v = Stored;
+			}
+
+			template< typename A >
+			void
+			array( A & a )
+			{
+				if ( ! Ok ) return;
+				Ok = Apply_ ? Reader.get_array( a ) : Reader.skip_array( a );
+			}
+
+			bool
+			count( int const n )
+			{
+				if ( ! Ok ) return false;
+				int Stored( 0 );
+				Ok = Reader.get( Stored ) && Stored == n;
+				return Ok;
+			}
+
+		public: // Data
+
+			PayloadReader Reader;
+			bool Ok = true;
+			std::string Section; // Last section entered (the one that failed when ! Ok)
+
+		private: // Data
+
+			bool Apply_;
+
+		};
+
+		// Availability manager cycle times count timesteps from the start of the environment: they are stored
+		// relative to the current timestep so they still mean the same after a restore on another day
+		template< typename Archive >
+		void
+		TransferCycleTime(
+			Archive & ar,
+			int & CycleTime
+		)
+		{
+			int RelativeTime( CycleTime - DataGlobals::SimTimeSteps );
+			ar.value( RelativeTime );
+			CycleTime = RelativeTime + DataGlobals::SimTimeSteps;
+		}
+
+		// The state carried from the end of warmup into the simulated days, in the order it is stored
+		template< typename Archive >
+		void
+		TransferState( Archive & ar )
+		{
+			ar.section( "Warmup" );
+			ar.value( DataReportingFlags::NumOfWarmupDays );
+
+			ar.section( "SurfaceHistories" );
+			{
+				using namespace DataHeatBalSurface;
+				ar.array( TH );
+				ar.array( QH );
+				ar.array( THM );
+				ar.array( QHM );
+				ar.array( TsrcHist );
+				ar.array( TuserHist );
+				ar.array( QsrcHist );
+				ar.array( TsrcHistM );
+				ar.array( TuserHistM );
+				ar.array( QsrcHistM );
+				ar.array( TempSurfIn );
+				ar.array( TempSurfInTmp );
+				ar.array( TempSurfOut );
+				ar.array( TempSource );
+				ar.array( TempUserLoc );
+				ar.array( SUMH );
+				ar.array( ZoneMRT );
+				ar.array( DataHeatBalance::TempEffBulkAir );
+				ar.array( DataHeatBalance::HConvIn );
+			}
+
+			ar.section( "CondFD" );
+			if ( ar.count( HeatBalFiniteDiffManager::SurfaceFD.isize() ) ) {
+				for ( auto & e : HeatBalFiniteDiffManager::SurfaceFD ) {
+					ar.array( e.T );
+					ar.array( e.TOld );
+					ar.array( e.TT );
+					ar.array( e.Rhov );
+					ar.array( e.RhovOld );
+					ar.array( e.RhoT );
+					ar.array( e.TD );
+					ar.array( e.TDT );
+					ar.array( e.TDTLast );
+					ar.array( e.TDOld );
+					ar.array( e.RH );
+					ar.array( e.EnthOld );
+					ar.array( e.EnthNew );
+					ar.array( e.EnthLast );
+					ar.array( e.CpDelXRhoS1 );
+					ar.array( e.CpDelXRhoS2 );
+					ar.array( e.TDpriortimestep );
+				}
+			}
+
+			ar.section( "ZoneAir" );
+			{
+				using namespace DataHeatBalFanSys;
+				ar.array( MAT );
+				ar.array( ZT );
+				ar.array( ZTAV );
+				ar.array( XMAT );
+				ar.array( XM2T );
+				ar.array( XM3T );
+				ar.array( XM4T );
+				ar.array( DSXMAT );
+				ar.array( DSXM2T );
+				ar.array( DSXM3T );
+				ar.array( DSXM4T );
+				ar.array( XMPT );
+				ar.array( ZTM1 );
+				ar.array( ZTM2 );
+				ar.array( ZTM3 );
+				ar.array( ZoneTMX );
+				ar.array( ZoneTM2 );
+				ar.array( ZoneT1 );
+				ar.array( ZoneAirHumRat );
+				ar.array( ZoneAirHumRatAvg );
+				ar.array( ZoneAirHumRatOld );
+				ar.array( WZoneTimeMinus1 );
+				ar.array( WZoneTimeMinus2 );
+				ar.array( WZoneTimeMinus3 );
+				ar.array( WZoneTimeMinus4 );
+				ar.array( DSWZoneTimeMinus1 );
+				ar.array( DSWZoneTimeMinus2 );
+				ar.array( DSWZoneTimeMinus3 );
+				ar.array( DSWZoneTimeMinus4 );
+				ar.array( WZoneTimeMinusP );
+				ar.array( ZoneWMX );
+				ar.array( ZoneWM2 );
+				ar.array( ZoneW1 );
+				ar.array( SysDepZoneLoadsLagged );
+				ar.array( TempTstatAir );
+				ar.array( TempZoneThermostatSetPoint );
+				ar.array( ZoneThermostatSetPointHi );
+				ar.array( ZoneThermostatSetPointLo );
+			}
+
+			ar.section( "Nodes" );
+			if ( ar.count( DataLoopNode::Node.isize() ) ) {
+				for ( auto & e : DataLoopNode::Node ) {
+					ar.value( e.Temp );
+					ar.value( e.TempMin );
+					ar.value( e.TempMax );
+					ar.value( e.TempSetPoint );
+					ar.value( e.TempSetPointHi );
+					ar.value( e.TempSetPointLo );
+					ar.value( e.TempLastTimestep );
+					ar.value( e.MassFlowRateRequest );
+					ar.value( e.MassFlowRate );
+					ar.value( e.MassFlowRateMin );
+					ar.value( e.MassFlowRateMax );
+					ar.value( e.MassFlowRateMinAvail );
+					ar.value( e.MassFlowRateMaxAvail );
+					ar.value( e.MassFlowRateSetPoint );
+					ar.value( e.Quality );
+					ar.value( e.Press );
+					ar.value( e.Enthalpy );
+					ar.value( e.EnthalpyLastTimestep );
+					ar.value( e.HumRat );
+					ar.value( e.HumRatMin );
+					ar.value( e.HumRatMax );
+					ar.value( e.HumRatSetPoint );
+					ar.value( e.CO2 );
+					ar.value( e.CO2SetPoint );
+					ar.value( e.GenContam );
+					ar.value( e.GenContamSetPoint );
+				}
+			}
+
+			ar.section( "AirLoops" );
+			{
+				using namespace DataAirLoop;
+				if ( ar.count( AirLoopFlow.isize() ) ) {
+					for ( auto & e : AirLoopFlow ) {
+						ar.value( e.ZoneExhaust );
+						ar.value( e.ZoneExhaustBalanced );
+						ar.value( e.ReqSupplyFrac );
+						ar.value( e.MinOutAir );
+						ar.value( e.MaxOutAir );
+						ar.value( e.OAMinFrac );
+						ar.value( e.Previous );
+						ar.value( e.SupFlow );
+						ar.value( e.RetFlow );
+						ar.value( e.RetFlow0 );
+						ar.value( e.RecircFlow );
+						ar.value( e.FanPLR );
+						ar.value( e.OAFrac );
+						ar.value( e.ZoneMixingFlow );
+						ar.value( e.RetFlowAdjustment );
+					}
+				}
+				if ( ar.count( AirLoopControlInfo.isize() ) ) {
+					for ( auto & e : AirLoopControlInfo ) {
+						ar.value( e.CyclingFan );
+						ar.value( e.FanOpMode );
+						ar.value( e.UnitarySysSimulating );
+						ar.value( e.ReqstEconoLockoutWithHeating );
+						ar.value( e.ReqstEconoLockoutWithCompressor );
+						ar.value( e.EconoActive );
+						ar.value( e.HeatRecoveryBypass );
+						ar.value( e.ResimAirLoopFlag );
+						ar.value( e.HeatRecoveryResimFlag );
+						ar.value( e.HeatRecoveryResimFlag2 );
+						ar.value( e.CheckHeatRecoveryBypassStatus );
+						ar.value( e.EconomizerFlowLocked );
+						ar.value( e.HighHumCtrlActive );
+						ar.value( e.EconoLockout );
+						ar.value( e.LoopFlowRateSet );
+						ar.value( e.NightVent );
+						ar.value( e.NewFlowRateFlag );
+						ar.value( e.ConvergedFlag );
+						ar.value( e.CoolingActiveFlag );
+						ar.value( e.HeatingActiveFlag );
+					}
+				}
+				if ( ar.count( PriAirSysAvailMgr.isize() ) ) {
+					for ( auto & e : PriAirSysAvailMgr ) {
+						ar.value( e.AvailStatus );
+						TransferCycleTime( ar, e.StartTime );
+						TransferCycleTime( ar, e.StopTime );
+						ar.value( e.ReqSupplyFrac );
+					}
+				}
+				ar.value( LoopFanOperationMode );
+				ar.value( LoopSystemOnMassFlowrate );
+				ar.value( LoopSystemOffMassFlowrate );
+				ar.value( LoopOnOffFanPartLoadRatio );
+				ar.value( LoopHeatingCoilMaxRTF );
+				ar.value( LoopOnOffFanRTF );
+				ar.value( LoopDXCoilRTF );
+				ar.value( LoopCompCycRatio );
+			}
+
+			ar.section( "PlantLoops" );
+			if ( ar.count( DataPlant::PlantLoop.isize() ) ) {
+				for ( auto & e : DataPlant::PlantLoop ) {
+					if ( ! ar.count( e.LoopSide.isize() ) ) return;
+					for ( auto & s : e.LoopSide ) {
+						ar.value( s.TimeElapsed );
+						ar.value( s.FlowRequest );
+						ar.value( s.FlowRequestTemperature );
+						ar.value( s.TempSetPoint );
+						ar.value( s.TempSetPointHi );
+						ar.value( s.TempSetPointLo );
+						ar.value( s.TempInterfaceTankOutlet );
+						ar.value( s.LastTempInterfaceTankOutlet );
+						ar.value( s.TotalPumpHeat );
+						ar.value( s.FlowRestrictionFlag );
+						ar.value( s.FlowLock );
+						ar.value( s.LoopSideInlet_TankTemp );
+						ar.value( s.LoopSideInlet_MdotCpDeltaT );
+						ar.value( s.LoopSideInlet_McpDTdt );
+						ar.array( s.InletNode.MassFlowRateHistory );
+						ar.array( s.InletNode.TemperatureHistory );
+						ar.array( s.OutletNode.MassFlowRateHistory );
+						ar.array( s.OutletNode.TemperatureHistory );
+						if ( ! ar.count( s.Branch.isize() ) ) return;
+						for ( auto & b : s.Branch ) {
+							ar.value( b.RequestedMassFlow );
+							if ( ! ar.count( b.Comp.isize() ) ) return;
+							for ( auto & c : b.Comp ) {
+								ar.value( c.ON );
+								ar.value( c.Available );
+								ar.value( c.MyLoad );
+								ar.value( c.EquipDemand );
+								ar.value( c.CurOpSchemeType );
+								ar.value( c.FreeCoolCntrlShutDown );
+								ar.value( c.FreeCoolCntrlMinCntrlTemp );
+							}
+						}
+					}
+				}
+			}
+			if ( ar.count( DataPlant::PlantAvailMgr.isize() ) ) {
+				for ( auto & e : DataPlant::PlantAvailMgr ) {
+					ar.value( e.AvailStatus );
+					TransferCycleTime( ar, e.StartTime );
+					TransferCycleTime( ar, e.StopTime );
+				}
+			}
+
+			ar.section( "WaterThermalTanks" );
+			if ( ar.count( WaterThermalTanks::WaterThermalTank.isize() ) ) {
+				for ( auto & e : WaterThermalTanks::WaterThermalTank ) {
+					ar.value( e.TankTemp );
+					ar.value( e.SavedTankTemp );
+					ar.value( e.TankTempAvg );
+					if ( ! ar.count( e.Node.isize() ) ) return;
+					for ( auto & n : e.Node ) {
+						ar.value( n.Temp );
+						ar.value( n.SavedTemp );
+					}
+				}
+			}
+
+			ar.section( "IceStorage" );
+			ar.value( IceThermalStorage::XCurIceFrac );
+			if ( ar.count( IceThermalStorage::IceStorageReport.isize() ) ) {
+				for ( auto & e : IceThermalStorage::IceStorageReport ) {
+					ar.value( e.IceFracRemain );
+				}
+			}
+			if ( ar.count( IceThermalStorage::DetIceStor.isize() ) ) {
+				for ( auto & e : IceThermalStorage::DetIceStor ) {
+					ar.value( e.IceFracRemaining );
+					ar.value( e.IceFracOnCoil );
+				}
+			}
+
+			ar.section( "Schedules" );
+			if ( ar.count( ScheduleManager::Schedule.isize() ) ) {
+				for ( auto & e : ScheduleManager::Schedule ) {
+					ar.value( e.CurrentValue );
+					ar.value( e.EMSActuatedOn );
+					ar.value( e.EMSValue );
+				}
+			}
+
+			ar.section( "Erl" );
+			if ( ar.count( DataRuntimeLanguage::ErlVariable.isize() ) ) {
+				for ( auto & e : DataRuntimeLanguage::ErlVariable ) {
+					ar.value( e.Value.Type );
+					ar.value( e.Value.Number );
+					ar.value( e.Value.initialized );
+				}
+			}
+			if ( ar.count( DataRuntimeLanguage::TrendVariable.isize() ) ) {
+				for ( auto & e : DataRuntimeLanguage::TrendVariable ) {
+					ar.array( e.TrendValARR );
+				}
+			}
+
+			ar.section( "End" );
+		}
+	}
+
+	// MODULE VARIABLE DECLARATIONS:
+	std::string CheckpointRecords; // Records written by this run: the file is rewritten whole for each new one
+	bool WarningIssued( false ); // True once a failure to write the checkpoint file has been reported
+
+	// Functions
+
+	void
+	clear_state()
+	{
+		CheckpointRecords.clear();
+		WarningIssued = false;
+		InputScanned = false;
+		InputHash = 0;
+		UnsavedObject.clear();
+	}
+
+	bool
+	CheckpointRequested()
+	{
+		return ! DataSystemVariables::SimulationCheckpointFile.empty() && ! DataGlobals::DoingSizing && ! DataGlobals::DoingHVACSizingSimulations;
+	}
+
+	bool
+	RestartRequested()
+	{
+		return ! DataSystemVariables::SimulationRestartFile.empty() && ! DataGlobals::DoingSizing && ! DataGlobals::DoingHVACSizingSimulations;
+	}
+
+	std::string
+	UnsavedStateObject()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the type of the first object in the model whose state is not saved in the checkpoint,
+		// or an empty string when the checkpoint covers the whole model.
+
+		ScanInput();
+		if ( ! UnsavedObject.empty() ) return UnsavedObject;
+		if ( DataContaminantBalance::Contaminant.CO2Simulation || DataContaminantBalance::Contaminant.GenericContamSimulation ) return "ZoneAirContaminantBalance";
+		return std::string();
+	}
+
+	std::uint64_t
+	ComputeEnvironmentKey()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Identifies the current environment of the current model for the checkpoint records.
+
+		// METHODOLOGY EMPLOYED:
+		// Hashes what has to agree for a saved state to mean the same thing: the version, the
+		// environment, the weather file and every input object except the output-only ones, so any
+		// edit to the model gives a new key.  The payload is also checked section by section.
+
+		ScanInput();
+		KeyHash Hash;
+		Hash.add( DataStringGlobals::VerString );
+		Hash.add( CheckpointFormatVersion );
+		Hash.add( DataEnvironment::CurEnvirNum );
+		Hash.add( DataEnvironment::EnvironmentName );
+		Hash.add( DataGlobals::KindOfSim );
+		Hash.add( DataGlobals::NumOfTimeStepInHour );
+		Hash.add( DataGlobals::NumOfZones );
+		Hash.add( DataSurfaces::TotSurfaces );
+		Hash.add( DataLoopNode::NumOfNodes );
+		Hash.add( InputHash );
+		return Hash.value();
+	}
+
+	std::string
+	PackState()
+	{
+		StateWriter Writer;
+		TransferState( Writer );
+		return std::move( Writer.Writer.buffer );
+	}
+
+	bool
+	UnpackState( std::string const & Payload )
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Copies a payload made by PackState into the state.  Returns false, leaving the state
+		// untouched, when the payload does not fit the model.
+
+		{ // Dry pass
+			StateReader Reader( Payload, false );
+			TransferState( Reader );
+			if ( ! Reader.Ok || ! Reader.Reader.at_end() ) {
+				ShowWarningError( "The simulation checkpoint for environment \"" + DataEnvironment::EnvironmentName + "\" does not match the model (section \"" + Reader.Section + "\")." );
+				ShowContinueError( "The warmup will be simulated." );
+				return false;
+			}
+		}
+		StateReader Reader( Payload, true );
+		TransferState( Reader );
+		return true;
+	}
+
+	void
+	SaveCheckpoint()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Appends the state of the current environment at the end of its warmup to the checkpoint file.
+
+		// METHODOLOGY EMPLOYED:
+		// The records written by this run are kept and the file is replaced by all of them, so it
+		// starts with the first record of the run and a reader never sees a partial record.  A
+		// failure to write is reported once and otherwise ignored.
+
+		if ( ! CheckpointRequested() ) return;
+
+		std::string const Unsaved( UnsavedStateObject() );
+		if ( ! Unsaved.empty() ) {
+			if ( ! WarningIssued ) {
+				ShowWarningError( "No simulation checkpoint is written: the state of " + Unsaved + " objects is not saved in checkpoints." );
+				WarningIssued = true;
+			}
+			return;
+		}
+
+		HeatBalanceSurfaceManager::UnpackCTFHistories();
+		std::string const Payload( PackState() );
+
+		PayloadWriter Header;
+		Header.put( CheckpointMagic );
+		Header.put( CheckpointFormatVersion );
+		Header.put( ComputeEnvironmentKey() );
+		Header.put( static_cast< std::uint64_t >( Payload.size() ) );
+		Header.put( PayloadHash( Payload ) );
+
+		std::string const & FilePath( DataSystemVariables::SimulationCheckpointFile );
+		CheckpointRecords.append( Header.buffer ).append( Payload );
+		bool const Written( BinaryPayload::write_file( FilePath, CheckpointRecords ) );
+		if ( ! Written && ! WarningIssued ) {
+			ShowWarningError( "Could not write the simulation checkpoint file \"" + FilePath + "\"." );
+			ShowContinueError( "The simulation continues without a checkpoint; check the SimulationCheckpointFile environment variable." );
+			WarningIssued = true;
+		}
+	}
+
+	bool
+	RestoreCheckpoint()
+	{
+
+		// PURPOSE OF THIS FUNCTION:
+		// Replaces the state of the current environment with the one saved at the end of its warmup
+		// by an earlier run.  Returns false, leaving the state untouched, when there is no usable record.
+
+		// METHODOLOGY EMPLOYED:
+		// Called at the end of the first warmup day.  The records are scanned for the environment key
+		// and the checksum of the matching one is validated before its payload is unpacked.
+
+		if ( ! RestartRequested() ) return false;
+
+		std::string const & FilePath( DataSystemVariables::SimulationRestartFile );
+		std::string const Unsaved( UnsavedStateObject() );
+		if ( ! Unsaved.empty() ) {
+			ShowWarningError( "The simulation checkpoint for environment \"" + DataEnvironment::EnvironmentName + "\" cannot be restored: the state of " + Unsaved + " objects is not saved in checkpoints." );
+			ShowContinueError( "The warmup will be simulated." );
+			return false;
+		}
+		std::string Contents;
+		if ( FileSystem::fileExists( FilePath ) ) {
+			std::ifstream RestartFile( FilePath, std::ios::binary );
+			Contents.assign( ( std::istreambuf_iterator< char >( RestartFile ) ), std::istreambuf_iterator< char >() );
+		}
+
+		std::string Payload;
+		if ( ! FindRecord( Contents, ComputeEnvironmentKey(), Payload ) ) {
+			ShowWarningError( "No usable simulation checkpoint for environment \"" + DataEnvironment::EnvironmentName + "\" was found in \"" + FilePath + "\"." );
+			ShowContinueError( "The warmup will be simulated." );
+			return false;
+		}
+		HeatBalanceSurfaceManager::UnpackCTFHistories();
+		return UnpackState( Payload );
+	}
+
+} // SimulationCheckpoint
+
+} // EnergyPlus
@@ -66,6 +66,7 @@ extern "C" {
 #include <SimulationManager.hh>
 #include <BranchInputManager.hh>
 #include <BranchNodeConnections.hh>
+#include <ColumnarOutput.hh>
 #include <CostEstimateManager.hh>
 #include <CurveManager.hh>
 #include <DataAirLoop.hh>
@@ -124,6 +125,7 @@ extern "C" {
 #include <PlantPipingSystemsManager.hh>
 #include <Psychrometrics.hh>
 #include <RefrigeratedCase.hh>
+#include <RunPeriodSegments.hh>
 #include <SetPointManager.hh>
 #include <SizingManager.hh>
 #include <SolarShading.hh>
@@ -315,6 +317,8 @@ namespace SimulationManager {
 		// Formats
 		static gio::Fmt Format_700( "('Environment:WarmupDays,',I3)" );
 
+		EP_PROFILE_ZONE( "ManageSimulation" );
+
 		//CreateSQLiteDatabase();
 		sqlite = EnergyPlus::CreateSQLiteDatabase();
 
@@ -339,6 +343,12 @@ namespace SimulationManager {
 
 		OpenOutputFiles();
 		GetProjectData();
+		if ( WriteColumnarOutput ) { // Requested on the command line or in Output:Diagnostics
+			if ( ! ColumnarOutput::OpenColumnarFile( DataStringGlobals::outputColFileName, ColumnarOutputCompression ) ) {
+				ShowWarningError( "ManageSimulation: Could not open file " + DataStringGlobals::outputColFileName + " for output (write), the columnar time series are not written." );
+			}
+		}
+		if ( RunPeriodSegments::SegmentNum > 1 ) DoDesDaySim = false; // The design days are reported by the first segment
 		CheckForMisMatchedEnvironmentSpecifications();
 		CheckForRequestedReporting();
 		SetPredefinedTables();
@@ -472,6 +482,8 @@ namespace SimulationManager {
 			if (KindOfSim == ksHVACSizeRunPeriodDesign) continue; // don't run these here, only for sizing simulations
 
 			++EnvCount;
+			RunPeriodSegments::BeginEnvironment();
+			ProfileZone const EnvironmentZone( ProfilingEnabled ? ProfileZoneID( "Environment: " + EnvironmentName ) : -1 ); // Profile tree of this environment
 
 			if ( sqlite ) {
 				sqlite->sqliteBegin();
@@ -526,6 +538,7 @@ namespace SimulationManager {
 					DisplayString( "Continuing Simulation at " + CurMnDy + " for " + EnvironmentName );
 					DisplayPerfSimulationFlag = false;
 				}
+				RunPeriodSegments::ManageOverlapDays();
 				// for simulations that last longer than a week, identify when the last year of the simulation is started
 				if ( ( DayOfSim > 365 ) && ( (NumOfDayInEnvrn - DayOfSim) == 364 ) && !WarmupFlag ){
 					DisplayString( "Starting last  year of environment at:  " + DayOfSimChr );
@@ -960,6 +973,8 @@ namespace SimulationManager {
 					ReportDetailedWarmupConvergence = true;
 				} else if ( SameString( Alphas( NumA ), "ReportDuringHVACSizingSimulation" ) ) {
 					ReportDuringHVACSizingSimulation = true;
+				} else if ( SameString( Alphas( NumA ), "WriteColumnarTimeSeries" ) ) {
+					WriteColumnarOutput = true;
 				} else if ( SameString( Alphas( NumA ), "CreateMinimalSurfaceVariables" ) ) {
 					continue;
 					//        CreateMinimalSurfaceVariables=.TRUE.
@@ -1341,6 +1356,9 @@ namespace SimulationManager {
 		mtr_stream = gio::out_stream( OutputFileMeters );
 		gio::write( OutputFileMeters, fmtA ) << "Program Version," + VerString;
 
+		// Report lines for the eso and mtr files are formatted and written on a background thread
+		if ( AsyncOutputWriter ) OutputProcessor::StartOutputWriter();
+
 		// Open the Branch-Node Details Output File
 		OutputFileBNDetails = GetNewUnitNumber();
 		{ IOFlags flags; flags.ACTION( "write" ); flags.STATUS( "UNKNOWN" ); gio::open( OutputFileBNDetails, DataStringGlobals::outputBndFileName, flags ); write_stat = flags.ios(); }
@@ -1425,6 +1443,9 @@ namespace SimulationManager {
 		std::string cepEnvSetThreads;
 		std::string cIDFSetThreads;
 
+		OutputProcessor::StopOutputWriter(); // Write the queued report lines before the end of data
+		ColumnarOutput::CloseColumnarFile();
+
 		EchoInputFile = FindUnitNumber( DataStringGlobals::outputAuditFileName );
 		// Record some items on the audit file
 		gio::write( EchoInputFile, fmtLD ) << "NumOfRVariable=" << NumOfRVariable_Setup;
@@ -63,6 +63,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataStringGlobals.hh>
+#include <DataTimings.hh>
 #include <DataZoneEquipment.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
@@ -221,6 +222,8 @@ namespace SizingManager {
 
 		// FLOW:
 
+		EP_PROFILE_ZONE( "ManageSizing" );
+
 		OutputFileZoneSizing = 0;
 		OutputFileSysSizing = 0;
 		TimeStepInDay = 0;
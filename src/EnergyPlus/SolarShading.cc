@@ -45,8 +45,13 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -59,6 +64,7 @@
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <SolarShading.hh>
+#include <BoundingVolumeHierarchy.hh>
 #include <DataDaylighting.hh>
 #include <DataDaylightingDevices.hh>
 #include <DataEnvironment.hh>
@@ -84,8 +90,11 @@
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <PolygonClipping.hh>
 #include <ScheduleManager.hh>
+#include <ShadingCache.hh>
 #include <SolarReflectionManager.hh>
+#include <ThreadPool.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WindowComplexManager.hh>
@@ -173,29 +182,29 @@ namespace SolarShading {
 	// (needs to be based on maxnumvertices)
 	int MaxHCS( 15000 ); // 200      ! Maximum number of HC surfaces (was 56)
 	// Following are initially set in AllocateModuleArrays
-	int MAXHCArrayBounds( 0 ); // Bounds based on Max Number of Vertices in surfaces
+	thread_local int MAXHCArrayBounds( 0 ); // Bounds based on Max Number of Vertices in surfaces
 	int MAXHCArrayIncrement( 0 ); // Increment based on Max Number of Vertices in surfaces
 	// The following variable should be re-engineered to lower in module hierarchy but need more analysis
-	int NVS; // Number of vertices of the shadow/clipped surface
-	int NumVertInShadowOrClippedSurface;
-	int CurrentSurfaceBeingShadowed;
-	int CurrentShadowingSurface;
-	int OverlapStatus; // Results of overlap calculation:
+	thread_local int NVS; // Number of vertices of the shadow/clipped surface
+	thread_local int NumVertInShadowOrClippedSurface;
+	thread_local int CurrentSurfaceBeingShadowed;
+	thread_local int CurrentShadowingSurface;
+	thread_local int OverlapStatus; // Results of overlap calculation:
 	// 1=No overlap; 2=NS1 completely within NS2
 	// 3=NS2 completely within NS1; 4=Partial overlap
 
-	Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
-	int FBKSHC; // HC location of first back surface
-	int FGSSHC; // HC location of first general shadowing surface
-	int FINSHC; // HC location of first back surface overlap
-	int FRVLHC; // HC location of first reveal surface
-	int FSBSHC; // HC location of first subsurface
-	int LOCHCA( 0 ); // Location of highest data in the HC arrays
-	int NBKSHC; // Number of back surfaces in the HC arrays
-	int NGSSHC; // Number of general shadowing surfaces in the HC arrays
-	int NINSHC; // Number of back surface overlaps in the HC arrays
-	int NRVLHC; // Number of reveal surfaces in HC array
-	int NSBSHC; // Number of subsurfaces in the HC arrays
+	thread_local Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
+	thread_local int FBKSHC; // HC location of first back surface
+	thread_local int FGSSHC; // HC location of first general shadowing surface
+	thread_local int FINSHC; // HC location of first back surface overlap
+	thread_local int FRVLHC; // HC location of first reveal surface
+	thread_local int FSBSHC; // HC location of first subsurface
+	thread_local int LOCHCA( 0 ); // Location of highest data in the HC arrays
+	thread_local int NBKSHC; // Number of back surfaces in the HC arrays
+	thread_local int NGSSHC; // Number of general shadowing surfaces in the HC arrays
+	thread_local int NINSHC; // Number of back surface overlaps in the HC arrays
+	thread_local int NRVLHC; // Number of reveal surfaces in HC array
+	thread_local int NSBSHC; // Number of subsurfaces in the HC arrays
 	bool CalcSkyDifShading; // True when sky diffuse solar shading is
 	int ShadowingCalcFrequency( 0 ); // Frequency for Shadowing Calculations
 	int ShadowingDaysLeft( 0 ); // Days left in current shadowing period
@@ -209,46 +218,60 @@ namespace SolarShading {
 		bool MustAllocSolarShading( true );
 		bool GetInputFlag( true );
 		bool firstTime( true );
+		// Guards the shared error tracking and statistics updated while sun positions are computed in parallel
+		std::mutex ShadowingMutex;
+		thread_local int ThreadMaxNumberOfFigures( 0 ); // Largest NRFIGS seen by this thread, avoids locking in MULTOL
+		std::unique_ptr< ThreadPool > shadingPool; // Threads for the parallel sun positions (started on first use)
+		std::size_t ShadingBatch( 0 ); // Number of FigureSolarBeamForAllHours calls
+		thread_local std::size_t ThreadShadingBatch( 0 ); // Call for which this thread last allocated its clipping state
+		// Sky patch sums for one sun position, copied to the DataHeatBalance debug arrays by FigureSolarBeamAtTimestep
+		thread_local Array1D< Real64 > SkyWithShdgIsoSky; // Diffuse solar irradiance from isotropic sky on surface, with shading
+		thread_local Array1D< Real64 > SkyWoShdgIsoSky; // Diffuse solar from isotropic sky on surface, without shading
+		thread_local Array1D< Real64 > SkyWithShdgHoriz; // Diffuse solar irradiance from horizon portion of sky on surface, with shading
+		thread_local Array1D< Real64 > SkyWoShdgHoriz; // Diffuse solar irradiance from horizon portion of sky on surface, without shading
+		int LastSkySunPosition( 0 ); // Latest sun position, in serial order, whose sky sums are in the debug arrays
+		Real64 const CastingPlaneTolerance( 0.0003 ); // Tolerance of the vertex above plane tests in CHKGSS
 	}
 
 	std::ofstream shd_stream; // Shading file stream
-	Array1D_int HCNS; // Surface number of back surface HC figures
-	Array1D_int HCNV; // Number of vertices of each HC figure
-	Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
-	Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
-	Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
-	Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
-	Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
+	thread_local Array1D_int HCNS; // Surface number of back surface HC figures
+	thread_local Array1D_int HCNV; // Number of vertices of each HC figure
+	thread_local Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
+	thread_local Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
+	thread_local Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
+	thread_local Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
+	thread_local Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
 	Array3D_int WindowRevealStatus;
-	Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
+	thread_local Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
 	// - Positive, Shadow - Negative, Overlap between two shadows
 	// - positive, etc., so that sum of HC areas=base sunlit area
-	Array1D< Real64 > HCT; // Transmittance of each HC figure
+	thread_local Array1D< Real64 > HCT; // Transmittance of each HC figure
 	Array1D< Real64 > ISABSF; // For simple interior solar distribution (in which all beam
 	// radiation entering zone is assumed to strike the floor),
 	// fraction of beam radiation absorbed by each floor surface
-	Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
+	thread_local Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
 	// Excludes multiplier for windows
 	// Shadowing combinations data structure...See ShadowingCombinations type
 	int NumTooManyFigures( 0 );
 	int NumTooManyVertices( 0 );
 	int NumBaseSubSurround( 0 );
-	Array1D< Real64 > SUNCOS( 3 ); // Direction cosines of solar position
-	Real64 XShadowProjection; // X projection of a shadow (formerly called C)
-	Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
-	Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
-	Array1D< Real64 > XVC; // X-vertices of the clipped figure
-	Array1D< Real64 > XVS; // X-vertices of the shadow
-	Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
-	Array1D< Real64 > YVC; // Y-vertices of the clipped figure
-	Array1D< Real64 > YVS; // Y-vertices of the shadow
-	Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
+	thread_local Array1D< Real64 > SUNCOS( 3 ); // Direction cosines of solar position
+	thread_local Real64 XShadowProjection; // X projection of a shadow (formerly called C)
+	thread_local Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
+	thread_local Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
+	thread_local Array1D< Real64 > XVC; // X-vertices of the clipped figure
+	thread_local Array1D< Real64 > XVS; // X-vertices of the shadow
+	thread_local Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
+	thread_local Array1D< Real64 > YVC; // Y-vertices of the clipped figure
+	thread_local Array1D< Real64 > YVS; // Y-vertices of the shadow
+	thread_local Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
 	// Used in Sutherland Hodman poly clipping
-	Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
-	Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
-	Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
-	Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-	Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	thread_local Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
+	thread_local Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
+	thread_local Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
+	thread_local Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
+	thread_local Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	thread_local Array1D< Real64 > HTEMP; // Clipping edge line values at the XTEMP1/YTEMP1 vertices
 	int maxNumberOfFigures( 0 );
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
@@ -323,7 +346,15 @@ namespace SolarShading {
 		CTEMP.deallocate();
 		XTEMP1.deallocate();
 		YTEMP1.deallocate();
+		HTEMP.deallocate();
 		maxNumberOfFigures = 0;
+		ThreadMaxNumberOfFigures = 0;
+		shadingPool.reset();
+		SkyWithShdgIsoSky.deallocate();
+		SkyWoShdgIsoSky.deallocate();
+		SkyWithShdgHoriz.deallocate();
+		SkyWoShdgHoriz.deallocate();
+		LastSkySunPosition = 0;
 		TrackTooManyFigures.deallocate();
 		TrackTooManyVertices.deallocate();
 		TrackBaseSubSurround.deallocate();
@@ -367,6 +398,8 @@ namespace SolarShading {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		// FLOW:
+		EP_PROFILE_ZONE( "InitSolarCalculations" );
+
 #ifdef EP_Count_Calls
 		++NumInitSolar_Calls;
 #endif
@@ -734,8 +767,8 @@ namespace SolarShading {
 
 		// FLOW:
 
-		CTHETA.dimension( TotSurfaces, 0.0 );
-		SAREA.dimension( TotSurfaces, 0.0 );
+		MAXHCArrayIncrement = MaxVerticesPerSurface + 1;
+		AllocateShadowingScratch();
 		SurfSunlitArea.dimension( TotSurfaces, 0.0 );
 		SurfSunlitFrac.dimension( TotSurfaces, 0.0 );
 		SunlitFracHR.dimension( 24, TotSurfaces, 0.0 );
@@ -842,24 +875,6 @@ namespace SolarShading {
 		SWInAbsTotalReport.dimension( TotSurfaces, 0.0 );
 		WindowRevealStatus.dimension( NumOfTimeStepInHour, 24, TotSurfaces, 0 );
 
-		// Weiler-Atherton
-		MAXHCArrayBounds = 2 * ( MaxVerticesPerSurface + 1 );
-		MAXHCArrayIncrement = MaxVerticesPerSurface + 1;
-		XTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		YTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		XVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
-		XVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
-		YVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
-		YVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
-		ZVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
-
-		// Sutherland-Hodgman
-		ATEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		BTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		CTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		XTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-		YTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
-
 		//energy
 		WinTransSolarEnergy.dimension( TotSurfaces, 0.0 );
 		WinBmSolarEnergy.dimension( TotSurfaces, 0.0 );
@@ -1237,6 +1252,56 @@ namespace SolarShading {
 
 	}
 
+	void
+	AllocateShadowingScratch()
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Allocates the thread_local arrays that hold the polygon clipping state for one sun
+		// position (homogeneous coordinate figures, clipping temporaries, CTHETA, SAREA and the
+		// sky patch sums).
+
+		// METHODOLOGY EMPLOYED:
+		// Called from AllocateModuleArrays for the main thread and by each shading pool worker in
+		// FigureSolarBeamForAllHours before it computes its first sun position of the call.
+
+		CTHETA.dimension( TotSurfaces, 0.0 );
+		SAREA.dimension( TotSurfaces, 0.0 );
+		SkyWithShdgIsoSky.dimension( TotSurfaces, 0.0 );
+		SkyWoShdgIsoSky.dimension( TotSurfaces, 0.0 );
+		SkyWithShdgHoriz.dimension( TotSurfaces, 0.0 );
+		SkyWoShdgHoriz.dimension( TotSurfaces, 0.0 );
+
+		HCA.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCB.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCC.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCX.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCY.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+		HCAREA.dimension( 2 * MaxHCS, 0.0 );
+		HCNS.dimension( 2 * MaxHCS, 0 );
+		HCNV.dimension( 2 * MaxHCS, 0 );
+		HCT.dimension( 2 * MaxHCS, 0.0 );
+
+		// Weiler-Atherton
+		MAXHCArrayBounds = 2 * ( MaxVerticesPerSurface + 1 );
+		XTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		YTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		XVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		XVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		YVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		YVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
+		ZVC.dimension( MaxVerticesPerSurface + 1, 0.0 );
+
+		// Sutherland-Hodgman
+		ATEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		BTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		CTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		XTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		YTEMP1.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+		HTEMP.dimension( 2 * ( MaxVerticesPerSurface + 1 ), 0.0 );
+
+	}
+
 	void
 	AnisoSkyViewFactors()
 	{
@@ -1517,7 +1582,7 @@ namespace SolarShading {
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static Real64 TolValue( 0.0003 );
+		Real64 const TolValue( CastingPlaneTolerance );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -2409,6 +2474,7 @@ namespace SolarShading {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		if ( NS > 2 * MaxHCS ) {
+			std::lock_guard< std::mutex > lock( ShadowingMutex );
 			ShowFatalError( "Solar Shading: HTrans: Too many Figures (>" + TrimSigDigits( MaxHCS ) + ')' );
 		}
 
@@ -2615,25 +2681,30 @@ namespace SolarShading {
 		int M; // Side number of figure N2
 		int N; // Vertex number of figure N1
 		bool CycleMainLoop; // Sets when to cycle main loop
-		Real64 HFunct;
+		static thread_local std::vector< Int64 > HFunct; // Side M values at the vertices of figure N1
+		static thread_local std::vector< char > Left; // Vertices of figure N1 left of any side of figure N2
 
 		NIN = 0;
 
+		// Eliminate cases where vertex N is to the left of side M: sides in the outer loop so the
+		// vertex loop is a contiguous kernel over the figure N1 row of the HC arrays.
+
+		HFunct.resize( N1NumVert );
+		Left.assign( N1NumVert, 0 );
+		Int64 const * const HCX_N1( &HCX( N1, 1 ) );
+		Int64 const * const HCY_N1( &HCY( N1, 1 ) );
+		for ( M = 1; M <= N2NumVert; ++M ) {
+			PolygonClipping::side_values( HCX_N1, HCY_N1, N1NumVert, HCA( N2, M ), HCB( N2, M ), HCC( N2, M ), HFunct.data() );
+			for ( N = 0; N < N1NumVert; ++N ) {
+				if ( HFunct[ N ] > 0 ) Left[ N ] = 1;
+			}
+		}
+
 		for ( N = 1; N <= N1NumVert; ++N ) {
 
 			CycleMainLoop = false;
 
-			// Eliminate cases where vertex N is to the left of side M.
-
-			for ( M = 1; M <= N2NumVert; ++M ) {
-				HFunct = HCX( N1, N ) * HCA( N2, M ) + HCY( N1, N ) * HCB( N2, M ) + HCC( N2, M );
-				if ( HFunct > 0.0 ) {
-					CycleMainLoop = true; // Set to cycle to the next value of N
-					break; // M DO loop
-				}
-			}
-
-			if ( CycleMainLoop ) continue;
+			if ( Left[ N - 1 ] ) continue;
 			++NIN;
 
 			// Check for duplication of previously determined points.
@@ -2713,19 +2784,32 @@ namespace SolarShading {
 		int KK;
 		int M; // Side number of figure NS2
 		int N; // Side number of figure NS1
+		static thread_local std::vector< Int64 > H1; // Side N values at the vertices of figure NS2
+		static thread_local std::vector< Int64 > H2; // Side M values at the vertices of figure NS1, by side M
+
+		// Side values at the vertices, including the closing vertex NV + 1 set by HTRANS.  Each vertex
+		// value is shared by the two sides it ends, so it is only computed once.
+
+		int const NH2( NV1 + 1 );
+		H1.resize( NV2 + 1 );
+		H2.resize( NV2 * NH2 );
+		for ( M = 1; M <= NV2; ++M ) {
+			PolygonClipping::side_values( &HCX( NS1, 1 ), &HCY( NS1, 1 ), NH2, HCA( NS2, M ), HCB( NS2, M ), HCC( NS2, M ), &H2[ ( M - 1 ) * NH2 ] );
+		}
 
 		for ( N = 1; N <= NV1; ++N ) {
+			PolygonClipping::side_values( &HCX( NS2, 1 ), &HCY( NS2, 1 ), NV2 + 1, HCA( NS1, N ), HCB( NS1, N ), HCC( NS1, N ), H1.data() );
 			for ( M = 1; M <= NV2; ++M ) {
 
 				// Eliminate cases where sides N and M do not intersect.
 
-				I1 = HCA( NS1, N ) * HCX( NS2, M ) + HCB( NS1, N ) * HCY( NS2, M ) + HCC( NS1, N );
-				I2 = HCA( NS1, N ) * HCX( NS2, M + 1 ) + HCB( NS1, N ) * HCY( NS2, M + 1 ) + HCC( NS1, N );
+				I1 = H1[ M - 1 ];
+				I2 = H1[ M ];
 				if ( I1 >= 0 && I2 >= 0 ) continue;
 				if ( I1 <= 0 && I2 <= 0 ) continue;
 
-				I1 = HCA( NS2, M ) * HCX( NS1, N ) + HCB( NS2, M ) * HCY( NS1, N ) + HCC( NS2, M );
-				I2 = HCA( NS2, M ) * HCX( NS1, N + 1 ) + HCB( NS2, M ) * HCY( NS1, N + 1 ) + HCC( NS2, M );
+				I1 = H2[ ( M - 1 ) * NH2 + N - 1 ];
+				I2 = H2[ ( M - 1 ) * NH2 + N ];
 				if ( I1 >= 0 && I2 >= 0 ) continue;
 				if ( I1 <= 0 && I2 <= 0 ) continue;
 
@@ -2852,15 +2936,14 @@ namespace SolarShading {
 			Real64 const HCA_E( HCA[ l ] );
 			Real64 const HCB_E( HCB[ l ] );
 			Real64 const HCC_E( HCC[ l ] );
-			Real64 XTEMP1_S( XTEMP1( S ) );
-			Real64 YTEMP1_S( YTEMP1( S ) );
+			PolygonClipping::edge_values( &XTEMP1( 1 ), &YTEMP1( 1 ), NVOUT, HCA_E, HCB_E, HCC_E, &HTEMP( 1 ) ); // Side of the clipping edge for every vertex
 			for ( int P = 1; P <= NVOUT; ++P ) {
 				Real64 const XTEMP1_P( XTEMP1( P ) );
 				Real64 const YTEMP1_P( YTEMP1( P ) );
-				HFunct = XTEMP1_P * HCA_E + YTEMP1_P * HCB_E + HCC_E;
+				HFunct = HTEMP( P );
 				// S is constant within this block
 				if ( HFunct <= 0.0 ) { // Vertex is not in the clipping plane
-					HFunct = XTEMP1_S * HCA_E + YTEMP1_S * HCB_E + HCC_E;
+					HFunct = HTEMP( S );
 					if ( HFunct > 0.0 ) { // Test vertex is in the clipping plane
 
 						// Find/store the intersection of the clip edge and the line connecting S and P
@@ -2903,6 +2986,7 @@ namespace SolarShading {
 						YTEMP.redimension( NewArrayBounds, 0.0 );
 						XTEMP1.redimension( NewArrayBounds, 0.0 );
 						YTEMP1.redimension( NewArrayBounds, 0.0 );
+						HTEMP.redimension( NewArrayBounds, 0.0 );
 						ATEMP.redimension( NewArrayBounds, 0.0 );
 						BTEMP.redimension( NewArrayBounds, 0.0 );
 						CTEMP.redimension( NewArrayBounds, 0.0 );
@@ -2926,7 +3010,7 @@ namespace SolarShading {
 					}
 
 				} else {
-					HFunct = XTEMP1_S * HCA_E + YTEMP1_S * HCB_E + HCC_E;
+					HFunct = HTEMP( S );
 					if ( HFunct <= 0.0 ) { // Test vertex is not in the clipping plane
 						if ( NVTEMP < 2 * ( MaxVerticesPerSurface + 1 )){  // avoid assigning to element outside of XTEMP array size
 							KK = NVTEMP;
@@ -2962,8 +3046,6 @@ namespace SolarShading {
 					}
 				}
 				S = P;
-				XTEMP1_S = XTEMP1_P;
-				YTEMP1_S = YTEMP1_P;
 			} // end loop over points of subject polygon
 
 			NVOUT = NVTEMP;
@@ -2972,22 +3054,7 @@ namespace SolarShading {
 
 			if ( E != NV2 ) {
 				if ( NVOUT > 2 ) { // Compute HC values for edges of output polygon
-					Real64 const X_1( XTEMP( 1 ) );
-					Real64 const Y_1( YTEMP( 1 ) );
-					Real64 X_P( X_1 ), X_P1;
-					Real64 Y_P( Y_1 ), Y_P1;
-					for ( int P = 1; P < NVOUT; ++P ) {
-						X_P1 = XTEMP( P + 1 );
-						Y_P1 = YTEMP( P + 1 );
-						ATEMP( P ) = Y_P - Y_P1;
-						BTEMP( P ) = X_P1 - X_P;
-						CTEMP( P ) = X_P * Y_P1 - Y_P * X_P1;
-						X_P = X_P1;
-						Y_P = Y_P1;
-					}
-					ATEMP( NVOUT ) = Y_P1 - Y_1;
-					BTEMP( NVOUT ) = X_1 - X_P1;
-					CTEMP( NVOUT ) = X_P1 * Y_1 - Y_P1 * X_1;
+					PolygonClipping::edge_lines( &XTEMP( 1 ), &YTEMP( 1 ), NVOUT, &ATEMP( 1 ), &BTEMP( 1 ), &CTEMP( 1 ) );
 				}
 			}
 
@@ -3050,7 +3117,11 @@ namespace SolarShading {
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
 
-		maxNumberOfFigures = max( maxNumberOfFigures, NRFIGS );
+		if ( NRFIGS > ThreadMaxNumberOfFigures ) {
+			ThreadMaxNumberOfFigures = NRFIGS;
+			std::lock_guard< std::mutex > lock( ShadowingMutex );
+			maxNumberOfFigures = max( maxNumberOfFigures, NRFIGS );
+		}
 
 		NS2 = NNN;
 		for ( I = 1; I <= NRFIGS; ++I ) {
@@ -3113,7 +3184,7 @@ namespace SolarShading {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Array1D< Real64 > SLOPE; // Slopes from left-most vertex to others
+		static thread_local Array1D< Real64 > SLOPE; // Slopes from left-most vertex to others
 		Real64 DELTAX; // Difference between X coordinates of two vertices
 		Real64 DELTAY; // Difference between Y coordinates of two vertices
 		Real64 SAVES; // Temporary location for exchange of variables
@@ -3127,7 +3198,7 @@ namespace SolarShading {
 		int M; // Number of slopes to be sorted
 		int N; // Vertex number
 		int P; // Location of first slope to be sorted
-		static bool FirstTimeFlag( true );
+		static thread_local bool FirstTimeFlag( true );
 
 		if ( FirstTimeFlag ) {
 			SLOPE.allocate( max( 10, MaxVerticesPerSurface + 1 ) );
@@ -3286,6 +3357,7 @@ namespace SolarShading {
 
 			OverlapStatus = TooManyFigures;
 
+			std::lock_guard< std::mutex > lock( ShadowingMutex );
 			if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
 				ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
 				TooManyFiguresMessage = true;
@@ -3374,6 +3446,7 @@ namespace SolarShading {
 
 			OverlapStatus = TooManyVertices;
 
+			std::lock_guard< std::mutex > lock( ShadowingMutex );
 			if ( ! TooManyVerticesMessage && ! DisplayExtraWarnings ) {
 				ShowWarningError( "DeterminePolygonOverlap: Too many vertices [>" + RoundSigDigits( MaxHCV ) + "] detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
 				TooManyVerticesMessage = true;
@@ -3389,6 +3462,7 @@ namespace SolarShading {
 
 			OverlapStatus = TooManyFigures;
 
+			std::lock_guard< std::mutex > lock( ShadowingMutex );
 			if ( ! TooManyFiguresMessage && ! DisplayExtraWarnings ) {
 				ShowWarningError( "DeterminePolygonOverlap: Too many figures [>" + RoundSigDigits( MaxHCS ) + "]  detected in an overlap calculation. Use Output:Diagnostics,DisplayExtraWarnings; for more details." );
 				TooManyFiguresMessage = true;
@@ -3433,6 +3507,7 @@ namespace SolarShading {
 		using WindowComplexManager::UpdateComplexWindows;
 		using DataSystemVariables::DetailedSkyDiffuseAlgorithm;
 		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataSystemVariables::NumberShadingThreads;
 		using DataGlobals::HourOfDay;
 		using DataGlobals::TimeStep;
 
@@ -3452,6 +3527,8 @@ namespace SolarShading {
 		int TS; // TimeStep Loop Counter
 		static bool Once( true );
 
+		EP_PROFILE_ZONE( "CalcPerSolarBeam" );
+
 		if ( Once ) InitComplexWindows();
 		Once = false;
 
@@ -3503,18 +3580,59 @@ namespace SolarShading {
 		}
 		// Initialize/update the Complex Fenestration geometry and optical properties
 		UpdateComplexWindows();
+		LastSkySunPosition = 0;
 		if ( ! DetailedSolarTimestepIntegration ) {
-			for ( iHour = 1; iHour <= 24; ++iHour ) { // Do for all hours.
-				for ( TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
-					FigureSolarBeamAtTimestep( iHour, TS );
-				} // TimeStep Loop
-			} // Hour Loop
+			if ( ShadingCache::LoadSolarBeam( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin ) ) return;
+			if ( NumberShadingThreads > 1 ) {
+				FigureSolarBeamForAllHours( min( NumberShadingThreads, 24 ) );
+			} else {
+				for ( iHour = 1; iHour <= 24; ++iHour ) { // Do for all hours.
+					for ( TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+						FigureSolarBeamAtTimestep( iHour, TS );
+					} // TimeStep Loop
+				} // Hour Loop
+			}
+			ShadingCache::SaveSolarBeam();
 		} else {
 			FigureSolarBeamAtTimestep( HourOfDay, TimeStep );
 		}
 
 	}
 
+	void
+	FigureSolarBeamForAllHours( int const NumThreads )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Computes the beam solar multipliers for every hour and timestep of the shadowing period,
+		// spreading the sun positions over NumThreads threads (the calling thread included).
+
+		// METHODOLOGY EMPLOYED:
+		// The hours are the tasks of a batch on the shading thread pool, which hands them out one at a
+		// time.  All timesteps of an hour are done in order on the same thread, so the hourly results
+		// (SunlitFracHR, CosIncAngHR and the frame/divider multipliers) are written exactly as in the
+		// serial loop and the results do not depend on the number of threads.  The polygon clipping
+		// state is thread_local; a pool worker allocates its own copy the first time it picks up an
+		// hour in each call.  The first fatal error raised on any thread is rethrown on the calling
+		// thread once the whole batch has stopped.
+
+		if ( ! shadingPool || shadingPool->size() != std::size_t( NumThreads ) ) shadingPool.reset( new ThreadPool( NumThreads ) );
+
+		++ShadingBatch;
+		std::thread::id const CallingThread( std::this_thread::get_id() );
+		shadingPool->run( 24, [ CallingThread ]( ThreadPool::size_type const iTask ){
+			if ( ( ThreadShadingBatch != ShadingBatch ) && ( std::this_thread::get_id() != CallingThread ) ) {
+				AllocateShadowingScratch();
+				ThreadShadingBatch = ShadingBatch;
+			}
+			int const iHour( int( iTask ) + 1 );
+			for ( int TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+				FigureSolarBeamAtTimestep( iHour, TS );
+			}
+		} );
+
+	}
+
 	void
 	FigureSunCosines(
 		int const iHour,
@@ -3673,10 +3791,11 @@ namespace SolarShading {
 
 		//   Note -- if not the below, values are set in SkyDifSolarShading routine (constant for simulation)
 		if ( DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing ) {
-			WithShdgIsoSky = 0.;
-			WoShdgIsoSky = 0.;
-			WithShdgHoriz = 0.;
-			WoShdgHoriz = 0.;
+			// Per-thread sums rather than the DataHeatBalance arrays so that sun positions can be done concurrently
+			SkyWithShdgIsoSky = 0.0;
+			SkyWoShdgIsoSky = 0.0;
+			SkyWithShdgHoriz = 0.0;
+			SkyWoShdgHoriz = 0.0;
 
 			DPhi = PiOvr2 / NPhi; // 15 deg for NPhi = 6
 			DTheta = 2.0 * Pi / NTheta; // 15 deg for NTheta = 24
@@ -3714,13 +3833,13 @@ namespace SolarShading {
 							FracIlluminated = SAREA( SurfNum ) / ( SurfArea + Eps );
 						}
 						Fac1WithShdg = Fac1WoShdg * FracIlluminated;
-						WithShdgIsoSky( SurfNum ) += Fac1WithShdg;
-						WoShdgIsoSky( SurfNum ) += Fac1WoShdg;
+						SkyWithShdgIsoSky( SurfNum ) += Fac1WithShdg;
+						SkyWoShdgIsoSky( SurfNum ) += Fac1WoShdg;
 
 						// Horizon region
 						if ( IPhi == 1 ) {
-							WithShdgHoriz( SurfNum ) += Fac1WithShdg;
-							WoShdgHoriz( SurfNum ) += Fac1WoShdg;
+							SkyWithShdgHoriz( SurfNum ) += Fac1WithShdg;
+							SkyWoShdgHoriz( SurfNum ) += Fac1WoShdg;
 						}
 					} // End of surface loop
 				} // End of Theta loop
@@ -3730,15 +3849,27 @@ namespace SolarShading {
 
 				if ( ! Surface( SurfNum ).ShadowingSurf && ( ! Surface( SurfNum ).HeatTransSurf || ! Surface( SurfNum ).ExtSolar || ( Surface( SurfNum ).ExtBoundCond != ExternalEnvironment && Surface( SurfNum ).ExtBoundCond != OtherSideCondModeledExt ) ) ) continue;
 
-				if ( std::abs( WoShdgIsoSky( SurfNum ) ) > Eps ) {
-					DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) );
+				if ( std::abs( SkyWoShdgIsoSky( SurfNum ) ) > Eps ) {
+					DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, SurfNum ) = ( SkyWithShdgIsoSky( SurfNum ) ) / ( SkyWoShdgIsoSky( SurfNum ) );
 				} else {
-					DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgIsoSky( SurfNum ) ) / ( WoShdgIsoSky( SurfNum ) + Eps );
+					DifShdgRatioIsoSkyHRTS( iTimeStep, iHour, SurfNum ) = ( SkyWithShdgIsoSky( SurfNum ) ) / ( SkyWoShdgIsoSky( SurfNum ) + Eps );
 				}
-				if ( std::abs( WoShdgHoriz( SurfNum ) ) > Eps ) {
-					DifShdgRatioHorizHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) );
+				if ( std::abs( SkyWoShdgHoriz( SurfNum ) ) > Eps ) {
+					DifShdgRatioHorizHRTS( iTimeStep, iHour, SurfNum ) = ( SkyWithShdgHoriz( SurfNum ) ) / ( SkyWoShdgHoriz( SurfNum ) );
 				} else {
-					DifShdgRatioHorizHRTS( iTimeStep, iHour, SurfNum ) = ( WithShdgHoriz( SurfNum ) ) / ( WoShdgHoriz( SurfNum ) + Eps );
+					DifShdgRatioHorizHRTS( iTimeStep, iHour, SurfNum ) = ( SkyWithShdgHoriz( SurfNum ) ) / ( SkyWoShdgHoriz( SurfNum ) + Eps );
+				}
+			}
+
+			{ // Leave the debug report arrays as the serial loop does: from the latest sun position computed
+				int const SunPosition( ( iHour - 1 ) * NumOfTimeStepInHour + iTimeStep );
+				std::lock_guard< std::mutex > lock( ShadowingMutex );
+				if ( SunPosition >= LastSkySunPosition ) {
+					LastSkySunPosition = SunPosition;
+					WithShdgIsoSky = SkyWithShdgIsoSky;
+					WoShdgIsoSky = SkyWoShdgIsoSky;
+					WithShdgHoriz = SkyWithShdgHoriz;
+					WoShdgHoriz = SkyWoShdgHoriz;
 				}
 			}
 
@@ -3796,6 +3927,7 @@ namespace SolarShading {
 		// Using/Aliasing
 		using namespace DataErrorTracking;
 		using General::TrimSigDigits;
+		using DataSystemVariables::CheckShadowingCombinations;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -3811,25 +3943,23 @@ namespace SolarShading {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Array1D_int GSS; // List of shadowing surfaces numbers for a receiving surface
-		Array1D_int BKS; // List of back surface numbers for a receiving surface
-		Array1D_int SBS; // List of subsurfaces for a receiving surface
-		static int MaxGSS( 50 ); // Current Max for GSS array
-		static int MaxBKS( 50 ); // Current Max for BKS array
-		static int MaxSBS( 50 ); // Current Max for SBS array
-		bool CannotShade; // TRUE if subsurface cannot shade receiving surface
+		std::vector< int > GSS; // List of shadowing surfaces numbers for a receiving surface
+		std::vector< int > BKS; // List of back surface numbers for a receiving surface
+		std::vector< int > SBS; // List of subsurfaces for a receiving surface
+		std::vector< int > CheckGSS; // Exhaustive search list of shadowing surfaces when verifying
 		bool HasWindow; // TRUE if a window is present on receiving surface
 		Real64 ZMIN; // Lowest point on the receiving surface
-		int BackSurfaceNumber; // Back surface number
 		int HTS; // Heat transfer surface number for a receiving surface
 		int GRSNR; // Receiving surface number
-		int GSSNR; // Shadowing surface number
-		int SBSNR; // Subsurface number
 		int NBKS; // Number of back surfaces for a receiving surface
 		int NGSS; // Number of shadowing surfaces for a receiving surface
 		int NSBS; // Number of subsurfaces for a receiving surface
+		int NumCheckMismatches( 0 ); // Receiving surfaces whose casting surface lists differ when verifying
 		bool ShadowingSurf; // True if a receiving surface is a shadowing surface
 		Array1D_bool CastingSurface; // tracking during setup of ShadowComb
+		Array1D< std::vector< int > > SurfsOnBase; // Surfaces (other than itself) on each base surface
+		Array1D< std::vector< int > > ZoneSurfs; // Surfaces of each zone
+		BoundingVolumeHierarchy CastingTree; // Possible general casting surfaces
 
 		static int MaxDim( 0 );
 
@@ -3841,20 +3971,6 @@ namespace SolarShading {
 
 		CastingSurface.dimension( TotSurfaces, false );
 
-		HCA.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
-		HCB.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
-		HCC.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
-		HCX.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
-		HCY.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
-		HCAREA.dimension( 2 * MaxHCS, 0.0 );
-		HCNS.dimension( 2 * MaxHCS, 0 );
-		HCNV.dimension( 2 * MaxHCS, 0 );
-		HCT.dimension( 2 * MaxHCS, 0.0 );
-
-		GSS.dimension( MaxGSS, 0 );
-		BKS.dimension( MaxGSS, 0 );
-		SBS.dimension( MaxGSS, 0 );
-
 		HTS = 0;
 
 		// Check every surface as a possible shadow receiving surface ("RS" = receiving surface).
@@ -3862,6 +3978,17 @@ namespace SolarShading {
 			return;
 		}
 
+		// Index the surfaces by base surface and by zone so each receiving surface only visits its own
+		SurfsOnBase.allocate( TotSurfaces );
+		ZoneSurfs.allocate( NumOfZones );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			int const BaseSurf( Surface( SurfNum ).BaseSurf );
+			if ( ( BaseSurf >= 1 ) && ( BaseSurf != SurfNum ) ) SurfsOnBase( BaseSurf ).push_back( SurfNum );
+			int const ZoneNum( Surface( SurfNum ).Zone );
+			if ( ( ZoneNum >= 1 ) && ( ZoneNum <= NumOfZones ) ) ZoneSurfs( ZoneNum ).push_back( SurfNum );
+		}
+		if ( SolarDistribution != MinimalShadowing ) BuildCastingSurfaceTree( CastingTree );
+
 		for ( GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) { // Loop through all surfaces (looking for potential receiving surfaces)...
 
 			ShadowingSurf = Surface( GRSNR ).ShadowingSurf;
@@ -3879,93 +4006,57 @@ namespace SolarShading {
 			ZMIN = minval( Surface( GRSNR ).Vertex, &Vector::z );
 
 			// Check every surface as a possible shadow casting surface ("SS" = shadow sending)
-			NGSS = 0;
+			GSS.clear();
 			if ( SolarDistribution != MinimalShadowing ) { // Except when doing simplified exterior shadowing.
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces, looking for ones that could shade GRSNR
-
-					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
-					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // A heat transfer subsurface of a receiving surface
-					// cannot shade the receiving surface
-					if ( ShadowingSurf ) {
-						// If receiving surf is a shadowing surface exclude matching shadow surface as sending surface
-						//IF((GSSNR == GRSNR+1 .AND. Surface(GSSNR)%Name(1:3) == 'Mir').OR. &
-						//   (GSSNR == GRSNR-1 .AND. Surface(GRSNR)%Name(1:3) == 'Mir')) CYCLE
-						if ( ( ( GSSNR == GRSNR + 1 ) && Surface( GSSNR ).MirroredSurf ) || ( ( GSSNR == GRSNR - 1 ) && Surface( GRSNR ).MirroredSurf ) ) continue;
-					}
-
-					if ( Surface( GSSNR ).BaseSurf == GRSNR ) { // Shadowing subsurface of receiving surface
-
-						++NGSS;
-						if ( NGSS > MaxGSS ) {
-							GSS.redimension( MaxGSS *= 2, 0 );
-						}
-						GSS( NGSS ) = GSSNR;
-
-					} else if ( ( Surface( GSSNR ).BaseSurf == 0 ) || ( ( Surface( GSSNR ).BaseSurf == GSSNR ) && ( ( Surface( GSSNR ).ExtBoundCond == ExternalEnvironment ) || Surface( GSSNR ).ExtBoundCond == OtherSideCondModeledExt ) ) ) { // Detached shadowing surface or | any other base surface exposed to outside environment
-
-						CHKGSS( GRSNR, GSSNR, ZMIN, CannotShade ); // Check to see if this can shade the receiving surface
-						if ( ! CannotShade ) { // Update the shadowing surface data if shading is possible
-							++NGSS;
-							if ( NGSS > MaxGSS ) {
-								GSS.redimension( MaxGSS *= 2, 0 );
-							}
-							GSS( NGSS ) = GSSNR;
-						}
-
+				FindCastingSurfaces( GRSNR, ZMIN, SurfsOnBase( GRSNR ), CastingTree, GSS );
+				if ( CheckShadowingCombinations ) {
+					FindCastingSurfacesExhaustive( GRSNR, ZMIN, CheckGSS );
+					if ( GSS != CheckGSS ) {
+						++NumCheckMismatches;
+						ShowSevereError( "DetermineShadowingCombinations: Casting surfaces of receiving Surface=\"" + Surface( GRSNR ).Name + "\" differ from the exhaustive search." );
+						ShowContinueError( "...Found " + TrimSigDigits( int( GSS.size() ) ) + " casting surfaces, exhaustive search found " + TrimSigDigits( int( CheckGSS.size() ) ) + ". The exhaustive search list is used." );
+						GSS.swap( CheckGSS );
 					}
+				}
 
-				} // ...end of surfaces DO loop (GSSNR)
 			} else { // Simplified Distribution -- still check for Shading Subsurfaces
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces (looking for surfaces which could shade GRSNR) ...
-
-					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
-					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // Skip heat transfer subsurfaces of receiving surface
-					if ( Surface( GSSNR ).BaseSurf == GRSNR ) { // Shadowing subsurface of receiving surface
-						++NGSS;
-						if ( NGSS > MaxGSS ) {
-							GSS.redimension( MaxGSS *= 2, 0 );
-						}
-						GSS( NGSS ) = GSSNR;
-					}
+				for ( int const GSSNR : SurfsOnBase( GRSNR ) ) { // Surfaces on the receiving surface (looking for surfaces which could shade GRSNR) ...
+					if ( Surface( GSSNR ).HeatTransSurf ) continue; // Skip heat transfer subsurfaces of receiving surface
+					GSS.push_back( GSSNR ); // Shadowing subsurface of receiving surface
 				}
 
 			} // ...end of check for simplified solar distribution
+			NGSS = GSS.size();
 
 			// Check every surface as a receiving subsurface of the receiving surface
-			NSBS = 0;
+			SBS.clear();
 			HasWindow = false;
 			//legacy: IF (OSENV(HTS) > 10) WINDOW=.TRUE. -->Note: WINDOW was set true for roof ponds, solar walls, or other zones
-			for ( SBSNR = 1; SBSNR <= TotSurfaces; ++SBSNR ) { // Loop through the surfaces yet again (looking for subsurfaces of GRSNR)...
+			for ( int const SBSNR : SurfsOnBase( GRSNR ) ) { // Loop through the surfaces on GRSNR (looking for subsurfaces of GRSNR)...
 
 				if ( ! Surface( SBSNR ).HeatTransSurf ) continue; // Skip non heat transfer subsurfaces
-				if ( SBSNR == GRSNR ) continue; // Surface itself cannot be its own subsurface
-				if ( Surface( SBSNR ).BaseSurf != GRSNR ) continue; // Ignore subsurfaces of other surfaces and other surfaces
 
 				if ( Construct( Surface( SBSNR ).Construction ).TransDiff > 0.0 ) HasWindow = true; // Check for window
 				CHKSBS( HTS, GRSNR, SBSNR ); // Check that the receiving surface completely encloses the subsurface;
 				// severe error if not
-				++NSBS;
-				if ( NSBS > MaxSBS ) {
-					SBS.redimension( MaxSBS *= 2, 0 );
-				}
-				SBS( NSBS ) = SBSNR;
+				SBS.push_back( SBSNR );
 
 			} // ...end of surfaces DO loop (SBSNR)
+			NSBS = SBS.size();
 
 			// Check every surface as a back surface
-			NBKS = 0;
+			BKS.clear();
 			//                                        Except for simplified
 			//                                        interior solar distribution,
-			if ( ( SolarDistribution == FullInteriorExterior ) && ( HasWindow ) ) { // For full interior solar distribution | and a window present on base surface (GRSNR)
+			if ( ( SolarDistribution == FullInteriorExterior ) && ( HasWindow ) && ( Surface( GRSNR ).Zone >= 1 ) ) { // For full interior solar distribution | and a window present on base surface (GRSNR)
 
-				for ( BackSurfaceNumber = 1; BackSurfaceNumber <= TotSurfaces; ++BackSurfaceNumber ) { // Loop through surfaces yet again, looking for back surfaces to GRSNR
+				for ( int const BackSurfaceNumber : ZoneSurfs( Surface( GRSNR ).Zone ) ) { // Loop through the surfaces of the zone, looking for back surfaces to GRSNR
 
 					if ( ! Surface( BackSurfaceNumber ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
 					if ( Surface( BackSurfaceNumber ).BaseSurf == GRSNR ) continue; // Skip subsurfaces of this GRSNR
 					if ( BackSurfaceNumber == GRSNR ) continue; // A back surface cannot be GRSNR itself
-					if ( Surface( BackSurfaceNumber ).Zone != Surface( GRSNR ).Zone ) continue; // Skip if back surface not in zone
 
 					if ( Surface( BackSurfaceNumber ).Class == SurfaceClass_IntMass ) continue;
 
@@ -3974,15 +4065,12 @@ namespace SolarShading {
 					//IF (Surface(BackSurfaceNumber)%BaseSurf /= BackSurfaceNumber) CYCLE ! Not for subsurfaces of Back Surface
 
 					CHKBKS( BackSurfaceNumber, GRSNR ); // CHECK FOR CONVEX ZONE; severe error if not
-					++NBKS;
-					if ( NBKS > MaxBKS ) {
-						BKS.redimension( MaxBKS *= 2, 0 );
-					}
-					BKS( NBKS ) = BackSurfaceNumber;
+					BKS.push_back( BackSurfaceNumber );
 
 				} // ...end of surfaces DO loop (BackSurfaceNumber)
 
 			}
+			NBKS = BKS.size();
 
 			// Put this into the ShadowComb data structure
 			ShadowComb( GRSNR ).UseThisSurf = true;
@@ -3993,27 +4081,29 @@ namespace SolarShading {
 
 			ShadowComb( GRSNR ).GenSurf.allocate( {0,ShadowComb( GRSNR ).NumGenSurf} );
 			ShadowComb( GRSNR ).GenSurf( 0 ) = 0;
-			if ( ShadowComb( GRSNR ).NumGenSurf > 0 ) {
-				ShadowComb( GRSNR ).GenSurf( {1,ShadowComb( GRSNR ).NumGenSurf} ) = GSS( {1,NGSS} );
+			for ( int I = 1; I <= NGSS; ++I ) {
+				ShadowComb( GRSNR ).GenSurf( I ) = GSS[ I - 1 ];
 			}
 
 			ShadowComb( GRSNR ).BackSurf.allocate( {0,ShadowComb( GRSNR ).NumBackSurf} );
 			ShadowComb( GRSNR ).BackSurf( 0 ) = 0;
-			if ( ShadowComb( GRSNR ).NumBackSurf > 0 ) {
-				ShadowComb( GRSNR ).BackSurf( {1,ShadowComb( GRSNR ).NumBackSurf} ) = BKS( {1,NBKS} );
+			for ( int I = 1; I <= NBKS; ++I ) {
+				ShadowComb( GRSNR ).BackSurf( I ) = BKS[ I - 1 ];
 			}
 
 			ShadowComb( GRSNR ).SubSurf.allocate( {0,ShadowComb( GRSNR ).NumSubSurf} );
 			ShadowComb( GRSNR ).SubSurf( 0 ) = 0;
-			if ( ShadowComb( GRSNR ).NumSubSurf > 0 ) {
-				ShadowComb( GRSNR ).SubSurf( {1,ShadowComb( GRSNR ).NumSubSurf} ) = SBS( {1,NSBS} );
+			for ( int I = 1; I <= NSBS; ++I ) {
+				ShadowComb( GRSNR ).SubSurf( I ) = SBS[ I - 1 ];
 			}
 
 		} // ...end of surfaces (GRSNR) DO loop
 
-		GSS.deallocate();
-		SBS.deallocate();
-		BKS.deallocate();
+		if ( NumCheckMismatches > 0 ) {
+			ShowSevereMessage( "DetermineShadowingCombinations: The casting surfaces of " + TrimSigDigits( NumCheckMismatches ) + " receiving surfaces differed from the exhaustive search." );
+		} else if ( CheckShadowingCombinations ) {
+			DisplayString( "Shadowing combinations agree with the exhaustive search" );
+		}
 
 		shd_stream << "Shadowing Combinations\n";
 		if ( SolarDistribution == MinimalShadowing ) {
@@ -4099,6 +4189,157 @@ namespace SolarShading {
 
 	}
 
+	void
+	BuildCastingSurfaceTree( BoundingVolumeHierarchy & CastingTree )
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Builds the bounding volume hierarchy over the surfaces that DetermineShadowingCombinations
+		// may list as general casting surfaces of another surface (not its own subsurfaces).
+
+		// METHODOLOGY EMPLOYED:
+		// The candidates are detached shading surfaces and base surfaces exposed to the outside, as in
+		// FindCastingSurfacesExhaustive.  Upward facing horizontal surfaces never pass CHKGSS so they are
+		// left out of the tree.
+
+		std::vector< BoundingVolumeHierarchy::Box > Boxes;
+		std::vector< int > Surfs;
+		for ( int GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) {
+			auto const & surface( Surface( GSSNR ) );
+			if ( ! ( ( surface.BaseSurf == 0 ) || ( ( surface.BaseSurf == GSSNR ) && ( ( surface.ExtBoundCond == ExternalEnvironment ) || ( surface.ExtBoundCond == OtherSideCondModeledExt ) ) ) ) ) continue;
+			if ( surface.OutNormVec( 3 ) > 0.9999 ) continue; // Horizontal and facing upward: cannot shade (CHKGSS)
+			BoundingVolumeHierarchy::Box Box;
+			for ( int I = 1; I <= surface.Sides; ++I ) {
+				Box.include( surface.Vertex( I ) );
+			}
+			Boxes.push_back( Box );
+			Surfs.push_back( GSSNR );
+		}
+		CastingTree.build( Boxes, Surfs );
+
+	}
+
+	void
+	FindCastingSurfaces(
+		int const GRSNR, // Receiving surface number
+		Real64 const ZMIN, // Lowest point of the receiving surface
+		std::vector< int > const & SurfsOnBase, // Surfaces whose base surface is GRSNR
+		BoundingVolumeHierarchy const & CastingTree, // Tree built by BuildCastingSurfaceTree
+		std::vector< int > & GSS // Casting surfaces of GRSNR in increasing surface number order
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the general casting surfaces of a receiving surface.  The list is the same as the
+		// one found by FindCastingSurfacesExhaustive, without testing every surface in the model.
+
+		// METHODOLOGY EMPLOYED:
+		// Shading subsurfaces of the receiving surface come from its base surface list.  Other casting
+		// surfaces come from a query of the casting surface tree that skips every box which lies
+		// entirely below the receiving surface (no point of it can be sunlit from above the lowest
+		// point of the receiving surface) or entirely behind the plane of the receiving surface.
+		// These are the first two tests of CHKGSS applied to the box corners; the bound on the
+		// plane distance over a box is at least that of any vertex inside it, and half the CHKGSS
+		// tolerance is kept as a margin for round-off, so no surface CHKGSS would accept is skipped.
+		// CHKGSS is then applied to each surface the query returns.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using namespace Vectors;
+
+		GSS.clear();
+
+		bool const ShadowingSurf( Surface( GRSNR ).ShadowingSurf );
+		auto const & surface_R( Surface( GRSNR ) );
+
+		// Mirrored shadowing surfaces do not shade their own copy
+		auto const IsMirrorOfReceiving = [ & ]( int const GSSNR ) -> bool {
+			return ShadowingSurf && ( ( ( GSSNR == GRSNR + 1 ) && Surface( GSSNR ).MirroredSurf ) || ( ( GSSNR == GRSNR - 1 ) && surface_R.MirroredSurf ) );
+		};
+
+		for ( int const GSSNR : SurfsOnBase ) { // Shadowing subsurfaces of the receiving surface
+			if ( Surface( GSSNR ).HeatTransSurf ) continue; // A heat transfer subsurface of a receiving surface cannot shade it
+			if ( IsMirrorOfReceiving( GSSNR ) ) continue;
+			GSS.push_back( GSSNR );
+		}
+
+		// Plane of the receiving surface as used by CHKGSS
+		auto const & vertex_R( surface_R.Vertex );
+		Vector const vertex_R_2( vertex_R( 2 ) );
+		Vector const CVec( cross( vertex_R( 3 ) - vertex_R_2, vertex_R( 1 ) - vertex_R_2 ) );
+		Real64 const PlaneTol( 0.5 * CastingPlaneTolerance );
+
+		auto const MayShade = [ & ]( BoundingVolumeHierarchy::Box const & Box ) -> bool {
+			if ( Box.u.z <= ZMIN ) return false; // Entirely below the receiving surface
+			Real64 const DX( ( CVec.x > 0.0 ? Box.u.x : Box.l.x ) - vertex_R_2.x );
+			Real64 const DY( ( CVec.y > 0.0 ? Box.u.y : Box.l.y ) - vertex_R_2.y );
+			Real64 const DZ( ( CVec.z > 0.0 ? Box.u.z : Box.l.z ) - vertex_R_2.z );
+			return CVec.x * DX + CVec.y * DY + CVec.z * DZ > PlaneTol; // Not entirely behind the receiving surface
+		};
+
+		bool CannotShade;
+		CastingTree.query( MayShade, [ & ]( int const GSSNR ) {
+			if ( GSSNR == GRSNR ) return; // Receiving surface cannot shade itself
+			if ( IsMirrorOfReceiving( GSSNR ) ) return;
+			CHKGSS( GRSNR, GSSNR, ZMIN, CannotShade ); // Check to see if this can shade the receiving surface
+			if ( ! CannotShade ) GSS.push_back( GSSNR );
+		} );
+
+		std::sort( GSS.begin(), GSS.end() );
+
+	}
+
+	void
+	FindCastingSurfacesExhaustive(
+		int const GRSNR, // Receiving surface number
+		Real64 const ZMIN, // Lowest point of the receiving surface
+		std::vector< int > & GSS // Casting surfaces of GRSNR in increasing surface number order
+	)
+	{
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Finds the general casting surfaces of a receiving surface by checking every surface in the
+		// model.  This is the original search of DetermineShadowingCombinations, kept to verify
+		// FindCastingSurfaces (CheckShadowingCombinations environment variable).
+
+		// REFERENCES:
+		// BLAST/IBLAST code, original author George Walton
+
+		bool CannotShade; // TRUE if subsurface cannot shade receiving surface
+		bool const ShadowingSurf( Surface( GRSNR ).ShadowingSurf );
+
+		GSS.clear();
+		for ( int GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces, looking for ones that could shade GRSNR
+
+			if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
+			if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // A heat transfer subsurface of a receiving surface
+			// cannot shade the receiving surface
+			if ( ShadowingSurf ) {
+				// If receiving surf is a shadowing surface exclude matching shadow surface as sending surface
+				//IF((GSSNR == GRSNR+1 .AND. Surface(GSSNR)%Name(1:3) == 'Mir').OR. &
+				//   (GSSNR == GRSNR-1 .AND. Surface(GRSNR)%Name(1:3) == 'Mir')) CYCLE
+				if ( ( ( GSSNR == GRSNR + 1 ) && Surface( GSSNR ).MirroredSurf ) || ( ( GSSNR == GRSNR - 1 ) && Surface( GRSNR ).MirroredSurf ) ) continue;
+			}
+
+			if ( Surface( GSSNR ).BaseSurf == GRSNR ) { // Shadowing subsurface of receiving surface
+
+				GSS.push_back( GSSNR );
+
+			} else if ( ( Surface( GSSNR ).BaseSurf == 0 ) || ( ( Surface( GSSNR ).BaseSurf == GSSNR ) && ( ( Surface( GSSNR ).ExtBoundCond == ExternalEnvironment ) || Surface( GSSNR ).ExtBoundCond == OtherSideCondModeledExt ) ) ) { // Detached shadowing surface or | any other base surface exposed to outside environment
+
+				CHKGSS( GRSNR, GSSNR, ZMIN, CannotShade ); // Check to see if this can shade the receiving surface
+				if ( ! CannotShade ) { // Update the shadowing surface data if shading is possible
+					GSS.push_back( GSSNR );
+				}
+
+			}
+
+		} // ...end of surfaces DO loop (GSSNR)
+
+	}
+
 	void
 	SHADOW(
 		int const iHour, // Hour index
@@ -4145,10 +4386,10 @@ namespace SolarShading {
 		int NGRS; // Coordinate transformation index
 		int NZ; // Zone Number of surface
 		int NVT;
-		static Array1D< Real64 > XVT; // X Vertices of Shadows
-		static Array1D< Real64 > YVT; // Y vertices of Shadows
-		static Array1D< Real64 > ZVT; // Z vertices of Shadows
-		static bool OneTimeFlag( true );
+		static thread_local Array1D< Real64 > XVT; // X Vertices of Shadows
+		static thread_local Array1D< Real64 > YVT; // Y vertices of Shadows
+		static thread_local Array1D< Real64 > ZVT; // Z vertices of Shadows
+		static thread_local bool OneTimeFlag( true );
 		int HTS; // Heat transfer surface number of the general receiving surface
 		int GRSNR; // Surface number of general receiving surface
 		int NBKS; // Number of back surfaces
@@ -4306,10 +4547,10 @@ namespace SolarShading {
 		int N;
 		int NVR;
 		int NVT; // Number of vertices of back surface
-		static Array1D< Real64 > XVT; // X,Y,Z coordinates of vertices of
-		static Array1D< Real64 > YVT; // back surfaces projected into system
-		static Array1D< Real64 > ZVT; // relative to receiving surface
-		static bool OneTimeFlag( true );
+		static thread_local Array1D< Real64 > XVT; // X,Y,Z coordinates of vertices of
+		static thread_local Array1D< Real64 > YVT; // back surfaces projected into system
+		static thread_local Array1D< Real64 > ZVT; // relative to receiving surface
+		static thread_local bool OneTimeFlag( true );
 		int BackSurfaceNumber;
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
@@ -4449,10 +4690,10 @@ namespace SolarShading {
 		int GSSNR; // General shadowing surface number
 		int MainOverlapStatus; // Overlap status of the main overlap calculation not the check for
 		// multiple overlaps (unless there was an error)
-		static Array1D< Real64 > XVT;
-		static Array1D< Real64 > YVT;
-		static Array1D< Real64 > ZVT;
-		static bool OneTimeFlag( true );
+		static thread_local Array1D< Real64 > XVT;
+		static thread_local Array1D< Real64 > YVT;
+		static thread_local Array1D< Real64 > ZVT;
+		static thread_local bool OneTimeFlag( true );
 		int NS1; // Number of the figure being overlapped
 		int NS2; // Number of the figure doing overlapping
 		int NS3; // Location to place results of overlap
@@ -7182,6 +7423,8 @@ namespace SolarShading {
 		Real64 EqTime;
 		//not used INTEGER SurfNum
 
+		EP_PROFILE_ZONE( "PerformSolarCalculations" );
+
 		// Calculate sky diffuse shading
 
 		if ( BeginSimFlag ) {
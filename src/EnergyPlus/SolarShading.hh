@@ -49,6 +49,7 @@
 
 // C++ Headers
 #include <fstream>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
@@ -62,6 +63,9 @@
 
 namespace EnergyPlus {
 
+// Forward
+class BoundingVolumeHierarchy;
+
 namespace SolarShading {
 
 	// Using/Aliasing
@@ -98,71 +102,74 @@ namespace SolarShading {
 	// (needs to be based on maxnumvertices)
 	extern int MaxHCS; // 200      ! Maximum number of HC surfaces (was 56)
 	// Following are initially set in AllocateModuleArrays
-	extern int MAXHCArrayBounds; // Bounds based on Max Number of Vertices in surfaces
+	extern thread_local int MAXHCArrayBounds; // Bounds based on Max Number of Vertices in surfaces
 	extern int MAXHCArrayIncrement; // Increment based on Max Number of Vertices in surfaces
 	// The following variable should be re-engineered to lower in module hierarchy but need more analysis
-	extern int NVS; // Number of vertices of the shadow/clipped surface
-	extern int NumVertInShadowOrClippedSurface;
-	extern int CurrentSurfaceBeingShadowed;
-	extern int CurrentShadowingSurface;
-	extern int OverlapStatus; // Results of overlap calculation:
+	// Variables declared thread_local hold the polygon clipping state of a single sun position; each thread
+	// computing sun positions in CalcPerSolarBeam works on its own copy (see AllocateShadowingScratch)
+	extern thread_local int NVS; // Number of vertices of the shadow/clipped surface
+	extern thread_local int NumVertInShadowOrClippedSurface;
+	extern thread_local int CurrentSurfaceBeingShadowed;
+	extern thread_local int CurrentShadowingSurface;
+	extern thread_local int OverlapStatus; // Results of overlap calculation:
 	// 1=No overlap; 2=NS1 completely within NS2
 	// 3=NS2 completely within NS1; 4=Partial overlap
 
-	extern Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
-	extern int FBKSHC; // HC location of first back surface
-	extern int FGSSHC; // HC location of first general shadowing surface
-	extern int FINSHC; // HC location of first back surface overlap
-	extern int FRVLHC; // HC location of first reveal surface
-	extern int FSBSHC; // HC location of first subsurface
-	extern int LOCHCA; // Location of highest data in the HC arrays
-	extern int NBKSHC; // Number of back surfaces in the HC arrays
-	extern int NGSSHC; // Number of general shadowing surfaces in the HC arrays
-	extern int NINSHC; // Number of back surface overlaps in the HC arrays
-	extern int NRVLHC; // Number of reveal surfaces in HC array
-	extern int NSBSHC; // Number of subsurfaces in the HC arrays
+	extern thread_local Array1D< Real64 > CTHETA; // Cosine of angle of incidence of sun's rays on surface NS
+	extern thread_local int FBKSHC; // HC location of first back surface
+	extern thread_local int FGSSHC; // HC location of first general shadowing surface
+	extern thread_local int FINSHC; // HC location of first back surface overlap
+	extern thread_local int FRVLHC; // HC location of first reveal surface
+	extern thread_local int FSBSHC; // HC location of first subsurface
+	extern thread_local int LOCHCA; // Location of highest data in the HC arrays
+	extern thread_local int NBKSHC; // Number of back surfaces in the HC arrays
+	extern thread_local int NGSSHC; // Number of general shadowing surfaces in the HC arrays
+	extern thread_local int NINSHC; // Number of back surface overlaps in the HC arrays
+	extern thread_local int NRVLHC; // Number of reveal surfaces in HC array
+	extern thread_local int NSBSHC; // Number of subsurfaces in the HC arrays
 	extern bool CalcSkyDifShading; // True when sky diffuse solar shading is
 	extern int ShadowingCalcFrequency; // Frequency for Shadowing Calculations
 	extern int ShadowingDaysLeft; // Days left in current shadowing period
 	extern bool debugging;
 	extern std::ofstream shd_stream; // Shading file stream
-	extern Array1D_int HCNS; // Surface number of back surface HC figures
-	extern Array1D_int HCNV; // Number of vertices of each HC figure
-	extern Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
-	extern Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
-	extern Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
+	extern thread_local Array1D_int HCNS; // Surface number of back surface HC figures
+	extern thread_local Array1D_int HCNV; // Number of vertices of each HC figure
+	extern thread_local Array2D< Int64 > HCA; // 'A' homogeneous coordinates of sides
+	extern thread_local Array2D< Int64 > HCB; // 'B' homogeneous coordinates of sides
+	extern thread_local Array2D< Int64 > HCC; // 'C' homogeneous coordinates of sides
+	extern thread_local Array2D< Int64 > HCX; // 'X' homogeneous coordinates of vertices of figure.
+	extern thread_local Array2D< Int64 > HCY; // 'Y' homogeneous coordinates of vertices of figure.
 	extern Array3D_int WindowRevealStatus;
-	extern Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
+	extern thread_local Array1D< Real64 > HCAREA; // Area of each HC figure.  Sign Convention:  Base Surface
 	// - Positive, Shadow - Negative, Overlap between two shadows
 	// - positive, etc., so that sum of HC areas=base sunlit area
-	extern Array1D< Real64 > HCT; // Transmittance of each HC figure
+	extern thread_local Array1D< Real64 > HCT; // Transmittance of each HC figure
 	extern Array1D< Real64 > ISABSF; // For simple interior solar distribution (in which all beam
 	// radiation entering zone is assumed to strike the floor),
 	// fraction of beam radiation absorbed by each floor surface
-	extern Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
+	extern thread_local Array1D< Real64 > SAREA; // Sunlit area of heat transfer surface HTS
 	// Excludes multiplier for windows
 	// Shadowing combinations data structure...See ShadowingCombinations type
 	extern int NumTooManyFigures;
 	extern int NumTooManyVertices;
 	extern int NumBaseSubSurround;
-	extern Array1D< Real64 > SUNCOS; // Direction cosines of solar position
-	extern Real64 XShadowProjection; // X projection of a shadow (formerly called C)
-	extern Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
-	extern Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
-	extern Array1D< Real64 > XVC; // X-vertices of the clipped figure
-	extern Array1D< Real64 > XVS; // X-vertices of the shadow
-	extern Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
-	extern Array1D< Real64 > YVC; // Y-vertices of the clipped figure
-	extern Array1D< Real64 > YVS; // Y-vertices of the shadow
-	extern Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
+	extern thread_local Array1D< Real64 > SUNCOS; // Direction cosines of solar position
+	extern thread_local Real64 XShadowProjection; // X projection of a shadow (formerly called C)
+	extern thread_local Real64 YShadowProjection; // Y projection of a shadow (formerly called S)
+	extern thread_local Array1D< Real64 > XTEMP; // Temporary 'X' values for HC vertices of the overlap
+	extern thread_local Array1D< Real64 > XVC; // X-vertices of the clipped figure
+	extern thread_local Array1D< Real64 > XVS; // X-vertices of the shadow
+	extern thread_local Array1D< Real64 > YTEMP; // Temporary 'Y' values for HC vertices of the overlap
+	extern thread_local Array1D< Real64 > YVC; // Y-vertices of the clipped figure
+	extern thread_local Array1D< Real64 > YVS; // Y-vertices of the shadow
+	extern thread_local Array1D< Real64 > ZVC; // Z-vertices of the clipped figure
 	// Used in Sutherland Hodman poly clipping
-	extern Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
-	extern Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
-	extern Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
-	extern Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
-	extern Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	extern thread_local Array1D< Real64 > ATEMP; // Temporary 'A' values for HC vertices of the overlap
+	extern thread_local Array1D< Real64 > BTEMP; // Temporary 'B' values for HC vertices of the overlap
+	extern thread_local Array1D< Real64 > CTEMP; // Temporary 'C' values for HC vertices of the overlap
+	extern thread_local Array1D< Real64 > XTEMP1; // Temporary 'X' values for HC vertices of the overlap
+	extern thread_local Array1D< Real64 > YTEMP1; // Temporary 'Y' values for HC vertices of the overlap
+	extern thread_local Array1D< Real64 > HTEMP; // Clipping edge line values at the XTEMP1/YTEMP1 vertices
 	extern int maxNumberOfFigures;
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE SolarShading
@@ -203,6 +210,9 @@ namespace SolarShading {
 	void
 	AllocateModuleArrays();
 
+	void
+	AllocateShadowingScratch();
+
 	void
 	AnisoSkyViewFactors();
 
@@ -332,6 +342,9 @@ namespace SolarShading {
 		Real64 const AvgCosSolarDeclin // Average value of Cosine of Solar Declination for period
 	);
 
+	void
+	FigureSolarBeamForAllHours( int const NumThreads );
+
 	void
 	FigureSunCosines(
 		int const iHour,
@@ -350,6 +363,25 @@ namespace SolarShading {
 	void
 	DetermineShadowingCombinations();
 
+	void
+	BuildCastingSurfaceTree( BoundingVolumeHierarchy & CastingTree );
+
+	void
+	FindCastingSurfaces(
+		int const GRSNR, // Receiving surface number
+		Real64 const ZMIN, // Lowest point of the receiving surface
+		std::vector< int > const & SurfsOnBase, // Surfaces whose base surface is GRSNR
+		BoundingVolumeHierarchy const & CastingTree, // Tree built by BuildCastingSurfaceTree
+		std::vector< int > & GSS // Casting surfaces of GRSNR in increasing surface number order
+	);
+
+	void
+	FindCastingSurfacesExhaustive(
+		int const GRSNR, // Receiving surface number
+		Real64 const ZMIN, // Lowest point of the receiving surface
+		std::vector< int > & GSS // Casting surfaces of GRSNR in increasing surface number order
+	);
+
 	void
 	SHADOW(
 		int const iHour, // Hour index
@@ -0,0 +1,478 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus Headers
+#include <EnergyPlus/SparseLUSolver.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <set>
+
+namespace EnergyPlus {
+
+// Package: Sparse Direct Solver
+//
+// Purpose: LU factorization and solution of square linear systems with a structurally symmetric
+//  sparsity pattern, such as the node balance matrices of network models
+//
+// Notes:
+//  Because the pattern is structurally symmetric the filled pattern is too, so it is found from the
+//   elimination tree of the pattern graph and stored once as rows holding both the L and U parts
+//  The numeric factorization is the row-oriented (IKJ) Doolittle scheme restricted to the filled pattern
+//  The minimum degree ordering works on an explicit elimination graph: that is simple and fast enough
+//   for the few thousand node sparse networks it is used on and it only runs once per pattern
+
+	SparseLUSolver::size_type const SparseLUSolver::npos( static_cast< size_type >( -1 ) );
+
+	// Elimination order: position k holds the (1-based) equation eliminated k-th
+	std::vector< int >
+	SparseLUSolver::order() const
+	{
+		std::vector< int > o( n_ );
+		for ( int k = 0; k < n_; ++k ) o[ k ] = perm_[ k ] + 1;
+		return o;
+	}
+
+	// Set up the pattern from the off-diagonal couplings ( i, j ): the ( j, i ) entries are implied
+	void
+	SparseLUSolver::setup(
+	 int const n,
+	 Couplings const & couplings,
+	 Ordering const ordering
+	)
+	{
+		assert( n >= 0 );
+		clear();
+		n_ = n;
+		if ( n_ == 0 ) return;
+
+		// Symmetric pattern graph without self loops or duplicates
+		std::vector< std::vector< int > > graph( n_ );
+		for ( auto const & c : couplings ) {
+			int const i( c.first - 1 );
+			int const j( c.second - 1 );
+			assert( ( 0 <= i ) && ( i < n_ ) );
+			assert( ( 0 <= j ) && ( j < n_ ) );
+			if ( i == j ) continue;
+			graph[ i ].push_back( j );
+			graph[ j ].push_back( i );
+		}
+		for ( auto & adj : graph ) {
+			std::sort( adj.begin(), adj.end() );
+			adj.erase( std::unique( adj.begin(), adj.end() ), adj.end() );
+		}
+
+		// Matrix storage: Each row is its sorted neighbors plus the diagonal
+		aRow_.reserve( n_ + 1 );
+		aDiag_.reserve( n_ );
+		aRow_.push_back( 0u );
+		for ( int i = 0; i < n_; ++i ) {
+			auto const & adj( graph[ i ] );
+			bool diag( false );
+			for ( int const j : adj ) {
+				if ( ( ! diag ) && ( j > i ) ) {
+					aDiag_.push_back( aCol_.size() );
+					aCol_.push_back( i );
+					diag = true;
+				}
+				aCol_.push_back( j );
+			}
+			if ( ! diag ) {
+				aDiag_.push_back( aCol_.size() );
+				aCol_.push_back( i );
+			}
+			aRow_.push_back( aCol_.size() );
+		}
+		aVal_.assign( aCol_.size(), 0.0 );
+
+		// Elimination order
+		switch ( ordering ) {
+		case Ordering::MinimumDegree:
+			order_minimum_degree( graph );
+			break;
+		case Ordering::ReverseCuthillMcKee:
+			order_reverse_cuthill_mckee( graph );
+			break;
+		default:
+			perm_.resize( n_ );
+			for ( int k = 0; k < n_; ++k ) perm_[ k ] = k;
+			break;
+		}
+		iperm_.resize( n_ );
+		for ( int k = 0; k < n_; ++k ) iperm_[ perm_[ k ] ] = k;
+
+		// Filled pattern
+		symbolic( graph );
+
+		// Map the matrix entries into the factor storage
+		aToF_.resize( aCol_.size() );
+		for ( int i = 0; i < n_; ++i ) {
+			int const fi( iperm_[ i ] );
+			auto const b( fCol_.begin() + fRow_[ fi ] );
+			auto const e( fCol_.begin() + fRow_[ fi + 1 ] );
+			for ( size_type p = aRow_[ i ]; p < aRow_[ i + 1 ]; ++p ) {
+				auto const f( std::lower_bound( b, e, iperm_[ aCol_[ p ] ] ) );
+				assert( ( f != e ) && ( *f == iperm_[ aCol_[ p ] ] ) );
+				aToF_[ p ] = f - fCol_.begin();
+			}
+		}
+
+		y_.resize( n_ );
+		w_.assign( n_, npos );
+	}
+
+	// Release all storage
+	void
+	SparseLUSolver::clear()
+	{
+		n_ = 0;
+		factored_ = false;
+		singular_ = 0;
+		aRow_.clear();
+		aCol_.clear();
+		aDiag_.clear();
+		aVal_.clear();
+		perm_.clear();
+		iperm_.clear();
+		fRow_.clear();
+		fCol_.clear();
+		fDiag_.clear();
+		fVal_.clear();
+		aToF_.clear();
+		y_.clear();
+		w_.clear();
+	}
+
+	// Zero the matrix entries keeping the pattern
+	void
+	SparseLUSolver::zero()
+	{
+		std::fill( aVal_.begin(), aVal_.end(), 0.0 );
+		factored_ = false;
+	}
+
+	// Numeric LU factorization: Returns false on a vanishing pivot
+	bool
+	SparseLUSolver::factor()
+	{
+		static Real64 const eps( 64.0 * std::numeric_limits< Real64 >::epsilon() );
+		factored_ = false;
+		singular_ = 0;
+
+		// Scatter the matrix into the filled pattern
+		std::fill( fVal_.begin(), fVal_.end(), 0.0 );
+		for ( size_type p = 0, e = aVal_.size(); p < e; ++p ) fVal_[ aToF_[ p ] ] = aVal_[ p ];
+
+		for ( int i = 0; i < n_; ++i ) {
+			size_type const b( fRow_[ i ] );
+			size_type const d( fDiag_[ i ] );
+			size_type const e( fRow_[ i + 1 ] );
+
+			// Row scale for the pivot test
+			Real64 scale( 0.0 );
+			for ( size_type p = b; p < e; ++p ) {
+				w_[ fCol_[ p ] ] = p;
+				scale = std::max( scale, std::abs( fVal_[ p ] ) );
+			}
+
+			// Eliminate the lower part of row i with the previously factored rows
+			for ( size_type p = b; p < d; ++p ) {
+				int const k( fCol_[ p ] );
+				Real64 const l( fVal_[ p ] /= fVal_[ fDiag_[ k ] ] );
+				if ( l == 0.0 ) continue;
+				for ( size_type q = fDiag_[ k ] + 1, qe = fRow_[ k + 1 ]; q < qe; ++q ) {
+					assert( w_[ fCol_[ q ] ] != npos );
+					fVal_[ w_[ fCol_[ q ] ] ] -= l * fVal_[ q ];
+				}
+			}
+
+			for ( size_type p = b; p < e; ++p ) w_[ fCol_[ p ] ] = npos;
+
+			Real64 const pivot( fVal_[ d ] );
+			if ( ( std::abs( pivot ) <= eps * scale ) || ( pivot == 0.0 ) || ( ! std::isfinite( pivot ) ) ) {
+				singular_ = perm_[ i ] + 1;
+				return false;
+			}
+		}
+
+		factored_ = true;
+		return true;
+	}
+
+	// Solve A x = b in place: b on entry and x on return (Factors first if needed)
+	bool
+	SparseLUSolver::solve( Array1D< Real64 > & b )
+	{
+		if ( ! factored_ ) {
+			if ( ! factor() ) return false;
+		}
+		back_substitute( b );
+		return true;
+	}
+
+	// Solve with the current factors in place: b on entry and x on return
+	void
+	SparseLUSolver::back_substitute( Array1D< Real64 > & b ) const
+	{
+		assert( b.size() >= static_cast< size_type >( n_ ) );
+		int const l( b.l() );
+
+		// Forward elimination with the unit lower triangle
+		for ( int i = 0; i < n_; ++i ) {
+			Real64 s( b[ perm_[ i ] ] );
+			for ( size_type p = fRow_[ i ], d = fDiag_[ i ]; p < d; ++p ) s -= fVal_[ p ] * y_[ fCol_[ p ] ];
+			y_[ i ] = s;
+		}
+
+		// Back substitution with the upper triangle
+		for ( int i = n_ - 1; i >= 0; --i ) {
+			Real64 s( y_[ i ] );
+			size_type const d( fDiag_[ i ] );
+			for ( size_type p = d + 1, e = fRow_[ i + 1 ]; p < e; ++p ) s -= fVal_[ p ] * y_[ fCol_[ p ] ];
+			y_[ i ] = s / fVal_[ d ];
+		}
+
+		for ( int i = 0; i < n_; ++i ) b( perm_[ i ] + l ) = y_[ i ];
+	}
+
+	// y = A x
+	void
+	SparseLUSolver::multiply( Array1D< Real64 > const & x, Array1D< Real64 > & y ) const
+	{
+		assert( x.size() >= static_cast< size_type >( n_ ) );
+		assert( y.size() >= static_cast< size_type >( n_ ) );
+		for ( int i = 0; i < n_; ++i ) {
+			Real64 s( 0.0 );
+			for ( size_type p = aRow_[ i ], e = aRow_[ i + 1 ]; p < e; ++p ) s += aVal_[ p ] * x[ aCol_[ p ] ];
+			y[ i ] = s;
+		}
+	}
+
+	// Copy the matrix into a dense row-major array of size n*n
+	void
+	SparseLUSolver::to_dense( Array1D< Real64 > & a ) const
+	{
+		size_type const n( n_ );
+		assert( a.size() >= n * n );
+		a = 0.0;
+		for ( size_type i = 0; i < n; ++i ) {
+			for ( size_type p = aRow_[ i ], e = aRow_[ i + 1 ]; p < e; ++p ) a[ i * n + aCol_[ p ] ] = aVal_[ p ];
+		}
+	}
+
+	// Position of ( i, j ) in the matrix storage or npos
+	SparseLUSolver::size_type
+	SparseLUSolver::position( int const i, int const j ) const
+	{
+		if ( ( i < 1 ) || ( i > n_ ) || ( j < 1 ) || ( j > n_ ) ) return npos;
+		if ( i == j ) return aDiag_[ i - 1 ];
+		auto const b( aCol_.begin() + aRow_[ i - 1 ] );
+		auto const e( aCol_.begin() + aRow_[ i ] );
+		auto const f( std::lower_bound( b, e, j - 1 ) );
+		return ( ( f != e ) && ( *f == j - 1 ) ? static_cast< size_type >( f - aCol_.begin() ) : npos );
+	}
+
+	// Minimum degree ordering of the pattern graph
+	void
+	SparseLUSolver::order_minimum_degree( std::vector< std::vector< int > > const & graph )
+	{
+		// Elimination graph and a degree queue with ties broken by index for reproducibility
+		std::vector< std::set< int > > g( n_ );
+		std::set< std::pair< int, int > > queue;
+		for ( int i = 0; i < n_; ++i ) {
+			g[ i ].insert( graph[ i ].begin(), graph[ i ].end() );
+			queue.emplace( static_cast< int >( g[ i ].size() ), i );
+		}
+
+		perm_.clear();
+		perm_.reserve( n_ );
+		std::vector< int > nbrs;
+		while ( ! queue.empty() ) {
+			int const v( queue.begin()->second );
+			queue.erase( queue.begin() );
+			perm_.push_back( v );
+
+			// Eliminate v: Its neighbors become a clique
+			nbrs.assign( g[ v ].begin(), g[ v ].end() );
+			for ( int const u : nbrs ) {
+				queue.erase( std::make_pair( static_cast< int >( g[ u ].size() ), u ) );
+				g[ u ].erase( v );
+			}
+			for ( int const u : nbrs ) {
+				for ( int const w : nbrs ) {
+					if ( w != u ) g[ u ].insert( w );
+				}
+			}
+			for ( int const u : nbrs ) queue.emplace( static_cast< int >( g[ u ].size() ), u );
+			g[ v ].clear();
+		}
+	}
+
+	// Reverse Cuthill-McKee ordering of the pattern graph
+	void
+	SparseLUSolver::order_reverse_cuthill_mckee( std::vector< std::vector< int > > const & graph )
+	{
+		std::vector< bool > visited( n_, false );
+		std::vector< int > level( n_, -1 );
+		perm_.clear();
+		perm_.reserve( n_ );
+
+		// Breadth-first level structure from s: Returns the last vertex reached and sets the depth
+		auto bfs = [&]( int const s, int & depth ) -> int {
+			std::vector< int > touched;
+			std::deque< int > q;
+			q.push_back( s );
+			level[ s ] = 0;
+			touched.push_back( s );
+			int last( s );
+			depth = 0;
+			while ( ! q.empty() ) {
+				int const v( q.front() );
+				q.pop_front();
+				if ( ( level[ v ] > depth ) || ( ( level[ v ] == depth ) && ( graph[ v ].size() < graph[ last ].size() ) ) ) last = v;
+				depth = std::max( depth, level[ v ] );
+				for ( int const u : graph[ v ] ) {
+					if ( level[ u ] < 0 ) {
+						level[ u ] = level[ v ] + 1;
+						touched.push_back( u );
+						q.push_back( u );
+					}
+				}
+			}
+			for ( int const v : touched ) level[ v ] = -1;
+			return last;
+		};
+
+		std::vector< int > nbrs;
+		for ( int r = 0; r < n_; ++r ) {
+			if ( visited[ r ] ) continue;
+
+			// Pseudo-peripheral start vertex for this component (George-Liu)
+			int s( r );
+			int depth( 0 );
+			int e( bfs( s, depth ) );
+			for ( int iter = 0; iter < 8; ++iter ) {
+				int d( 0 );
+				int const f( bfs( e, d ) );
+				if ( d <= depth ) break;
+				s = e;
+				e = f;
+				depth = d;
+			}
+
+			// Cuthill-McKee sweep visiting neighbors by increasing degree
+			std::size_t head( perm_.size() );
+			perm_.push_back( s );
+			visited[ s ] = true;
+			while ( head < perm_.size() ) {
+				int const v( perm_[ head++ ] );
+				nbrs.clear();
+				for ( int const u : graph[ v ] ) {
+					if ( ! visited[ u ] ) {
+						visited[ u ] = true;
+						nbrs.push_back( u );
+					}
+				}
+				std::stable_sort( nbrs.begin(), nbrs.end(), [&]( int const a, int const b ){ return graph[ a ].size() < graph[ b ].size(); } );
+				perm_.insert( perm_.end(), nbrs.begin(), nbrs.end() );
+			}
+		}
+		std::reverse( perm_.begin(), perm_.end() );
+	}
+
+	// Symbolic factorization: Build the filled pattern in elimination order
+	void
+	SparseLUSolver::symbolic( std::vector< std::vector< int > > const & graph )
+	{
+		// Column structures of L from the elimination tree
+		std::vector< std::vector< int > > lcol( n_ );
+		std::vector< std::vector< int > > children( n_ );
+		std::vector< int > marker( n_, -1 );
+		for ( int k = 0; k < n_; ++k ) {
+			auto & s( lcol[ k ] );
+			marker[ k ] = k;
+			for ( int const j0 : graph[ perm_[ k ] ] ) {
+				int const j( iperm_[ j0 ] );
+				if ( ( j > k ) && ( marker[ j ] != k ) ) {
+					marker[ j ] = k;
+					s.push_back( j );
+				}
+			}
+			for ( int const c : children[ k ] ) {
+				for ( int const j : lcol[ c ] ) {
+					if ( ( j > k ) && ( marker[ j ] != k ) ) {
+						marker[ j ] = k;
+						s.push_back( j );
+					}
+				}
+			}
+			std::sort( s.begin(), s.end() );
+			if ( ! s.empty() ) children[ s.front() ].push_back( k );
+		}
+
+		// Rows of the filled pattern: L part from the columns, then the diagonal, then the U part by symmetry
+		std::vector< std::vector< int > > lrow( n_ );
+		for ( int k = 0; k < n_; ++k ) {
+			for ( int const i : lcol[ k ] ) lrow[ i ].push_back( k );
+		}
+		fRow_.clear();
+		fRow_.reserve( n_ + 1 );
+		fRow_.push_back( 0u );
+		fDiag_.resize( n_ );
+		for ( int i = 0; i < n_; ++i ) {
+			fCol_.insert( fCol_.end(), lrow[ i ].begin(), lrow[ i ].end() );
+			fDiag_[ i ] = fCol_.size();
+			fCol_.push_back( i );
+			fCol_.insert( fCol_.end(), lcol[ i ].begin(), lcol[ i ].end() );
+			fRow_.push_back( fCol_.size() );
+		}
+		fVal_.assign( fCol_.size(), 0.0 );
+	}
+
+} // EnergyPlus
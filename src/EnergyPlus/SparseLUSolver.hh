@@ -0,0 +1,285 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EnergyPlus_SparseLUSolver_hh_INCLUDED
+#define EnergyPlus_SparseLUSolver_hh_INCLUDED
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace EnergyPlus {
+
+// Package: Sparse Direct Solver
+//
+// Purpose: LU factorization and solution of square linear systems with a structurally symmetric
+//  sparsity pattern, such as the node balance matrices of network models
+//
+// Notes:
+//  Indexing of the public interface is 1-based to match the Array1D node arrays of the callers
+//  The pattern is set once by setup() and a fill-reducing ordering plus the symbolic factorization
+//   are computed there so each numeric factorization is a single pass over the filled pattern
+//  No pivoting is performed: the intended matrices are diagonally dominant (transport balances)
+//   or symmetric positive definite (network Jacobians); factor() reports a vanishing pivot so the
+//   caller can fall back to a pivoting dense solver
+
+class SparseLUSolver
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Coupling = std::pair< int, int >;
+	using Couplings = std::vector< Coupling >;
+
+	// Fill-reducing orderings
+	enum class Ordering {
+		Natural, // As given
+		ReverseCuthillMcKee, // Bandwidth/profile reduction
+		MinimumDegree // Fill reduction
+	};
+
+public: // Creation
+
+	// Default Constructor
+	SparseLUSolver() :
+	 n_( 0 ),
+	 factored_( false ),
+	 singular_( 0 )
+	{}
+
+public: // Properties
+
+	// Number of equations
+	int
+	size() const
+	{
+		return n_;
+	}
+
+	// Pattern set up?
+	bool
+	initialized() const
+	{
+		return n_ > 0;
+	}
+
+	// Numeric factorization current?
+	bool
+	factored() const
+	{
+		return factored_;
+	}
+
+	// Equation (1-based, original order) whose pivot vanished in the last factor(), or 0
+	int
+	singular() const
+	{
+		return singular_;
+	}
+
+	// Number of stored entries of the matrix
+	size_type
+	nonZeros() const
+	{
+		return aVal_.size();
+	}
+
+	// Number of stored entries of the LU factors including fill
+	size_type
+	factorNonZeros() const
+	{
+		return fVal_.size();
+	}
+
+	// Elimination order: position k holds the (1-based) equation eliminated k-th
+	std::vector< int >
+	order() const;
+
+	// Is ( i, j ) in the pattern?
+	bool
+	contains( int const i, int const j ) const
+	{
+		return position( i, j ) != npos;
+	}
+
+public: // Indexers
+
+	// Matrix entry ( i, j ): must be in the pattern
+	Real64 &
+	operator ()( int const i, int const j )
+	{
+		size_type const p( position( i, j ) );
+		assert( p != npos );
+		factored_ = false;
+		return aVal_[ p ];
+	}
+
+	// Matrix entry ( i, j ): zero if not in the pattern
+	Real64
+	operator ()( int const i, int const j ) const
+	{
+		size_type const p( position( i, j ) );
+		return ( p != npos ? aVal_[ p ] : 0.0 );
+	}
+
+	// Diagonal entry ( i, i )
+	Real64 &
+	diagonal( int const i )
+	{
+		assert( ( 1 <= i ) && ( i <= n_ ) );
+		factored_ = false;
+		return aVal_[ aDiag_[ i - 1 ] ];
+	}
+
+	// Diagonal entry ( i, i )
+	Real64
+	diagonal( int const i ) const
+	{
+		assert( ( 1 <= i ) && ( i <= n_ ) );
+		return aVal_[ aDiag_[ i - 1 ] ];
+	}
+
+public: // Methods
+
+	// Set up the pattern from the off-diagonal couplings ( i, j ): the ( j, i ) entries are implied
+	void
+	setup(
+	 int const n,
+	 Couplings const & couplings,
+	 Ordering const ordering = Ordering::MinimumDegree
+	);
+
+	// Release all storage
+	void
+	clear();
+
+	// Zero the matrix entries keeping the pattern
+	void
+	zero();
+
+	// Numeric LU factorization: Returns false on a vanishing pivot
+	bool
+	factor();
+
+	// Solve A x = b in place: b on entry and x on return (Factors first if needed)
+	bool
+	solve( Array1D< Real64 > & b );
+
+	// Solve with the current factors in place: b on entry and x on return
+	void
+	back_substitute( Array1D< Real64 > & b ) const;
+
+	// y = A x
+	void
+	multiply( Array1D< Real64 > const & x, Array1D< Real64 > & y ) const;
+
+	// Copy the matrix into a dense row-major array of size n*n
+	void
+	to_dense( Array1D< Real64 > & a ) const;
+
+private: // Methods
+
+	// Position of ( i, j ) in the matrix storage or npos
+	size_type
+	position( int const i, int const j ) const;
+
+	// Minimum degree ordering of the pattern graph
+	void
+	order_minimum_degree( std::vector< std::vector< int > > const & graph );
+
+	// Reverse Cuthill-McKee ordering of the pattern graph
+	void
+	order_reverse_cuthill_mckee( std::vector< std::vector< int > > const & graph );
+
+	// Symbolic factorization: Build the filled pattern in elimination order
+	void
+	symbolic( std::vector< std::vector< int > > const & graph );
+
+private: // Static Data
+
+	static size_type const npos;
+
+private: // Data
+
+	int n_; // Number of equations
+	bool factored_; // Factors current with the matrix entries?
+	int singular_; // Equation with a vanishing pivot in the last factorization, or 0
+
+	// Matrix in compressed sparse row form (0-based, original order)
+	std::vector< size_type > aRow_; // Row starts
+	std::vector< int > aCol_; // Column indexes: Sorted within each row
+	std::vector< size_type > aDiag_; // Diagonal positions
+	std::vector< Real64 > aVal_; // Values
+
+	// Elimination order
+	std::vector< int > perm_; // Elimination position => original index
+	std::vector< int > iperm_; // Original index => elimination position
+
+	// LU factors in compressed sparse row form (0-based, elimination order): Unit lower triangle is implied
+	std::vector< size_type > fRow_; // Row starts
+	std::vector< int > fCol_; // Column indexes: Sorted within each row
+	std::vector< size_type > fDiag_; // Diagonal positions
+	std::vector< Real64 > fVal_; // Values
+	std::vector< size_type > aToF_; // Matrix position => factor position
+
+	// Work arrays
+	mutable std::vector< Real64 > y_;
+	std::vector< size_type > w_;
+
+}; // SparseLUSolver
+
+} // EnergyPlus
+
+#endif
@@ -0,0 +1,150 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus Headers
+#include <EnergyPlus/ThreadPool.hh>
+
+namespace EnergyPlus {
+
+	// Constructor: Pool of nThreads threads, including the calling thread
+	ThreadPool::
+	ThreadPool( size_type const nThreads )
+	{
+		size_type const nWorkers( nThreads > 1u ? nThreads - 1u : 0u );
+		workers_.reserve( nWorkers );
+		for ( size_type i = 0; i < nWorkers; ++i ) {
+			workers_.emplace_back( &ThreadPool::work, this );
+		}
+	}
+
+	// Destructor: Stops and joins the workers
+	ThreadPool::
+	~ThreadPool()
+	{
+		{
+			std::lock_guard< std::mutex > lock( mutex_ );
+			stop_ = true;
+		}
+		start_.notify_all();
+		for ( auto & worker : workers_ ) worker.join();
+	}
+
+	// Run task( i ) for i in [ 0, nTasks ) and return when all have finished
+	void
+	ThreadPool::
+	run( size_type const nTasks, Task const & task )
+	{
+		if ( nTasks == 0u ) return;
+		if ( workers_.empty() || nTasks == 1u ) { // Nothing to share
+			for ( size_type i = 0; i < nTasks; ++i ) task( i );
+			return;
+		}
+
+		{
+			std::lock_guard< std::mutex > lock( mutex_ );
+			task_ = &task;
+			nTasks_ = nTasks;
+			next_ = 0u;
+			error_ = nullptr;
+			busy_ = workers_.size();
+			++batch_;
+		}
+		start_.notify_all();
+
+		drain();
+
+		std::exception_ptr error;
+		{
+			std::unique_lock< std::mutex > lock( mutex_ );
+			done_.wait( lock, [ this ]{ return busy_ == 0u; } );
+			task_ = nullptr;
+			error = error_;
+			error_ = nullptr;
+		}
+		if ( error ) std::rethrow_exception( error );
+	}
+
+	// Worker thread loop
+	void
+	ThreadPool::
+	work()
+	{
+		size_type batch( 0u );
+		while ( true ) {
+			{
+				std::unique_lock< std::mutex > lock( mutex_ );
+				start_.wait( lock, [ this, batch ]{ return stop_ || batch_ != batch; } );
+				if ( stop_ ) return;
+				batch = batch_;
+			}
+			drain();
+			bool last( false );
+			{
+				std::lock_guard< std::mutex > lock( mutex_ );
+				last = ( --busy_ == 0u );
+			}
+			if ( last ) done_.notify_one();
+		}
+	}
+
+	// Run tasks from the current batch until none are left
+	void
+	ThreadPool::
+	drain()
+	{
+		Task const & task( *task_ );
+		for ( size_type i = next_++; i < nTasks_; i = next_++ ) {
+			try {
+				task( i );
+			} catch ( ... ) {
+				std::lock_guard< std::mutex > lock( mutex_ );
+				if ( ! error_ ) error_ = std::current_exception();
+				next_ = nTasks_; // Stop handing out tasks
+			}
+		}
+	}
+
+} // EnergyPlus
@@ -0,0 +1,143 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EnergyPlus_ThreadPool_hh_INCLUDED
+#define EnergyPlus_ThreadPool_hh_INCLUDED
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+// C++ Headers
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EnergyPlus {
+
+// Package: Thread Pool
+//
+// Purpose: Persistent set of worker threads for running many small batches of independent tasks,
+//  such as the per-zone surface heat balances of each inside iteration, without the cost of
+//  starting threads for every batch
+//
+// Notes:
+//  The calling thread works on the batch too, so a pool of size N starts N-1 workers
+//  Tasks are handed out one index at a time from a shared counter: the thread that runs a given
+//   task varies from batch to batch, so tasks must not depend on which thread runs them
+//  The first exception thrown by a task is rethrown from run once the whole batch has stopped
+//  A pool runs one batch at a time and run must not be called from a task
+
+class ThreadPool
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Task = std::function< void( size_type ) >;
+
+public: // Creation
+
+	// Constructor: Pool of nThreads threads, including the calling thread
+	explicit
+	ThreadPool( size_type const nThreads );
+
+	// Destructor: Stops and joins the workers
+	~ThreadPool();
+
+	// Not copyable
+	ThreadPool( ThreadPool const & ) = delete;
+	ThreadPool &
+	operator =( ThreadPool const & ) = delete;
+
+public: // Properties
+
+	// Number of threads, including the calling thread
+	size_type
+	size() const
+	{
+		return workers_.size() + 1u;
+	}
+
+public: // Methods
+
+	// Run task( i ) for i in [ 0, nTasks ) and return when all have finished
+	void
+	run( size_type const nTasks, Task const & task );
+
+private: // Methods
+
+	// Worker thread loop
+	void
+	work();
+
+	// Run tasks from the current batch until none are left
+	void
+	drain();
+
+private: // Data
+
+	std::vector< std::thread > workers_;
+	std::mutex mutex_;
+	std::condition_variable start_; // Signals a new batch or shutdown to the workers
+	std::condition_variable done_; // Signals the end of a batch to the caller
+	Task const * task_ = nullptr; // Current batch task
+	size_type nTasks_ = 0u; // Current batch size
+	std::atomic< size_type > next_{ 0u }; // Next task index to hand out
+	size_type batch_ = 0u; // Batch counter: workers start when it changes
+	size_type busy_ = 0u; // Workers still on the current batch
+	bool stop_ = false; // Shutdown requested
+	std::exception_ptr error_; // First exception thrown by a task of the current batch
+
+};
+
+} // EnergyPlus
+
+#endif
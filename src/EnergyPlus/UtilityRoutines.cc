@@ -66,6 +66,7 @@ extern "C" {
 #include <UtilityRoutines.hh>
 #include <BranchInputManager.hh>
 #include <BranchNodeConnections.hh>
+#include <ColumnarOutput.hh>
 #include <CommandLineInterface.hh>
 #include <DataEnvironment.hh>
 #include <DataErrorTracking.hh>
@@ -81,6 +82,7 @@ extern "C" {
 #include <General.hh>
 #include <GeneralRoutines.hh>
 #include <NodeInputManager.hh>
+#include <OutputProcessor.hh>
 #include <OutputReports.hh>
 #include <PlantManager.hh>
 #include <SimulationManager.hh>
@@ -205,6 +207,8 @@ AbortEnergyPlus()
 	CheckPlantOnAbort();
 	ShowRecurringErrors();
 	SummarizeErrors();
+	OutputProcessor::StopOutputWriter(); // Write the queued report lines before the files are closed
+	ColumnarOutput::CloseColumnarFile(); // Index what was written so that the file can still be read
 	CloseMiscOpenFiles();
 	NumWarnings = RoundSigDigits( TotalWarningErrors );
 	strip( NumWarnings );
@@ -439,6 +443,8 @@ EndEnergyPlus()
 	ReportSurfaceErrors();
 	ShowRecurringErrors();
 	SummarizeErrors();
+	OutputProcessor::StopOutputWriter(); // Write the queued report lines before the files are closed
+	ColumnarOutput::CloseColumnarFile(); // Index what was written so that the file can still be read
 	CloseMiscOpenFiles();
 	NumWarnings = RoundSigDigits( TotalWarningErrors );
 	strip( NumWarnings );
@@ -1588,6 +1594,8 @@ ShowErrorMessage(
 	using DataGlobals::DoingInputProcessing;
 	using DataGlobals::CacheIPErrorFile;
 	using DataGlobals::err_stream;
+	using DataGlobals::OutputFileStandard;
+	using DataGlobals::OutputFileMeters;
 
 	// Locals
 	// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1614,6 +1622,10 @@ ShowErrorMessage(
 	} else {
 		gio::write( CacheIPErrorFile, fmtA ) << ErrorMessage;
 	}
+	if ( ( present( OutUnit1 ) && ( ( OutUnit1() == OutputFileStandard ) || ( OutUnit1() == OutputFileMeters ) ) ) ||
+			( present( OutUnit2 ) && ( ( OutUnit2() == OutputFileStandard ) || ( OutUnit2() == OutputFileMeters ) ) ) ) {
+		OutputProcessor::FlushOutputWriter(); // The message follows any queued report lines
+	}
 	if ( present( OutUnit1 ) ) {
 		gio::write( OutUnit1, ErrorFormat ) << ErrorMessage;
 	}
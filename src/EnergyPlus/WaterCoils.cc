@@ -127,8 +127,6 @@ namespace WaterCoils {
 	using Psychrometrics::PsyRhoAirFnPbTdbW;
 	using Psychrometrics::PsyHFnTdbRhPb;
 	using Psychrometrics::PsyTsatFnHPb;
-	using FluidProperties::GetSpecificHeatGlycol;
-	using FluidProperties::GetDensityGlycol;
 	using DataPlant::TypeOf_CoilWaterCooling;
 	using DataPlant::TypeOf_CoilWaterDetailedFlatCooling;
 	using DataPlant::TypeOf_CoilWaterSimpleHeating;
@@ -984,7 +982,7 @@ namespace WaterCoils {
 
 		// Do the Begin Environment initializations
 		if ( BeginEnvrnFlag && MyEnvrnFlag( CoilNum ) ) {
-			rho = GetDensityGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, InitConvTemp, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+			rho = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().rho( InitConvTemp, RoutineName );
 			//Initialize all report variables to a known state at beginning of simulation
 			WaterCoil( CoilNum ).TotWaterHeatingCoilEnergy = 0.0;
 			WaterCoil( CoilNum ).TotWaterCoolingCoilEnergy = 0.0;
@@ -1004,7 +1002,7 @@ namespace WaterCoils {
 			if ( WaterCoil( CoilNum ).WaterCoilType == CoilType_Cooling ) { // 'Cooling'
 				Node( WaterInletNode ).Temp = 5.0;
 
-				Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, Node( WaterInletNode ).Temp, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+				Cp = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().cp( Node( WaterInletNode ).Temp, RoutineName );
 
 				Node( WaterInletNode ).Enthalpy = Cp * Node( WaterInletNode ).Temp;
 				Node( WaterInletNode ).Quality = 0.0;
@@ -1015,7 +1013,7 @@ namespace WaterCoils {
 			if ( WaterCoil( CoilNum ).WaterCoilType == CoilType_Heating ) { // 'Heating'
 				Node( WaterInletNode ).Temp = 60.0;
 
-				Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, Node( WaterInletNode ).Temp, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+				Cp = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().cp( Node( WaterInletNode ).Temp, RoutineName );
 
 				Node( WaterInletNode ).Enthalpy = Cp * Node( WaterInletNode ).Temp;
 				Node( WaterInletNode ).Quality = 0.0;
@@ -1229,7 +1227,7 @@ namespace WaterCoils {
 					}
 
 					// Enthalpy of Water at Intlet design conditions
-					Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, WaterCoil( CoilNum ).DesInletWaterTemp, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+					Cp = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().cp( WaterCoil( CoilNum ).DesInletWaterTemp, RoutineName );
 
 					DesOutletWaterTemp = WaterCoil( CoilNum ).DesInletWaterTemp + WaterCoil( CoilNum ).DesTotWaterCoilLoad / ( WaterCoil( CoilNum ).MaxWaterMassFlowRate * Cp );
 
@@ -1441,7 +1439,7 @@ namespace WaterCoils {
 			WaterCoil( CoilNum ).InletAirMassFlowRate = StdRhoAir * WaterCoil( CoilNum ).DesAirVolFlowRate;
 			CapacitanceAir = WaterCoil( CoilNum ).InletAirMassFlowRate * PsyCpAirFnWTdb( WaterCoil( CoilNum ).InletAirHumRat, WaterCoil( CoilNum ).InletAirTemp );
 
-			Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, WaterCoil( CoilNum ).InletWaterTemp, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+			Cp = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().cp( WaterCoil( CoilNum ).InletWaterTemp, RoutineName );
 
 			CapacitanceWater = WaterCoil( CoilNum ).InletWaterMassFlowRate * Cp;
 			CMin = min( CapacitanceAir, CapacitanceWater );
@@ -2086,7 +2084,7 @@ namespace WaterCoils {
 				RequestSizing( CompType, CompName, HeatingWaterDesCoilWaterVolFlowUsedForUASizing, SizingString, TempSize, bPRINT, RoutineName );
 				DataWaterFlowUsedForSizing = TempSize;
 				WaterCoil( CoilNum ).InletWaterTemp = PlantSizData( PltSizHeatNum ).ExitTemp;
-				rho = GetDensityGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, DataGlobals::CWInitConvTemp, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+				rho = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().rho( DataGlobals::CWInitConvTemp, RoutineName );
 				WaterCoil( CoilNum ).InletWaterMassFlowRate = rho * DataWaterFlowUsedForSizing;
 				WaterCoil( CoilNum ).DesWaterHeatingCoilRate = DataCapacityUsedForSizing;
 
@@ -2234,7 +2232,7 @@ namespace WaterCoils {
 
 		if ( WaterMassFlowRate > MassFlowTolerance ) { // If the coil is operating
 			CapacitanceAir = PsyCpAirFnWTdb( Win, 0.5 * ( TempAirIn + TempWaterIn ) ) * AirMassFlow;
-			Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, TempWaterIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+			Cp = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().cp( TempWaterIn, RoutineName );
 			CapacitanceWater = Cp * WaterMassFlowRate;
 			CapacitanceMin = min( CapacitanceAir, CapacitanceWater );
 			CapacitanceMax = max( CapacitanceAir, CapacitanceWater );
@@ -2516,7 +2514,7 @@ namespace WaterCoils {
 			//       Ratio of secondary (fin) to total (secondary plus primary) surface areas
 			FinToTotSurfAreaRatio = WaterCoil( CoilNum ).FinSurfArea / WaterCoil( CoilNum ).TotCoilOutsideSurfArea;
 			//      known water and air flow parameters:
-			rho = GetDensityGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, TempWaterIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+			rho = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().rho( TempWaterIn, RoutineName );
 			//      water flow velocity - assuming number of water circuits = NumOfTubesPerRow
 			TubeWaterVel = WaterMassFlowRate * 4.0 / ( WaterCoil( CoilNum ).NumOfTubesPerRow * rho * Pi * WaterCoil( CoilNum ).TubeInsideDiam * WaterCoil( CoilNum ).TubeInsideDiam );
 			//      air mass flow rate per unit area
@@ -2613,7 +2611,7 @@ namespace WaterCoils {
 			//       dry coil outside thermal resistance = [1/UA] (dry coil)
 			CoilToAirThermResistDrySurf = 1.0 / ( WaterCoil( CoilNum ).TotCoilOutsideSurfArea * AirSideDrySurfFilmCoef * DryCoilEfficiency );
 			//       definitions made to simplify some of the expressions used below
-			Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, TempWaterIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+			Cp = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().cp( TempWaterIn, RoutineName );
 			ScaledWaterSpecHeat = WaterMassFlowRate * Cp * ConvK / AirMassFlow;
 			DryCoilCoeff1 = 1.0 / ( AirMassFlow * MoistAirSpecificHeat ) - 1.0 / ( WaterMassFlowRate * Cp * ConvK );
 			//       perform initialisations for all wet solution
@@ -3147,7 +3145,7 @@ namespace WaterCoils {
 		// Calculate air and water capacity rates
 		CapacitanceAir = AirMassFlow * PsyCpAirFnWTdb( WaterCoil( CoilNum ).InletAirHumRat, WaterCoil( CoilNum ).InletAirTemp );
 		// Water Capacity Rate
-		Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, WaterTempIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+		Cp = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().cp( WaterTempIn, RoutineName );
 
 		CapacitanceWater = WaterMassFlowRate * Cp;
 
@@ -3289,7 +3287,7 @@ namespace WaterCoils {
 		// coil as counterflow enthalpy heat exchanger
 		UACoilTotalEnth = 1.0 / ( IntermediateCpSat * WaterSideResist + AirSideResist * PsyCpAirFnWTdb( 0.0, AirTempIn ) );
 		CapacityRateAirWet = AirMassFlow;
-		Cp = GetSpecificHeatGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, WaterTempIn, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+		Cp = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().cp( WaterTempIn, RoutineName );
 		CapacityRateWaterWet = WaterMassFlowRate * ( Cp / IntermediateCpSat );
 		CoilOutletStreamCondition( CoilNum, CapacityRateAirWet, EnthAirInlet, CapacityRateWaterWet, EnthSatAirInletWaterTemp, UACoilTotalEnth, EnthAirOutlet, EnthSatAirOutletWaterTemp );
 
@@ -4030,7 +4028,7 @@ namespace WaterCoils {
 			//  put here to catch all types of DX coils
 			Tavg = ( WaterCoil( CoilNum ).InletAirTemp - WaterCoil( CoilNum ).OutletAirTemp ) / 2.0;
 
-			RhoWater = GetDensityGlycol( PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidName, Tavg, PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).FluidIndex, RoutineName );
+			RhoWater = PlantLoop( WaterCoil( CoilNum ).WaterLoopNum ).glycol().rho( Tavg, RoutineName );
 			//   CR9155 Remove specific humidity calculations
 			SpecHumIn = WaterCoil( CoilNum ).InletAirHumRat;
 			SpecHumOut = WaterCoil( CoilNum ).OutletAirHumRat;
@@ -61,6 +61,7 @@
 // EnergyPlus Headers
 #include <CommandLineInterface.hh>
 #include <WeatherManager.hh>
+#include <ColumnarOutput.hh>
 #include <DataEnvironment.hh>
 #include <DataHeatBalance.hh>
 #include <DataStringGlobals.hh>
@@ -68,6 +69,7 @@
 #include <DataPrecisionGlobals.hh>
 #include <DataReportingFlags.hh>
 #include <DataSystemVariables.hh>
+#include <DataTimings.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
 #include <General.hh>
@@ -76,6 +78,7 @@
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <Psychrometrics.hh>
+#include <RunPeriodSegments.hh>
 #include <ScheduleManager.hh>
 #include <ThermalComfort.hh>
 #include <UtilityRoutines.hh>
@@ -563,6 +566,8 @@ namespace WeatherManager {
 
 		// FLOW:
 
+		EP_PROFILE_ZONE( "ManageWeather" );
+
 		InitializeWeather( PrintEnvrnStamp );
 
 		SetCurrentWeather();
@@ -5192,6 +5197,7 @@ Label9999: ;
 
 			if ( PrintEnvrnStamp ) {
 
+				OutputProcessor::FlushOutputWriter(); // The stamps follow any queued report lines
 				if ( PrintEndDataDictionary && DoOutputReporting ) {
 					gio::write( OutputFileStandard, EndOfHeaderFormat );
 					gio::write( OutputFileMeters, EndOfHeaderFormat );
@@ -5201,6 +5207,7 @@ Label9999: ;
 					std::string const & Title( Environment( Envrn ).Title );
 					gio::write( OutputFileStandard, EnvironmentStampFormat ) << EnvironmentReportChr << Title << Latitude << Longitude << TimeZoneNumber << Elevation;
 					gio::write( OutputFileMeters, EnvironmentStampFormat ) << EnvironmentReportChr << Title << Latitude << Longitude << TimeZoneNumber << Elevation;
+					ColumnarOutput::BeginEnvironment( Title, Latitude, Longitude, TimeZoneNumber, Elevation );
 					PrintEnvrnStamp = false;
 				}
 
@@ -5591,6 +5598,11 @@ Label9999: ;
 				ErrorsFound = true;
 			}
 
+			// narrow the run period to the months of this segment
+			if ( RunPeriodSegments::SegmentNum > 0 ) {
+				RunPeriodSegments::SplitRunPeriod( RunPeriodInput( Loop ), LeapYearAdd, ErrorsFound );
+			}
+
 			//calculate the annual start and end dates from the user inputted month and day
 			RunPeriodInput( Loop ).StartDate = JulianDay( RunPeriodInput( Loop ).StartMonth, RunPeriodInput( Loop ).StartDay, LeapYearAdd );
 			RunPeriodInput( Loop ).EndDate = JulianDay( RunPeriodInput( Loop ).EndMonth, RunPeriodInput( Loop ).EndDay, LeapYearAdd );
@@ -5619,6 +5631,11 @@ Label9999: ;
 			Loop = RP + Ptr;
 			RunPeriodInput( Loop ).Title = cAlphaArgs( 1 );
 
+			if ( RunPeriodSegments::SegmentNum > 0 ) {
+				ShowSevereError( cCurrentModuleObject + "=\"" + cAlphaArgs( 1 ) + "\" cannot be split into run period segments; use RunPeriod instead." );
+				ErrorsFound = true;
+			}
+
 			//set the start and end day of month from user input
 			// N1 , \field Begin Month
 			// N2 , \field Begin Day of Month
@@ -5768,6 +5785,9 @@ Label9999: ;
 			TotRunPers = 1;
 			WeathSimReq = true;
 			RunPeriodInput.allocate( TotRunPers );
+			if ( RunPeriodSegments::SegmentNum > 0 ) {
+				RunPeriodSegments::SplitRunPeriod( RunPeriodInput( 1 ), LeapYearAdd, ErrorsFound );
+			}
 			RunPeriodInput( 1 ).StartDate = JulianDay( RunPeriodInput( 1 ).StartMonth, RunPeriodInput( 1 ).StartDay, LeapYearAdd );
 			RunPeriodInput( 1 ).EndDate = JulianDay( RunPeriodInput( 1 ).EndMonth, RunPeriodInput( 1 ).EndDay, LeapYearAdd );
 			RunPeriodInput( 1 ).MonWeekDay = 0;
@@ -9307,6 +9327,7 @@ Label9998: ;
 			env.EndMonth = runPer.EndMonth;
 			env.EndDay = runPer.EndDay;
 			env.NumSimYears = runPer.NumSimYears;
+			env.SegmentOverlapDays = runPer.SegmentOverlapDays;
 			if ( runPer.ActualWeather ) {
 				env.CurrentYear = runPer.StartYear;
 				env.IsLeapYear = IsLeapYear( runPer.StartYear );
@@ -294,6 +294,7 @@ namespace WeatherManager {
 		bool MatchYear; // for actual weather will be true
 		bool ActualWeather; // true when using actual weather data
 		int RawSimDays; // number of basic sim days.
+		int SegmentOverlapDays; // Days simulated ahead of a run period segment without reporting
 
 		// Default Constructor
 		EnvironmentData() :
@@ -330,7 +331,8 @@ namespace WeatherManager {
 			TreatYearsAsConsecutive( true ),
 			MatchYear( false ),
 			ActualWeather( false ),
-			RawSimDays( 0 )
+			RawSimDays( 0 ),
+			SegmentOverlapDays( 0 )
 		{}
 
 	};
@@ -424,6 +426,7 @@ namespace WeatherManager {
 		bool RollDayTypeOnRepeat; // If repeating run period, increment day type on repeat.
 		bool TreatYearsAsConsecutive; // When year rolls over, increment year and recalculate Leap Year
 		bool ActualWeather; // true when using actual weather data
+		int SegmentOverlapDays; // Days simulated ahead of a run period segment without reporting
 
 		// Default Constructor
 		RunPeriodData() :
@@ -448,7 +451,8 @@ namespace WeatherManager {
 			IsLeapYear( false ),
 			RollDayTypeOnRepeat( true ),
 			TreatYearsAsConsecutive( true ),
-			ActualWeather( false )
+			ActualWeather( false ),
+			SegmentOverlapDays( 0 )
 		{}
 
 	};
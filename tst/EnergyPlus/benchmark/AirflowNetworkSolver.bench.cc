@@ -0,0 +1,233 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::AirflowNetworkSolver Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/AirflowNetworkSolver.hh>
+#include <EnergyPlus/DataAirflowNetwork.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// C++ Headers
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::AirflowNetworkSolver;
+using DataAirflowNetwork::AirflowNetworkLinkageData;
+using DataAirflowNetwork::AirflowNetworkNodeData;
+
+namespace {
+
+	int const Sizes[] = { 1, 5, 20 }; // Floors
+	int const ZonesPerFloor( 10 ); // Zones along a corridor zone
+	int const ExternalPerFloor( 4 ); // External nodes: one per facade
+
+	// Network of an office building with a ducted supply and return on every floor, numbered as AirflowNetwork numbers it:
+	//  Zones, then external nodes, then the distribution nodes
+	//  Zones open to the corridor and leak to their neighbors, the floor above and their facade
+	//  Each floor has supply and return trunks with a terminal and a return grille per zone, joined by risers to one air handler
+	void
+	setup_network( int const NumFloors )
+	{
+		static int set_up( 0 ); // Floors of the current setup
+		if ( set_up == NumFloors ) return;
+
+		int const NumZones( NumFloors * ( ZonesPerFloor + 1 ) );
+		int const NumExternal( NumFloors * ExternalPerFloor );
+		int const DistPerFloor( 4 * ZonesPerFloor + 2 ); // Supply and return trunks, terminals and grilles, and two riser nodes
+		int const NumNodes( NumZones + NumExternal + NumFloors * DistPerFloor + 2 ); // Air handler inlet and outlet
+		auto const zone = []( int const floor, int const i ){ return ( floor - 1 ) * ( ZonesPerFloor + 1 ) + i + 1; }; // i = 0: corridor
+		auto const external = [ NumZones ]( int const floor, int const facade ){ return NumZones + ( floor - 1 ) * ExternalPerFloor + facade; };
+		auto const dist = [ NumZones, NumExternal, DistPerFloor ]( int const floor, int const i ){ return NumZones + NumExternal + ( floor - 1 ) * DistPerFloor + i; };
+		int const AHUInlet( NumNodes - 1 );
+		int const AHUOutlet( NumNodes );
+
+		std::vector< std::pair< int, int > > links;
+		for ( int floor = 1; floor <= NumFloors; ++floor ) {
+			for ( int i = 1; i <= ZonesPerFloor; ++i ) {
+				links.emplace_back( zone( floor, i ), zone( floor, 0 ) ); // Door
+				if ( i > 1 ) links.emplace_back( zone( floor, i - 1 ), zone( floor, i ) ); // Partition crack
+				if ( floor < NumFloors ) links.emplace_back( zone( floor, i ), zone( floor + 1, i ) ); // Floor crack
+				int const facade( i <= ZonesPerFloor / 2 ? 1 : 3 );
+				links.emplace_back( zone( floor, i ), external( floor, facade ) ); // Window
+				links.emplace_back( zone( floor, i ), external( floor, facade ) ); // Wall crack
+				if ( ( i == 1 ) || ( i == ZonesPerFloor ) ) links.emplace_back( zone( floor, i ), external( floor, i == 1 ? 2 : 4 ) ); // End wall
+			}
+			links.emplace_back( zone( floor, 0 ), external( floor, 2 ) ); // Corridor doors
+			links.emplace_back( zone( floor, 0 ), external( floor, 4 ) );
+			for ( int i = 1; i <= ZonesPerFloor; ++i ) {
+				int const supply( dist( floor, i ) ), terminal( dist( floor, ZonesPerFloor + i ) );
+				int const grille( dist( floor, 2 * ZonesPerFloor + i ) ), ret( dist( floor, 3 * ZonesPerFloor + i ) );
+				links.emplace_back( i == 1 ? dist( floor, 4 * ZonesPerFloor + 1 ) : supply - 1, supply ); // Supply trunk
+				links.emplace_back( supply, terminal );
+				links.emplace_back( terminal, zone( floor, i ) );
+				links.emplace_back( zone( floor, i ), grille );
+				links.emplace_back( grille, ret );
+				links.emplace_back( ret, i == 1 ? dist( floor, 4 * ZonesPerFloor + 2 ) : ret - 1 ); // Return trunk
+			}
+			int const supplyRiser( dist( floor, 4 * ZonesPerFloor + 1 ) ), returnRiser( dist( floor, 4 * ZonesPerFloor + 2 ) );
+			links.emplace_back( floor == 1 ? AHUOutlet : dist( floor - 1, 4 * ZonesPerFloor + 1 ), supplyRiser );
+			links.emplace_back( returnRiser, floor == 1 ? AHUInlet : dist( floor - 1, 4 * ZonesPerFloor + 2 ) );
+		}
+		links.emplace_back( AHUInlet, AHUOutlet ); // Fan
+		links.emplace_back( external( 1, 1 ), AHUInlet ); // Outdoor air
+		links.emplace_back( AHUInlet, external( 1, 3 ) ); // Relief
+
+		NetworkNumOfNodes = NumNodes;
+		NetworkNumOfLinks = int( links.size() );
+		DataAirflowNetwork::NumOfNodesMultiZone = 0;
+		AirflowNetworkNodeData.deallocate();
+		AirflowNetworkNodeData.allocate( NumNodes );
+		for ( int n = 1; n <= NumNodes; ++n ) {
+			AirflowNetworkNodeData( n ).Name = "Node " + std::to_string( n );
+			AirflowNetworkNodeData( n ).NodeTypeNum = ( ( n > NumZones ) && ( n <= NumZones + NumExternal ) ? 1 : 0 );
+		}
+		AirflowNetworkLinkageData.deallocate();
+		AirflowNetworkLinkageData.allocate( NetworkNumOfLinks );
+		for ( int i = 1; i <= NetworkNumOfLinks; ++i ) {
+			AirflowNetworkLinkageData( i ).NodeNums( 1 ) = links[ i - 1 ].first;
+			AirflowNetworkLinkageData( i ).NodeNums( 2 ) = links[ i - 1 ].second;
+		}
+		ID.deallocate();
+		ID.allocate( NumNodes );
+		for ( int n = 1; n <= NumNodes; ++n ) ID( n ) = n;
+		IK.deallocate();
+		IK.allocate( NumNodes + 1 );
+		SETSKY(); // Skyline profile and sparse LU pattern
+		AD.deallocate();
+		AD.allocate( NumNodes );
+		AU.deallocate();
+		AU.allocate( IK( NumNodes + 1 ) ); // As AllocateAirflowNetworkData sizes it
+		PZ.deallocate();
+		PZ.allocate( NumNodes );
+		set_up = NumFloors;
+	}
+
+	// Location matrix flag and element array of a link of the given flow derivative as AirflowNetworkSolver::FILJAC sets them up
+	int
+	element( int const i, Array1D< Real64 > & X )
+	{
+		Real64 const DF( 1.0e-3 * ( 1 + i % 7 ) );
+		int FLAG( 1 );
+		if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 1 ) ).NodeTypeNum == 0 ) {
+			++FLAG;
+			X( 1 ) = DF;
+			X( 2 ) = -DF;
+		}
+		if ( AirflowNetworkNodeData( AirflowNetworkLinkageData( i ).NodeNums( 2 ) ).NodeTypeNum == 0 ) {
+			FLAG += 2;
+			X( 4 ) = DF;
+			X( 3 ) = -DF;
+		}
+		return FLAG;
+	}
+
+	// Fill, factor and solve the Jacobian of one Newton iteration with the skyline solver
+	void
+	bench_skyline( int const NumFloors, std::size_t const iterations )
+	{
+		setup_network( NumFloors );
+		int const NNZE( IK( NetworkNumOfNodes + 1 ) - 1 );
+		Array1D< Real64 > X( 4 );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			for ( int n = 1; n <= NetworkNumOfNodes; ++n ) AD( n ) = ( AirflowNetworkNodeData( n ).NodeTypeNum == 1 ? 1.0 : 0.0 );
+			for ( int n = 1; n <= NNZE; ++n ) AU( n ) = 0.0;
+			for ( int i = 1; i <= NetworkNumOfLinks; ++i ) {
+				int const FLAG( element( i, X ) );
+				if ( FLAG != 1 ) FILSKY( X, AirflowNetworkLinkageData( i ).NodeNums, IK, AU, AD, FLAG );
+			}
+			for ( int n = 1; n <= NetworkNumOfNodes; ++n ) PZ( n ) = 1.0;
+			FACSKY( AU, AD, AU, IK, NetworkNumOfNodes, 0 );
+			SLVSKY( AU, AD, AU, PZ, IK, NetworkNumOfNodes, 0 );
+			sum += PZ( 1 );
+		}
+		Benchmark::keep( sum );
+	}
+
+	// Fill, factor and solve the Jacobian of one Newton iteration with the sparse LU solver
+	void
+	bench_sparse( int const NumFloors, std::size_t const iterations )
+	{
+		setup_network( NumFloors );
+		Array1D< Real64 > X( 4 );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			PressureJacobian.zero();
+			for ( int n = 1; n <= NetworkNumOfNodes; ++n ) {
+				if ( AirflowNetworkNodeData( n ).NodeTypeNum == 1 ) PressureJacobian.diagonal( n ) = 1.0;
+			}
+			for ( int i = 1; i <= NetworkNumOfLinks; ++i ) {
+				int const FLAG( element( i, X ) );
+				if ( FLAG != 1 ) FILSPARSE( X, AirflowNetworkLinkageData( i ).NodeNums, PressureJacobian, FLAG );
+			}
+			for ( int n = 1; n <= NetworkNumOfNodes; ++n ) PZ( n ) = 1.0;
+			FACSPARSE( PressureJacobian );
+			PressureJacobian.back_substitute( PZ );
+			sum += PZ( 1 );
+		}
+		Benchmark::keep( sum );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		for ( int const n : Sizes ) {
+			std::string const size( "/" + std::to_string( n ) );
+			Benchmark::add( "AirflowNetworkSolver/Skyline" + size, [ n ]( std::size_t const i ){ bench_skyline( n, i ); } );
+			Benchmark::add( "AirflowNetworkSolver/SparseLU" + size, [ n ]( std::size_t const i ){ bench_sparse( n, i ); } );
+		}
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
@@ -0,0 +1,238 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/DataIPShortCuts.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/FileSystem.hh>
+#include <EnergyPlus/InputProcessor.hh>
+#include <EnergyPlus/SortAndStringUtilities.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace EnergyPlus {
+
+namespace Benchmark {
+
+	Real64 volatile sink( 0.0 );
+
+	namespace {
+		// Constructed on first use so registrations from any translation unit are safe
+		std::vector< std::pair< std::string, Function > > &
+		benchmarks()
+		{
+			static std::vector< std::pair< std::string, Function > > registry;
+			return registry;
+		}
+
+		std::string skip_reason; // Why the running benchmark was skipped: Empty if it was not
+
+		Real64
+		seconds( Function const & function, std::size_t const iterations )
+		{
+			auto const start( std::chrono::steady_clock::now() );
+			function( iterations );
+			return std::chrono::duration< Real64 >( std::chrono::steady_clock::now() - start ).count();
+		}
+	}
+
+	void
+	add( std::string const & name, Function const & function )
+	{
+		benchmarks().emplace_back( name, function );
+	}
+
+	int
+	run( std::string const & filter, Real64 const min_seconds, int const repeats )
+	{
+		auto & registry( benchmarks() );
+		std::stable_sort( registry.begin(), registry.end(), []( std::pair< std::string, Function > const & a, std::pair< std::string, Function > const & b ){ return a.first < b.first; } );
+
+		std::size_t width( 9 );
+		for ( auto const & benchmark : registry ) width = std::max( width, benchmark.first.length() );
+		std::printf( "%-*s %14s %14s\n", int( width ), "Benchmark", "ns/iteration", "iterations" );
+
+		int n_run( 0 );
+		int n_skipped( 0 );
+		for ( auto const & benchmark : registry ) {
+			if ( benchmark.first.find( filter ) == std::string::npos ) continue;
+			Function const & function( benchmark.second );
+
+			// Untimed run of no iterations for the one time setup, such as processing input, of the first call
+			skip_reason.clear();
+			function( 0u );
+			if ( ! skip_reason.empty() ) {
+				std::printf( "%-*s %14s %14s  %s\n", int( width ), benchmark.first.c_str(), "skipped", "-", skip_reason.c_str() );
+				++n_skipped;
+				continue;
+			}
+
+			// Grow the iteration count until one run takes long enough to time
+			std::size_t iterations( 1u );
+			Real64 elapsed( seconds( function, iterations ) );
+			while ( ( elapsed < min_seconds ) && ( iterations < std::numeric_limits< std::size_t >::max() / 16u ) ) {
+				Real64 const scale( elapsed > 0.0 ? 1.5 * min_seconds / elapsed : 16.0 );
+				iterations = std::max( iterations + 1u, std::size_t( Real64( iterations ) * std::min( scale, 16.0 ) ) );
+				elapsed = seconds( function, iterations );
+			}
+
+			// Fastest of the repeats
+			Real64 best( elapsed );
+			for ( int r = 1; r < repeats; ++r ) best = std::min( best, seconds( function, iterations ) );
+
+			if ( ! skip_reason.empty() ) { // Setup failed after the untimed run: The timing is meaningless
+				std::printf( "%-*s %14s %14s  %s\n", int( width ), benchmark.first.c_str(), "skipped", "-", skip_reason.c_str() );
+				++n_skipped;
+				continue;
+			}
+			std::printf( "%-*s %14.2f %14lu\n", int( width ), benchmark.first.c_str(), 1.0e9 * best / Real64( iterations ), static_cast< unsigned long >( iterations ) );
+			++n_run;
+		}
+		if ( n_skipped > 0 ) std::fprintf( stderr, "%d benchmark(s) skipped\n", n_skipped );
+		return n_run;
+	}
+
+	void
+	skip( std::string const & reason )
+	{
+		skip_reason = reason.empty() ? std::string( "setup failed" ) : reason;
+	}
+
+	bool
+	load_idd()
+	{
+		using namespace InputProcessor;
+		static int loaded( 0 ); // 0: Not tried, 1: Loaded, -1: Failed
+		if ( loaded != 0 ) return loaded > 0;
+		loaded = -1;
+
+		std::string const exeDirectory( FileSystem::getParentDirectoryPath( FileSystem::getAbsolutePath( FileSystem::getProgramPath() ) ) );
+		std::string idd_location( exeDirectory + "Energy+.idd" );
+		if ( ! FileSystem::fileExists( idd_location ) ) idd_location = FileSystem::getParentDirectoryPath( exeDirectory ) + "Energy+.idd";
+		std::ifstream idd_stream( idd_location, std::ios_base::in | std::ios_base::binary );
+		if ( ! idd_stream ) {
+			std::fprintf( stderr, "Benchmarks needing input skipped: Energy+.idd not found at \"%s\"\n", idd_location.c_str() );
+			return false;
+		}
+
+		bool errors_found( false );
+		ProcessingIDD = true;
+		DataSystemVariables::SortedIDD = true;
+		ProcessDataDicFile( idd_stream, errors_found );
+		ProcessingIDD = false;
+		if ( errors_found ) return false;
+
+		ListOfObjects.allocate( NumObjectDefs );
+		for ( int i = 1; i <= NumObjectDefs; ++i ) ListOfObjects( i ) = ObjectDef( i ).Name;
+		iListOfObjects.allocate( NumObjectDefs );
+		SortAndStringUtilities::SetupAndSort( ListOfObjects, iListOfObjects );
+		ObjectStartRecord.dimension( NumObjectDefs, 0 );
+		ObjectGotCount.dimension( NumObjectDefs, 0 );
+		InitSecretObjects();
+		loaded = 1;
+		return true;
+	}
+
+	bool
+	process_idf( std::string const & idf )
+	{
+		using namespace InputProcessor;
+		if ( ! load_idd() ) return false;
+
+		for ( int i = 1; i <= NumObjectDefs; ++i ) ObjectDef( i ).NumFound = 0; // Or the unique objects are reported as repeated
+		ObjectStartRecord = 0;
+		ObjectGotCount = 0;
+		NumLines = 0;
+		NumOutOfRangeErrorsFound = 0;
+		NumBlankReqFieldFound = 0;
+		NumMiscErrorsFound = 0;
+		// Building and GlobalGeometryRules are required objects: Defaults are added as the unit test fixture does
+		std::string idf_text( idf );
+		if ( ( idf.compare( 0, 9, "Building," ) != 0 ) && ( idf.find( "\nBuilding," ) == std::string::npos ) ) {
+			idf_text += "\nBuilding,Bldg,0.0,Suburbs,.04,.4,FullExterior,25,6;";
+		}
+		if ( ( idf.compare( 0, 20, "GlobalGeometryRules," ) != 0 ) && ( idf.find( "\nGlobalGeometryRules," ) == std::string::npos ) ) {
+			idf_text += "\nGlobalGeometryRules,UpperLeftCorner,Counterclockwise,Relative;";
+		}
+		std::istringstream idf_stream( idf_text );
+		ProcessInputDataFile( idf_stream );
+
+		// As ProcessInput leaves the work arrays of the GetInput routines
+		ListOfSections.allocate( NumSectionDefs );
+		for ( int i = 1; i <= NumSectionDefs; ++i ) ListOfSections( i ) = SectionDef( i ).Name;
+		DataIPShortCuts::cAlphaFieldNames.allocate( MaxAlphaIDFDefArgsFound );
+		DataIPShortCuts::cAlphaArgs.allocate( MaxAlphaIDFDefArgsFound );
+		DataIPShortCuts::lAlphaFieldBlanks.dimension( MaxAlphaIDFDefArgsFound, false );
+		DataIPShortCuts::cNumericFieldNames.allocate( MaxNumericIDFDefArgsFound );
+		DataIPShortCuts::rNumericArgs.dimension( MaxNumericIDFDefArgsFound, 0.0 );
+		DataIPShortCuts::lNumericFieldBlanks.dimension( MaxNumericIDFDefArgsFound, false );
+		IDFRecordsGotten.dimension( NumIDFRecords, false );
+
+		if ( NumOutOfRangeErrorsFound + NumBlankReqFieldFound + NumMiscErrorsFound > 0 ) {
+			std::fprintf( stderr, "Benchmark input has errors: %d out of range, %d blank required fields, %d other\n", NumOutOfRangeErrorsFound, NumBlankReqFieldFound, NumMiscErrorsFound );
+			return false;
+		}
+		return true;
+	}
+
+	void
+	list()
+	{
+		for ( auto const & benchmark : benchmarks() ) std::printf( "%s\n", benchmark.first.c_str() );
+	}
+
+} // Benchmark
+
+} // EnergyPlus
@@ -0,0 +1,124 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EnergyPlus_Benchmark_hh_INCLUDED
+#define EnergyPlus_Benchmark_hh_INCLUDED
+
+// Purpose: Minimal micro-benchmark harness for timing EnergyPlus kernels in isolation
+//
+// Notes:
+//  A benchmark is a function that runs its kernel a given number of times
+//  It is first called, untimed, for zero iterations so one time setup in the benchmark is not timed
+//  The harness grows the iteration count until a run takes long enough to time reliably and reports
+//   the fastest of several runs in nanoseconds per iteration, which is the least noisy estimate
+//  Register benchmarks with a namespace scope Registration object in a *.bench.cc file
+//  Pass results to keep() so the compiler cannot drop the work being timed
+//  Benchmarks that need input objects load the IDD and process IDF text once, before timing
+//  A benchmark whose setup fails calls skip() and returns: It is reported as skipped instead of timed
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace EnergyPlus {
+
+namespace Benchmark {
+
+	using Function = std::function< void( std::size_t const ) >; // Runs the kernel the given number of times
+
+	// Add a benchmark
+	void
+	add( std::string const & name, Function const & function );
+
+	// Run the benchmarks whose name contains the filter and print their timings: Returns the number timed
+	int
+	run( std::string const & filter = std::string(), Real64 const min_seconds = 0.1, int const repeats = 5 );
+
+	// Mark the running benchmark as skipped for the given reason
+	void
+	skip( std::string const & reason );
+
+	// List the benchmark names
+	void
+	list();
+
+	// Process Energy+.idd once, from beside the executable or its parent as the unit tests find it: Returns false if not found
+	bool
+	load_idd();
+
+	// Replace the input records by those of the IDF text: Returns false if the IDD is not found or the IDF has errors
+	bool
+	process_idf( std::string const & idf );
+
+	// Sink for results so the timed work is kept
+	extern Real64 volatile sink;
+
+	template< typename T >
+	inline
+	void
+	keep( T const & value )
+	{
+		sink = static_cast< Real64 >( value );
+	}
+
+	// Registration of a benchmark at static initialization
+	struct Registration
+	{
+		Registration( std::string const & name, Function const & function )
+		{
+			add( name, function );
+		}
+	};
+
+} // Benchmark
+
+} // EnergyPlus
+
+#endif
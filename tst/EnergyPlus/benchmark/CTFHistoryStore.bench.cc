@@ -0,0 +1,212 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::CTFHistoryStore Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/CTFHistoryStore.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array3D.hh>
+
+// C++ Headers
+#include <string>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalSurface;
+using namespace EnergyPlus::DataSurfaces;
+using DataHeatBalance::Construct;
+
+namespace {
+
+	int const Sizes[] = { 100, 1000, 10000 }; // Surfaces
+	int const NumConstructions( 4 ); // Light to heavy: 3, 6, 9, and 12 CTF terms
+	int const MaxTerms( 12 );
+
+	// Opaque CTF walls cycling through the constructions, with a CTF time step of the zone time step
+	void
+	setup_walls( int const NumSurfaces )
+	{
+		if ( TotSurfaces == NumSurfaces ) return;
+		DataGlobals::TimeStepZone = 0.25;
+		TotSurfaces = NumSurfaces;
+		Surface.deallocate();
+		Surface.allocate( TotSurfaces );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			Surface( SurfNum ).HeatTransSurf = true;
+			Surface( SurfNum ).Class = SurfaceClass_Wall;
+			Surface( SurfNum ).HeatTransferAlgorithm = HeatTransferModel_CTF;
+			Surface( SurfNum ).Construction = 1 + ( SurfNum - 1 ) % NumConstructions;
+		}
+		Construct.deallocate();
+		Construct.allocate( NumConstructions );
+		for ( int ConstrNum = 1; ConstrNum <= NumConstructions; ++ConstrNum ) {
+			auto & construct( Construct( ConstrNum ) );
+			int const n( 3 * ConstrNum );
+			construct.NumCTFTerms = n;
+			construct.NumHistories = 1;
+			construct.CTFTimeStep = 0.25;
+			construct.CTFOutside.dimension( {0,n}, 0.0 );
+			construct.CTFCross.dimension( {0,n}, 0.0 );
+			construct.CTFInside.dimension( {0,n}, 0.0 );
+			construct.CTFFlux.dimension( {0,n}, 0.0 );
+			for ( int Term = 0; Term <= n; ++Term ) {
+				construct.CTFOutside( Term ) = 1.1 / ( Term + 1 );
+				construct.CTFCross( Term ) = 0.2 / ( Term + 1 );
+				construct.CTFInside( Term ) = 1.3 / ( Term + 1 );
+				construct.CTFFlux( Term ) = 0.4 / ( Term + 2 );
+			}
+		}
+		TH.dimension( 2, MaxTerms + 1, TotSurfaces, 0.0 );
+		QH.dimension( 2, MaxTerms + 1, TotSurfaces, 0.0 );
+		THM.dimension( 2, MaxTerms + 1, TotSurfaces, 0.0 );
+		QHM.dimension( 2, MaxTerms + 1, TotSurfaces, 0.0 );
+		SUMH.dimension( TotSurfaces, 0 );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			for ( int HistTermNum = 1; HistTermNum <= MaxTerms + 1; ++HistTermNum ) {
+				THM( 1, HistTermNum, SurfNum ) = TH( 1, HistTermNum, SurfNum ) = 10.0 + 0.1 * HistTermNum;
+				THM( 2, HistTermNum, SurfNum ) = TH( 2, HistTermNum, SurfNum ) = 20.0 - 0.1 * HistTermNum;
+				QHM( 1, HistTermNum, SurfNum ) = QH( 1, HistTermNum, SurfNum ) = 5.0 - 0.2 * HistTermNum;
+				QHM( 2, HistTermNum, SurfNum ) = QH( 2, HistTermNum, SurfNum ) = 3.0 + 0.2 * HistTermNum;
+			}
+		}
+	}
+
+	// Surface by surface history sums over TH/QH as CalcHeatBalanceOutsideSurf/InsideSurf do them without the store
+	void
+	bench_sum_const_parts_surfaces( int const NumSurfaces, std::size_t const iterations )
+	{
+		setup_walls( NumSurfaces );
+		Array1D< Real64 > OutPart( TotSurfaces, 0.0 ), InPart( TotSurfaces, 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				auto const & construct( Construct( Surface( SurfNum ).Construction ) );
+				Real64 QIC( 0.0 ), QOC( 0.0 );
+				for ( int Term = 1; Term <= construct.NumCTFTerms; ++Term ) {
+					QIC += construct.CTFCross( Term ) * TH( 1, Term + 1, SurfNum ) - construct.CTFInside( Term ) * TH( 2, Term + 1, SurfNum ) + construct.CTFFlux( Term ) * QH( 2, Term + 1, SurfNum );
+					QOC += construct.CTFOutside( Term ) * TH( 1, Term + 1, SurfNum ) - construct.CTFCross( Term ) * TH( 2, Term + 1, SurfNum ) + construct.CTFFlux( Term ) * QH( 1, Term + 1, SurfNum );
+				}
+				OutPart( SurfNum ) = QOC;
+				InPart( SurfNum ) = QIC;
+			}
+		}
+		Benchmark::keep( OutPart( TotSurfaces ) + InPart( 1 ) );
+	}
+
+	void
+	bench_sum_const_parts_store( int const NumSurfaces, std::size_t const iterations )
+	{
+		setup_walls( NumSurfaces );
+		CTFHistoryStore store;
+		store.build();
+		Array1D< Real64 > OutPart( TotSurfaces, 0.0 ), InPart( TotSurfaces, 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			store.sumConstParts( OutPart, InPart );
+		}
+		store.unpack();
+		Benchmark::keep( OutPart( TotSurfaces ) + InPart( 1 ) );
+	}
+
+	// Surface by surface shift of the master histories as UpdateThermalHistories does it without the store
+	void
+	bench_update_histories_surfaces( int const NumSurfaces, std::size_t const iterations )
+	{
+		setup_walls( NumSurfaces );
+		Array1D< Real64 > TempExt1( TotSurfaces, 12.0 ), TempInt1( TotSurfaces, 21.0 ), QExt1( TotSurfaces, 2.0 ), QInt1( TotSurfaces, 1.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+				int const n( Construct( Surface( SurfNum ).Construction ).NumCTFTerms );
+				for ( int Side = 1; Side <= 2; ++Side ) {
+					for ( int HistTermNum = n + 1; HistTermNum >= 3; --HistTermNum ) {
+						TH( Side, HistTermNum, SurfNum ) = THM( Side, HistTermNum, SurfNum ) = THM( Side, HistTermNum - 1, SurfNum );
+						QH( Side, HistTermNum, SurfNum ) = QHM( Side, HistTermNum, SurfNum ) = QHM( Side, HistTermNum - 1, SurfNum );
+					}
+				}
+				TH( 1, 2, SurfNum ) = THM( 1, 2, SurfNum ) = TempExt1( SurfNum );
+				TH( 2, 2, SurfNum ) = THM( 2, 2, SurfNum ) = TempInt1( SurfNum );
+				QH( 1, 2, SurfNum ) = QHM( 1, 2, SurfNum ) = QExt1( SurfNum );
+				QH( 2, 2, SurfNum ) = QHM( 2, 2, SurfNum ) = QInt1( SurfNum );
+			}
+		}
+		Benchmark::keep( TH( 1, 3, TotSurfaces ) );
+	}
+
+	void
+	bench_update_histories_store( int const NumSurfaces, std::size_t const iterations )
+	{
+		setup_walls( NumSurfaces );
+		CTFHistoryStore store;
+		store.build();
+		Array1D< Real64 > TempExt1( TotSurfaces, 12.0 ), TempInt1( TotSurfaces, 21.0 ), QExt1( TotSurfaces, 2.0 ), QInt1( TotSurfaces, 1.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			store.updateHistories( TempExt1, TempInt1, QExt1, QInt1 );
+		}
+		store.unpack();
+		Benchmark::keep( TH( 1, 3, TotSurfaces ) );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		for ( int const n : Sizes ) {
+			std::string const size( "/" + std::to_string( n ) );
+			Benchmark::add( "CTFHistoryStore/sumConstParts" + size, [ n ]( std::size_t const i ){ bench_sum_const_parts_store( n, i ); } );
+			Benchmark::add( "CTFHistoryStore/sumConstParts/Surfaces" + size, [ n ]( std::size_t const i ){ bench_sum_const_parts_surfaces( n, i ); } );
+			Benchmark::add( "CTFHistoryStore/updateHistories" + size, [ n ]( std::size_t const i ){ bench_update_histories_store( n, i ); } );
+			Benchmark::add( "CTFHistoryStore/updateHistories/Surfaces" + size, [ n ]( std::size_t const i ){ bench_update_histories_surfaces( n, i ); } );
+		}
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
@@ -0,0 +1,209 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::CurveManager Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/InputProcessor.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <string>
+
+using namespace EnergyPlus;
+
+namespace {
+
+	int const NumPoints( 256 ); // Sweep points over each curve's range
+
+	// Performance curves of the forms equipment models use, with the ranges of typical DX coil and chiller curves
+	std::string const CurveObjects(
+		"Curve:Linear,Linear,0.5,0.02,0.0,40.0,,;\n"
+		"Curve:Quadratic,Quadratic,0.8,0.2,-0.05,0.0,1.5,,;\n"
+		"Curve:Cubic,Cubic,0.2,1.2,-0.8,0.35,0.0,1.0,,;\n"
+		"Curve:Exponent,Exponent,0.0,1.0,1.3,0.0,2.0,,;\n"
+		"Curve:Biquadratic,Biquadratic,0.94,0.009,0.00034,-0.0068,-0.00004,-0.00029,12.8,23.9,18.0,46.1,,;\n"
+		"Curve:Bicubic,Bicubic,0.86,0.022,0.0002,-0.0056,0.00002,-0.0003,0.000001,-0.0000005,0.000002,-0.000001,12.8,23.9,18.0,46.1,,;\n"
+		"Curve:QuadraticLinear,QuadraticLinear,0.4,0.015,-0.0001,0.011,0.0002,0.000003,12.8,23.9,18.0,46.1,,;\n"
+	);
+
+	// Tables over a regular grid of the Biquadratic curve: Interpolated, and fit by regression to the curve form
+	std::string
+	table_objects()
+	{
+		std::string idf(
+			"Table:OneIndependentVariable,TableOneIV,Cubic,LinearInterpolationOfTable,0.0,1.0,,,Dimensionless,Dimensionless,,"
+		);
+		char value[ 64 ];
+		for ( int i = 0; i <= 10; ++i ) {
+			Real64 const x( 0.1 * i );
+			std::snprintf( value, sizeof( value ), "%.2f,%.6f%c", x, 0.2 + 1.2 * x - 0.8 * x * x + 0.35 * x * x * x, i < 10 ? ',' : ';' );
+			idf += value;
+		}
+		idf += '\n';
+		for ( std::string const method : { "LinearInterpolationOfTable", "EvaluateCurveToLimits" } ) {
+			idf += "Table:TwoIndependentVariables,TableTwoIV" + std::string( method == "EvaluateCurveToLimits" ? "Regression" : "Interpolation" ) + ",BiQuadratic," + method + ",12.8,23.9,18.0,46.1,,,Temperature,Temperature,Dimensionless,,";
+			for ( int i = 0; i <= 5; ++i ) {
+				for ( int j = 0; j <= 5; ++j ) {
+					Real64 const x( 12.8 + ( 23.9 - 12.8 ) * i / 5.0 ), y( 18.0 + ( 46.1 - 18.0 ) * j / 5.0 );
+					std::snprintf( value, sizeof( value ), "%.4f,%.4f,%.6f%c", x, y, 0.94 + 0.009 * x + 0.00034 * x * x - 0.0068 * y - 0.00004 * y * y - 0.00029 * x * y, i < 5 || j < 5 ? ',' : ';' );
+					idf += value;
+				}
+			}
+			idf += '\n';
+		}
+		return idf;
+	}
+
+	// Curve index by the name as written, after getting the curves once: 0 if the input could not be processed
+	int
+	curve_index( std::string const & name )
+	{
+		static int loaded( 0 ); // 0: Not tried, 1: Loaded, -1: Failed
+		if ( loaded == 0 ) {
+			loaded = -1;
+			if ( ! Benchmark::process_idf( CurveObjects + table_objects() ) ) return 0;
+			CurveManager::GetCurveInput();
+			CurveManager::GetCurvesInputFlag = false;
+			loaded = 1;
+		}
+		return loaded > 0 ? CurveManager::GetCurveIndex( InputProcessor::MakeUPPERCase( name ) ) : 0;
+	}
+
+	void
+	bench_curve_value( std::string const & name, std::size_t const iterations )
+	{
+		int const index( curve_index( name ) );
+		if ( index == 0 ) {
+			Benchmark::skip( "curve " + name + " not found or curve input could not be processed" );
+			return;
+		}
+		Real64 xMin, xMax;
+		CurveManager::GetCurveMinMaxValues( index, xMin, xMax );
+		Real64 const dx( ( xMax - xMin ) / ( NumPoints - 1 ) );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			sum += CurveManager::CurveValue( index, xMin + dx * ( k % NumPoints ) );
+		}
+		Benchmark::keep( sum );
+	}
+
+	void
+	bench_curve_value_2( std::string const & name, std::size_t const iterations )
+	{
+		int const index( curve_index( name ) );
+		if ( index == 0 ) {
+			Benchmark::skip( "curve " + name + " not found or curve input could not be processed" );
+			return;
+		}
+		Real64 xMin, xMax, yMin, yMax;
+		CurveManager::GetCurveMinMaxValues( index, xMin, xMax, yMin, yMax );
+		Real64 const dx( ( xMax - xMin ) / 15.0 ), dy( ( yMax - yMin ) / 15.0 );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			sum += CurveManager::CurveValue( index, xMin + dx * ( k % 16 ), yMin + dy * ( ( k / 16 ) % 16 ) );
+		}
+		Benchmark::keep( sum );
+	}
+
+	// CurveValueBatch over the same sweep as bench_curve_value_2 (or bench_curve_value for one variable), timed per point
+	void
+	bench_curve_value_batch( std::string const & name, bool const two_variables, std::size_t const iterations )
+	{
+		int const index( curve_index( name ) );
+		if ( index == 0 ) {
+			Benchmark::skip( "curve " + name + " not found or curve input could not be processed" );
+			return;
+		}
+		Real64 xMin, xMax, yMin, yMax;
+		CurveManager::GetCurveMinMaxValues( index, xMin, xMax, yMin, yMax );
+		Array1D< Real64 > x( NumPoints ), y( NumPoints ), result( NumPoints );
+		for ( int i = 1; i <= NumPoints; ++i ) {
+			if ( two_variables ) {
+				x( i ) = xMin + ( xMax - xMin ) / 15.0 * ( ( i - 1 ) % 16 );
+				y( i ) = yMin + ( yMax - yMin ) / 15.0 * ( ( ( i - 1 ) / 16 ) % 16 );
+			} else {
+				x( i ) = xMin + ( xMax - xMin ) / ( NumPoints - 1 ) * ( i - 1 );
+			}
+		}
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; k += NumPoints ) {
+			if ( two_variables ) {
+				CurveManager::CurveValueBatch( index, x, y, result );
+			} else {
+				CurveManager::CurveValueBatch( index, x, result );
+			}
+			sum += result( 1 + k % NumPoints );
+		}
+		Benchmark::keep( sum );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		for ( std::string const name : { "Linear", "Quadratic", "Cubic", "Exponent", "TableOneIV" } ) {
+			Benchmark::add( "CurveManager/CurveValue/" + name, [ name ]( std::size_t const i ){ bench_curve_value( name, i ); } );
+		}
+		for ( std::string const name : { "Biquadratic", "Bicubic", "QuadraticLinear", "TableTwoIVInterpolation", "TableTwoIVRegression" } ) {
+			Benchmark::add( "CurveManager/CurveValue/" + name, [ name ]( std::size_t const i ){ bench_curve_value_2( name, i ); } );
+		}
+		for ( std::string const name : { "Quadratic", "Cubic" } ) {
+			Benchmark::add( "CurveManager/CurveValueBatch/" + name, [ name ]( std::size_t const i ){ bench_curve_value_batch( name, false, i ); } );
+		}
+		for ( std::string const name : { "Biquadratic", "Bicubic" } ) {
+			Benchmark::add( "CurveManager/CurveValueBatch/" + name, [ name ]( std::size_t const i ){ bench_curve_value_batch( name, true, i ); } );
+		}
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
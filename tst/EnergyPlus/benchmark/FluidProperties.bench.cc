@@ -0,0 +1,203 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::FluidProperties Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/FluidProperties.hh>
+
+// C++ Headers
+#include <string>
+
+using namespace EnergyPlus;
+
+namespace {
+
+	int const NumPoints( 256 ); // Sweep points over each property's range
+
+	// The default fluids and a 30% propylene glycol, as a plant loop would be set up, evaluated with the
+	// given FluidProperties:Settings method: false if the input could not be processed
+	bool
+	get_fluids( int const method )
+	{
+		static int loaded( 0 ); // 0: Not tried, >0: Method loaded, -1: Failed
+		if ( loaded != method ) {
+			if ( loaded < 0 ) return false;
+			loaded = -1;
+			FluidProperties::clear_state();
+			std::string idf( "FluidProperties:GlycolConcentration,PG30,PropyleneGlycol,,0.3;\n" );
+			if ( method == FluidProperties::PropertyMethodUniformGrid ) idf += "FluidProperties:Settings,UniformGrid;\n";
+			if ( ! Benchmark::process_idf( idf ) ) return false;
+			FluidProperties::GetFluidPropertiesData();
+			FluidProperties::GetInput = false;
+			loaded = method;
+		}
+		return true;
+	}
+
+	enum class GlycolProperty { SpecificHeat, Density, Conductivity, Viscosity };
+
+	// Property of a glycol over the loop temperatures from chilled to hot water, through the named
+	// routines or through a FluidProperties::GlycolHandle as the plant components use
+	void
+	bench_glycol( int const method, std::string const & glycol, GlycolProperty const property, bool const use_handle, std::size_t const iterations )
+	{
+		if ( ! get_fluids( method ) ) {
+			Benchmark::skip( "fluid property input could not be processed" );
+			return;
+		}
+		static std::string const RoutineName( "Benchmark" );
+		int index( 0 );
+		FluidProperties::GlycolHandle const handle( FluidProperties::GlycolHandle::resolve( glycol ) );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			Real64 const T( 5.0 + 55.0 * ( k % NumPoints ) / ( NumPoints - 1 ) );
+			switch ( property ) {
+			case GlycolProperty::SpecificHeat:
+				sum += use_handle ? handle.cp( T, RoutineName ) : FluidProperties::GetSpecificHeatGlycol( glycol, T, index, RoutineName );
+				break;
+			case GlycolProperty::Density:
+				sum += use_handle ? handle.rho( T, RoutineName ) : FluidProperties::GetDensityGlycol( glycol, T, index, RoutineName );
+				break;
+			case GlycolProperty::Conductivity:
+				sum += use_handle ? handle.k( T, RoutineName ) : FluidProperties::GetConductivityGlycol( glycol, T, index, RoutineName );
+				break;
+			case GlycolProperty::Viscosity:
+				sum += use_handle ? handle.mu( T, RoutineName ) : FluidProperties::GetViscosityGlycol( glycol, T, index, RoutineName );
+				break;
+			}
+		}
+		Benchmark::keep( sum );
+	}
+
+	enum class SteamProperty { SatPressure, SatTemperature, SatEnthalpy, SatDensity, SatSpecificHeat, SupHeatEnthalpy, SupHeatDensity };
+
+	// Property of steam: Saturated over the temperatures of steam coils and boilers, superheated at 2 bar
+	void
+	bench_steam( int const method, SteamProperty const property, std::size_t const iterations )
+	{
+		if ( ! get_fluids( method ) ) {
+			Benchmark::skip( "fluid property input could not be processed" );
+			return;
+		}
+		static std::string const Steam( "STEAM" );
+		static std::string const RoutineName( "Benchmark" );
+		int index( 0 );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			Real64 const f( Real64( k % NumPoints ) / ( NumPoints - 1 ) );
+			Real64 const T( 100.0 + 80.0 * f );
+			switch ( property ) {
+			case SteamProperty::SatPressure:
+				sum += FluidProperties::GetSatPressureRefrig( Steam, T, index, RoutineName );
+				break;
+			case SteamProperty::SatTemperature:
+				sum += FluidProperties::GetSatTemperatureRefrig( Steam, 101325.0 + 900000.0 * f, index, RoutineName );
+				break;
+			case SteamProperty::SatEnthalpy:
+				sum += FluidProperties::GetSatEnthalpyRefrig( Steam, T, 1.0, index, RoutineName );
+				break;
+			case SteamProperty::SatDensity:
+				sum += FluidProperties::GetSatDensityRefrig( Steam, T, 1.0, index, RoutineName );
+				break;
+			case SteamProperty::SatSpecificHeat:
+				sum += FluidProperties::GetSatSpecificHeatRefrig( Steam, T, 0.0, index, RoutineName );
+				break;
+			case SteamProperty::SupHeatEnthalpy:
+				sum += FluidProperties::GetSupHeatEnthalpyRefrig( Steam, 130.0 + 120.0 * f, 200000.0, index, RoutineName );
+				break;
+			case SteamProperty::SupHeatDensity:
+				sum += FluidProperties::GetSupHeatDensityRefrig( Steam, 130.0 + 120.0 * f, 200000.0, index, RoutineName );
+				break;
+			}
+		}
+		Benchmark::keep( sum );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		struct { char const * name; char const * handle_name; GlycolProperty property; } const glycol_properties[] = {
+			{ "GetSpecificHeatGlycol", "GlycolHandle::cp", GlycolProperty::SpecificHeat },
+			{ "GetDensityGlycol", "GlycolHandle::rho", GlycolProperty::Density },
+			{ "GetConductivityGlycol", "GlycolHandle::k", GlycolProperty::Conductivity },
+			{ "GetViscosityGlycol", "GlycolHandle::mu", GlycolProperty::Viscosity }
+		};
+		struct { char const * name; SteamProperty property; } const steam_properties[] = {
+			{ "GetSatPressureRefrig", SteamProperty::SatPressure },
+			{ "GetSatTemperatureRefrig", SteamProperty::SatTemperature },
+			{ "GetSatEnthalpyRefrig", SteamProperty::SatEnthalpy },
+			{ "GetSatDensityRefrig", SteamProperty::SatDensity },
+			{ "GetSatSpecificHeatRefrig", SteamProperty::SatSpecificHeat },
+			{ "GetSupHeatEnthalpyRefrig", SteamProperty::SupHeatEnthalpy },
+			{ "GetSupHeatDensityRefrig", SteamProperty::SupHeatDensity }
+		};
+		// The method is a name prefix so the benchmarks of each method run together and the fluids are only set up twice
+		struct { char const * name; int method; } const methods[] = {
+			{ "FluidProperties/", FluidProperties::PropertyMethodExact },
+			{ "FluidProperties/UniformGrid/", FluidProperties::PropertyMethodUniformGrid }
+		};
+		for ( auto const & m : methods ) {
+			int const method( m.method );
+			for ( auto const & p : glycol_properties ) {
+				for ( std::string const glycol : { "WATER", "PG30" } ) {
+					GlycolProperty const property( p.property );
+					Benchmark::add( std::string( m.name ) + p.name + "/" + glycol, [ method, glycol, property ]( std::size_t const i ){ bench_glycol( method, glycol, property, false, i ); } );
+					Benchmark::add( std::string( m.name ) + p.handle_name + "/" + glycol, [ method, glycol, property ]( std::size_t const i ){ bench_glycol( method, glycol, property, true, i ); } );
+				}
+			}
+			for ( auto const & p : steam_properties ) {
+				SteamProperty const property( p.property );
+				Benchmark::add( std::string( m.name ) + p.name + "/STEAM", [ method, property ]( std::size_t const i ){ bench_steam( method, property, i ); } );
+			}
+		}
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
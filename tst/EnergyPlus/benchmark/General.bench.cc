@@ -0,0 +1,103 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::General Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/General.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+using namespace EnergyPlus;
+
+namespace {
+
+	// Part load ratio residual of the shape the component models solve: Load against capacity with a part load curve
+	Real64
+	part_load_residual( Real64 const PartLoadRatio, Real64 const Load, Real64 const Capacity )
+	{
+		return ( Load - Capacity * PartLoadRatio * ( 0.85 + 0.15 * PartLoadRatio ) ) / Load;
+	}
+
+	// Solution through the Par array overload, as most component models call it
+	void
+	bench_solve_regula_falsi_par( std::size_t const iterations )
+	{
+		Array1D< Real64 > Par( 2 );
+		Par( 2 ) = 10000.0; // Capacity
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			Par( 1 ) = 500.0 + 35.0 * ( k % 256 ); // Load
+			int SolFla( 0 );
+			Real64 PartLoadRatio( 0.0 );
+			General::SolveRegulaFalsi( 1.0e-6, 50, SolFla, PartLoadRatio, []( Real64 const PLR, Array1< Real64 > const & Par ){ return part_load_residual( PLR, Par( 1 ), Par( 2 ) ); }, 0.0, 1.0, Par );
+			sum += PartLoadRatio;
+		}
+		Benchmark::keep( sum );
+	}
+
+	// Solution through the overload taking a closure over the parameters
+	void
+	bench_solve_regula_falsi_lambda( std::size_t const iterations )
+	{
+		Real64 const Capacity( 10000.0 );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			Real64 const Load( 500.0 + 35.0 * ( k % 256 ) );
+			int SolFla( 0 );
+			Real64 PartLoadRatio( 0.0 );
+			General::SolveRegulaFalsi( 1.0e-6, 50, SolFla, PartLoadRatio, [ Load, Capacity ]( Real64 const PLR ){ return part_load_residual( PLR, Load, Capacity ); }, 0.0, 1.0 );
+			sum += PartLoadRatio;
+		}
+		Benchmark::keep( sum );
+	}
+
+	Benchmark::Registration const par( "General/SolveRegulaFalsi/Par", bench_solve_regula_falsi_par );
+	Benchmark::Registration const lambda( "General/SolveRegulaFalsi/Lambda", bench_solve_regula_falsi_lambda );
+
+}
@@ -0,0 +1,165 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::HeatBalanceIntRadExchange Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/HeatBalanceIntRadExchange.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// C++ Headers
+#include <string>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataSurfaces;
+using DataHeatBalance::Construct;
+using DataHeatBalance::Zone;
+
+namespace {
+
+	int const NumZones( 10 );
+	int const Sizes[] = { 6, 24, 96 }; // Surfaces per zone: A box, and zones with subdivided walls, partitions and windows
+
+	// Zones of the given number of heat transfer surfaces: Floor, roof and walls facing the four directions, about a sixth of them windows
+	// The IDD is needed for the view factor input and report checks of the initialization: Returns false if it is not found
+	bool
+	setup_zones( int const NumZoneSurfaces )
+	{
+		static int set_up( 0 ); // Surfaces per zone of the current setup
+		if ( set_up == NumZoneSurfaces ) return true;
+		if ( ! Benchmark::process_idf( std::string() ) ) return false;
+		HeatBalanceIntRadExchange::clear_state(); // Initialize again for the new zones
+		DataGlobals::NumOfZones = NumZones;
+		TotSurfaces = NumZones * NumZoneSurfaces;
+		Zone.deallocate();
+		Zone.allocate( NumZones );
+		Surface.deallocate();
+		Surface.allocate( TotSurfaces );
+		SurfaceWindow.deallocate();
+		SurfaceWindow.allocate( TotSurfaces );
+		Construct.deallocate();
+		Construct.allocate( 2 );
+		Construct( 1 ).InsideAbsorpThermal = 0.9;
+		Construct( 2 ).TypeIsWindow = true;
+		Construct( 2 ).TotGlassLayers = 1;
+		Construct( 2 ).InsideAbsorpThermal = 0.84;
+		for ( int ZoneNum = 1; ZoneNum <= NumZones; ++ZoneNum ) {
+			auto & zone( Zone( ZoneNum ) );
+			zone.Name = "Zone " + std::to_string( ZoneNum );
+			zone.SurfaceFirst = ( ZoneNum - 1 ) * NumZoneSurfaces + 1;
+			zone.SurfaceLast = ZoneNum * NumZoneSurfaces;
+			for ( int ZoneSurfNum = 1; ZoneSurfNum <= NumZoneSurfaces; ++ZoneSurfNum ) {
+				int const SurfNum( zone.SurfaceFirst + ZoneSurfNum - 1 );
+				auto & surface( Surface( SurfNum ) );
+				surface.Name = zone.Name + " Surface " + std::to_string( ZoneSurfNum );
+				surface.Zone = ZoneNum;
+				surface.HeatTransSurf = true;
+				surface.Sides = 4;
+				surface.Construction = 1;
+				if ( ZoneSurfNum == 1 ) { // Floor
+					surface.Class = SurfaceClass_Floor;
+					surface.Tilt = 180.0;
+					surface.Area = 100.0;
+				} else if ( ZoneSurfNum == 2 ) { // Roof
+					surface.Class = SurfaceClass_Roof;
+					surface.Tilt = 0.0;
+					surface.Area = 100.0;
+				} else {
+					bool const window( ZoneSurfNum % 6 == 0 );
+					surface.Class = window ? SurfaceClass_Window : SurfaceClass_Wall;
+					surface.Construction = window ? 2 : 1;
+					surface.Azimuth = 90.0 * ( ZoneSurfNum % 4 );
+					surface.Tilt = 90.0;
+					surface.Area = 120.0 / ( NumZoneSurfaces - 2 );
+				}
+			}
+		}
+		Array1D< Real64 > SurfaceTemp( TotSurfaces, 20.0 ), NetLWRadToSurf( TotSurfaces, 0.0 );
+		HeatBalanceIntRadExchange::CalcInteriorRadExchange( SurfaceTemp, 0, NetLWRadToSurf ); // Initializes the view factors
+		set_up = NumZoneSurfaces;
+		return true;
+	}
+
+	// Long-wave exchange among the zone surfaces: ScriptF is recalculated for every call on the first iteration of an environment
+	void
+	bench_calc_interior_rad_exchange( int const NumZoneSurfaces, int const SurfIterations, std::size_t const iterations )
+	{
+		if ( ! setup_zones( NumZoneSurfaces ) ) {
+			Benchmark::skip( "zone surface input could not be processed" );
+			return;
+		}
+		DataGlobals::BeginEnvrnFlag = ( SurfIterations == 0 );
+		Array1D< Real64 > SurfaceTemp( TotSurfaces ), NetLWRadToSurf( TotSurfaces, 0.0 );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) SurfaceTemp( SurfNum ) = 18.0 + 0.05 * ( SurfNum % 97 );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			HeatBalanceIntRadExchange::CalcInteriorRadExchange( SurfaceTemp, SurfIterations, NetLWRadToSurf );
+			sum += NetLWRadToSurf( 1 );
+		}
+		DataGlobals::BeginEnvrnFlag = false;
+		Benchmark::keep( sum );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		for ( int const n : Sizes ) {
+			std::string const size( "/" + std::to_string( n ) );
+			Benchmark::add( "HeatBalanceIntRadExchange/CalcInteriorRadExchange/ScriptF" + size, [ n ]( std::size_t const i ){ bench_calc_interior_rad_exchange( n, 0, i ); } );
+			Benchmark::add( "HeatBalanceIntRadExchange/CalcInteriorRadExchange" + size, [ n ]( std::size_t const i ){ bench_calc_interior_rad_exchange( n, 1, i ); } );
+		}
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
@@ -0,0 +1,176 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::InputProcessor Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/InputProcessor.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+using namespace EnergyPlus;
+
+namespace {
+
+	// Synthetic input sizes in MB: the largest is on the scale of generated district and parametric models
+	std::size_t const SizesMB[] = { 1, 16, 500 };
+
+	// IDF of about the given size: zones with a compact schedule and six detailed surfaces each, laid out
+	// with the field comments IDF Editor writes, so comment and whitespace handling is timed as well
+	std::string
+	synthetic_idf( std::size_t const bytes )
+	{
+		std::string idf(
+			"Version,8.6;\n\n"
+			"Building,\n"
+			"    Synthetic Building,      !- Name\n"
+			"    0.0,                     !- North Axis {deg}\n"
+			"    Suburbs,                 !- Terrain\n"
+			"    0.04,                    !- Loads Convergence Tolerance Value\n"
+			"    0.4,                     !- Temperature Convergence Tolerance Value {deltaC}\n"
+			"    FullExterior,            !- Solar Distribution\n"
+			"    25,                      !- Maximum Number of Warmup Days\n"
+			"    6;                       !- Minimum Number of Warmup Days\n\n"
+			"GlobalGeometryRules,\n"
+			"    UpperLeftCorner,         !- Starting Vertex Position\n"
+			"    Counterclockwise,        !- Vertex Entry Direction\n"
+			"    Relative;                !- Coordinate System\n\n"
+		);
+		idf.reserve( bytes + 4096 );
+		char object[ 1024 ];
+		for ( unsigned long zone = 1; idf.length() < bytes; ++zone ) {
+			std::snprintf( object, sizeof( object ),
+				"Zone,\n"
+				"    Zone %lu,                !- Name\n"
+				"    0,                       !- Direction of Relative North {deg}\n"
+				"    %lu.0,                   !- X Origin {m}\n"
+				"    0,                       !- Y Origin {m}\n"
+				"    0,                       !- Z Origin {m}\n"
+				"    1,                       !- Type\n"
+				"    1,                       !- Multiplier\n"
+				"    autocalculate,           !- Ceiling Height {m}\n"
+				"    autocalculate;           !- Volume {m3}\n\n", zone, 10ul * zone );
+			idf += object;
+			std::snprintf( object, sizeof( object ),
+				"Schedule:Compact,\n"
+				"    Zone %lu Occupancy,      !- Name\n"
+				"    Fraction,                !- Schedule Type Limits Name\n"
+				"    Through: 12/31,          !- Field 1\n"
+				"    For: Weekdays SummerDesignDay, !- Field 2\n"
+				"    Until: 08:00,0.0,        !- Field 3\n"
+				"    Until: 18:00,1.0,        !- Field 5\n"
+				"    Until: 24:00,0.0,        !- Field 7\n"
+				"    For: AllOtherDays,       !- Field 9\n"
+				"    Until: 24:00,0.0;        !- Field 10\n\n", zone );
+			idf += object;
+			for ( int surface = 1; surface <= 6; ++surface ) {
+				std::snprintf( object, sizeof( object ),
+					"BuildingSurface:Detailed,\n"
+					"    Zone %lu Surface %d,     !- Name\n"
+					"    Wall,                    !- Surface Type\n"
+					"    Exterior Wall,           !- Construction Name\n"
+					"    Zone %lu,                !- Zone Name\n"
+					"    Outdoors,                !- Outside Boundary Condition\n"
+					"    ,                        !- Outside Boundary Condition Object\n"
+					"    SunExposed,              !- Sun Exposure\n"
+					"    WindExposed,             !- Wind Exposure\n"
+					"    0.50000,                 !- View Factor to Ground\n"
+					"    4,                       !- Number of Vertices\n"
+					"    %d.0,0.0,3.0,            !- X,Y,Z ==> Vertex 1 {m}\n"
+					"    %d.0,0.0,0.0,            !- X,Y,Z ==> Vertex 2 {m}\n"
+					"    %d.5,10.0,0.0,           !- X,Y,Z ==> Vertex 3 {m}\n"
+					"    %d.5,10.0,3.0;           !- X,Y,Z ==> Vertex 4 {m}\n\n", zone, surface, zone, surface, surface, surface, surface );
+				idf += object;
+			}
+		}
+		return idf;
+	}
+
+	// Parse and validate a synthetic IDF into IDFRecords, as ProcessInput does for in.idf
+	void
+	bench_process_input_data_file( std::size_t const megabytes, std::size_t const iterations )
+	{
+		using namespace InputProcessor;
+		if ( ! Benchmark::load_idd() ) {
+			Benchmark::skip( "Energy+.idd could not be processed" );
+			return;
+		}
+
+		// Generated once per size and kept for the repeated runs: the text is not part of the timing
+		static std::size_t generated_megabytes( 0 );
+		static std::istringstream idf_stream;
+		if ( generated_megabytes != megabytes ) {
+			idf_stream.str( synthetic_idf( megabytes << 20 ) );
+			generated_megabytes = megabytes;
+		}
+
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			idf_stream.clear();
+			idf_stream.seekg( 0 );
+			for ( int i = 1; i <= NumObjectDefs; ++i ) ObjectDef( i ).NumFound = 0; // Or the unique objects are reported as repeated
+			ObjectStartRecord = 0;
+			NumLines = 0;
+			ProcessInputDataFile( idf_stream );
+		}
+		Benchmark::keep( NumIDFRecords );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		for ( std::size_t const megabytes : SizesMB ) {
+			Benchmark::add( "InputProcessor/ProcessInputDataFile/" + std::to_string( megabytes ) + "MB", [ megabytes ]( std::size_t const i ){ bench_process_input_data_file( megabytes, i ); } );
+		}
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
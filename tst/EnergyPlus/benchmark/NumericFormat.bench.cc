@@ -0,0 +1,190 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::NumericFormat Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/General.hh>
+#include <EnergyPlus/NumericFormat.hh>
+#include <EnergyPlus/OutputReportTabular.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// C++ Headers
+#include <string>
+#include <vector>
+
+using namespace EnergyPlus;
+using namespace ObjexxFCL;
+
+namespace {
+
+	// Values of the magnitudes the eio and tabular reports show: Temperatures, flows, loads and small fractions
+	std::vector< Real64 > const &
+	values()
+	{
+		static std::vector< Real64 > v;
+		if ( v.empty() ) {
+			for ( int i = 0; i < 1024; ++i ) {
+				v.push_back( -20.0 + 0.0731 * i ); // Temperatures
+				v.push_back( 0.00137 * ( i + 1 ) ); // Flows and fractions, E edited below 0.1
+				v.push_back( 1234.5678 * ( i + 1 ) ); // Loads
+			}
+		}
+		return v;
+	}
+
+	// The gio list-directed write the formatting used before
+	void
+	bench_list_directed_gio( std::size_t const iterations )
+	{
+		static gio::Fmt fmtLD( "*" );
+		std::vector< Real64 > const & v( values() );
+		std::size_t n( 0u );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			std::string String;
+			gio::write( String, fmtLD ) << v[ k % v.size() ];
+			n += String.length();
+		}
+		Benchmark::keep( n );
+	}
+
+	void
+	bench_list_directed( std::size_t const iterations )
+	{
+		std::vector< Real64 > const & v( values() );
+		char s[ NumericFormat::BufferSize ];
+		std::size_t n( 0u );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			n += NumericFormat::format_list_directed( v[ k % v.size() ], s );
+		}
+		Benchmark::keep( n );
+	}
+
+	// The gio F12.2 write RealToStr used before
+	void
+	bench_fixed_gio( std::size_t const iterations )
+	{
+		static gio::Fmt fmtF( "(F12.2)" );
+		std::vector< Real64 > const & v( values() );
+		std::size_t n( 0u );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			std::string String;
+			gio::write( String, fmtF ) << v[ k % v.size() ];
+			n += String.length();
+		}
+		Benchmark::keep( n );
+	}
+
+	void
+	bench_fixed( std::size_t const iterations )
+	{
+		std::vector< Real64 > const & v( values() );
+		char s[ NumericFormat::BufferSize ];
+		std::size_t n( 0u );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			n += NumericFormat::format_fixed( v[ k % v.size() ], 12, 2, s );
+		}
+		Benchmark::keep( n );
+	}
+
+	void
+	bench_shortest( std::size_t const iterations )
+	{
+		std::vector< Real64 > const & v( values() );
+		char s[ NumericFormat::BufferSize ];
+		std::size_t n( 0u );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			n += NumericFormat::format_shortest( v[ k % v.size() ], s );
+		}
+		Benchmark::keep( n );
+	}
+
+	void
+	bench_round_sig_digits( std::size_t const iterations )
+	{
+		std::vector< Real64 > const & v( values() );
+		std::size_t n( 0u );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			n += General::RoundSigDigits( v[ k % v.size() ], 2 ).length();
+		}
+		Benchmark::keep( n );
+	}
+
+	void
+	bench_trim_sig_digits( std::size_t const iterations )
+	{
+		std::vector< Real64 > const & v( values() );
+		std::size_t n( 0u );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			n += General::TrimSigDigits( v[ k % v.size() ], 3 ).length();
+		}
+		Benchmark::keep( n );
+	}
+
+	void
+	bench_real_to_str( std::size_t const iterations )
+	{
+		std::vector< Real64 > const & v( values() );
+		std::size_t n( 0u );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			n += OutputReportTabular::RealToStr( v[ k % v.size() ], 2 ).length();
+		}
+		Benchmark::keep( n );
+	}
+
+	Benchmark::Registration const list_directed_gio( "NumericFormat/ListDirected/gio", bench_list_directed_gio );
+	Benchmark::Registration const list_directed( "NumericFormat/ListDirected", bench_list_directed );
+	Benchmark::Registration const fixed_gio( "NumericFormat/Fixed/gio", bench_fixed_gio );
+	Benchmark::Registration const fixed( "NumericFormat/Fixed", bench_fixed );
+	Benchmark::Registration const shortest( "NumericFormat/Shortest", bench_shortest );
+	Benchmark::Registration const round_sig_digits( "General/RoundSigDigits", bench_round_sig_digits );
+	Benchmark::Registration const trim_sig_digits( "General/TrimSigDigits", bench_trim_sig_digits );
+	Benchmark::Registration const real_to_str( "OutputReportTabular/RealToStr", bench_real_to_str );
+
+}
@@ -0,0 +1,127 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::PierceSurface Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/PierceSurface.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Vector3.hh>
+
+// C++ Headers
+#include <cmath>
+#include <string>
+
+using namespace EnergyPlus;
+using DataVectorTypes::Vector;
+
+namespace {
+
+	int const NumRays( 256 ); // Rays from a grid of origins, about half of which miss the surface
+
+	enum class Case { Rectangle, Convex, Nonconvex };
+
+	// Floor surface at z = 0 spanning [0,1] x [0,1]: Rectangle, 16-gon, or 16-vertex star
+	DataSurfaces::SurfaceData
+	floor_surface( Case const shape )
+	{
+		DataSurfaces::SurfaceData floor;
+		if ( shape == Case::Rectangle ) {
+			floor.Vertex.dimension( 4 );
+			floor.Vertex = { Vector( 0, 0, 0 ), Vector( 1, 0, 0 ), Vector( 1, 1, 0 ), Vector( 0, 1, 0 ) };
+			floor.Shape = DataSurfaces::SurfaceShape::Rectangle;
+		} else {
+			int const n( 16 );
+			floor.Vertex.dimension( n );
+			for ( int i = 1; i <= n; ++i ) { // Counterclockwise from above
+				Real64 const t( 6.283185307179586 * ( i - 1 ) / n );
+				Real64 const r( shape == Case::Nonconvex && i % 2 == 0 ? 0.25 : 0.5 );
+				floor.Vertex( i ) = Vector( 0.5 + r * std::cos( t ), 0.5 + r * std::sin( t ), 0.0 );
+			}
+			floor.Shape = DataSurfaces::SurfaceShape::Polygonal;
+		}
+		floor.set_computed_geometry();
+		return floor;
+	}
+
+	void
+	bench_pierce_surface( Case const shape, std::size_t const iterations )
+	{
+		DataSurfaces::SurfaceData const floor( floor_surface( shape ) );
+		Vector const rayDir( 0.1, 0.05, -1.0 );
+		Vector hitPt( 0.0 );
+		int hits( 0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			int const ray( k % NumRays );
+			Vector const rayOri( -0.2 + 1.4 * ( ray % 16 ) / 15.0, -0.2 + 1.4 * ( ray / 16 ) / 15.0, 1.0 );
+			bool hit( false );
+			PierceSurface( floor, rayOri, rayDir, hitPt, hit );
+			if ( hit ) ++hits;
+		}
+		Benchmark::keep( hits );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		struct { char const * name; Case shape; } const cases[] = {
+			{ "Rectangle", Case::Rectangle },
+			{ "Convex", Case::Convex },
+			{ "Nonconvex", Case::Nonconvex }
+		};
+		for ( auto const & c : cases ) {
+			Case const shape( c.shape );
+			Benchmark::add( std::string( "PierceSurface/" ) + c.name, [ shape ]( std::size_t const i ){ bench_pierce_surface( shape, i ); } );
+		}
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
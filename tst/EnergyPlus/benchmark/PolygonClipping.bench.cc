@@ -0,0 +1,166 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::PolygonClipping Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/PolygonClipping.hh>
+#include <EnergyPlus/SolarShading.hh>
+
+// C++ Headers
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace EnergyPlus;
+
+namespace {
+
+	// Shadow polygon sizes: rectangles, clipped rectangles, and the larger figures overlaps produce
+	int const Sizes[] = { 4, 6, 8, 12, 16, 24 };
+	int const MaxSize( 24 );
+
+	// Clockwise regular polygon in homogeneous coordinate units (0.01 mm), as SolarShading orients its figures
+	void
+	polygon( int const n, Real64 const radius, Real64 const rotation, Real64 const x0, std::vector< Real64 > & x, std::vector< Real64 > & y )
+	{
+		x.resize( n );
+		y.resize( n );
+		for ( int i = 0; i < n; ++i ) {
+			Real64 const t( rotation - 6.283185307179586 * i / n );
+			x[ i ] = std::round( x0 + radius * std::cos( t ) );
+			y[ i ] = std::round( radius * std::sin( t ) );
+		}
+	}
+
+	void
+	bench_edge_values( int const n, bool const vectorized, std::size_t const iterations )
+	{
+		std::vector< Real64 > x, y, h( n );
+		polygon( n, 150000.0, 0.1, 0.0, x, y );
+		Real64 a( y[ 0 ] - y[ 1 ] ), b( x[ 1 ] - x[ 0 ] ), c( x[ 0 ] * y[ 1 ] - y[ 0 ] * x[ 1 ] );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			if ( vectorized ) {
+				PolygonClipping::edge_values( x.data(), y.data(), n, a, b, c, h.data() );
+			} else {
+				PolygonClipping::edge_values_scalar( x.data(), y.data(), n, a, b, c, h.data() );
+			}
+			c += h[ n - 1 ] > 0.0 ? -1.0 : 1.0; // Depend on the result
+		}
+		Benchmark::keep( c );
+	}
+
+	void
+	bench_edge_lines( int const n, bool const vectorized, std::size_t const iterations )
+	{
+		std::vector< Real64 > x, y, a( n ), b( n ), c( n );
+		polygon( n, 150000.0, 0.1, 0.0, x, y );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			if ( vectorized ) {
+				PolygonClipping::edge_lines( x.data(), y.data(), n, a.data(), b.data(), c.data() );
+			} else {
+				PolygonClipping::edge_lines_scalar( x.data(), y.data(), n, a.data(), b.data(), c.data() );
+			}
+			x[ 0 ] += c[ n - 1 ] > 0.0 ? -1.0 : 1.0; // Depend on the result
+		}
+		Benchmark::keep( x[ 0 ] );
+	}
+
+	// Sutherland-Hodgman overlap of two n-gons through the SolarShading HC arrays
+	void
+	bench_clippoly( int const n, std::size_t const iterations )
+	{
+		using namespace SolarShading;
+		DataSurfaces::MaxVerticesPerSurface = MaxSize;
+		MaxHCV = MaxSize;
+		MaxHCS = 2;
+		MAXHCArrayIncrement = MaxSize + 1;
+		AllocateShadowingScratch();
+
+		std::vector< Real64 > x, y;
+		polygon( n, 150000.0, 0.0, 0.0, x, y ); // Figure 1: Subject
+		for ( int i = 0; i < n; ++i ) {
+			XVS( i + 1 ) = x[ i ] / HCMULT;
+			YVS( i + 1 ) = y[ i ] / HCMULT;
+		}
+		HTRANS( 1, 1, n );
+		polygon( n, 120000.0, 0.3, 60000.0, x, y ); // Figure 2: Clipping, offset so it overlaps partially
+		for ( int i = 0; i < n; ++i ) {
+			XVS( i + 1 ) = x[ i ] / HCMULT;
+			YVS( i + 1 ) = y[ i ] / HCMULT;
+		}
+		HTRANS( 1, 2, n );
+
+		int total( 0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			int NV3( 0 );
+			OverlapStatus = PartialOverlap;
+			CLIPPOLY( 1, 2, n, n, NV3 );
+			total += NV3;
+		}
+		Benchmark::keep( total );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		for ( int const n : Sizes ) {
+			std::string const size( "/" + std::to_string( n ) );
+			std::string const simd( std::string( "/" ) + PolygonClipping::instruction_set() );
+			Benchmark::add( "PolygonClipping/edge_values" + simd + size, [ n ]( std::size_t const i ){ bench_edge_values( n, true, i ); } );
+			Benchmark::add( "PolygonClipping/edge_values/Scalar" + size, [ n ]( std::size_t const i ){ bench_edge_values( n, false, i ); } );
+			Benchmark::add( "PolygonClipping/edge_lines" + simd + size, [ n ]( std::size_t const i ){ bench_edge_lines( n, true, i ); } );
+			Benchmark::add( "PolygonClipping/edge_lines/Scalar" + size, [ n ]( std::size_t const i ){ bench_edge_lines( n, false, i ); } );
+			Benchmark::add( "SolarShading/CLIPPOLY" + size, [ n ]( std::size_t const i ){ bench_clippoly( n, i ); } );
+		}
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
@@ -0,0 +1,138 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::Psychrometrics Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/Psychrometrics.hh>
+
+// C++ Headers
+#include <vector>
+
+using namespace EnergyPlus;
+
+namespace {
+
+	// Sweep points: Each call sees a different state so cached results and branch history don't flatter the timing
+	int const NumPoints( 256 );
+
+	struct AirState
+	{
+		Real64 Tdb; // Dry-bulb temperature {C}
+		Real64 W; // Humidity ratio {kgWater/kgDryAir}
+		Real64 Pb; // Barometric pressure {Pa}
+	};
+
+	// Air states from cold dry to hot humid at pressures from high altitude to sea level: The first call initializes the psychrometrics
+	std::vector< AirState > const &
+	air_states()
+	{
+		static std::vector< AirState > states;
+		if ( states.empty() ) {
+			Psychrometrics::InitializePsychRoutines();
+			for ( int i = 0; i < NumPoints; ++i ) {
+				Real64 const Tdb( -20.0 + 65.0 * ( i % 16 ) / 15.0 );
+				Real64 const RH( 0.1 + 0.8 * ( ( i / 16 ) % 4 ) / 3.0 );
+				Real64 const Pb( 84000.0 + ( 101325.0 - 84000.0 ) * ( i / 64 ) / 3.0 );
+				states.push_back( { Tdb, Psychrometrics::PsyWFnTdbRhPb( Tdb, RH, Pb ), Pb } );
+			}
+		}
+		return states;
+	}
+
+	void
+	bench_twb_fn_tdb_w_pb( std::size_t const iterations )
+	{
+		std::vector< AirState > const & states( air_states() );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			AirState const & s( states[ k % NumPoints ] );
+			sum += Psychrometrics::PsyTwbFnTdbWPb( s.Tdb, s.W, s.Pb );
+		}
+		Benchmark::keep( sum );
+	}
+
+	void
+	bench_tsat_fn_pb( std::size_t const iterations )
+	{
+		std::vector< AirState > const & states( air_states() );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			sum += Psychrometrics::PsyTsatFnPb( states[ k % NumPoints ].Pb * ( 0.01 + 0.002 * ( k % 64 ) ) ); // 840 to 12900 Pa: Saturation pressures from -4 to 51 C
+		}
+		Benchmark::keep( sum );
+	}
+
+	void
+	bench_psat_fn_temp( std::size_t const iterations )
+	{
+		air_states(); // Initializes the psychrometric caches
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			sum += Psychrometrics::PsyPsatFnTemp( -40.0 + 100.0 * ( k % NumPoints ) / ( NumPoints - 1 ) );
+		}
+		Benchmark::keep( sum );
+	}
+
+	void
+	bench_rho_air_fn_pb_tdb_w( std::size_t const iterations )
+	{
+		std::vector< AirState > const & states( air_states() );
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			AirState const & s( states[ k % NumPoints ] );
+			sum += Psychrometrics::PsyRhoAirFnPbTdbW( s.Pb, s.Tdb, s.W );
+		}
+		Benchmark::keep( sum );
+	}
+
+	Benchmark::Registration const twb( "Psychrometrics/PsyTwbFnTdbWPb", bench_twb_fn_tdb_w_pb );
+	Benchmark::Registration const tsat( "Psychrometrics/PsyTsatFnPb", bench_tsat_fn_pb );
+	Benchmark::Registration const psat( "Psychrometrics/PsyPsatFnTemp", bench_psat_fn_temp );
+	Benchmark::Registration const rho( "Psychrometrics/PsyRhoAirFnPbTdbW", bench_rho_air_fn_pb_tdb_w );
+
+}
@@ -0,0 +1,224 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::SolarShading Micro-Benchmarks
+
+// EnergyPlus Headers
+#include "Benchmark.hh"
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/HeatBalanceManager.hh>
+#include <EnergyPlus/ScheduleManager.hh>
+#include <EnergyPlus/SimulationManager.hh>
+#include <EnergyPlus/SolarShading.hh>
+#include <EnergyPlus/SurfaceGeometry.hh>
+
+// C++ Headers
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+using namespace EnergyPlus;
+
+namespace {
+
+	int const ClipSizes[] = { 4, 8, 16 }; // Vertices of the clipped shadow casting figure
+	int const NumBuildings( 10 ); // Row of single zone buildings shading each other and shaded by a detached wall
+
+	// Clip a regular polygon tilted through the plane of the receiving surface so about half of it is below
+	void
+	bench_clip( int const n, std::size_t const iterations )
+	{
+		using namespace SolarShading;
+		DataSurfaces::MaxVerticesPerSurface = 24;
+		MaxHCV = 24;
+		MaxHCS = 2;
+		MAXHCArrayIncrement = 25;
+		AllocateShadowingScratch();
+
+		Array1D< Real64 > XVT( n + 1 ), YVT( n + 1 ), ZVT( n + 1 );
+		for ( int i = 1; i <= n; ++i ) {
+			Real64 const t( 6.283185307179586 * ( i - 1 ) / n + 0.1 );
+			XVT( i ) = 1.5 * std::cos( t );
+			YVT( i ) = 1.5 * std::sin( t );
+			ZVT( i ) = 0.2 + XVT( i ); // Tilted about the y axis
+		}
+		int total( 0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			CLIP( n, XVT, YVT, ZVT );
+			total += NVS;
+		}
+		Benchmark::keep( total );
+	}
+
+	// Row of box buildings with a south window and overhang each, and a detached wall to the south of the row
+	std::string
+	shading_idf()
+	{
+		std::string idf(
+			"Building,Shading Benchmark,0,Suburbs,0.04,0.4,FullExterior,25,6;\n"
+			"Timestep,6;\n"
+			"GlobalGeometryRules,UpperLeftCorner,Counterclockwise,Relative;\n"
+			"Material,Brick,Rough,0.1,1.2,2000,900,0.9,0.7,0.7;\n"
+			"Material,Concrete,MediumRough,0.1,1.7,2240,840,0.9,0.65,0.65;\n"
+			"WindowMaterial:SimpleGlazingSystem,Glazing,2.0,0.4,0.5;\n"
+			"Construction,Wall,Brick;\n"
+			"Construction,Slab,Concrete;\n"
+			"Construction,Window,Glazing;\n"
+			"Shading:Building:Detailed,Detached Wall,,4,0,-20,6,0,-20,0,"
+		);
+		char object[ 1024 ];
+		std::snprintf( object, sizeof( object ), "%d,-20,0,%d,-20,6;\n", 15 * NumBuildings, 15 * NumBuildings );
+		idf += object;
+		for ( int b = 1; b <= NumBuildings; ++b ) {
+			std::snprintf( object, sizeof( object ), "Zone,Zone %d,0,%d,0,0,1,1,,;\n", b, 15 * ( b - 1 ) );
+			idf += object;
+			struct { char const * name; char const * type; char const * construction; char const * vertices; } const surfaces[] = {
+				{ "North", "Wall", "Wall", "10,10,3,10,10,0,0,10,0,0,10,3" },
+				{ "East", "Wall", "Wall", "10,0,3,10,0,0,10,10,0,10,10,3" },
+				{ "South", "Wall", "Wall", "0,0,3,0,0,0,10,0,0,10,0,3" },
+				{ "West", "Wall", "Wall", "0,10,3,0,10,0,0,0,0,0,0,3" },
+				{ "Roof", "Roof", "Slab", "0,0,3,10,0,3,10,10,3,0,10,3" },
+				{ "Floor", "Floor", "Slab", "0,10,0,10,10,0,10,0,0,0,0,0" }
+			};
+			for ( auto const & s : surfaces ) {
+				std::snprintf( object, sizeof( object ), "BuildingSurface:Detailed,Zone %d %s,%s,%s,Zone %d,Outdoors,,SunExposed,WindExposed,0.5,4,%s;\n", b, s.name, s.type, s.construction, b, s.vertices );
+				idf += object;
+			}
+			std::snprintf( object, sizeof( object ), "FenestrationSurface:Detailed,Zone %d Window,Window,Window,Zone %d South,,0.5,,,1,4,2,0,2.5,2,0,0.5,8,0,0.5,8,0,2.5;\n", b, b );
+			idf += object;
+			std::snprintf( object, sizeof( object ), "Shading:Zone:Detailed,Zone %d Overhang,Zone %d South,,4,1.5,0,2.7,1.5,-1,2.7,8.5,-1,2.7,8.5,0,2.7;\n", b, b );
+			idf += object;
+		}
+		return idf;
+	}
+
+	// Surfaces and shadowing combinations of the shading model: false if the input could not be processed
+	bool
+	setup_shading()
+	{
+		static int set_up( 0 ); // 0: Not tried, 1: Set up, -1: Failed
+		if ( set_up != 0 ) return set_up > 0;
+		set_up = -1;
+		if ( ! Benchmark::process_idf( shading_idf() ) ) return false;
+
+		bool ErrorsFound( false );
+		SimulationManager::GetProjectData();
+		HeatBalanceManager::GetProjectControlData( ErrorsFound );
+		HeatBalanceManager::SetPreConstructionInputParameters();
+		ScheduleManager::ProcessScheduleInput();
+		HeatBalanceManager::GetMaterialData( ErrorsFound );
+		HeatBalanceManager::GetFrameAndDividerData( ErrorsFound );
+		HeatBalanceManager::GetConstructData( ErrorsFound );
+		HeatBalanceManager::GetZoneData( ErrorsFound );
+		SurfaceGeometry::GetGeometryParameters( ErrorsFound );
+		if ( ErrorsFound ) return false;
+
+		SurfaceGeometry::CosZoneRelNorth.allocate( DataGlobals::NumOfZones );
+		SurfaceGeometry::SinZoneRelNorth.allocate( DataGlobals::NumOfZones );
+		for ( int ZoneNum = 1; ZoneNum <= DataGlobals::NumOfZones; ++ZoneNum ) {
+			SurfaceGeometry::CosZoneRelNorth( ZoneNum ) = std::cos( -DataHeatBalance::Zone( ZoneNum ).RelNorth * DataGlobals::DegToRadians );
+			SurfaceGeometry::SinZoneRelNorth( ZoneNum ) = std::sin( -DataHeatBalance::Zone( ZoneNum ).RelNorth * DataGlobals::DegToRadians );
+		}
+		SurfaceGeometry::CosBldgRelNorth = 1.0;
+		SurfaceGeometry::SinBldgRelNorth = 0.0;
+		SurfaceGeometry::GetSurfaceData( ErrorsFound );
+		SurfaceGeometry::SetupZoneGeometry( ErrorsFound );
+		if ( ErrorsFound ) return false;
+
+		SolarShading::AllocateModuleArrays();
+		SolarShading::DetermineShadowingCombinations();
+		set_up = 1;
+		return true;
+	}
+
+	// Sun positions and shadows of every time step of a day near the summer solstice
+	void
+	bench_calc_per_solar_beam( std::size_t const iterations )
+	{
+		if ( ! setup_shading() ) {
+			Benchmark::skip( "shading surface input could not be processed" );
+			return;
+		}
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			SolarShading::CalcPerSolarBeam( 0.0, 0.3978, 0.9175 );
+		}
+		Benchmark::keep( DataHeatBalance::SunlitFrac( 1, 12, 1 ) );
+	}
+
+	// Shadows of one time step, over the daylight hours
+	void
+	bench_figure_solar_beam_at_timestep( std::size_t const iterations )
+	{
+		if ( ! setup_shading() ) {
+			Benchmark::skip( "shading surface input could not be processed" );
+			return;
+		}
+		SolarShading::CalcPerSolarBeam( 0.0, 0.3978, 0.9175 ); // Sun positions
+		Real64 sum( 0.0 );
+		for ( std::size_t k = 0; k < iterations; ++k ) {
+			int const iHour( 7 + k % 12 );
+			SolarShading::FigureSolarBeamAtTimestep( iHour, 1 );
+			sum += DataHeatBalance::SunlitFrac( 1, iHour, 1 );
+		}
+		Benchmark::keep( sum );
+	}
+
+	bool
+	register_benchmarks()
+	{
+		for ( int const n : ClipSizes ) {
+			Benchmark::add( "SolarShading/CLIP/" + std::to_string( n ), [ n ]( std::size_t const i ){ bench_clip( n, i ); } );
+		}
+		Benchmark::add( "SolarShading/CalcPerSolarBeam", bench_calc_per_solar_beam );
+		Benchmark::add( "SolarShading/FigureSolarBeamAtTimestep", bench_figure_solar_beam_at_timestep );
+		return true;
+	}
+
+	bool const registered( register_benchmarks() );
+
+}
@@ -46,6 +46,9 @@
 
 // EnergyPlus::AirflowNetworkSolver unit tests
 
+// C++ Headers
+#include <cmath>
+
 // Google test headers
 #include <gtest/gtest.h>
 
@@ -53,6 +56,7 @@
 #include <DataAirflowNetwork.hh>
 #include <AirflowNetworkBalanceManager.hh>
 #include <AirflowNetworkSolver.hh>
+#include <DataSystemVariables.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
 #include "Fixtures/EnergyPlusFixture.hh"
@@ -122,4 +126,113 @@ TEST_F( EnergyPlusFixture, AirflowNetworkSolverTest_HorizontalOpening )
 	AirflowNetworkCompData.deallocate();
 }
 
+TEST_F( EnergyPlusFixture, AirflowNetworkSolverTest_SparseMatchesSkyline )
+{
+	// A 10 x 10 grid of zones coupled by leaks, each zone also leaking to one external node
+	int const NumOfSide( 10 );
+	int const NumOfZones( NumOfSide * NumOfSide );
+	int const ExtNode( NumOfZones + 1 );
+	int const NumOfLinks( 2 * NumOfSide * ( NumOfSide - 1 ) + NumOfZones );
+	int ITER;
+	int i;
+	int j;
+	int k;
+	int n;
 
+	AirflowNetworkNumOfNodes = NumOfZones + 1;
+	AirflowNetworkNumOfLinks = NumOfLinks;
+	AirflowNetworkNumOfComps = 1;
+
+	AirflowNetworkCompData.allocate( 1 );
+	AirflowNetworkCompData( 1 ).CompTypeNum = CompTypeNum_PLR;
+	AirflowNetworkCompData( 1 ).TypeNum = 1;
+	DisSysCompLeakData.allocate( 1 );
+	DisSysCompLeakData( 1 ).FlowCoef = 0.01;
+	DisSysCompLeakData( 1 ).FlowExpo = 0.65;
+
+	AirflowNetworkNodeData.allocate( AirflowNetworkNumOfNodes );
+	AirflowNetworkNodeSimu.allocate( AirflowNetworkNumOfNodes );
+	for ( n = 1; n <= AirflowNetworkNumOfNodes; ++n ) {
+		AirflowNetworkNodeData( n ).NodeTypeNum = ( n == ExtNode ? 1 : 0 );
+		AirflowNetworkNodeData( n ).NodeHeight = 0.0;
+		AirflowNetworkNodeSimu( n ).TZ = 20.0;
+		AirflowNetworkNodeSimu( n ).WZ = 0.008;
+		AirflowNetworkNodeSimu( n ).PZ = 0.0;
+	}
+
+	AirflowNetworkLinkageData.allocate( NumOfLinks );
+	AirflowNetworkLinkSimu.allocate( NumOfLinks );
+	k = 0;
+	for ( i = 1; i <= NumOfSide; ++i ) {
+		for ( j = 1; j <= NumOfSide; ++j ) {
+			n = ( i - 1 ) * NumOfSide + j;
+			if ( j < NumOfSide ) {
+				++k;
+				AirflowNetworkLinkageData( k ).NodeNums( 1 ) = n;
+				AirflowNetworkLinkageData( k ).NodeNums( 2 ) = n + 1;
+			}
+			if ( i < NumOfSide ) {
+				++k;
+				AirflowNetworkLinkageData( k ).NodeNums( 1 ) = n;
+				AirflowNetworkLinkageData( k ).NodeNums( 2 ) = n + NumOfSide;
+			}
+			++k;
+			AirflowNetworkLinkageData( k ).NodeNums( 1 ) = ExtNode;
+			AirflowNetworkLinkageData( k ).NodeNums( 2 ) = n;
+		}
+	}
+	ASSERT_EQ( NumOfLinks, k );
+	for ( k = 1; k <= NumOfLinks; ++k ) {
+		AirflowNetworkLinkageData( k ).CompNum = 1;
+	}
+
+	AirflowNetworkSimu.InitFlag = 0;
+	AirflowNetworkSimu.MaxIteration = 500;
+	AirflowNetworkSimu.RelTol = 1.0e-6;
+	AirflowNetworkSimu.AbsTol = 1.0e-8;
+	AirflowNetworkSimu.ConvLimit = -0.5;
+	AirflowNetworkSimu.MaxPressure = 500.0;
+
+	DataSystemVariables::AFNSkylineSolver = false;
+	DataSystemVariables::AFNModifiedNewton = false;
+	AllocateAirflowNetworkData();
+	EXPECT_TRUE( PressureJacobian.initialized() );
+	EXPECT_FALSE( PressureJacobianMultiZone.initialized() );
+	EXPECT_EQ( AirflowNetworkNumOfNodes, PressureJacobian.size() );
+	// The external node is coupled to every zone and should not fill the factors
+	EXPECT_LT( PressureJacobian.factorNonZeros(), 4u * PressureJacobian.nonZeros() );
+
+	for ( n = 1; n <= NetworkNumOfNodes; ++n ) {
+		RHOZ( n ) = 1.2;
+		SQRTDZ( n ) = std::sqrt( RHOZ( n ) );
+		VISCZ( n ) = 1.71432e-5 + 4.828e-8 * 20.0;
+	}
+	for ( k = 1; k <= NetworkNumOfLinks; ++k ) {
+		PS( k ) = 0.0;
+		PW( k ) = ( AirflowNetworkLinkageData( k ).NodeNums( 1 ) == ExtNode ? 20.0 * std::sin( 0.7 * k ) : 0.0 );
+	}
+
+	// Sparse LU
+	AirflowNetworkSolver::PZ = 0.0;
+	SOLVZP( IK, AD, AU, ITER );
+	Array1D< Real64 > const PZSparse( AirflowNetworkSolver::PZ );
+
+	// Sparse LU with Jacobian reuse
+	DataSystemVariables::AFNModifiedNewton = true;
+	AirflowNetworkSolver::PZ = 0.0;
+	SOLVZP( IK, AD, AU, ITER );
+	Array1D< Real64 > const PZModified( AirflowNetworkSolver::PZ );
+	DataSystemVariables::AFNModifiedNewton = false;
+
+	// Skyline
+	DataSystemVariables::AFNSkylineSolver = true;
+	AirflowNetworkSolver::PZ = 0.0;
+	SOLVZP( IK, AD, AU, ITER );
+	DataSystemVariables::AFNSkylineSolver = false;
+
+	EXPECT_EQ( 0.0, AirflowNetworkSolver::PZ( ExtNode ) );
+	for ( n = 1; n <= NumOfZones; ++n ) {
+		EXPECT_NEAR( AirflowNetworkSolver::PZ( n ), PZSparse( n ), 1.0e-6 );
+		EXPECT_NEAR( AirflowNetworkSolver::PZ( n ), PZModified( n ), 1.0e-3 );
+	}
+}
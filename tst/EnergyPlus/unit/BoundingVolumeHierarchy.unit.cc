@@ -0,0 +1,159 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::BoundingVolumeHierarchy Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/BoundingVolumeHierarchy.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <vector>
+
+using namespace EnergyPlus;
+using Box = BoundingVolumeHierarchy::Box;
+using Vector = BoundingVolumeHierarchy::Vector;
+
+namespace {
+
+	// Boxes scattered over a building sized region with a simple linear congruential sequence
+	std::vector< Box >
+	scattered_boxes( int const n )
+	{
+		std::vector< Box > boxes;
+		unsigned int seed( 12345u );
+		auto next = [ & ]() -> Real64 {
+			seed = 1103515245u * seed + 12345u;
+			return Real64( ( seed >> 8 ) % 10000u ) / 100.0; // [0,100)
+		};
+		for ( int i = 0; i < n; ++i ) {
+			Vector const p( next(), next(), next() * 0.3 );
+			Box b;
+			b.include( p );
+			b.include( Vector( p.x + 0.05 * next(), p.y + 0.05 * next(), p.z + 0.05 * next() ) );
+			boxes.push_back( b );
+		}
+		return boxes;
+	}
+
+	bool
+	overlaps( Box const & a, Box const & b )
+	{
+		return ( a.l.x <= b.u.x ) && ( b.l.x <= a.u.x ) && ( a.l.y <= b.u.y ) && ( b.l.y <= a.u.y ) && ( a.l.z <= b.u.z ) && ( b.l.z <= a.u.z );
+	}
+
+}
+
+TEST( BoundingVolumeHierarchyTest, Empty )
+{
+	BoundingVolumeHierarchy tree;
+	tree.build( std::vector< Box >(), std::vector< int >() );
+	EXPECT_TRUE( tree.empty() );
+	EXPECT_EQ( 0u, tree.nodeCount() );
+	int visits( 0 );
+	tree.query( []( Box const & ){ return true; }, [ & ]( int ){ ++visits; } );
+	EXPECT_EQ( 0, visits );
+}
+
+TEST( BoundingVolumeHierarchyTest, QueryMatchesExhaustive )
+{
+	int const n( 500 );
+	std::vector< Box > const boxes( scattered_boxes( n ) );
+	std::vector< int > ids;
+	for ( int i = 1; i <= n; ++i ) ids.push_back( i );
+
+	BoundingVolumeHierarchy tree;
+	tree.build( boxes, ids );
+	EXPECT_EQ( size_t( n ), tree.size() );
+	EXPECT_GT( tree.nodeCount(), 1u );
+
+	std::vector< Box > const regions( scattered_boxes( 40 ) );
+	for ( Box region : regions ) {
+		region.include( Vector( region.u.x + 10.0, region.u.y + 10.0, region.u.z + 5.0 ) );
+		std::vector< int > found;
+		tree.query( [ & ]( Box const & b ){ return overlaps( b, region ); }, [ & ]( int const id ){ found.push_back( id ); } );
+		std::sort( found.begin(), found.end() );
+		std::vector< int > expected;
+		for ( int i = 0; i < n; ++i ) {
+			if ( overlaps( boxes[ i ], region ) ) expected.push_back( ids[ i ] );
+		}
+		EXPECT_EQ( expected, found );
+	}
+
+	// Half-space test like the receiving surface plane culling in SolarShading
+	std::vector< int > found;
+	tree.query( []( Box const & b ){ return b.u.z > 15.0; }, [ & ]( int const id ){ found.push_back( id ); } );
+	std::sort( found.begin(), found.end() );
+	std::vector< int > expected;
+	for ( int i = 0; i < n; ++i ) {
+		if ( boxes[ i ].u.z > 15.0 ) expected.push_back( ids[ i ] );
+	}
+	EXPECT_EQ( expected, found );
+}
+
+TEST( BoundingVolumeHierarchyTest, CoincidentBoxes )
+{
+	// All centers equal: the build must stop splitting and keep every item
+	std::vector< Box > boxes( 20 );
+	std::vector< int > ids;
+	for ( int i = 0; i < 20; ++i ) {
+		boxes[ i ].include( Vector( 0.0, 0.0, 0.0 ) );
+		boxes[ i ].include( Vector( 1.0, 1.0, 1.0 ) );
+		ids.push_back( 100 + i );
+	}
+	BoundingVolumeHierarchy tree;
+	tree.build( boxes, ids, 2 );
+	std::vector< int > found;
+	tree.query( []( Box const & ){ return true; }, [ & ]( int const id ){ found.push_back( id ); } );
+	std::sort( found.begin(), found.end() );
+	EXPECT_EQ( ids, found );
+
+	tree.clear();
+	EXPECT_TRUE( tree.empty() );
+}
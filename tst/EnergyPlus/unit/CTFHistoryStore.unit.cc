@@ -0,0 +1,207 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::CTFHistoryStore Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/CTFHistoryStore.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array3D.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataHeatBalSurface;
+using namespace EnergyPlus::DataSurfaces;
+using DataHeatBalance::Construct;
+
+namespace {
+
+	// Three walls sharing a three term construction on a two zone time step CTF time step and a resistive wall
+	void
+	setup_walls()
+	{
+		DataGlobals::TimeStepZone = 0.25;
+		TotSurfaces = 4;
+		Surface.allocate( TotSurfaces );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			Surface( SurfNum ).HeatTransSurf = true;
+			Surface( SurfNum ).Class = SurfaceClass_Wall;
+			Surface( SurfNum ).HeatTransferAlgorithm = HeatTransferModel_CTF;
+			Surface( SurfNum ).Construction = ( SurfNum == 3 ? 2 : 1 );
+		}
+		Construct.allocate( 2 );
+		Construct( 1 ).NumCTFTerms = 3;
+		Construct( 1 ).NumHistories = 2;
+		Construct( 1 ).CTFTimeStep = 0.5;
+		Construct( 2 ).NumCTFTerms = 1;
+		Construct( 2 ).NumHistories = 1;
+		Construct( 2 ).CTFTimeStep = 0.25;
+		Construct( 1 ).CTFOutside.dimension( {0,3}, 0.0 );
+		Construct( 1 ).CTFCross.dimension( {0,3}, 0.0 );
+		Construct( 1 ).CTFInside.dimension( {0,3}, 0.0 );
+		Construct( 1 ).CTFFlux.dimension( {0,3}, 0.0 );
+		for ( int Term = 0; Term <= 3; ++Term ) {
+			Construct( 1 ).CTFOutside( Term ) = 1.1 - 0.3 * Term;
+			Construct( 1 ).CTFCross( Term ) = 0.2 + 0.05 * Term;
+			Construct( 1 ).CTFInside( Term ) = 1.3 - 0.35 * Term;
+			Construct( 1 ).CTFFlux( Term ) = 0.4 / ( Term + 1 );
+		}
+		TH.dimension( 2, 4, TotSurfaces, 0.0 );
+		QH.dimension( 2, 4, TotSurfaces, 0.0 );
+		THM.dimension( 2, 4, TotSurfaces, 0.0 );
+		QHM.dimension( 2, 4, TotSurfaces, 0.0 );
+		SUMH.dimension( TotSurfaces, 0 );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			for ( int HistTermNum = 1; HistTermNum <= 4; ++HistTermNum ) {
+				THM( 1, HistTermNum, SurfNum ) = TH( 1, HistTermNum, SurfNum ) = 10.0 + HistTermNum + 0.1 * SurfNum;
+				THM( 2, HistTermNum, SurfNum ) = TH( 2, HistTermNum, SurfNum ) = 20.0 - HistTermNum + 0.2 * SurfNum;
+				QHM( 1, HistTermNum, SurfNum ) = QH( 1, HistTermNum, SurfNum ) = 5.0 * HistTermNum - SurfNum;
+				QHM( 2, HistTermNum, SurfNum ) = QH( 2, HistTermNum, SurfNum ) = 3.0 * SurfNum - HistTermNum;
+			}
+		}
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, CTFHistoryStore_PacksByConstruction )
+{
+	setup_walls();
+	CTFHistoryStore store;
+	EXPECT_FALSE( store.built() );
+	store.build();
+	EXPECT_TRUE( store.built() );
+	ASSERT_EQ( 1u, store.groups().size() );
+	EXPECT_EQ( 3u, store.groups()[ 0 ].Surfaces.size() );
+	EXPECT_TRUE( store.packed( 1 ) );
+	EXPECT_TRUE( store.packed( 2 ) );
+	EXPECT_FALSE( store.packed( 3 ) ); // Resistance only construction
+	EXPECT_TRUE( store.packed( 4 ) );
+	EXPECT_FALSE( store.stale() );
+	Surface( 2 ).Construction = 2;
+	EXPECT_TRUE( store.stale() );
+	store.clear();
+	EXPECT_FALSE( store.built() );
+	EXPECT_FALSE( store.packed( 1 ) );
+}
+
+TEST_F( EnergyPlusFixture, CTFHistoryStore_MatchesSurfaceHistories )
+{
+	setup_walls();
+	CTFHistoryStore store;
+	store.build();
+
+	// Reference: the surface by surface sums and history updates
+	Array3D< Real64 > rTH( TH ), rQH( QH ), rTHM( THM ), rQHM( QHM );
+	Array1D_int rSUMH( SUMH );
+	auto const & construct( Construct( 1 ) );
+	Array1D< Real64 > OutPart( TotSurfaces, 0.0 ), InPart( TotSurfaces, 0.0 );
+	Array1D< Real64 > TempExt1( TotSurfaces ), TempInt1( TotSurfaces ), QExt1( TotSurfaces ), QInt1( TotSurfaces );
+	for ( int Step = 1; Step <= 7; ++Step ) {
+		store.sumConstParts( OutPart, InPart );
+		for ( int SurfNum : { 1, 2, 4 } ) {
+			Real64 QIC( 0.0 ), QOC( 0.0 );
+			for ( int Term = 1; Term <= construct.NumCTFTerms; ++Term ) {
+				QIC += construct.CTFCross( Term ) * rTH( 1, Term + 1, SurfNum ) - construct.CTFInside( Term ) * rTH( 2, Term + 1, SurfNum ) + construct.CTFFlux( Term ) * rQH( 2, Term + 1, SurfNum );
+				QOC += construct.CTFOutside( Term ) * rTH( 1, Term + 1, SurfNum ) - construct.CTFCross( Term ) * rTH( 2, Term + 1, SurfNum ) + construct.CTFFlux( Term ) * rQH( 1, Term + 1, SurfNum );
+			}
+			EXPECT_EQ( QOC, OutPart( SurfNum ) );
+			EXPECT_EQ( QIC, InPart( SurfNum ) );
+		}
+
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			TempExt1( SurfNum ) = 12.0 + Step * 0.7 - SurfNum;
+			TempInt1( SurfNum ) = 21.0 - Step * 0.3 + SurfNum;
+			QExt1( SurfNum ) = 2.0 * Step - SurfNum;
+			QInt1( SurfNum ) = Step + 0.5 * SurfNum;
+		}
+		store.updateHistories( TempExt1, TempInt1, QExt1, QInt1 );
+		for ( int SurfNum : { 1, 2, 4 } ) {
+			int const n( construct.NumCTFTerms );
+			if ( ++rSUMH( SurfNum ) == construct.NumHistories ) {
+				rSUMH( SurfNum ) = 0;
+				for ( int Side = 1; Side <= 2; ++Side ) {
+					for ( int HistTermNum = n + 1; HistTermNum >= 3; --HistTermNum ) {
+						rTH( Side, HistTermNum, SurfNum ) = rTHM( Side, HistTermNum, SurfNum ) = rTHM( Side, HistTermNum - 1, SurfNum );
+						rQH( Side, HistTermNum, SurfNum ) = rQHM( Side, HistTermNum, SurfNum ) = rQHM( Side, HistTermNum - 1, SurfNum );
+					}
+				}
+				rTH( 1, 2, SurfNum ) = rTHM( 1, 2, SurfNum ) = TempExt1( SurfNum );
+				rTH( 2, 2, SurfNum ) = rTHM( 2, 2, SurfNum ) = TempInt1( SurfNum );
+				rQH( 1, 2, SurfNum ) = rQHM( 1, 2, SurfNum ) = QExt1( SurfNum );
+				rQH( 2, 2, SurfNum ) = rQHM( 2, 2, SurfNum ) = QInt1( SurfNum );
+			} else {
+				Real64 const sum_steps( ( double( rSUMH( SurfNum ) ) * DataGlobals::TimeStepZone ) / construct.CTFTimeStep );
+				for ( int Side = 1; Side <= 2; ++Side ) {
+					for ( int HistTermNum = n + 1; HistTermNum >= 3; --HistTermNum ) {
+						rTH( Side, HistTermNum, SurfNum ) = rTHM( Side, HistTermNum, SurfNum ) - ( rTHM( Side, HistTermNum, SurfNum ) - rTHM( Side, HistTermNum - 1, SurfNum ) ) * sum_steps;
+						rQH( Side, HistTermNum, SurfNum ) = rQHM( Side, HistTermNum, SurfNum ) - ( rQHM( Side, HistTermNum, SurfNum ) - rQHM( Side, HistTermNum - 1, SurfNum ) ) * sum_steps;
+					}
+				}
+				rTH( 1, 2, SurfNum ) = rTHM( 1, 2, SurfNum ) - ( rTHM( 1, 2, SurfNum ) - TempExt1( SurfNum ) ) * sum_steps;
+				rTH( 2, 2, SurfNum ) = rTHM( 2, 2, SurfNum ) - ( rTHM( 2, 2, SurfNum ) - TempInt1( SurfNum ) ) * sum_steps;
+				rQH( 1, 2, SurfNum ) = rQHM( 1, 2, SurfNum ) - ( rQHM( 1, 2, SurfNum ) - QExt1( SurfNum ) ) * sum_steps;
+				rQH( 2, 2, SurfNum ) = rQHM( 2, 2, SurfNum ) - ( rQHM( 2, 2, SurfNum ) - QInt1( SurfNum ) ) * sum_steps;
+			}
+			EXPECT_EQ( rTH( 1, 2, SurfNum ), TH( 1, 2, SurfNum ) ); // Most recent term is kept current
+			EXPECT_EQ( rQH( 2, 2, SurfNum ), QH( 2, 2, SurfNum ) );
+		}
+		EXPECT_TRUE( eq( rSUMH, SUMH ) );
+	}
+
+	store.unpack();
+	EXPECT_TRUE( eq( rTH, TH ) );
+	EXPECT_TRUE( eq( rQH, QH ) );
+	EXPECT_TRUE( eq( rTHM, THM ) );
+	EXPECT_TRUE( eq( rQHM, QHM ) );
+}
@@ -0,0 +1,346 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::ColumnarOutput Unit Tests
+
+// C++ Headers
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/ColumnarOutput.hh>
+#include <EnergyPlus/ColumnarOutputFormat.hh>
+#include <EnergyPlus/ColumnarOutputReader.hh>
+#include <EnergyPlus/FileSystem.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ColumnarOutput;
+using namespace EnergyPlus::ColumnarOutputFormat;
+
+namespace {
+
+	// Time step temperature of a row
+	double
+	temperature(
+		int const day,
+		int const hour,
+		int const timeStep
+	)
+	{
+		return day * 1000.0 + hour * 10.0 + timeStep + 0.25;
+	}
+
+	// Write a design day and a run period long enough to need several chunks
+	void
+	write_file(
+		std::string const & FileName,
+		bool const Compress
+	)
+	{
+		ASSERT_TRUE( OpenColumnarFile( FileName, Compress ) );
+		AddVariable( 7, IntervalTimeStep, KindVariable, 1, false, 1, "Zone", "ZONE ONE", "Zone Mean Air Temperature", "C", "" );
+		AddVariable( 8, IntervalTimeStep, KindVariable, 2, false, 2, "HVAC", "COIL", "Coil Energy", "J", "ON SCHEDULE" );
+		AddVariable( 9, IntervalDaily, KindMeter, 2, true, 1, "Facility:Electricity", "", "Electricity:Facility", "J", "" );
+
+		BeginEnvironment( "DENVER SUMMER", 39.74, -105.18, -7.0, 1829.0 );
+		for ( int day = 1; day <= 3; ++day ) {
+			for ( int hour = 1; hour <= 24; ++hour ) {
+				for ( int timeStep = 1; timeStep <= 4; ++timeStep ) {
+					AddTimeStamp( IntervalTimeStep, day, 7, 20 + day, hour, timeStep * 15.0, ( timeStep - 1 ) * 15.0, 0, "SummerDesignDay", false );
+					AddValue( 7, temperature( day, hour, timeStep ) );
+					if ( timeStep == 4 ) AddValue( 8, hour * 100.0 ); // Not in every row
+				}
+			}
+			AddTimeStamp( IntervalDaily, day, 7, 20 + day, 0, 0.0, 0.0, 0, "SummerDesignDay", false );
+			AddValue( 9, day * 1.0e6, day * 10.0, 7210100 + day * 10000, day * 20.0, 7211500 + day * 10000 );
+		}
+
+		BeginEnvironment( "DENVER ANNUAL", 39.74, -105.18, -7.0, 1829.0 );
+		for ( int day = 1; day <= 45; ++day ) {
+			for ( int hour = 1; hour <= 24; ++hour ) {
+				for ( int timeStep = 1; timeStep <= 4; ++timeStep ) {
+					AddTimeStamp( IntervalTimeStep, day, 1 + ( day - 1 ) / 31, 1 + ( day - 1 ) % 31, hour, timeStep * 15.0, ( timeStep - 1 ) * 15.0, 0, day % 7 == 0 ? "Sunday" : "Monday", false );
+					AddValue( 7, temperature( day, hour, timeStep ) );
+				}
+			}
+		}
+		CloseColumnarFile();
+		EXPECT_FALSE( Active );
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, ColumnarOutput_Dictionary )
+{
+	std::string const FileName( "ColumnarOutputDictionary.col" );
+	write_file( FileName, true );
+
+	ColumnarOutputReader reader( FileName );
+	ASSERT_TRUE( reader.is_open() ) << reader.error();
+	EXPECT_TRUE( reader.compressed() );
+
+	ASSERT_EQ( 3u, reader.variables().size() );
+	ColumnarOutputReader::Variable const * coil( reader.variable( 8 ) );
+	ASSERT_NE( nullptr, coil );
+	EXPECT_EQ( "COIL", coil->Key );
+	EXPECT_EQ( "Coil Energy", coil->Name );
+	EXPECT_EQ( "J", coil->Units );
+	EXPECT_EQ( "ON SCHEDULE", coil->Schedule );
+	EXPECT_EQ( 2, coil->StoreType );
+	EXPECT_EQ( 2, coil->IndexType );
+	ColumnarOutputReader::Variable const * meter( reader.variable( 9 ) );
+	ASSERT_NE( nullptr, meter );
+	EXPECT_EQ( KindMeter, meter->Kind );
+	EXPECT_EQ( IntervalDaily, meter->Interval );
+	EXPECT_TRUE( meter->MeterFileOnly );
+	EXPECT_EQ( nullptr, reader.variable( 10 ) );
+	EXPECT_EQ( std::vector< int >( { 7 } ), reader.find( "ZONE ONE", "Zone Mean Air Temperature" ) );
+	EXPECT_EQ( std::vector< int >( { 9 } ), reader.find( "", "Electricity:Facility" ) );
+
+	ASSERT_EQ( 2u, reader.environments().size() );
+	EXPECT_EQ( "DENVER SUMMER", reader.environments()[ 0 ].Title );
+	EXPECT_EQ( "DENVER ANNUAL", reader.environments()[ 1 ].Title );
+	EXPECT_DOUBLE_EQ( -105.18, reader.environments()[ 1 ].Longitude );
+	EXPECT_EQ( std::vector< std::string >( { "SummerDesignDay", "Monday", "Sunday" } ), reader.day_types() );
+
+	// One chunk for the design day, the run period's 4320 rows split in two
+	ASSERT_EQ( 3u, reader.chunks().size() );
+	EXPECT_EQ( 291u, reader.chunks()[ 0 ].Rows );
+	EXPECT_EQ( ChunkRows, reader.chunks()[ 1 ].Rows );
+	EXPECT_EQ( 4320u - ChunkRows, reader.chunks()[ 2 ].Rows );
+	EXPECT_EQ( 2u, reader.chunks()[ 2 ].Environment );
+
+	FileSystem::removeFile( FileName );
+}
+
+TEST_F( EnergyPlusFixture, ColumnarOutput_ReadSeries )
+{
+	std::string const FileName( "ColumnarOutputReadSeries.col" );
+	write_file( FileName, true );
+
+	ColumnarOutputReader reader( FileName );
+	ASSERT_TRUE( reader.is_open() ) << reader.error();
+	ColumnarOutputReader::Series series;
+
+	// Every value of the run period, across the chunks
+	ASSERT_TRUE( reader.read( 7, series, 2u ) ) << reader.error();
+	ASSERT_EQ( 4320u, series.Values.size() );
+	for ( std::size_t i = 0; i < series.Values.size(); ++i ) {
+		int const day( int( i / 96 ) + 1 );
+		int const hour( int( i / 4 ) % 24 + 1 );
+		int const timeStep( int( i % 4 ) + 1 );
+		ASSERT_EQ( temperature( day, hour, timeStep ), series.Values[ i ] );
+		ASSERT_EQ( day, series.Times[ i ].DayOfSim );
+		ASSERT_EQ( hour, series.Times[ i ].Hour );
+		ASSERT_EQ( timeStep * 15.0, series.Times[ i ].EndMinute );
+	}
+	EXPECT_TRUE( series.MinValues.empty() );
+
+	// Both environments
+	ASSERT_TRUE( reader.read( 7, series ) );
+	EXPECT_EQ( 288u + 4320u, series.Values.size() );
+	EXPECT_EQ( 1u, series.Environments.front() );
+	EXPECT_EQ( 2u, series.Environments.back() );
+
+	// Time range: the end of day 1 through day 2 of the design day
+	ASSERT_TRUE( reader.read( 7, series, 1u, 1440.0, 2880.0 ) );
+	ASSERT_EQ( 97u, series.Values.size() );
+	EXPECT_EQ( temperature( 1, 24, 4 ), series.Values.front() );
+	EXPECT_EQ( temperature( 2, 24, 4 ), series.Values.back() );
+
+	// A column without a value in every row
+	ASSERT_TRUE( reader.read( 8, series, 1u ) );
+	ASSERT_EQ( 72u, series.Values.size() );
+	EXPECT_EQ( 100.0, series.Values[ 0 ] );
+	EXPECT_EQ( 60.0, series.Times[ 0 ].EndMinute );
+	EXPECT_EQ( 2400.0, series.Values[ 71 ] );
+	EXPECT_EQ( 3, series.Times[ 71 ].DayOfSim );
+	ASSERT_TRUE( reader.read( 8, series, 2u ) );
+	EXPECT_TRUE( series.Values.empty() );
+
+	// Minimum and maximum with their dates
+	ASSERT_TRUE( reader.read( 9, series ) );
+	ASSERT_EQ( 3u, series.Values.size() );
+	ASSERT_EQ( 3u, series.MaxDates.size() );
+	EXPECT_EQ( 2.0e6, series.Values[ 1 ] );
+	EXPECT_EQ( 20.0, series.MinValues[ 1 ] );
+	EXPECT_EQ( 7230100, series.MinDates[ 1 ] );
+	EXPECT_EQ( 40.0, series.MaxValues[ 1 ] );
+	EXPECT_EQ( 7231500, series.MaxDates[ 1 ] );
+	EXPECT_EQ( IntervalDaily, series.Times[ 1 ].Interval );
+	EXPECT_EQ( 22, series.Times[ 1 ].DayOfMonth );
+	EXPECT_EQ( "SummerDesignDay", reader.day_types()[ series.Times[ 1 ].DayType - 1 ] );
+
+	FileSystem::removeFile( FileName );
+}
+
+TEST_F( EnergyPlusFixture, ColumnarOutput_Uncompressed )
+{
+	std::string const FileName( "ColumnarOutputUncompressed.col" );
+	write_file( FileName, false );
+
+	ColumnarOutputReader reader( FileName );
+	ASSERT_TRUE( reader.is_open() ) << reader.error();
+	EXPECT_FALSE( reader.compressed() );
+	ColumnarOutputReader::Series series;
+	ASSERT_TRUE( reader.read( 7, series, 2u, 44.0 * 1440.0 + 1.0 ) ); // The last day
+	ASSERT_EQ( 96u, series.Values.size() );
+	EXPECT_EQ( temperature( 45, 1, 1 ), series.Values.front() );
+
+	FileSystem::removeFile( FileName );
+}
+
+TEST_F( EnergyPlusFixture, ColumnarOutput_WriteCSV )
+{
+	std::string const FileName( "ColumnarOutputWriteCSV.col" );
+	write_file( FileName, true );
+
+	ColumnarOutputReader reader( FileName );
+	ASSERT_TRUE( reader.is_open() ) << reader.error();
+	std::ostringstream csv;
+	ASSERT_TRUE( reader.write_csv( csv, std::vector< int >( { 7, 8, 9 } ), 1u ) ) << reader.error();
+
+	std::istringstream lines( csv.str() );
+	std::string line;
+	std::getline( lines, line );
+	EXPECT_EQ( "Date/Time,ZONE ONE:Zone Mean Air Temperature [C](TimeStep),COIL:Coil Energy [J](TimeStep),Electricity:Facility [J](Daily)", line );
+	std::getline( lines, line );
+	EXPECT_EQ( " 07/21  00:15:00,1011.25,,", line );
+	for ( int i = 0; i < 95; ++i ) std::getline( lines, line );
+	EXPECT_EQ( " 07/21  24:00:00,1244.25,2400,1000000", line ); // The day ends with the last time step
+	int count( 97 );
+	while ( std::getline( lines, line ) ) ++count;
+	EXPECT_EQ( 1 + 288, count );
+
+	EXPECT_FALSE( reader.write_csv( csv, std::vector< int >( { 10 } ) ) );
+
+	FileSystem::removeFile( FileName );
+}
+
+TEST_F( EnergyPlusFixture, ColumnarOutput_Incomplete )
+{
+	std::string const FileName( "ColumnarOutputIncomplete.col" );
+	ASSERT_TRUE( OpenColumnarFile( FileName, true ) );
+	AddVariable( 7, IntervalHourly, KindVariable, 1, false, 1, "Zone", "ZONE ONE", "Zone Mean Air Temperature", "C", "" );
+	AddValue( 7, 1.0 ); // Before any time stamp: dropped
+	AddTimeStamp( IntervalHourly, 1, 1, 1, 1, 0.0, 0.0, 0, "Monday", false );
+	AddValue( 7, 21.0 );
+
+	ColumnarOutputReader reader;
+	EXPECT_FALSE( reader.open( FileName ) ); // Not closed yet: no index
+	EXPECT_FALSE( reader.is_open() );
+	EXPECT_NE( std::string::npos, reader.error().find( "did not close it" ) ) << reader.error();
+
+	CloseColumnarFile();
+	ASSERT_TRUE( reader.open( FileName ) ) << reader.error();
+	ColumnarOutputReader::Series series;
+	ASSERT_TRUE( reader.read( 7, series ) );
+	ASSERT_EQ( 1u, series.Values.size() );
+	EXPECT_EQ( 21.0, series.Values[ 0 ] );
+	EXPECT_EQ( 0u, series.Environments[ 0 ] ); // Before the first environment stamp
+	reader.close();
+
+	EXPECT_FALSE( reader.open( "ColumnarOutputMissing.col" ) );
+	EXPECT_FALSE( reader.is_open() );
+	EXPECT_FALSE( reader.error().empty() );
+
+	FileSystem::removeFile( FileName );
+}
+
+TEST_F( EnergyPlusFixture, ColumnarOutput_DamagedCounts )
+{
+	std::string const FileName( "ColumnarOutputDamaged.col" );
+	ASSERT_TRUE( OpenColumnarFile( FileName, true ) );
+	AddVariable( 7, IntervalHourly, KindVariable, 1, false, 1, "Zone", "ZONE ONE", "Zone Mean Air Temperature", "C", "" );
+	AddTimeStamp( IntervalHourly, 1, 1, 1, 1, 0.0, 0.0, 0, "Monday", false );
+	AddValue( 7, 21.0 );
+	CloseColumnarFile();
+
+	// Day type count of the dictionary far beyond the bytes that follow it
+	std::string bytes;
+	{
+		std::ifstream in( FileName, std::ios::binary );
+		bytes.assign( std::istreambuf_iterator< char >( in ), std::istreambuf_iterator< char >() );
+	}
+	ASSERT_GT( bytes.size(), HeaderSize + TrailerSize );
+	Cursor trailer( bytes.data() + bytes.size() - TrailerSize, bytes.data() + bytes.size() );
+	std::size_t const dictionaryOffset( trailer.u64() );
+	std::size_t const indexOffset( trailer.u64() );
+	ASSERT_LT( dictionaryOffset + 8u, bytes.size() );
+	std::string damaged( bytes );
+	damaged.replace( dictionaryOffset + 4u, 4u, 4u, '\xff' );
+	{
+		std::ofstream out( FileName, std::ios::binary );
+		out.write( damaged.data(), damaged.size() );
+	}
+
+	ColumnarOutputReader reader;
+	EXPECT_FALSE( reader.open( FileName ) );
+	EXPECT_FALSE( reader.is_open() );
+	EXPECT_NE( std::string::npos, reader.error().find( "damaged dictionary" ) ) << reader.error();
+
+	// Row count of the first chunk far beyond ChunkRows: magic, chunk count, offset, stored size and flags precede it
+	std::size_t const rowsOffset( indexOffset + 4u + 4u + 8u + 4u + 1u );
+	ASSERT_LT( rowsOffset + 4u, bytes.size() - TrailerSize );
+	damaged = bytes;
+	damaged.replace( rowsOffset, 4u, 4u, '\xff' );
+	{
+		std::ofstream out( FileName, std::ios::binary );
+		out.write( damaged.data(), damaged.size() );
+	}
+
+	EXPECT_FALSE( reader.open( FileName ) );
+	EXPECT_FALSE( reader.is_open() );
+	EXPECT_NE( std::string::npos, reader.error().find( "damaged index" ) ) << reader.error();
+
+	FileSystem::removeFile( FileName );
+}
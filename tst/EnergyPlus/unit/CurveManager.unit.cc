@@ -989,3 +989,67 @@ TEST_F( EnergyPlusFixture, Tables_OneIndependentVariable_Linear_EvaluateCurveTyp
 
 		EXPECT_FALSE( has_err_output() );
 }
+
+TEST_F( EnergyPlusFixture, CurveManager_EvaluatorMatchesPerformanceCurveObject ) {
+
+	std::string const idf_objects = delimited_string( {
+		"Version,8.5;",
+		"Curve:Linear,Linear,0.5,0.02,0.0,40.0,,;",
+		"Curve:Quadratic,Quadratic,0.8,0.2,-0.05,0.0,1.5,0.85,0.95;",
+		"Curve:Cubic,Cubic,0.2,1.2,-0.8,0.35,0.0,1.0,,;",
+		"Curve:Exponent,Exponent,0.0,1.0,1.3,0.0,2.0,,;",
+		"Curve:ExponentialDecay,ExponentialDecay,0.1,0.9,-0.8,0.0,5.0,,;",
+		"Curve:RectangularHyperbola1,RectangularHyperbola1,1.2,0.4,0.05,0.0,3.0,,;",
+		"Curve:Biquadratic,Biquadratic,0.94,0.009,0.00034,-0.0068,-0.00004,-0.00029,12.8,23.9,18.0,46.1,,;",
+		"Curve:Bicubic,Bicubic,0.86,0.022,0.0002,-0.0056,0.00002,-0.0003,0.000001,-0.0000005,0.000002,-0.000001,12.8,23.9,18.0,46.1,0.8,;",
+		"Curve:QuadraticLinear,QuadraticLinear,0.4,0.015,-0.0001,0.011,0.0002,0.000003,12.8,23.9,18.0,46.1,,;",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+	CurveManager::GetCurveInput();
+	CurveManager::GetCurvesInputFlag = false;
+	ASSERT_EQ( 9, CurveManager::NumCurves );
+
+	// Every curve here has a specialized evaluator, and it must reproduce the general routine exactly
+	int const NumPoints( 101 );
+	Array1D< Real64 > X( NumPoints ), Y( NumPoints ), Result( NumPoints );
+	for ( std::string const Name : { "LINEAR", "QUADRATIC", "CUBIC", "EXPONENT", "EXPONENTIALDECAY", "RECTANGULARHYPERBOLA1", "BIQUADRATIC", "BICUBIC", "QUADRATICLINEAR" } ) {
+		int const CurveIndex( CurveManager::GetCurveIndex( Name ) );
+		ASSERT_GT( CurveIndex, 0 );
+		ASSERT_TRUE( CurveManager::PerfCurve( CurveIndex ).Evaluator != nullptr );
+		Real64 xMin, xMax, yMin, yMax;
+		CurveManager::GetCurveMinMaxValues( CurveIndex, xMin, xMax, yMin, yMax );
+		bool const TwoVariables( Name == "BIQUADRATIC" || Name == "BICUBIC" || Name == "QUADRATICLINEAR" );
+		for ( int i = 1; i <= NumPoints; ++i ) { // Includes points beyond the limits at both ends
+			X( i ) = xMin - 0.1 * ( xMax - xMin ) + 1.2 * ( xMax - xMin ) * ( i - 1 ) / ( NumPoints - 1 );
+			Y( i ) = yMax + 0.1 * ( yMax - yMin ) - 1.2 * ( yMax - yMin ) * ( i - 1 ) / ( NumPoints - 1 );
+			if ( TwoVariables ) {
+				EXPECT_EQ( CurveManager::PerformanceCurveObject( CurveIndex, X( i ), Y( i ) ), CurveManager::CurveValue( CurveIndex, X( i ), Y( i ) ) );
+			} else {
+				EXPECT_EQ( CurveManager::PerformanceCurveObject( CurveIndex, X( i ) ), CurveManager::CurveValue( CurveIndex, X( i ) ) );
+			}
+		}
+
+		// Batch evaluation gives the same values and leaves the report variables as the last call would
+		if ( TwoVariables ) {
+			CurveManager::CurveValueBatch( CurveIndex, X, Y, Result );
+		} else {
+			CurveManager::CurveValueBatch( CurveIndex, X, Result );
+		}
+		for ( int i = 1; i <= NumPoints; ++i ) {
+			EXPECT_EQ( CurveManager::PerformanceCurveObject( CurveIndex, X( i ), Y( i ) ), Result( i ) );
+		}
+		EXPECT_EQ( Result( NumPoints ), CurveManager::PerfCurve( CurveIndex ).CurveOutput );
+		EXPECT_EQ( X( NumPoints ), CurveManager::PerfCurve( CurveIndex ).CurveInput1 );
+	}
+
+	// EMS override applies to every point of a batch
+	int const CurveIndex( CurveManager::GetCurveIndex( "QUADRATIC" ) );
+	CurveManager::PerfCurve( CurveIndex ).EMSOverrideOn = true;
+	CurveManager::PerfCurve( CurveIndex ).EMSOverrideCurveValue = 0.5;
+	CurveManager::CurveValueBatch( CurveIndex, X, Result );
+	for ( int i = 1; i <= NumPoints; ++i ) {
+		EXPECT_EQ( 0.5, Result( i ) );
+	}
+
+}
@@ -0,0 +1,154 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::DataTimings Unit Tests
+
+// C++ Headers
+#include <sstream>
+#include <string>
+#include <thread>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataTimings.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataTimings;
+
+namespace {
+
+	void
+	ProfiledInner()
+	{
+		EP_PROFILE_ZONE( "ProfileTest Inner" );
+	}
+
+	void
+	ProfiledOuter( int const NumInner )
+	{
+		EP_PROFILE_ZONE( "ProfileTest Outer" );
+		for ( int i = 0; i < NumInner; ++i ) ProfiledInner();
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, DataTimings_ProfileDisabled )
+{
+	ProfilingEnabled = false;
+	ProfiledOuter( 3 );
+
+	std::ostringstream Tree;
+	WriteProfileTree( Tree );
+	EXPECT_EQ( "", Tree.str() );
+
+	std::ostringstream Trace;
+	WriteProfileTrace( Trace );
+	EXPECT_EQ( std::string::npos, Trace.str().find( "ProfileTest" ) );
+}
+
+TEST_F( EnergyPlusFixture, DataTimings_ProfileTree )
+{
+	ProfilingEnabled = true;
+	ProfiledOuter( 3 );
+	ProfiledOuter( 2 );
+	ProfiledInner();
+	ProfilingEnabled = false;
+
+	EXPECT_EQ( "ProfileTest Inner", ProfileZoneName( ProfileZoneID( "ProfileTest Inner" ) ) );
+
+	std::ostringstream Tree;
+	WriteProfileTree( Tree );
+	std::string const Report( Tree.str() );
+
+	EXPECT_EQ( 0u, Report.find( "Thread 0\nZone,Calls,Inclusive Time {s},Exclusive Time {s},Inclusive Time {% of thread}\n" ) );
+	// The outer zone was entered twice at the top level, enclosing five calls of the inner zone
+	EXPECT_NE( std::string::npos, Report.find( "\nProfileTest Outer,2," ) );
+	EXPECT_NE( std::string::npos, Report.find( "\n  ProfileTest Inner,5," ) );
+	// The inner zone entered on its own is a separate node of the tree
+	EXPECT_NE( std::string::npos, Report.find( "\nProfileTest Inner,1," ) );
+}
+
+TEST_F( EnergyPlusFixture, DataTimings_ProfileTrace )
+{
+	ProfilingEnabled = true;
+	ProfiledOuter( 1 );
+	std::thread Worker( [](){ ProfiledInner(); } );
+	Worker.join();
+	{
+		ProfileZone const Zone( ProfileZoneID( "ProfileTest \"Quoted\"" ) );
+	}
+	ProfilingEnabled = false;
+
+	std::ostringstream Trace;
+	WriteProfileTrace( Trace );
+	std::string const Json( Trace.str() );
+
+	EXPECT_EQ( 0u, Json.find( "{\"traceEvents\":[\n{\"name\":\"ProfileTest Inner\",\"ph\":\"X\",\"ts\":" ) );
+	EXPECT_NE( std::string::npos, Json.find( "{\"name\":\"ProfileTest Outer\",\"ph\":\"X\"," ) );
+	EXPECT_NE( std::string::npos, Json.find( "{\"name\":\"ProfileTest \\\"Quoted\\\"\"," ) );
+	EXPECT_NE( std::string::npos, Json.find( ",\"pid\":1,\"tid\":1}" ) ); // The worker thread
+	EXPECT_NE( std::string::npos, Json.find( "\"truncated\":false}}" ) );
+
+	// Only the first events of each thread are kept for the trace
+	clear_state();
+	MaxTraceEvents = 2;
+	ProfilingEnabled = true;
+	ProfiledOuter( 3 );
+	ProfilingEnabled = false;
+
+	std::ostringstream Truncated;
+	WriteProfileTrace( Truncated );
+	EXPECT_EQ( std::string::npos, Truncated.str().find( "ProfileTest Outer" ) );
+	EXPECT_NE( std::string::npos, Truncated.str().find( "\"truncated\":true}}" ) );
+
+	std::ostringstream Tree;
+	WriteProfileTree( Tree );
+	EXPECT_NE( std::string::npos, Tree.str().find( "\n  ProfileTest Inner,3," ) );
+}
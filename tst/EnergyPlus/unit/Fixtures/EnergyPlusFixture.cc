@@ -55,6 +55,7 @@
 #include "../TestHelpers/IdfParser.hh"
 // A to Z order
 #include <EnergyPlus/AirflowNetworkBalanceManager.hh>
+#include <EnergyPlus/AirflowNetworkSolver.hh>
 #include <EnergyPlus/BaseboardElectric.hh>
 #include <EnergyPlus/BaseboardRadiator.hh>
 #include <EnergyPlus/Boilers.hh>
@@ -65,6 +66,7 @@
 #include <EnergyPlus/ChillerExhaustAbsorption.hh>
 #include <EnergyPlus/ChillerGasAbsorption.hh>
 #include <EnergyPlus/ChillerIndirectAbsorption.hh>
+#include <EnergyPlus/ColumnarOutput.hh>
 #include <EnergyPlus/CondenserLoopTowers.hh>
 #include <EnergyPlus/CoolTower.hh>
 #include <EnergyPlus/CrossVentMgr.hh>
@@ -98,6 +100,7 @@
 #include <EnergyPlus/DataSurfaceLists.hh>
 #include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/DataTimings.hh>
 #include <EnergyPlus/DataUCSDSharedData.hh>
 #include <EnergyPlus/DataZoneControls.hh>
 #include <EnergyPlus/DataZoneEnergyDemands.hh>
@@ -165,10 +168,13 @@
 #include <EnergyPlus/ReturnAirPathManager.hh>
 #include <EnergyPlus/RoomAirModelAirflowNetwork.hh>
 #include <EnergyPlus/RoomAirModelManager.hh>
+#include <EnergyPlus/RunPeriodSegments.hh>
 #include <EnergyPlus/RuntimeLanguageProcessor.hh>
 #include <EnergyPlus/ScheduleManager.hh>
 #include <EnergyPlus/SetPointManager.hh>
+#include <EnergyPlus/ShadingCache.hh>
 #include <EnergyPlus/SimAirServingZones.hh>
+#include <EnergyPlus/SimulationCheckpoint.hh>
 #include <EnergyPlus/SimulationManager.hh>
 #include <EnergyPlus/SingleDuct.hh>
 #include <EnergyPlus/SizingManager.hh>
@@ -261,6 +267,7 @@ namespace EnergyPlus {
 	{
 		// A to Z order
 		AirflowNetworkBalanceManager::clear_state();
+		AirflowNetworkSolver::clear_state();
 		BaseboardElectric::clear_state();
 		BaseboardRadiator::clear_state();
 		Boilers::clear_state();
@@ -270,6 +277,7 @@ namespace EnergyPlus {
 		ChillerExhaustAbsorption::clear_state();
 		ChillerGasAbsorption::clear_state();
 		ChillerIndirectAbsorption::clear_state();
+		ColumnarOutput::clear_state();
 		CondenserLoopTowers::clear_state();
 		CoolTower::clear_state();
 		CrossVentMgr::clear_state();
@@ -301,6 +309,7 @@ namespace EnergyPlus {
 		DataSizing::clear_state();
 		DataSurfaceLists::clear_state();
 		DataSurfaces::clear_state();
+		DataTimings::clear_state();
 		DataUCSDSharedData::clear_state();
 		DataZoneControls::clear_state();
 		DataZoneEnergyDemands::clear_state();
@@ -368,10 +377,13 @@ namespace EnergyPlus {
 		ReturnAirPathManager::clear_state();
 		RoomAirModelAirflowNetwork::clear_state();
 		RoomAirModelManager::clear_state();
+		RunPeriodSegments::clear_state();
 		RuntimeLanguageProcessor::clear_state();
 		ScheduleManager::clear_state();
 		SetPointManager::clear_state();
+		ShadingCache::clear_state();
 		SimAirServingZones::clear_state();
+		SimulationCheckpoint::clear_state();
 		SimulationManager::clear_state();
 		SingleDuct::clear_state();
 		SizingManager::clear_state();
@@ -50,10 +50,12 @@
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataPlant.hh>
 #include <EnergyPlus/FluidProperties.hh>
 
 #include <cmath>
 #include <ctgmath>
+#include <vector>
 
 #include "Fixtures/EnergyPlusFixture.hh"
 
@@ -95,3 +97,209 @@ TEST_F( EnergyPlusFixture, FluidProperties_GetDensityGlycol)
 }
 
 
+
+TEST_F( EnergyPlusFixture, FluidProperties_UniformGridMatchesExact )
+{
+
+	std::string const idf_objects = delimited_string({
+		" Version,8.4;",
+		" ",
+		"FluidProperties:Settings,",
+		"  UniformGrid,      !- Property Evaluation Method",
+		"  1.0E-5;           !- Uniform Grid Tolerance",
+		" ",
+		"FluidProperties:GlycolConcentration,",
+		"  GLHXFluid,       !- Name",
+		"  PropyleneGlycol, !- Glycol Type",
+		"  ,                !- User Defined Glycol Name",
+		"  0.3;             !- Glycol Concentration",
+		" "
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	int GlycolIndex = 0;
+	int RefrigIndex = 0;
+	GetDensityGlycol( "GLHXFLUID", 20.0, GlycolIndex, "UnitTest" );
+	GetSatPressureRefrig( "STEAM", 100.0, RefrigIndex, "UnitTest" );
+	EXPECT_FALSE( has_err_output() );
+	EXPECT_EQ( PropertyMethodUniformGrid, PropertyMethod );
+
+	auto & glycol( GlycolData( GlycolIndex ) );
+	auto & refrig( RefrigData( RefrigIndex ) );
+	EXPECT_TRUE( glycol.CpGrid.Active );
+	EXPECT_TRUE( glycol.RhoGrid.Active );
+	EXPECT_TRUE( glycol.CondGrid.Active );
+	EXPECT_TRUE( glycol.ViscGrid.Active );
+	EXPECT_TRUE( refrig.PsGrid.Active );
+	EXPECT_TRUE( refrig.HfGrid.Active );
+	EXPECT_TRUE( refrig.SHTempIndex.Active );
+	EXPECT_TRUE( refrig.SHPressIndex.Active );
+	EXPECT_LE( glycol.RhoGrid.MaxDeviation, 1.0E-5 );
+
+	// values on the grids, then the same values interpolated in the supplied tables
+	std::vector< Real64 > Grid;
+	std::vector< Real64 > Exact;
+	auto Evaluate = [&]( std::vector< Real64 > & Values ) {
+		for ( Real64 T = -30.0; T <= 120.0; T += 0.37 ) {
+			Values.push_back( GetSpecificHeatGlycol( "GLHXFLUID", T, GlycolIndex, "UnitTest" ) );
+			Values.push_back( GetDensityGlycol( "GLHXFLUID", T, GlycolIndex, "UnitTest" ) );
+			Values.push_back( GetConductivityGlycol( "GLHXFLUID", T, GlycolIndex, "UnitTest" ) );
+			Values.push_back( GetViscosityGlycol( "GLHXFLUID", T, GlycolIndex, "UnitTest" ) );
+		}
+		for ( Real64 T = 1.0; T <= 350.0; T += 1.3 ) {
+			Values.push_back( GetSatPressureRefrig( "STEAM", T, RefrigIndex, "UnitTest" ) );
+			Values.push_back( GetSatEnthalpyRefrig( "STEAM", T, 0.4, RefrigIndex, "UnitTest" ) );
+			Values.push_back( GetSatDensityRefrig( "STEAM", T, 0.4, RefrigIndex, "UnitTest" ) );
+			Values.push_back( GetSatSpecificHeatRefrig( "STEAM", T, 0.4, RefrigIndex, "UnitTest" ) );
+			Values.push_back( GetSupHeatEnthalpyRefrig( "STEAM", T + 20.0, 101325.0, RefrigIndex, "UnitTest" ) );
+			Values.push_back( GetSupHeatDensityRefrig( "STEAM", T + 20.0, 101325.0, RefrigIndex, "UnitTest" ) );
+		}
+		for ( Real64 P = 1000.0; P <= 1.0e7; P *= 1.17 ) {
+			Values.push_back( GetSatTemperatureRefrig( "STEAM", P, RefrigIndex, "UnitTest" ) );
+		}
+	};
+	Evaluate( Grid );
+
+	glycol.CpGrid.Active = glycol.RhoGrid.Active = glycol.CondGrid.Active = glycol.ViscGrid.Active = false;
+	refrig.PsGrid.Active = refrig.HfGrid.Active = refrig.CpfGrid.Active = refrig.VfGrid.Active = false;
+	refrig.PsPresIndex.Active = refrig.SHTempIndex.Active = refrig.SHPressIndex.Active = false;
+	Evaluate( Exact );
+
+	ASSERT_EQ( Exact.size(), Grid.size() );
+	for ( std::size_t i = 0; i < Exact.size(); ++i ) {
+		EXPECT_NEAR( Exact[ i ], Grid[ i ], 2.0E-5 * std::abs( Exact[ i ] ) + 1.0E-9 );
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, FluidProperties_UniformGridIndexedMatchesExact )
+{
+
+	std::string const idf_objects = delimited_string({
+		" Version,8.4;",
+		" ",
+		"FluidProperties:Settings,",
+		"  UniformGrid;      !- Property Evaluation Method",
+		" ",
+		"FluidProperties:GlycolConcentration,",
+		"  GLHXFluid,       !- Name",
+		"  PropyleneGlycol, !- Glycol Type",
+		"  ,                !- User Defined Glycol Name",
+		"  0.3;             !- Glycol Concentration",
+		" "
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	int GlycolIndex = 0;
+	int RefrigIndex = 0;
+	GetDensityGlycol( "GLHXFLUID", 20.0, GlycolIndex, "UnitTest" );
+	GetSatPressureRefrig( "STEAM", 100.0, RefrigIndex, "UnitTest" );
+	EXPECT_FALSE( has_err_output() );
+
+	// no resampled table can meet a negative tolerance, so every table keeps its supplied points
+	UniformGridTolerance = -1.0;
+	InitializeUniformGrids();
+
+	auto & glycol( GlycolData( GlycolIndex ) );
+	auto & refrig( RefrigData( RefrigIndex ) );
+	EXPECT_TRUE( glycol.CpGrid.Active );
+	EXPECT_FALSE( glycol.CpGrid.Resampled );
+	EXPECT_TRUE( glycol.RhoGrid.Active );
+	EXPECT_FALSE( glycol.RhoGrid.Resampled );
+	EXPECT_TRUE( glycol.CondGrid.Active );
+	EXPECT_FALSE( glycol.CondGrid.Resampled );
+	EXPECT_TRUE( glycol.ViscGrid.Active );
+	EXPECT_FALSE( glycol.ViscGrid.Resampled );
+	EXPECT_TRUE( refrig.PsGrid.Active );
+	EXPECT_FALSE( refrig.PsGrid.Resampled );
+
+	// values from the indexed tables, then the same values from the supplied tables; steps of 0.25 C include the supplied points
+	std::vector< Real64 > Indexed;
+	std::vector< Real64 > Exact;
+	auto Evaluate = [&]( std::vector< Real64 > & Values ) {
+		for ( Real64 T = -30.0; T <= 120.0; T += 0.25 ) {
+			Values.push_back( GetSpecificHeatGlycol( "GLHXFLUID", T, GlycolIndex, "UnitTest" ) );
+			Values.push_back( GetDensityGlycol( "GLHXFLUID", T, GlycolIndex, "UnitTest" ) );
+			Values.push_back( GetConductivityGlycol( "GLHXFLUID", T, GlycolIndex, "UnitTest" ) );
+			Values.push_back( GetViscosityGlycol( "GLHXFLUID", T, GlycolIndex, "UnitTest" ) );
+		}
+		for ( Real64 T = 1.0; T <= 350.0; T += 0.25 ) {
+			Values.push_back( GetSatPressureRefrig( "STEAM", T, RefrigIndex, "UnitTest" ) );
+		}
+	};
+	Evaluate( Indexed );
+
+	glycol.CpGrid.Active = glycol.RhoGrid.Active = glycol.CondGrid.Active = glycol.ViscGrid.Active = false;
+	refrig.PsGrid.Active = false;
+	Evaluate( Exact );
+
+	ASSERT_EQ( Exact.size(), Indexed.size() );
+	for ( std::size_t i = 0; i < Exact.size(); ++i ) {
+		EXPECT_EQ( Exact[ i ], Indexed[ i ] );
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, FluidProperties_FindArrayIndexUniform )
+{
+
+	Array1D< Real64 > Array( { 0.5, 0.6, 2.0, 2.05, 7.5, 30.0, 31.0, 90.0 } );
+	FluidPropsUniformIndex Index;
+	SetupUniformIndex( Index, Array, 2, 7 );
+	EXPECT_TRUE( Index.Active );
+
+	for ( Real64 Value = 0.0; Value <= 95.0; Value += 0.01 ) {
+		EXPECT_EQ( FindArrayIndex( Value, Array, 2, 7 ), FindArrayIndex( Value, Array, 2, 7, Index ) );
+	}
+	for ( int Loop = 1; Loop <= 8; ++Loop ) {
+		EXPECT_EQ( FindArrayIndex( Array( Loop ), Array, 2, 7 ), FindArrayIndex( Array( Loop ), Array, 2, 7, Index ) );
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, FluidProperties_GlycolHandle )
+{
+
+	std::string const idf_objects = delimited_string( {
+		" Version,8.4;",
+		" ",
+		"FluidProperties:GlycolConcentration,",
+		"  GLHXFluid,       !- Name",
+		"  PropyleneGlycol, !- Glycol Type",
+		"  ,                !- User Defined Glycol Name",
+		"  0.3;             !- Glycol Concentration",
+		" "
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	GlycolHandle Handle( GlycolHandle::resolve( "GLHXFLUID" ) );
+	ASSERT_TRUE( Handle.resolved() );
+	EXPECT_FALSE( GlycolHandle::resolve( "NOT A GLYCOL" ).resolved() );
+
+	// Same results as the named routines, inside and outside the supplied data range
+	int FluidIndex = 0;
+	for ( Real64 Temperature = -40.0; Temperature <= 130.0; Temperature += 0.25 ) {
+		EXPECT_DOUBLE_EQ( GetSpecificHeatGlycol( "GLHXFLUID", Temperature, FluidIndex, "UnitTest" ), Handle.cp( Temperature, "UnitTest" ) );
+		EXPECT_DOUBLE_EQ( GetDensityGlycol( "GLHXFLUID", Temperature, FluidIndex, "UnitTest" ), Handle.rho( Temperature, "UnitTest" ) );
+		EXPECT_DOUBLE_EQ( GetConductivityGlycol( "GLHXFLUID", Temperature, FluidIndex, "UnitTest" ), Handle.k( Temperature, "UnitTest" ) );
+		EXPECT_DOUBLE_EQ( GetViscosityGlycol( "GLHXFLUID", Temperature, FluidIndex, "UnitTest" ), Handle.mu( Temperature, "UnitTest" ) );
+	}
+	EXPECT_EQ( FluidIndex, Handle.Index );
+
+	// Range warnings are still counted against the glycol
+	int const LowErrCount( GlycolErrorTracking( Handle.Index ).SpecHeatLowErrCount );
+	Handle.cp( -100.0, "UnitTest" );
+	EXPECT_EQ( LowErrCount + 1, GlycolErrorTracking( Handle.Index ).SpecHeatLowErrCount );
+
+	// Plant loop resolves and keeps its fluid index, and the handle carries the fluid name
+	DataPlant::PlantLoopData Loop;
+	Loop.FluidName = "GLHXFLUID";
+	EXPECT_EQ( Handle.Index, Loop.glycol().Index );
+	EXPECT_EQ( Handle.Index, Loop.FluidIndex );
+	EXPECT_EQ( "GLHXFLUID", Loop.glycol().Name );
+	EXPECT_DOUBLE_EQ( Handle.rho( 20.0, "UnitTest" ), Loop.glycol().rho( 20.0, "UnitTest" ) );
+
+}
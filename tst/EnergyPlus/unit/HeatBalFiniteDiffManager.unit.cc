@@ -51,8 +51,13 @@
 
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
 #include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataMoistureBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/HeatBalFiniteDiffManager.hh>
 
 using namespace EnergyPlus::HeatBalFiniteDiffManager;
@@ -181,4 +186,110 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, HeatBalFiniteDiffManager_SolveTridiagonal )
+	{
+		// 2 x1 - x2 = 0, -x(i-1) + 2 x(i) - x(i+1) = 0, -x4 + 2 x5 = 6 has the solution x(i) = i
+		int const n( 5 );
+		Array1D< Real64 > Lower( n, -1.0 );
+		Array1D< Real64 > Diag( n, 2.0 );
+		Array1D< Real64 > Upper( n, -1.0 );
+		Array1D< Real64 > RHS( n, 0.0 );
+		Array1D< Real64 > X( n, 0.0 );
+		Lower( 1 ) = Upper( n ) = 0.0;
+		RHS( n ) = 6.0;
+		SolveTridiagonal( Lower, Diag, Upper, RHS, X );
+		for ( int i = 1; i <= n; ++i ) {
+			EXPECT_NEAR( double( i ), X( i ), 1.0e-12 );
+		}
+	}
+
+	TEST_F( EnergyPlusFixture, HeatBalFiniteDiffManager_DirectSolveMatchesGaussSeidel )
+	{
+		// Two layer exterior wall with constant properties: the direct solve of the node equations
+		// should give the temperatures the Gauss-Seidel iteration converges to, within the
+		// Gauss-Seidel convergence criterion
+		int const SurfNum( 1 );
+		int const NodesPerLayer( 5 );
+		int const TotNodes( 2 * NodesPerLayer );
+		DataGlobals::TimeStepZoneSec = 600.0;
+
+		DataSurfaces::TotSurfaces = 1;
+		DataSurfaces::Surface.allocate( 1 );
+		auto & surface( DataSurfaces::Surface( SurfNum ) );
+		surface.Construction = 1;
+		surface.Zone = 1;
+		surface.Area = 10.0;
+		surface.ExtBoundCond = DataSurfaces::ExternalEnvironment;
+		surface.HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_CondFD;
+
+		DataHeatBalance::Material.allocate( 2 );
+		MaterialFD.allocate( 2 );
+		for ( int MatNum = 1; MatNum <= 2; ++MatNum ) {
+			auto & mat( DataHeatBalance::Material( MatNum ) );
+			mat.Group = DataHeatBalance::RegularMaterial;
+			mat.Thickness = 0.1;
+			mat.Conductivity = ( MatNum == 1 ) ? 1.3 : 0.05;
+			mat.Density = ( MatNum == 1 ) ? 2000.0 : 40.0;
+			mat.SpecHeat = ( MatNum == 1 ) ? 900.0 : 1400.0;
+			MaterialFD( MatNum ).TempEnth.dimension( 2, 3, -100.0 ); // not a phase change material
+			MaterialFD( MatNum ).TempCond.dimension( 2, 3, -100.0 ); // constant conductivity
+		}
+
+		DataHeatBalance::Construct.allocate( 1 );
+		DataHeatBalance::Construct( 1 ).TotLayers = 2;
+		DataHeatBalance::Construct( 1 ).LayerPoint.dimension( 2, 0 );
+		DataHeatBalance::Construct( 1 ).LayerPoint( 1 ) = 1;
+		DataHeatBalance::Construct( 1 ).LayerPoint( 2 ) = 2;
+		ConstructFD.allocate( 1 );
+		ConstructFD( 1 ).TotNodes = TotNodes;
+		ConstructFD( 1 ).DeltaTime = 600;
+		ConstructFD( 1 ).NodeNumPoint.dimension( 2, NodesPerLayer );
+		ConstructFD( 1 ).DelX.dimension( 2, 0.1 / NodesPerLayer );
+
+		SurfaceFD.allocate( 1 );
+		auto & surfaceFD( SurfaceFD( SurfNum ) );
+		for ( auto * a : { &surfaceFD.T, &surfaceFD.TOld, &surfaceFD.TT, &surfaceFD.Rhov, &surfaceFD.RhovOld, &surfaceFD.RhoT, &surfaceFD.TD, &surfaceFD.TDT, &surfaceFD.TDTLast, &surfaceFD.TDOld, &surfaceFD.TDreport, &surfaceFD.RH, &surfaceFD.RHreport, &surfaceFD.EnthOld, &surfaceFD.EnthNew, &surfaceFD.EnthLast, &surfaceFD.QDreport, &surfaceFD.CpDelXRhoS1, &surfaceFD.CpDelXRhoS2, &surfaceFD.TDpriortimestep, &surfaceFD.NodeLower, &surfaceFD.NodeDiag, &surfaceFD.NodeUpper, &surfaceFD.NodeRHS } ) {
+			a->dimension( TotNodes + 1, 0.0 );
+		}
+
+		// Cold outside, warm inside
+		DataMoistureBalance::TempOutsideAirFD.dimension( 1, -5.0 );
+		DataMoistureBalance::RhoVaporAirOut.dimension( 1, 0.0 );
+		DataMoistureBalance::HConvExtFD.dimension( 1, 20.0 );
+		DataMoistureBalance::HAirFD.dimension( 1, 2.0 );
+		DataMoistureBalance::HSkyFD.dimension( 1, 1.5 );
+		DataMoistureBalance::HGrndFD.dimension( 1, 1.0 );
+		DataMoistureBalance::HConvInFD.dimension( 1, 3.0 );
+		DataMoistureBalance::RhoVaporSurfIn.dimension( 1, 0.0 );
+		DataEnvironment::SkyTemp = -15.0;
+		DataHeatBalFanSys::MAT.dimension( 1, 21.0 );
+		for ( auto * a : { &DataHeatBalSurface::QRadSWOutAbs, &DataHeatBalSurface::QRadSWOutMvIns, &DataHeatBalSurface::NetLWRadToSurf, &DataHeatBalSurface::QRadSWInAbs, &DataHeatBalance::QRadThermInAbs, &DataHeatBalFanSys::QHTRadSysSurf, &DataHeatBalFanSys::QHWBaseboardSurf, &DataHeatBalFanSys::QSteamBaseboardSurf, &DataHeatBalFanSys::QElecBaseboardSurf, &DataHeatBalFanSys::QCoolingPanelSurf, &DataHeatBalSurface::OpaqSurfInsFaceConductionFlux, &DataHeatBalSurface::OpaqSurfInsFaceConduction, &DataHeatBalSurface::OpaqSurfOutsideFaceConductionFlux, &DataHeatBalSurface::OpaqSurfOutsideFaceConduction, &DataHeatBalSurface::QdotRadOutRepPerArea, &DataHeatBalSurface::QdotRadOutRep, &DataHeatBalSurface::QRadOutReport } ) {
+			a->dimension( 1, 0.0 );
+		}
+		DataHeatBalSurface::QRadSWOutAbs( SurfNum ) = 150.0;
+
+		Array1D< Real64 > TDTGaussSeidel;
+		for ( int const SolutionType : { GaussSeidelIteration, TridiagonalDirect } ) {
+			CondFDSolutionType = SolutionType;
+			for ( auto * a : { &surfaceFD.TD, &surfaceFD.TDT, &surfaceFD.TDreport, &surfaceFD.TDpriortimestep } ) {
+				*a = 15.0;
+			}
+			Real64 TempSurfIn( 0.0 );
+			Real64 TempSurfOut( 0.0 );
+			for ( int Step = 1; Step <= 3; ++Step ) {
+				surfaceFD.TD = surfaceFD.TDT;
+				CalcHeatBalFiniteDiff( SurfNum, TempSurfIn, TempSurfOut );
+			}
+			if ( SolutionType == GaussSeidelIteration ) {
+				TDTGaussSeidel = surfaceFD.TDT;
+			} else {
+				for ( int i = 1; i <= TotNodes + 1; ++i ) {
+					EXPECT_NEAR( TDTGaussSeidel( i ), surfaceFD.TDT( i ), 0.05 );
+				}
+				EXPECT_NEAR( TDTGaussSeidel( TotNodes + 1 ), TempSurfIn, 0.05 );
+				EXPECT_NEAR( TDTGaussSeidel( 1 ), TempSurfOut, 0.05 );
+			}
+		}
+	}
+
 }
@@ -46,6 +46,9 @@
 
 // EnergyPlus::HeatBalanceSurfaceManager Unit Tests
 
+// C++ Headers
+#include <vector>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
@@ -57,7 +60,11 @@
 #include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataHeatBalFanSys.hh>
 #include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/ElectricPowerServiceManager.hh>
+#include <EnergyPlus/HeatBalanceManager.hh>
 #include <EnergyPlus/HeatBalanceSurfaceManager.hh>
+#include <EnergyPlus/Psychrometrics.hh>
 #include <EnergyPlus/ScheduleManager.hh>
 
 using namespace EnergyPlus::HeatBalanceSurfaceManager;
@@ -313,5 +320,278 @@ namespace EnergyPlus {
 		EXPECT_EQ( 12.5, DataHeatBalSurface::TuserHist( 1, 3 ) ); // Now check to see that it is shifting the temperature history properly
 		
 	}
-	
+
+	TEST_F( EnergyPlusFixture, HeatBalanceSurfaceManager_ThreadedSurfaceHeatBalance )
+	{
+
+		// Two zones joined by an interzone wall, each with an outdoor wall, a roof and a ground floor, and a window in
+		// the first zone so that both the concurrent and the serial surface passes are used
+		std::string const idf_objects = delimited_string( {
+			"Version,8.4;",
+			"GlobalGeometryRules,",
+			"  UpperLeftCorner,         !- Starting Vertex Position",
+			"  Counterclockwise,        !- Vertex Entry Direction",
+			"  Relative;                !- Coordinate System",
+			"Material,",
+			"  Concrete Block,          !- Name",
+			"  MediumRough,             !- Roughness",
+			"  0.1014984,               !- Thickness {m}",
+			"  0.3805070,               !- Conductivity {W/m-K}",
+			"  608.7016,                !- Density {kg/m3}",
+			"  836.8000;                !- Specific Heat {J/kg-K}",
+			"Construction,",
+			"  WallConstruction,        !- Name",
+			"  Concrete Block;          !- Outside Layer",
+			"WindowMaterial:SimpleGlazingSystem,",
+			"  WindowMaterial,          !- Name",
+			"  5.778,                   !- U-Factor {W/m2-K}",
+			"  0.819,                   !- Solar Heat Gain Coefficient",
+			"  0.881;                   !- Visible Transmittance",
+			"Construction,",
+			"  WindowConstruction,      !- Name",
+			"  WindowMaterial;          !- Outside Layer",
+			"Zone,",
+			"  Zone 1,                  !- Name",
+			"  0,                       !- Direction of Relative North {deg}",
+			"  0,                       !- X Origin {m}",
+			"  0,                       !- Y Origin {m}",
+			"  0,                       !- Z Origin {m}",
+			"  1,                       !- Type",
+			"  1,                       !- Multiplier",
+			"  autocalculate,           !- Ceiling Height {m}",
+			"  autocalculate;           !- Volume {m3}",
+			"Zone,",
+			"  Zone 2,                  !- Name",
+			"  0,                       !- Direction of Relative North {deg}",
+			"  0,                       !- X Origin {m}",
+			"  0,                       !- Y Origin {m}",
+			"  0,                       !- Z Origin {m}",
+			"  1,                       !- Type",
+			"  1,                       !- Multiplier",
+			"  autocalculate,           !- Ceiling Height {m}",
+			"  autocalculate;           !- Volume {m3}",
+			"BuildingSurface:Detailed,",
+			"  Zone 1 Wall,             !- Name",
+			"  Wall,                    !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone 1,                  !- Zone Name",
+			"  Outdoors,                !- Outside Boundary Condition",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  SunExposed,              !- Sun Exposure",
+			"  WindExposed,             !- Wind Exposure",
+			"  0.5,                     !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  0,0,3,                   !- X,Y,Z ==> Vertex 1 {m}",
+			"  0,0,0,                   !- X,Y,Z ==> Vertex 2 {m}",
+			"  5,0,0,                   !- X,Y,Z ==> Vertex 3 {m}",
+			"  5,0,3;                   !- X,Y,Z ==> Vertex 4 {m}",
+			"FenestrationSurface:Detailed,",
+			"  Zone 1 Window,           !- Name",
+			"  Window,                  !- Surface Type",
+			"  WindowConstruction,      !- Construction Name",
+			"  Zone 1 Wall,             !- Building Surface Name",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  0.5,                     !- View Factor to Ground",
+			"  ,                        !- Shading Control Name",
+			"  ,                        !- Frame and Divider Name",
+			"  1.0,                     !- Multiplier",
+			"  4,                       !- Number of Vertices",
+			"  1,0,2,                   !- X,Y,Z ==> Vertex 1 {m}",
+			"  1,0,1,                   !- X,Y,Z ==> Vertex 2 {m}",
+			"  4,0,1,                   !- X,Y,Z ==> Vertex 3 {m}",
+			"  4,0,2;                   !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			"  Zone 1 Roof,             !- Name",
+			"  Roof,                    !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone 1,                  !- Zone Name",
+			"  Outdoors,                !- Outside Boundary Condition",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  SunExposed,              !- Sun Exposure",
+			"  WindExposed,             !- Wind Exposure",
+			"  0,                       !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  0,5,3,                   !- X,Y,Z ==> Vertex 1 {m}",
+			"  0,0,3,                   !- X,Y,Z ==> Vertex 2 {m}",
+			"  5,0,3,                   !- X,Y,Z ==> Vertex 3 {m}",
+			"  5,5,3;                   !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			"  Zone 1 Floor,            !- Name",
+			"  Floor,                   !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone 1,                  !- Zone Name",
+			"  Ground,                  !- Outside Boundary Condition",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  NoSun,                   !- Sun Exposure",
+			"  NoWind,                  !- Wind Exposure",
+			"  1.0,                     !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  5,5,0,                   !- X,Y,Z ==> Vertex 1 {m}",
+			"  5,0,0,                   !- X,Y,Z ==> Vertex 2 {m}",
+			"  0,0,0,                   !- X,Y,Z ==> Vertex 3 {m}",
+			"  0,5,0;                   !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			"  Zone 1 Partition,        !- Name",
+			"  Wall,                    !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone 1,                  !- Zone Name",
+			"  Surface,                 !- Outside Boundary Condition",
+			"  Zone 2 Partition,        !- Outside Boundary Condition Object",
+			"  NoSun,                   !- Sun Exposure",
+			"  NoWind,                  !- Wind Exposure",
+			"  0,                       !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  5,0,3,                   !- X,Y,Z ==> Vertex 1 {m}",
+			"  5,0,0,                   !- X,Y,Z ==> Vertex 2 {m}",
+			"  5,5,0,                   !- X,Y,Z ==> Vertex 3 {m}",
+			"  5,5,3;                   !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			"  Zone 2 Wall,             !- Name",
+			"  Wall,                    !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone 2,                  !- Zone Name",
+			"  Outdoors,                !- Outside Boundary Condition",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  SunExposed,              !- Sun Exposure",
+			"  WindExposed,             !- Wind Exposure",
+			"  0.5,                     !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  10,5,3,                  !- X,Y,Z ==> Vertex 1 {m}",
+			"  10,5,0,                  !- X,Y,Z ==> Vertex 2 {m}",
+			"  5,5,0,                   !- X,Y,Z ==> Vertex 3 {m}",
+			"  5,5,3;                   !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			"  Zone 2 Roof,             !- Name",
+			"  Roof,                    !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone 2,                  !- Zone Name",
+			"  Outdoors,                !- Outside Boundary Condition",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  SunExposed,              !- Sun Exposure",
+			"  WindExposed,             !- Wind Exposure",
+			"  0,                       !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  5,5,3,                   !- X,Y,Z ==> Vertex 1 {m}",
+			"  5,0,3,                   !- X,Y,Z ==> Vertex 2 {m}",
+			"  10,0,3,                  !- X,Y,Z ==> Vertex 3 {m}",
+			"  10,5,3;                  !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			"  Zone 2 Floor,            !- Name",
+			"  Floor,                   !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone 2,                  !- Zone Name",
+			"  Ground,                  !- Outside Boundary Condition",
+			"  ,                        !- Outside Boundary Condition Object",
+			"  NoSun,                   !- Sun Exposure",
+			"  NoWind,                  !- Wind Exposure",
+			"  1.0,                     !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  10,5,0,                  !- X,Y,Z ==> Vertex 1 {m}",
+			"  10,0,0,                  !- X,Y,Z ==> Vertex 2 {m}",
+			"  5,0,0,                   !- X,Y,Z ==> Vertex 3 {m}",
+			"  5,5,0;                   !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			"  Zone 2 Partition,        !- Name",
+			"  Wall,                    !- Surface Type",
+			"  WallConstruction,        !- Construction Name",
+			"  Zone 2,                  !- Zone Name",
+			"  Surface,                 !- Outside Boundary Condition",
+			"  Zone 1 Partition,        !- Outside Boundary Condition Object",
+			"  NoSun,                   !- Sun Exposure",
+			"  NoWind,                  !- Wind Exposure",
+			"  0,                       !- View Factor to Ground",
+			"  4,                       !- Number of Vertices",
+			"  5,5,3,                   !- X,Y,Z ==> Vertex 1 {m}",
+			"  5,5,0,                   !- X,Y,Z ==> Vertex 2 {m}",
+			"  5,0,0,                   !- X,Y,Z ==> Vertex 3 {m}",
+			"  5,0,3;                   !- X,Y,Z ==> Vertex 4 {m}"
+		} );
+
+		int const NumTimeSteps( 4 );
+
+		// Runs the surface heat balances of the model over a few time steps and returns the surface temperatures
+		// and fluxes of every step, one after another
+		auto const RunSurfaceHeatBalances = [ & ]( int const NumThreads ) -> std::vector< Real64 > {
+			bool ErrorsFound( false );
+			std::vector< Real64 > Results;
+			EXPECT_FALSE( process_idf( idf_objects ) );
+
+			DataHeatBalance::ZoneIntGain.allocate( 2 );
+			createFacilityElectricPowerServiceObject();
+			HeatBalanceManager::SetPreConstructionInputParameters();
+			HeatBalanceManager::GetProjectControlData( ErrorsFound );
+			HeatBalanceManager::GetFrameAndDividerData( ErrorsFound );
+			HeatBalanceManager::GetMaterialData( ErrorsFound );
+			HeatBalanceManager::GetConstructData( ErrorsFound );
+			HeatBalanceManager::GetBuildingData( ErrorsFound );
+			EXPECT_FALSE( ErrorsFound );
+
+			Psychrometrics::InitializePsychRoutines();
+
+			DataSystemVariables::NumberSurfaceHeatBalanceThreads = NumThreads;
+			DataGlobals::TimeStep = 1;
+			DataGlobals::TimeStepZone = 1;
+			DataGlobals::NumOfTimeStepInHour = 1;
+			DataGlobals::BeginSimFlag = true;
+			DataGlobals::BeginEnvrnFlag = true;
+			DataEnvironment::OutBaroPress = 100000;
+
+			for ( int Step = 1; Step <= NumTimeSteps; ++Step ) {
+				DataGlobals::HourOfDay = Step;
+				DataEnvironment::OutDryBulbTemp = -10.0 + 4.0 * Step;
+				DataEnvironment::SkyTemp = DataEnvironment::OutDryBulbTemp - 10.0;
+				DataEnvironment::WindSpeed = 2.0 + Step;
+				for ( auto & surface : DataSurfaces::Surface ) {
+					surface.OutDryBulbTemp = DataEnvironment::OutDryBulbTemp;
+					surface.OutWetBulbTemp = DataEnvironment::OutDryBulbTemp - 2.0;
+					surface.WindSpeed = DataEnvironment::WindSpeed;
+				}
+
+				HeatBalanceManager::ManageHeatBalance();
+				DataGlobals::BeginSimFlag = false;
+				DataGlobals::BeginEnvrnFlag = false;
+
+				for ( int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum ) {
+					Results.push_back( DataHeatBalSurface::TempSurfIn( SurfNum ) );
+					Results.push_back( DataHeatBalSurface::TempSurfOut( SurfNum ) );
+					Results.push_back( DataHeatBalSurface::QdotConvInRep( SurfNum ) );
+					Results.push_back( DataHeatBalSurface::QdotConvOutRep( SurfNum ) );
+					Results.push_back( DataHeatBalSurface::QdotRadNetSurfInRep( SurfNum ) );
+					Results.push_back( DataHeatBalSurface::OpaqSurfInsFaceConductionFlux( SurfNum ) );
+					Results.push_back( DataHeatBalSurface::OpaqSurfOutsideFaceConductionFlux( SurfNum ) );
+				}
+			}
+			DataSystemVariables::NumberSurfaceHeatBalanceThreads = 1;
+			return Results;
+		};
+
+		std::vector< Real64 > const SerialResults( RunSurfaceHeatBalances( 1 ) );
+
+		// Opaque surfaces of both zones are shared out to the threads; the window is left to the serial pass
+		int NumConcurrentOutside( 0 );
+		int NumConcurrentInside( 0 );
+		for ( int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum ) {
+			if ( ! DataSurfaces::Surface( SurfNum ).HeatTransSurf ) continue;
+			bool const Window( DataSurfaces::Surface( SurfNum ).Class == DataSurfaces::SurfaceClass_Window );
+			if ( ! Window && ConcurrentOutsideFace( SurfNum ) ) ++NumConcurrentOutside;
+			if ( ConcurrentInsideFace( SurfNum ) ) ++NumConcurrentInside;
+			if ( Window ) {
+				EXPECT_FALSE( ConcurrentInsideFace( SurfNum ) );
+			}
+		}
+		EXPECT_EQ( 8, NumConcurrentOutside );
+		EXPECT_EQ( 8, NumConcurrentInside );
+
+		// Start again from a clean state and run the same time steps with the zones spread over several threads
+		TearDown();
+		SetUp();
+		std::vector< Real64 > const ThreadedResults( RunSurfaceHeatBalances( 4 ) );
+
+		ASSERT_EQ( SerialResults.size(), ThreadedResults.size() );
+		for ( std::size_t i = 0; i < SerialResults.size(); ++i ) {
+			EXPECT_EQ( SerialResults[ i ], ThreadedResults[ i ] );
+		}
+
+	}
+
 }
@@ -49,8 +49,12 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus/DataOutputs.hh>
+#include <EnergyPlus/FileSystem.hh>
 #include <EnergyPlus/InputProcessor.hh>
 #include <EnergyPlus/SortAndStringUtilities.hh>
 
@@ -226,6 +230,72 @@ namespace EnergyPlus {
 
 		}
 
+		TEST_F( InputProcessorFixture, processIDD_Compiled )
+		{
+			using namespace InputProcessor;
+			std::string const idd_objects = delimited_string({
+				"Timestep,",
+				"       \\unique-object",
+				"  N1 ; \\field Number of Timesteps per Hour",
+				"       \\default 6",
+				"       \\minimum 1",
+				"       \\maximum 60",
+				"Output:SQLite,",
+				"       \\unique-object",
+				"  A1 ; \\field Option Type",
+				"       \\type choice",
+				"       \\key Simple",
+				"       \\key SimpleAndTabular",
+				"       \\retaincase",
+				"       \\required-field"
+			});
+
+			bool errors_found = false;
+			ASSERT_FALSE( process_idd( idd_objects, errors_found ) );
+
+			std::string const compiled_idd( "eplusout.iddc" );
+			std::uint64_t const key( CompiledIDDKey( idd_objects ) );
+			ASSERT_TRUE( SaveCompiledIDD( compiled_idd, key ) );
+
+			auto const objects( ObjectDef );
+			int const num_objects( NumObjectDefs );
+			int const max_alphas( MaxAlphaArgsFound );
+			int const max_numerics( MaxNumericArgsFound );
+			ObjectDef.deallocate();
+			NumObjectDefs = 0;
+			MaxAlphaArgsFound = 0;
+			MaxNumericArgsFound = 0;
+
+			EXPECT_FALSE( LoadCompiledIDD( compiled_idd, CompiledIDDKey( idd_objects + "\n" ) ) );
+			EXPECT_EQ( 0, NumObjectDefs );
+			ASSERT_TRUE( LoadCompiledIDD( compiled_idd, key ) );
+			FileSystem::removeFile( compiled_idd );
+
+			ASSERT_EQ( num_objects, NumObjectDefs );
+			EXPECT_EQ( max_alphas, MaxAlphaArgsFound );
+			EXPECT_EQ( max_numerics, MaxNumericArgsFound );
+			for ( int i = 1; i <= NumObjectDefs; ++i ) {
+				EXPECT_EQ( objects( i ).Name, ObjectDef( i ).Name );
+				EXPECT_EQ( objects( i ).NumParams, ObjectDef( i ).NumParams );
+				EXPECT_EQ( objects( i ).NumAlpha, ObjectDef( i ).NumAlpha );
+				EXPECT_EQ( objects( i ).NumNumeric, ObjectDef( i ).NumNumeric );
+				EXPECT_EQ( objects( i ).MinNumFields, ObjectDef( i ).MinNumFields );
+				EXPECT_EQ( objects( i ).UniqueObject, ObjectDef( i ).UniqueObject );
+				EXPECT_TRUE( compare_containers( objects( i ).AlphaOrNumeric, ObjectDef( i ).AlphaOrNumeric ) );
+				EXPECT_TRUE( compare_containers( objects( i ).ReqField, ObjectDef( i ).ReqField ) );
+				EXPECT_TRUE( compare_containers( objects( i ).AlphRetainCase, ObjectDef( i ).AlphRetainCase ) );
+				EXPECT_TRUE( compare_containers( objects( i ).AlphFieldChks, ObjectDef( i ).AlphFieldChks ) );
+			}
+			EXPECT_EQ( "TIMESTEP", ObjectDef( 1 ).Name );
+			EXPECT_TRUE( ObjectDef( 1 ).NumRangeChks( 1 ).DefaultChk );
+			EXPECT_DOUBLE_EQ( 6.0, ObjectDef( 1 ).NumRangeChks( 1 ).Default );
+			EXPECT_EQ( 1, ObjectDef( 1 ).NumRangeChks( 1 ).WhichMinMax( 1 ) );
+			EXPECT_DOUBLE_EQ( 60.0, ObjectDef( 1 ).NumRangeChks( 1 ).MinMaxValue( 2 ) );
+			EXPECT_EQ( "Number of Timesteps per Hour", ObjectDef( 1 ).NumRangeChks( 1 ).FieldName );
+			EXPECT_TRUE( ObjectDef( 2 ).AlphRetainCase( 1 ) );
+			EXPECT_TRUE( ObjectDef( 2 ).ReqField( 1 ) );
+		}
+
 		TEST_F( InputProcessorFixture, processIDF )
 		{
 			using namespace InputProcessor;
@@ -474,6 +544,99 @@ namespace EnergyPlus {
 
 		}
 
+		TEST_F( InputProcessorFixture, getObjectItem_Interleaved )
+		{
+			std::string const idf_objects = delimited_string({
+				"Version,8.3;",
+				"Schedule:Constant, Sched A, , 1.0;",
+				"ScheduleTypeLimits, Fraction, 0.0, 1.0, Continuous;",
+				"Schedule:Constant, Sched B, , 2.0;",
+				"ScheduleTypeLimits, Any Number;",
+				"Schedule:Constant, Sched C, , 3.0;",
+				"Schedule:Constant, Sched B, , 4.0;",
+			});
+
+			ASSERT_FALSE( process_idf( idf_objects ) );
+
+			std::string const CurrentModuleObject = "Schedule:Constant";
+			ASSERT_EQ( 4, GetNumObjectsFound( CurrentModuleObject ) );
+
+			int NumAlphas = 0;
+			int NumNumbers = 0;
+			int IOStatus = 0;
+			Array1D_string Alphas( 3 );
+			Array1D< Real64 > Numbers( 2, 0.0 );
+
+			std::vector< std::string > const names( { "SCHED A", "SCHED B", "SCHED C", "SCHED B" } );
+			for ( int i = 1; i <= 4; ++i ) {
+				GetObjectItem( CurrentModuleObject, i, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus );
+				EXPECT_EQ( 1, IOStatus );
+				EXPECT_EQ( names[ i - 1 ], Alphas( 1 ) );
+				EXPECT_DOUBLE_EQ( Real64( i ), Numbers( 1 ) );
+			}
+			GetObjectItem( "ScheduleTypeLimits", 2, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus );
+			EXPECT_EQ( 1, IOStatus );
+			EXPECT_EQ( "ANY NUMBER", Alphas( 1 ) );
+
+			GetObjectItem( CurrentModuleObject, 5, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus );
+			EXPECT_EQ( -1, IOStatus );
+
+			EXPECT_EQ( 2, GetObjectItemNum( CurrentModuleObject, "SCHED B" ) );
+			EXPECT_EQ( 3, GetObjectItemNum( "SCHEDULE:CONSTANT", "SCHED C" ) );
+			EXPECT_EQ( 0, GetObjectItemNum( CurrentModuleObject, "Sched C" ) );
+			EXPECT_EQ( -1, GetObjectItemNum( "Schedule:NotAnObject", "SCHED C" ) );
+
+			TellMeHowManyObjectItemArgs( "ScheduleTypeLimits", 1, NumAlphas, NumNumbers, IOStatus );
+			EXPECT_EQ( 1, IOStatus );
+			EXPECT_EQ( 2, NumAlphas );
+			EXPECT_EQ( 2, NumNumbers );
+		}
+
+		TEST_F( InputProcessorFixture, processIDF_FieldsNotCarriedOver )
+		{
+			std::string const idf_objects = delimited_string({
+				"Version,8.3;",
+				"ScheduleTypeLimits, Fraction, 0.0, 1.0, Continuous;",
+				"ScheduleTypeLimits, Any Number, , , ;",
+				"Schedule:Constant, Sched A, Fraction, 1.5D-1;",
+				"Schedule:Constant, Sched B, , 2.5e-1;",
+			});
+
+			ASSERT_FALSE( process_idf( idf_objects ) );
+
+			int NumAlphas = 0;
+			int NumNumbers = 0;
+			int IOStatus = 0;
+			Array1D_string Alphas( 3 );
+			Array1D< Real64 > Numbers( 2, 0.0 );
+			Array1D_bool AlphaBlanks( 3, false );
+			Array1D_bool NumericBlanks( 2, false );
+
+			// Nothing from the first ScheduleTypeLimits shows through the blank fields of the second
+			GetObjectItem( "ScheduleTypeLimits", 2, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, NumericBlanks, AlphaBlanks );
+			EXPECT_EQ( 1, IOStatus );
+			ASSERT_EQ( 2, NumAlphas );
+			ASSERT_EQ( 2, NumNumbers );
+			EXPECT_EQ( "ANY NUMBER", Alphas( 1 ) );
+			EXPECT_EQ( "", Alphas( 2 ) );
+			EXPECT_TRUE( AlphaBlanks( 2 ) );
+			EXPECT_DOUBLE_EQ( 0.0, Numbers( 1 ) );
+			EXPECT_DOUBLE_EQ( 0.0, Numbers( 2 ) );
+			EXPECT_TRUE( NumericBlanks( 1 ) );
+			EXPECT_TRUE( NumericBlanks( 2 ) );
+
+			// Fortran style exponent
+			GetObjectItem( "Schedule:Constant", 1, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, NumericBlanks, AlphaBlanks );
+			EXPECT_EQ( "FRACTION", Alphas( 2 ) );
+			EXPECT_DOUBLE_EQ( 0.15, Numbers( 1 ) );
+
+			GetObjectItem( "Schedule:Constant", 2, Alphas, NumAlphas, Numbers, NumNumbers, IOStatus, NumericBlanks, AlphaBlanks );
+			EXPECT_EQ( "", Alphas( 2 ) );
+			EXPECT_TRUE( AlphaBlanks( 2 ) );
+			EXPECT_DOUBLE_EQ( 0.25, Numbers( 1 ) );
+			EXPECT_FALSE( NumericBlanks( 1 ) );
+		}
+
 		TEST_F( InputProcessorFixture, findItemInSortedList )
 		{
 			InputProcessor::ListOfObjects = Array1D_string ({
@@ -1555,6 +1718,103 @@ namespace EnergyPlus {
 			EXPECT_TRUE( RepObjects( 5 ).TransitionDefer );
 		}
 
+		TEST_F( InputProcessorFixture, processIDF_CompiledIDDRecords )
+		{
+			// The records of an IDF read with the definitions loaded from a compiled IDD are the same as with the parsed IDD
+			using namespace InputProcessor;
+			std::string const idf_objects = delimited_string({
+				"Version,8.3;",
+				"Timestep, 4;",
+				"SimulationControl, No, No, No, Yes, Yes;",
+				"Building, Bldg, 0.0, Suburbs, .04, .4, FullExterior, 25, 6;",
+				"GlobalGeometryRules, UpperLeftCorner, Counterclockwise, Relative;",
+				"ScheduleTypeLimits, Fraction, 0.0, 1.0, Continuous;",
+				"ScheduleTypeLimits, Any Number, , , ;",
+				"Schedule:Constant, Sched A, Fraction, 1.5D-1;",
+				"Schedule:Compact, Sched B, Fraction, Through: 12/31, For: AllDays,",
+				"  Until: 12:00, 0.25,  ! Morning",
+				"  Until: 24:00, 1.;",
+				"Zone, Zone One, 0, 0, 0, 0, 1, 1, autocalculate, autocalculate;",
+				"Material, Brick, Rough, 0.1016, 0.89, 1920, 790, 0.9, 0.7, 0.7;",
+				"Construction, Wall, Brick;",
+				"BuildingSurface:Detailed, Wall 1, Wall, Wall, Zone One, Outdoors, , SunExposed, WindExposed, autocalculate, 4,",
+				"  0, 0, 3, 0, 0, 0, 10, 0, 0, 10, 0, 3;",
+				"Output:Variable, *, Zone Mean Air Temperature, hourly;",
+			});
+
+			bool errors_found = false;
+			ASSERT_FALSE( process_idd( "", errors_found ) );
+			std::string const compiled_idd( "eplusout-records.iddc" );
+			std::uint64_t const key( CompiledIDDKey( "processIDF_CompiledIDDRecords" ) );
+			ASSERT_TRUE( SaveCompiledIDD( compiled_idd, key ) );
+
+			std::istringstream parsed_idd_stream( idf_objects );
+			NumLines = 0;
+			InitSecretObjects();
+			ProcessInputDataFile( parsed_idd_stream );
+			auto const records( IDFRecords );
+			int const num_records( NumIDFRecords );
+			ASSERT_EQ( 14, num_records );
+
+			std::ostream * const echo( InputProcessor::echo_stream );
+			InputProcessor::clear_state();
+			InputProcessor::echo_stream = echo;
+			ASSERT_TRUE( LoadCompiledIDD( compiled_idd, key ) );
+			FileSystem::removeFile( compiled_idd );
+			ListOfObjects.allocate( NumObjectDefs );
+			for ( int i = 1; i <= NumObjectDefs; ++i ) ListOfObjects( i ) = ObjectDef( i ).Name;
+			iListOfObjects.allocate( NumObjectDefs );
+			SortAndStringUtilities::SetupAndSort( ListOfObjects, iListOfObjects );
+			ObjectStartRecord.dimension( NumObjectDefs, 0 );
+			ObjectGotCount.dimension( NumObjectDefs, 0 );
+
+			std::istringstream compiled_idd_stream( idf_objects );
+			NumLines = 0;
+			InitSecretObjects();
+			ProcessInputDataFile( compiled_idd_stream );
+
+			ASSERT_EQ( num_records, NumIDFRecords );
+			for ( int i = 1; i <= num_records; ++i ) {
+				auto const & expected( records( i ) );
+				auto const & record( IDFRecords( i ) );
+				EXPECT_EQ( expected.Name, record.Name );
+				EXPECT_EQ( expected.ObjectDefPtr, record.ObjectDefPtr );
+				ASSERT_EQ( expected.NumAlphas, record.NumAlphas ) << expected.Name;
+				ASSERT_EQ( expected.NumNumbers, record.NumNumbers ) << expected.Name;
+				for ( int j = 1; j <= expected.NumAlphas; ++j ) {
+					EXPECT_EQ( expected.Alphas( j ), record.Alphas( j ) ) << expected.Name << " alpha " << j;
+					EXPECT_EQ( expected.AlphBlank( j ), record.AlphBlank( j ) ) << expected.Name << " alpha " << j;
+				}
+				for ( int j = 1; j <= expected.NumNumbers; ++j ) {
+					EXPECT_EQ( expected.Numbers( j ), record.Numbers( j ) ) << expected.Name << " number " << j; // Bit for bit
+					EXPECT_EQ( expected.NumBlank( j ), record.NumBlank( j ) ) << expected.Name << " number " << j;
+				}
+			}
+		}
+
+		TEST_F( InputProcessorFixture, processNumber_ListDirectedRead )
+		{
+			// Plain decimals take a faster path than the list-directed read: both must give the same bits
+			static gio::Fmt fmtLD( "*" );
+			std::vector< std::string > const numbers( { "0", "1", "-1", "+2", "0.1", ".1", "1.", "-.5", "3.14159265358979", "0.30000000000000004",
+				"1e3", "1E-3", "-2.5e+10", "6.02214076E23", "1.7976931348623157E308", "2.2250738585072014E-308", "123456789012345678901234567890",
+				"1.5D-1", "2d2", "0000.000100", "-0.0", "1.2.3", "1e", "+", "." } );
+			for ( auto const & number : numbers ) {
+				bool error_flag = false;
+				Real64 const value( ProcessNumber( number, error_flag ) );
+				Real64 expected( 0.0 );
+				IOFlags flags;
+				gio::read( number, fmtLD, flags ) >> expected;
+				if ( flags.ios() != 0 ) {
+					EXPECT_TRUE( error_flag ) << number;
+					EXPECT_EQ( 0.0, value ) << number;
+				} else {
+					EXPECT_FALSE( error_flag ) << number;
+					EXPECT_EQ( expected, value ) << number; // Bit for bit
+				}
+			}
+		}
+
 	}
 
 }
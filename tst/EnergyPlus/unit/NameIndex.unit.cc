@@ -0,0 +1,176 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::NameIndex Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/InputProcessor.hh>
+#include <EnergyPlus/NameIndex.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// C++ Headers
+#include <string>
+
+using namespace EnergyPlus;
+
+namespace {
+
+	struct Named
+	{
+		std::string Name;
+	};
+
+} // namespace
+
+TEST_F( EnergyPlusFixture, NameIndex_MatchesLinearSearch )
+{
+	Array1D_string Names( { "Zone 1", "ZONE 1", "Plenum", "zone 1", "Core", "Plenum" } );
+	int const NumNames( Names.isize() );
+	NameIndex Index( Names, NumNames );
+	EXPECT_EQ( NumNames, Index.size() );
+
+	for ( char const * Name : { "Zone 1", "ZONE 1", "zone 1", "zONE 1", "Plenum", "PLENUM", "Core", "Attic", "" } ) {
+		EXPECT_EQ( InputProcessor::FindItemInList( Name, Names, NumNames ), Index.find( Name ) ) << Name;
+		EXPECT_EQ( InputProcessor::FindItem( Name, Names, NumNames ), Index.find_caseless( Name ) ) << Name;
+	}
+}
+
+TEST_F( EnergyPlusFixture, NameIndex_Growth )
+{
+	NameIndex Index;
+	EXPECT_TRUE( Index.empty() );
+	for ( int i = 1; i <= 5000; ++i ) {
+		EXPECT_EQ( i, Index.add( "Node " + std::to_string( i ) ) );
+	}
+	EXPECT_EQ( 5000, Index.size() );
+	for ( int i = 1; i <= 5000; ++i ) {
+		EXPECT_EQ( i, Index.find( "Node " + std::to_string( i ) ) );
+		EXPECT_EQ( i, Index.find_caseless( "NODE " + std::to_string( i ) ) );
+		EXPECT_EQ( 0, Index.find( "NODE " + std::to_string( i ) ) );
+	}
+	EXPECT_EQ( 0, Index.find( "Node 5001" ) );
+
+	Index.clear();
+	EXPECT_TRUE( Index.empty() );
+	EXPECT_EQ( 0, Index.find( "Node 1" ) );
+	EXPECT_EQ( 1, Index.add( "Node 1" ) );
+}
+
+TEST_F( EnergyPlusFixture, NameIndex_FollowsList )
+{
+	Array1D< Named > Items( 2 );
+	Items( 1 ).Name = "Chiller";
+	Items( 2 ).Name = "Boiler";
+	NameIndex Index;
+	EXPECT_EQ( 2, Index.find( "Boiler", Items, 2 ) );
+	EXPECT_EQ( 2, Index.size() );
+
+	// Grown list is reindexed when a name added after the index was built misses
+	Items.redimension( 3 );
+	Items( 3 ).Name = "Tower";
+	EXPECT_EQ( 1, Index.find( "Chiller", Items, 3 ) );
+	EXPECT_EQ( 2, Index.size() );
+	EXPECT_EQ( 3, Index.find( "Tower", Items, 3 ) );
+	EXPECT_EQ( 3, Index.size() );
+	Items.redimension( 4 );
+	Items( 4 ).Name = "Pump";
+	EXPECT_EQ( 4, Index.find_caseless( "PUMP", Items, 4 ) );
+	EXPECT_EQ( 0, Index.find( "Fan", Items, 4 ) );
+
+	// Shrunk list is reindexed when a hit is past its end
+	Items.redimension( 3 );
+	EXPECT_EQ( 0, Index.find( "Pump", Items, 3 ) );
+	EXPECT_EQ( 3, Index.size() );
+
+	// Renamed item is reindexed when found
+	Items( 2 ).Name = "Heater";
+	Items( 1 ).Name = "Boiler";
+	EXPECT_EQ( 1, Index.find( "Boiler", Items, 3 ) );
+	EXPECT_EQ( 2, Index.find_caseless( "HEATER", Items, 3 ) );
+
+	// Item renamed to a name that missed is found once the owner clears the index
+	EXPECT_EQ( 0, Index.find( "Fan", Items, 3 ) );
+	Items( 3 ).Name = "Fan";
+	Index.clear();
+	EXPECT_EQ( 3, Index.find( "Fan", Items, 3 ) );
+	Items( 3 ).Name = "Valve";
+	Index.clear();
+	EXPECT_EQ( 3, Index.find_caseless( "VALVE", Items, 3 ) );
+	EXPECT_EQ( 0, Index.find( "Fan", Items, 3 ) );
+	EXPECT_EQ( 3, Index.size() );
+}
+
+TEST_F( EnergyPlusFixture, NameIndex_VerifyName )
+{
+	NameIndex Index;
+	bool ErrorFound( false );
+	bool IsBlank( false );
+
+	InputProcessor::VerifyName( "Curve A", Index, ErrorFound, IsBlank, "Curve:Linear Name" );
+	EXPECT_FALSE( ErrorFound );
+	InputProcessor::VerifyName( "CURVE A", Index, ErrorFound, IsBlank, "Curve:Cubic Name" );
+	EXPECT_TRUE( ErrorFound );
+	EXPECT_FALSE( IsBlank );
+	InputProcessor::VerifyName( "", Index, ErrorFound, IsBlank, "Curve:Cubic Name" );
+	EXPECT_TRUE( ErrorFound );
+	EXPECT_TRUE( IsBlank );
+
+	// Names in error are still indexed so item numbers follow the list
+	EXPECT_EQ( 3, Index.size() );
+	EXPECT_EQ( 2, Index.find( "CURVE A" ) );
+
+	std::string const error_string = delimited_string( {
+		"   ** Severe  ** Curve:Cubic Name, duplicate name=CURVE A",
+		"   ** Severe  ** Curve:Cubic Name, cannot be blank",
+	} );
+	EXPECT_TRUE( compare_err_stream( error_string, true ) );
+}
@@ -0,0 +1,143 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::NumericFormat Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/General.hh>
+#include <EnergyPlus/NumericFormat.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// C++ Headers
+#include <cmath>
+#include <string>
+
+using namespace EnergyPlus;
+using namespace ObjexxFCL;
+
+namespace {
+
+	std::string
+	list_directed( Real64 const value )
+	{
+		char s[ NumericFormat::BufferSize ];
+		return std::string( s, NumericFormat::format_list_directed( value, s ) );
+	}
+
+	std::string
+	gio_list_directed( Real64 const value )
+	{
+		static gio::Fmt fmtLD( "*" );
+		std::string String;
+		gio::write( String, fmtLD ) << value;
+		return String;
+	}
+
+}
+
+TEST( NumericFormat, ListDirected )
+{
+	EXPECT_EQ( "   0.00000000000000     ", list_directed( 0.0 ) );
+	EXPECT_EQ( "   1.00000000000000     ", list_directed( 1.0 ) );
+	EXPECT_EQ( "  0.500000000000000     ", list_directed( 0.5 ) );
+	EXPECT_EQ( "   123.456000000000     ", list_directed( 123.456 ) );
+	EXPECT_EQ( " 10000000000000000.     ", list_directed( 1.0e16 ) );
+	EXPECT_EQ( "  5.000000000000000E-002", list_directed( 0.05 ) );
+	EXPECT_EQ( " -5.000000000000000E-002", list_directed( -0.05 ) );
+	EXPECT_EQ( "  1.000000000000000E+017", list_directed( 1.0e17 ) );
+	EXPECT_EQ( "  0.999999999999999E-001", list_directed( 0.0999999999999999 ) );
+
+	// Same field as gio across the magnitudes, including the subnormals gio scales in long double
+	for ( int k = -320; k <= 307; ++k ) {
+		Real64 const v( std::pow( 10.0, k ) );
+		EXPECT_EQ( gio_list_directed( v ), list_directed( v ) ) << v;
+		EXPECT_EQ( gio_list_directed( -0.99999999999999 * v ), list_directed( -0.99999999999999 * v ) ) << v;
+		EXPECT_EQ( gio_list_directed( 9.999999999999999 * v ), list_directed( 9.999999999999999 * v ) ) << v;
+	}
+	for ( int i = -20000; i <= 20000; ++i ) {
+		Real64 const v( i * 0.005 );
+		EXPECT_EQ( gio_list_directed( v ), list_directed( v ) ) << v;
+	}
+}
+
+TEST( NumericFormat, FixedAndInteger )
+{
+	char s[ NumericFormat::BufferSize ];
+	EXPECT_EQ( "      -0.000", std::string( s, NumericFormat::format_fixed( -0.0001, 12, 3, s ) ) );
+	EXPECT_EQ( "     123.457", std::string( s, NumericFormat::format_fixed( 123.4567, 12, 3, s ) ) );
+	EXPECT_EQ( "         12.", std::string( s, NumericFormat::format_fixed( 12.4, 12, 0, s ) ) );
+	EXPECT_EQ( ".123", std::string( s, NumericFormat::format_fixed( 0.1234, 4, 3, s ) ) );
+	EXPECT_EQ( "****", std::string( s, NumericFormat::format_fixed( 12.5, 4, 3, s ) ) );
+	EXPECT_EQ( "          -5", std::string( s, NumericFormat::format_list_directed( std::int64_t( -5 ), s ) ) );
+	EXPECT_EQ( "-2147483648", std::string( s, NumericFormat::format_integer( -2147483648ll, s ) ) );
+	EXPECT_EQ( "0.1", std::string( s, NumericFormat::format_shortest( 0.1, s ) ) );
+	EXPECT_EQ( "-1234.5", std::string( s, NumericFormat::format_shortest( -1234.5, s ) ) );
+}
+
+TEST( NumericFormat, RoundAndTrimSigDigits )
+{
+	EXPECT_EQ( "2.68", General::RoundSigDigits( 2.675, 2 ) );
+	EXPECT_EQ( "2.67", General::TrimSigDigits( 2.675, 2 ) );
+	EXPECT_EQ( "0.13", General::RoundSigDigits( 0.125, 2 ) );
+	EXPECT_EQ( "-10.00", General::RoundSigDigits( -9.9999, 2 ) );
+	EXPECT_EQ( "-9.99", General::TrimSigDigits( -9.9999, 2 ) );
+	EXPECT_EQ( "100", General::RoundSigDigits( 99.995, 0 ) );
+	EXPECT_EQ( "99", General::TrimSigDigits( 99.995, 0 ) );
+	EXPECT_EQ( "1234567.9", General::RoundSigDigits( 1234567.891, 1 ) );
+	EXPECT_EQ( "5.000E-002", General::RoundSigDigits( 0.05, 3 ) );
+	EXPECT_EQ( "-4.E-004", General::TrimSigDigits( -0.0004, 0 ) );
+	EXPECT_EQ( "1.00E+020", General::RoundSigDigits( 1.0e20, 2 ) );
+	EXPECT_EQ( "0.000", General::RoundSigDigits( 0.0, 3 ) );
+	EXPECT_EQ( "0", General::TrimSigDigits( 0.0, 0 ) );
+	EXPECT_EQ( "NAN", General::RoundSigDigits( std::nan( "" ), 2 ) );
+	EXPECT_EQ( "-42", General::RoundSigDigits( -42 ) );
+	EXPECT_EQ( "42", General::TrimSigDigits( 42 ) );
+}
@@ -54,6 +54,7 @@
 #include <EnergyPlus/OutputProcessor.hh>
 #include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/InputProcessor.hh>
 #include <EnergyPlus/WeatherManager.hh>
 #include <EnergyPlus/PurchasedAirManager.hh>
 
@@ -1571,6 +1572,49 @@ namespace EnergyPlus {
 
 		}
 
+		TEST_F( EnergyPlusFixture, OutputProcessor_asyncOutputWriter )
+		{
+			DataGlobals::MinutesPerTimeStep = 10;
+			std::string const dayType( "WinterDesignDay" );
+
+			StartOutputWriter();
+
+			WriteTimeStampFormatData( DataGlobals::mtr_stream, ReportHourly, 1, "1", 1, "1", false, 12, 21, 1, _, _, 0, dayType );
+			WriteReportMeterData( 1, "1", 616771620.98702729, ReportHourly, 0.0, 0, 0.0, 0, false );
+			WriteReportMeterData( 1, "1", 616771620.98702729, ReportDaily, 4283136.2516839253, 12210110, 4283136.2587211775, 12212460, false );
+			WriteCumulativeReportMeterData( 1, "1", 0, true );
+			WriteNumericData( 2, "2", 999.9 );
+			WriteNumericData( 2, "2", -999 );
+			WriteReportIntegerData( 3, "3", 616771620.98702729, 1, 10, ReportHourly, 0, 0, 0, 0 );
+
+			// Lines come out in the order they were reported once the writer has caught up
+			FlushOutputWriter();
+			EXPECT_TRUE( compare_mtr_stream( delimited_string( {
+				"1,1,12,21, 0, 1, 0.00,60.00,WinterDesignDay",
+				"1,616771620.9870273",
+				"1,616771620.9870273,4283136.251683925, 1,10,4283136.2587211779,24,60",
+				"1,0.0" } ) ) );
+			EXPECT_TRUE( compare_eso_stream( delimited_string( {
+				"1,616771620.9870273",
+				"1,616771620.9870273,4283136.251683925, 1,10,4283136.2587211779,24,60",
+				"2,999.9",
+				"2,-999",
+				"3,61677162.0987027" } ) ) );
+
+			// More lines than the ring holds: the simulation thread waits for the writer
+			std::vector< std::string > lines;
+			for ( int i = 0; i < 10000; ++i ) {
+				WriteNumericData( 4, "4", i );
+				lines.push_back( "4," + std::to_string( i ) );
+			}
+			StopOutputWriter();
+			EXPECT_TRUE( compare_eso_stream( delimited_string( lines ) ) );
+
+			// Written directly once the writer has stopped
+			WriteNumericData( 5, "5", 1.5 );
+			EXPECT_TRUE( compare_eso_stream( delimited_string( { "5,1.5" } ) ) );
+		}
+
 		TEST_F( SQLiteFixture, OutputProcessor_writeNumericData_2 )
 		{
 			sqlite_test->createSQLiteTimeIndexRecord( 4, 1, 1, 0 );
@@ -3343,6 +3387,119 @@ namespace EnergyPlus {
 			} ) );
 
 		}
+		TEST_F( EnergyPlusFixture, OutputProcessor_ReportingListsSkipUnreportedVariables )
+		{
+			std::string const idf_objects = delimited_string( {
+				"Version,8.3;",
+				"Output:Variable,SPACE1,Zone Test Energy,hourly;",
+				"EnergyManagementSystem:Sensor,Space2Energy,SPACE2,Zone Test Energy;",
+			} );
+
+			ASSERT_FALSE( process_idf( idf_objects ) );
+			InputProcessor::PreScanReportingVariables();
+
+			DataGlobals::MinutesPerTimeStep = 10;
+			TimeValue.allocate( 2 );
+			auto timeStep = 1.0 / 6;
+			SetupTimePointers( "Zone", timeStep );
+			SetupTimePointers( "HVAC", timeStep );
+			TimeValue( 1 ).CurMinute = 0;
+			TimeValue( 2 ).CurMinute = 0;
+
+			GetReportVariableInput();
+			Real64 space1_energy = 2.0;
+			Real64 space2_energy = 3.0;
+			Real64 light_consumption = 5.0;
+			SetupOutputVariable( "Zone Test Energy [J]", space1_energy, "System", "Sum", "SPACE1" );
+			SetupOutputVariable( "Zone Test Energy [J]", space2_energy, "System", "Sum", "SPACE2" );
+			SetupOutputVariable( "Lights Electric Energy [J]", light_consumption, "System", "Sum", "SPACE1 LIGHTS", _, "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE1", 1, 1 );
+
+			int space1Index = 0;
+			int space2Index = 0;
+			int lightsIndex = 0;
+			for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+				if ( RVariableTypes( Loop ).VarName == "SPACE1:Zone Test Energy" ) space1Index = Loop;
+				if ( RVariableTypes( Loop ).VarName == "SPACE2:Zone Test Energy" ) space2Index = Loop;
+				if ( RVariableTypes( Loop ).VarName == "SPACE1 LIGHTS:Lights Electric Energy" ) lightsIndex = Loop;
+			}
+			ASSERT_GT( space1Index, 0 );
+			ASSERT_GT( space2Index, 0 );
+			ASSERT_GT( lightsIndex, 0 );
+
+			// The unreported, unmetered SPACE2 variable is not accumulated
+			UpdateDataandReport( DataGlobals::HVACTSReporting );
+
+			EXPECT_EQ( 2u, ReportingLists( HVACVar ).RActive.size() );
+			EXPECT_EQ( 1u, ReportingLists( HVACVar ).RReported.size() );
+			EXPECT_EQ( 0u, ReportingLists( ZoneVar ).RActive.size() );
+			EXPECT_DOUBLE_EQ( 2.0, GetInternalVariableValueExternalInterface( 2, space1Index ) );
+			EXPECT_DOUBLE_EQ( 0.0, GetInternalVariableValueExternalInterface( 2, space2Index ) );
+			EXPECT_DOUBLE_EQ( 5.0, GetInternalVariableValueExternalInterface( 2, lightsIndex ) );
+
+			// An external interface reads every variable, so they are all accumulated from then on
+			RequestAllVariablesAccumulated();
+			UpdateDataandReport( DataGlobals::HVACTSReporting );
+
+			EXPECT_EQ( 3u, ReportingLists( HVACVar ).RActive.size() );
+			EXPECT_EQ( 1u, ReportingLists( HVACVar ).RReported.size() );
+			EXPECT_DOUBLE_EQ( 4.0, GetInternalVariableValueExternalInterface( 2, space1Index ) );
+			EXPECT_DOUBLE_EQ( 3.0, GetInternalVariableValueExternalInterface( 2, space2Index ) );
+			EXPECT_DOUBLE_EQ( 10.0, GetInternalVariableValueExternalInterface( 2, lightsIndex ) );
+
+			// Setting up another variable rebuilds the lists
+			Real64 light2_consumption = 7.0;
+			SetupOutputVariable( "Lights Electric Energy [J]", light2_consumption, "System", "Sum", "SPACE2 LIGHTS", _, "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE2", 1, 1 );
+			EXPECT_FALSE( ReportingListsCurrent );
+			UpdateDataandReport( DataGlobals::HVACTSReporting );
+			EXPECT_TRUE( ReportingListsCurrent );
+			EXPECT_EQ( 4u, ReportingLists( HVACVar ).RActive.size() );
+		}
+
+		TEST_F( EnergyPlusFixture, OutputProcessor_MeterMapSumsMeteredVariables )
+		{
+			std::string const idf_objects = delimited_string( {
+				"Version,8.3;",
+			} );
+
+			ASSERT_FALSE( process_idf( idf_objects ) );
+
+			DataGlobals::MinutesPerTimeStep = 10;
+			TimeValue.allocate( 2 );
+			auto timeStep = 1.0 / 6;
+			SetupTimePointers( "Zone", timeStep );
+			SetupTimePointers( "HVAC", timeStep );
+			TimeValue( 1 ).CurMinute = 0;
+			TimeValue( 2 ).CurMinute = 0;
+
+			GetReportVariableInput();
+			Real64 light1_consumption = 5.0;
+			Real64 light2_consumption = 7.0;
+			SetupOutputVariable( "Lights Electric Energy [J]", light1_consumption, "System", "Sum", "SPACE1 LIGHTS", _, "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE1", 2, 1 );
+			SetupOutputVariable( "Lights Electric Energy [J]", light2_consumption, "System", "Sum", "SPACE2 LIGHTS", _, "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE2", 1, 1 );
+			MeterValue.dimension( NumEnergyMeters, 0.0 );
+
+			UpdateDataandReport( DataGlobals::HVACTSReporting );
+
+			// Both variables are on the facility, building and end use meters, each on its own zone meters
+			int const facilityMeter = GetMeterIndex( "ELECTRICITY:FACILITY" );
+			int const space1Meter = GetMeterIndex( "ELECTRICITY:ZONE:SPACE1" );
+			int const space2Meter = GetMeterIndex( "ELECTRICITY:ZONE:SPACE2" );
+			ASSERT_GT( facilityMeter, 0 );
+			ASSERT_GT( space1Meter, 0 );
+			ASSERT_GT( space2Meter, 0 );
+			ASSERT_EQ( NumEnergyMeters + 1, int( MeterMap.RowStart.size() ) );
+			EXPECT_EQ( 2, MeterMap.RowStart[ facilityMeter ] - MeterMap.RowStart[ facilityMeter - 1 ] );
+			EXPECT_EQ( 1, MeterMap.RowStart[ space1Meter ] - MeterMap.RowStart[ space1Meter - 1 ] );
+			EXPECT_EQ( 1, MeterMap.RowStart[ space2Meter ] - MeterMap.RowStart[ space2Meter - 1 ] );
+
+			UpdateDataandReport( DataGlobals::ZoneTSReporting );
+
+			EXPECT_DOUBLE_EQ( 17.0, GetCurrentMeterValue( facilityMeter ) );
+			EXPECT_DOUBLE_EQ( 10.0, GetCurrentMeterValue( space1Meter ) );
+			EXPECT_DOUBLE_EQ( 7.0, GetCurrentMeterValue( space2Meter ) );
+			EXPECT_DOUBLE_EQ( 0.0, MeterValue( facilityMeter ) );
+		}
+
 		TEST_F (EnergyPlusFixture, OutputProcessor_GenOutputVariablesAuditReport)
 		{
 			std::string const idf_objects = delimited_string ({
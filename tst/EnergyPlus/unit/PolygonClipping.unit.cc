@@ -0,0 +1,144 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::PolygonClipping Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/PolygonClipping.hh>
+
+// C++ Headers
+#include <cmath>
+#include <vector>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::PolygonClipping;
+
+namespace {
+
+	// Regular polygon in homogeneous coordinate units (0.01 mm) with a fractional offset so the
+	// products are not all exact
+	void
+	polygon( int const n, std::vector< Real64 > & x, std::vector< Real64 > & y )
+	{
+		x.resize( n );
+		y.resize( n );
+		for ( int i = 0; i < n; ++i ) {
+			Real64 const t( 6.283185307179586 * i / n );
+			x[ i ] = std::round( 250000.0 * std::cos( t ) ) + 0.37 * i;
+			y[ i ] = std::round( 180000.0 * std::sin( t ) ) - 0.21 * i;
+		}
+	}
+
+}
+
+TEST( PolygonClippingTest, EdgeValues )
+{
+	EXPECT_NE( nullptr, instruction_set() );
+	std::vector< Real64 > x, y;
+	for ( int n = 0; n <= 21; ++n ) {
+		polygon( n, x, y );
+		std::vector< Real64 > h( n ), h_ref( n );
+		Real64 const a( -360000.0 ), b( 510000.0 ), c( 1.5e10 );
+		edge_values( x.data(), y.data(), n, a, b, c, h.data() );
+		edge_values_scalar( x.data(), y.data(), n, a, b, c, h_ref.data() );
+		for ( int i = 0; i < n; ++i ) {
+			EXPECT_EQ( h_ref[ i ], h[ i ] ) << "n=" << n << " i=" << i;
+		}
+	}
+
+	// Points left of, on, and right of the line y = x
+	Real64 const px[] = { 0.0, 1.0, 2.0 };
+	Real64 const py[] = { 1.0, 1.0, 1.0 };
+	Real64 h[ 3 ];
+	edge_values( px, py, 3, -1.0, 1.0, 0.0, h );
+	EXPECT_GT( h[ 0 ], 0.0 );
+	EXPECT_EQ( 0.0, h[ 1 ] );
+	EXPECT_LT( h[ 2 ], 0.0 );
+}
+
+TEST( PolygonClippingTest, EdgeLines )
+{
+	std::vector< Real64 > x, y;
+	for ( int n = 3; n <= 21; ++n ) {
+		polygon( n, x, y );
+		std::vector< Real64 > a( n ), b( n ), c( n ), a_ref( n ), b_ref( n ), c_ref( n );
+		edge_lines( x.data(), y.data(), n, a.data(), b.data(), c.data() );
+		edge_lines_scalar( x.data(), y.data(), n, a_ref.data(), b_ref.data(), c_ref.data() );
+		for ( int i = 0; i < n; ++i ) {
+			EXPECT_EQ( a_ref[ i ], a[ i ] ) << "n=" << n << " i=" << i;
+			EXPECT_EQ( b_ref[ i ], b[ i ] ) << "n=" << n << " i=" << i;
+			EXPECT_EQ( c_ref[ i ], c[ i ] ) << "n=" << n << " i=" << i;
+		}
+	}
+
+	// Unit square: both ends of every edge are on its line and the polygon is to the left
+	Real64 const sx[] = { 0.0, 1.0, 1.0, 0.0 };
+	Real64 const sy[] = { 0.0, 0.0, 1.0, 1.0 };
+	Real64 a[ 4 ], b[ 4 ], c[ 4 ];
+	edge_lines( sx, sy, 4, a, b, c );
+	for ( int i = 0; i < 4; ++i ) {
+		int const j( ( i + 1 ) % 4 );
+		EXPECT_EQ( 0.0, a[ i ] * sx[ i ] + b[ i ] * sy[ i ] + c[ i ] );
+		EXPECT_EQ( 0.0, a[ i ] * sx[ j ] + b[ i ] * sy[ j ] + c[ i ] );
+		EXPECT_GT( a[ i ] * 0.5 + b[ i ] * 0.5 + c[ i ], 0.0 );
+	}
+}
+
+TEST( PolygonClippingTest, SideValues )
+{
+	// Large HC values stay exact in Int64
+	Int64 const x[] = { 0, 100000000, 100000000, 0 };
+	Int64 const y[] = { 0, 0, 100000000, 100000000 };
+	Int64 h[ 4 ];
+	side_values( x, y, 4, -100000000, 100000000, 1, h );
+	EXPECT_EQ( 1, h[ 0 ] );
+	EXPECT_EQ( -9999999999999999, h[ 1 ] );
+	EXPECT_EQ( 1, h[ 2 ] );
+	EXPECT_EQ( 10000000000000001, h[ 3 ] );
+}
@@ -0,0 +1,233 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::RunPeriodSegments Unit Tests
+
+// C++ Headers
+#include <fstream>
+#include <sstream>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/FileSystem.hh>
+#include <EnergyPlus/RunPeriodSegments.hh>
+#include <EnergyPlus/WeatherManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::RunPeriodSegments;
+
+namespace {
+
+	std::string const Dictionary(
+		"Program Version,EnergyPlus, Version 8.6.0\n"
+		"1,5,Environment Title[],Latitude[deg],Longitude[deg],Time Zone[],Elevation[m]\n"
+		"2,6,Day of Simulation[],Month[],Day of Month[],DST Indicator[1=yes 0=no],Hour[],StartMinute[],EndMinute[],DayType\n"
+		"3,3,Cumulative Day of Simulation[],Month[],Day of Month[],DST Indicator[1=yes 0=no],DayType  ! When Daily Report Variables Requested\n"
+		"4,2,Cumulative Days of Simulation[],Month[]  ! When Monthly Report Variables Requested\n"
+		"5,1,Cumulative Days of Simulation[] ! When Run Period Report Variables Requested\n"
+		"7,1,Environment,Site Outdoor Air Drybulb Temperature [C] !Daily\n"
+		"8,1,Cumulative Electricity:Facility [J] !Daily\n"
+		"9,11,Environment,Site Outdoor Air Drybulb Temperature [C] !RunPeriod [Value,Min,Month,Day,Hour,Minute,Max,Month,Day,Hour,Minute]\n"
+		"End of Data Dictionary\n" );
+
+	std::string const DesignDay(
+		"1,DENVER SUMMER,  39.74, -105.18,  -7.00, 1829.00\n"
+		"3,1, 7,21, 0,SummerDesignDay\n"
+		"7,25.0\n"
+		"8,100.0\n" );
+
+	std::string const RunPeriodStamp( "1,DENVER ANNUAL,  39.74, -105.18,  -7.00, 1829.00\n" );
+
+	void
+	write_file(
+		std::string const & FileName,
+		std::string const & Contents
+	)
+	{
+		std::ofstream Stream( FileName, std::ios_base::out | std::ios_base::trunc );
+		Stream << Contents;
+	}
+
+	std::string
+	read_file( std::string const & FileName )
+	{
+		std::ifstream Stream( FileName );
+		std::stringstream Contents;
+		Contents << Stream.rdbuf();
+		return Contents.str();
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, RunPeriodSegments_SegmentMonths )
+{
+	int FirstMonth;
+	int LastMonth;
+
+	SegmentMonths( 1, 12, 4, 1, FirstMonth, LastMonth );
+	EXPECT_EQ( 1, FirstMonth );
+	EXPECT_EQ( 3, LastMonth );
+	SegmentMonths( 1, 12, 4, 4, FirstMonth, LastMonth );
+	EXPECT_EQ( 10, FirstMonth );
+	EXPECT_EQ( 12, LastMonth );
+
+	// Uneven shares
+	SegmentMonths( 1, 12, 5, 3, FirstMonth, LastMonth );
+	EXPECT_EQ( 5, FirstMonth );
+	EXPECT_EQ( 7, LastMonth );
+	SegmentMonths( 1, 12, 5, 5, FirstMonth, LastMonth );
+	EXPECT_EQ( 10, FirstMonth );
+	EXPECT_EQ( 12, LastMonth );
+
+	// One month per segment
+	SegmentMonths( 3, 5, 3, 2, FirstMonth, LastMonth );
+	EXPECT_EQ( 4, FirstMonth );
+	EXPECT_EQ( 4, LastMonth );
+}
+
+TEST_F( EnergyPlusFixture, RunPeriodSegments_SplitRunPeriod )
+{
+	NumSegments = 4;
+	OverlapDays = 7;
+	bool ErrorsFound( false );
+
+	// Third quarter, starting a week into June; the year starts on a Sunday
+	SegmentNum = 3;
+	WeatherManager::RunPeriodData RunPeriod;
+	RunPeriod.DayOfWeek = 1;
+	SplitRunPeriod( RunPeriod, 0, ErrorsFound );
+	EXPECT_FALSE( ErrorsFound );
+	EXPECT_EQ( 6, RunPeriod.StartMonth );
+	EXPECT_EQ( 24, RunPeriod.StartDay );
+	EXPECT_EQ( 9, RunPeriod.EndMonth );
+	EXPECT_EQ( 30, RunPeriod.EndDay );
+	EXPECT_EQ( 7, RunPeriod.DayOfWeek ); // June 24 is a Saturday
+	EXPECT_EQ( 7, RunPeriod.SegmentOverlapDays );
+
+	// The first segment has no days ahead of it to overlap
+	SegmentNum = 1;
+	RunPeriod = WeatherManager::RunPeriodData();
+	RunPeriod.StartDay = 3;
+	SplitRunPeriod( RunPeriod, 0, ErrorsFound );
+	EXPECT_FALSE( ErrorsFound );
+	EXPECT_EQ( 1, RunPeriod.StartMonth );
+	EXPECT_EQ( 3, RunPeriod.StartDay );
+	EXPECT_EQ( 3, RunPeriod.EndMonth );
+	EXPECT_EQ( 31, RunPeriod.EndDay );
+	EXPECT_EQ( 0, RunPeriod.DayOfWeek );
+	EXPECT_EQ( 0, RunPeriod.SegmentOverlapDays );
+
+	// Fewer months than segments
+	RunPeriod = WeatherManager::RunPeriodData();
+	RunPeriod.EndMonth = 2;
+	RunPeriod.EndDay = 28;
+	SplitRunPeriod( RunPeriod, 0, ErrorsFound );
+	EXPECT_TRUE( ErrorsFound );
+
+	// Repeated run periods
+	ErrorsFound = false;
+	RunPeriod = WeatherManager::RunPeriodData();
+	RunPeriod.NumSimYears = 2;
+	SplitRunPeriod( RunPeriod, 0, ErrorsFound );
+	EXPECT_TRUE( ErrorsFound );
+}
+
+TEST_F( EnergyPlusFixture, RunPeriodSegments_StitchOutputFiles )
+{
+	// The first segment reports the design day and days 1-2; the second simulates day 2 again as overlap and reports days 3-4
+	std::vector< std::string > const SegmentFiles( { "RunPeriodSegments1.eso", "RunPeriodSegments2.eso" } );
+	write_file( SegmentFiles[ 0 ], Dictionary + DesignDay + RunPeriodStamp +
+		"3,1, 1, 1, 0,Sunday\n7,1.0\n8,10.0\n"
+		"3,2, 1, 2, 0,Monday\n7,3.0\n8,30.0\n"
+		"5,2\n9,2.0,-5.0, 1, 1, 3,60,8.0, 1, 2,14,60\n"
+		"End of Data\n Number of Records Written=           7\n" );
+	write_file( SegmentFiles[ 1 ], Dictionary + RunPeriodStamp +
+		"3,2, 1, 3, 0,Tuesday\n7,5.0\n8,50.0\n"
+		"3,3, 1, 4, 0,Wednesday\n7,7.0\n8,120.0\n"
+		"5,3\n9,6.0,-9.0, 1, 4, 5,60,9.0, 1, 3,15,60\n"
+		"End of Data\n Number of Records Written=           5\n" );
+
+	std::vector< SegmentManifest > Manifests( 2 );
+	Manifests[ 0 ].Environments.emplace_back( "DENVER ANNUAL", 0, 2 );
+	Manifests[ 0 ].AveragedReportIDs = { 7, 9 };
+	Manifests[ 1 ].Environments.emplace_back( "DENVER ANNUAL", 1, 2 );
+	Manifests[ 1 ].AveragedReportIDs = { 7, 9 };
+
+	std::string ErrorMessage;
+	ASSERT_TRUE( StitchOutputFiles( SegmentFiles, Manifests, "RunPeriodSegments.eso", ErrorMessage ) );
+	std::string const Stitched( Dictionary + DesignDay + RunPeriodStamp +
+		"3,1, 1, 1, 0,Sunday\n7,1.0\n8,10.0\n"
+		"3,2, 1, 2, 0,Monday\n7,3.0\n8,30.0\n"
+		"3,3, 1, 3, 0,Tuesday\n7,5.0\n8,80.0\n"
+		"3,4, 1, 4, 0,Wednesday\n7,7.0\n8,150.0\n"
+		"5,4\n9,4.0,-9.0, 1, 4, 5,60,9.0, 1, 3,15,60\n"
+		"End of Data\n Number of Records Written=          11\n" );
+	EXPECT_EQ( Stitched, read_file( "RunPeriodSegments.eso" ) );
+
+	// Compare with a serial run that differs on the third day
+	std::string Reference( Stitched );
+	Reference.replace( Reference.find( "7,5.0" ), 5, "7,4.0" );
+	write_file( "RunPeriodSegmentsSerial.eso", Reference );
+	std::vector< VariableDifference > Differences;
+	ASSERT_TRUE( CompareOutputFiles( "RunPeriodSegments.eso", "RunPeriodSegmentsSerial.eso", Differences ) );
+	ASSERT_EQ( 3u, Differences.size() );
+	EXPECT_EQ( "Environment,Site Outdoor Air Drybulb Temperature [C] !Daily", Differences[ 0 ].Name );
+	EXPECT_EQ( 5, Differences[ 0 ].Count );
+	EXPECT_DOUBLE_EQ( 1.0, Differences[ 0 ].MaxAbsDiff );
+	EXPECT_DOUBLE_EQ( 0.25, Differences[ 0 ].MaxRelDiff );
+	EXPECT_DOUBLE_EQ( 1.0, Differences[ 0 ].SumSqDiff );
+	EXPECT_DOUBLE_EQ( 0.0, Differences[ 1 ].MaxAbsDiff );
+	EXPECT_DOUBLE_EQ( 0.0, Differences[ 2 ].MaxAbsDiff );
+
+	for ( auto const & FileName : SegmentFiles ) {
+		FileSystem::removeFile( FileName );
+	}
+	FileSystem::removeFile( "RunPeriodSegments.eso" );
+	FileSystem::removeFile( "RunPeriodSegmentsSerial.eso" );
+}
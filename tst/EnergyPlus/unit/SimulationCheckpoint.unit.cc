@@ -0,0 +1,302 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::SimulationCheckpoint Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataAirLoop.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/DataReportingFlags.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/FileSystem.hh>
+#include <EnergyPlus/InputProcessor.hh>
+#include <EnergyPlus/ScheduleManager.hh>
+#include <EnergyPlus/SimulationCheckpoint.hh>
+#include <EnergyPlus/WaterThermalTanks.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::SimulationCheckpoint;
+
+namespace {
+
+	// Fill the state with values derived from Base
+	void
+	set_state( Real64 const Base )
+	{
+		DataReportingFlags::NumOfWarmupDays = int( Base ) + 5;
+		for ( std::size_t l = 0; l < DataHeatBalSurface::TH.size(); ++l ) {
+			DataHeatBalSurface::TH[ l ] = Base + l;
+			DataHeatBalSurface::QH[ l ] = Base - l;
+		}
+		DataHeatBalFanSys::MAT = Base + 20.0;
+		DataHeatBalFanSys::ZoneAirHumRat = Base * 0.001;
+		for ( int NodeNum = 1; NodeNum <= 3; ++NodeNum ) {
+			DataLoopNode::Node( NodeNum ).Temp = Base + NodeNum;
+			DataLoopNode::Node( NodeNum ).MassFlowRate = Base * NodeNum;
+		}
+		DataAirLoop::AirLoopFlow( 1 ).SupFlow = Base * 2.0;
+		DataAirLoop::AirLoopControlInfo( 1 ).EconoActive = ( int( Base ) % 2 == 1 );
+		DataAirLoop::PriAirSysAvailMgr( 1 ).StopTime = DataGlobals::SimTimeSteps + int( Base );
+		DataPlant::PlantLoop( 1 ).LoopSide( 2 ).LoopSideInlet_TankTemp = Base + 10.0;
+		DataPlant::PlantLoop( 1 ).LoopSide( 2 ).Branch( 1 ).Comp( 1 ).MyLoad = Base * 1000.0;
+		ScheduleManager::Schedule( 1 ).CurrentValue = Base;
+		WaterThermalTanks::WaterThermalTank( 1 ).TankTemp = Base + 50.0;
+		WaterThermalTanks::WaterThermalTank( 1 ).Node( 2 ).SavedTemp = Base + 40.0;
+	}
+
+	// A small state: surface histories for two surfaces, two zones, three nodes, an air loop, a plant loop with one
+	// component, a schedule and a stratified tank
+	void
+	setup_state()
+	{
+		DataHeatBalSurface::TH.allocate( 2, 3, 2 );
+		DataHeatBalSurface::QH.allocate( 2, 3, 2 );
+		DataHeatBalFanSys::MAT.allocate( 2 );
+		DataHeatBalFanSys::ZoneAirHumRat.allocate( 2 );
+		DataLoopNode::NumOfNodes = 3;
+		DataLoopNode::Node.allocate( 3 );
+		DataAirLoop::AirLoopFlow.allocate( 1 );
+		DataAirLoop::AirLoopControlInfo.allocate( 1 );
+		DataAirLoop::PriAirSysAvailMgr.allocate( 1 );
+		DataPlant::PlantLoop.allocate( 1 );
+		DataPlant::PlantLoop( 1 ).LoopSide.allocate( 2 );
+		DataPlant::PlantLoop( 1 ).LoopSide( 2 ).Branch.allocate( 1 );
+		DataPlant::PlantLoop( 1 ).LoopSide( 2 ).Branch( 1 ).Comp.allocate( 1 );
+		ScheduleManager::Schedule.allocate( 1 );
+		WaterThermalTanks::WaterThermalTank.allocate( 1 );
+		WaterThermalTanks::WaterThermalTank( 1 ).Node.allocate( 2 );
+		set_state( 1.0 );
+	}
+
+	// Replace the processed input by one record per object name, each with one alpha and one number
+	void
+	set_input( std::vector< std::string > const & ObjectNames, Real64 const Number )
+	{
+		using InputProcessor::IDFRecords;
+		InputProcessor::NumIDFRecords = int( ObjectNames.size() );
+		IDFRecords.allocate( InputProcessor::NumIDFRecords );
+		for ( int Loop = 1; Loop <= InputProcessor::NumIDFRecords; ++Loop ) {
+			auto & Record( IDFRecords( Loop ) );
+			Record.Name = ObjectNames[ Loop - 1 ];
+			Record.NumAlphas = 1;
+			Record.Alphas.allocate( 1 );
+			Record.Alphas( 1 ) = "OBJECT " + std::to_string( Loop );
+			Record.AlphBlank.dimension( 1, false );
+			Record.NumNumbers = 1;
+			Record.Numbers.dimension( 1, Number );
+			Record.NumBlank.dimension( 1, false );
+		}
+		SimulationCheckpoint::clear_state();
+	}
+
+	void
+	expect_state( Real64 const Base )
+	{
+		EXPECT_EQ( int( Base ) + 5, DataReportingFlags::NumOfWarmupDays );
+		for ( std::size_t l = 0; l < DataHeatBalSurface::TH.size(); ++l ) {
+			EXPECT_EQ( Base + l, DataHeatBalSurface::TH[ l ] );
+			EXPECT_EQ( Base - l, DataHeatBalSurface::QH[ l ] );
+		}
+		EXPECT_EQ( Base + 20.0, DataHeatBalFanSys::MAT( 2 ) );
+		EXPECT_EQ( Base * 0.001, DataHeatBalFanSys::ZoneAirHumRat( 1 ) );
+		for ( int NodeNum = 1; NodeNum <= 3; ++NodeNum ) {
+			EXPECT_EQ( Base + NodeNum, DataLoopNode::Node( NodeNum ).Temp );
+			EXPECT_EQ( Base * NodeNum, DataLoopNode::Node( NodeNum ).MassFlowRate );
+		}
+		EXPECT_EQ( Base * 2.0, DataAirLoop::AirLoopFlow( 1 ).SupFlow );
+		EXPECT_EQ( int( Base ) % 2 == 1, DataAirLoop::AirLoopControlInfo( 1 ).EconoActive );
+		EXPECT_EQ( DataGlobals::SimTimeSteps + int( Base ), DataAirLoop::PriAirSysAvailMgr( 1 ).StopTime );
+		EXPECT_EQ( Base + 10.0, DataPlant::PlantLoop( 1 ).LoopSide( 2 ).LoopSideInlet_TankTemp );
+		EXPECT_EQ( Base * 1000.0, DataPlant::PlantLoop( 1 ).LoopSide( 2 ).Branch( 1 ).Comp( 1 ).MyLoad );
+		EXPECT_EQ( Base, ScheduleManager::Schedule( 1 ).CurrentValue );
+		EXPECT_EQ( Base + 50.0, WaterThermalTanks::WaterThermalTank( 1 ).TankTemp );
+		EXPECT_EQ( Base + 40.0, WaterThermalTanks::WaterThermalTank( 1 ).Node( 2 ).SavedTemp );
+	}
+
+}
+
+TEST_F( EnergyPlusFixture, SimulationCheckpoint_PackUnpack )
+{
+	DataGlobals::SimTimeSteps = 480;
+	setup_state();
+	std::string const Payload( PackState() );
+
+	// Restored on an earlier day: the availability manager cycle times move with the timestep count
+	DataGlobals::SimTimeSteps = 96;
+	set_state( 7.0 );
+	EXPECT_TRUE( UnpackState( Payload ) );
+	expect_state( 1.0 );
+	EXPECT_FALSE( has_err_output() );
+}
+
+TEST_F( EnergyPlusFixture, SimulationCheckpoint_ModelMismatch )
+{
+	setup_state();
+	std::string const Payload( PackState() );
+
+	// A node added since the checkpoint was written: nothing may be copied, not even the sections ahead of the nodes
+	DataLoopNode::NumOfNodes = 4;
+	DataLoopNode::Node.redimension( 4 );
+	set_state( 7.0 );
+	EXPECT_FALSE( UnpackState( Payload ) );
+	expect_state( 7.0 );
+	EXPECT_TRUE( has_err_output() );
+
+	// A truncated payload
+	DataLoopNode::NumOfNodes = 3;
+	DataLoopNode::Node.redimension( 3 );
+	EXPECT_FALSE( UnpackState( Payload.substr( 0, Payload.size() - 1 ) ) );
+	expect_state( 7.0 );
+	EXPECT_TRUE( has_err_output() );
+}
+
+TEST_F( EnergyPlusFixture, SimulationCheckpoint_File )
+{
+	setup_state();
+	std::string const CheckpointFile( "eplus-checkpoint-test.bin" );
+	DataSystemVariables::SimulationCheckpointFile = CheckpointFile;
+
+	// One record per environment in the file
+	DataEnvironment::CurEnvirNum = 1;
+	DataEnvironment::EnvironmentName = "WINTER DAY";
+	SaveCheckpoint();
+	DataEnvironment::CurEnvirNum = 2;
+	DataEnvironment::EnvironmentName = "SUMMER DAY";
+	set_state( 2.0 );
+	SaveCheckpoint();
+	EXPECT_TRUE( FileSystem::fileExists( CheckpointFile ) );
+
+	DataSystemVariables::SimulationCheckpointFile.clear();
+	DataSystemVariables::SimulationRestartFile = CheckpointFile;
+	DataEnvironment::CurEnvirNum = 1;
+	DataEnvironment::EnvironmentName = "WINTER DAY";
+	set_state( 7.0 );
+	EXPECT_TRUE( RestoreCheckpoint() );
+	expect_state( 1.0 );
+	DataEnvironment::CurEnvirNum = 2;
+	DataEnvironment::EnvironmentName = "SUMMER DAY";
+	EXPECT_TRUE( RestoreCheckpoint() );
+	expect_state( 2.0 );
+	EXPECT_FALSE( has_err_output() );
+
+	// No record for an environment that was not checkpointed
+	DataEnvironment::CurEnvirNum = 3;
+	DataEnvironment::EnvironmentName = "RUN PERIOD";
+	EXPECT_FALSE( RestoreCheckpoint() );
+	expect_state( 2.0 );
+	EXPECT_TRUE( has_err_output() );
+
+	// Sizing periods are never restored
+	DataEnvironment::CurEnvirNum = 1;
+	DataEnvironment::EnvironmentName = "WINTER DAY";
+	DataGlobals::DoingSizing = true;
+	EXPECT_FALSE( RestoreCheckpoint() );
+	DataGlobals::DoingSizing = false;
+
+	FileSystem::removeFile( CheckpointFile );
+	DataSystemVariables::SimulationRestartFile.clear();
+}
+
+TEST_F( EnergyPlusFixture, SimulationCheckpoint_InputKey )
+{
+	DataEnvironment::CurEnvirNum = 1;
+	DataEnvironment::EnvironmentName = "WINTER DAY";
+
+	set_input( { "Zone", "Output:Variable" }, 1.0 );
+	std::uint64_t const Key( ComputeEnvironmentKey() );
+	EXPECT_TRUE( UnsavedStateObject().empty() );
+
+	// A changed output request keeps the key
+	set_input( { "Zone", "Output:Variable", "Output:Meter", "OutputControl:Table:Style" }, 1.0 );
+	EXPECT_EQ( Key, ComputeEnvironmentKey() );
+
+	// Any edit to the model changes it, even one that keeps the numbers of zones, surfaces and nodes
+	set_input( { "Zone", "Output:Variable" }, 2.0 );
+	EXPECT_NE( Key, ComputeEnvironmentKey() );
+	set_input( { "Zone", "Schedule:Constant", "Output:Variable" }, 1.0 );
+	EXPECT_NE( Key, ComputeEnvironmentKey() );
+}
+
+TEST_F( EnergyPlusFixture, SimulationCheckpoint_UnsavedState )
+{
+	setup_state();
+	set_input( { "Zone", "Pipe:Outdoor" }, 1.0 );
+	EXPECT_EQ( "Pipe:Outdoor", UnsavedStateObject() );
+
+	// The pipe history is not in the checkpoint: nothing is written and nothing is restored
+	std::string const CheckpointFile( "eplus-checkpoint-unsaved.bin" );
+	DataSystemVariables::SimulationCheckpointFile = CheckpointFile;
+	DataEnvironment::CurEnvirNum = 1;
+	DataEnvironment::EnvironmentName = "WINTER DAY";
+	SaveCheckpoint();
+	EXPECT_FALSE( FileSystem::fileExists( CheckpointFile ) );
+	EXPECT_TRUE( has_err_output() );
+
+	set_input( { "Zone" }, 1.0 );
+	SaveCheckpoint();
+	EXPECT_TRUE( FileSystem::fileExists( CheckpointFile ) );
+	EXPECT_FALSE( has_err_output() );
+
+	DataSystemVariables::SimulationCheckpointFile.clear();
+	DataSystemVariables::SimulationRestartFile = CheckpointFile;
+	set_input( { "Zone", "GroundHeatExchanger:Vertical" }, 1.0 );
+	set_state( 7.0 );
+	EXPECT_FALSE( RestoreCheckpoint() );
+	expect_state( 7.0 );
+	EXPECT_TRUE( has_err_output() );
+
+	FileSystem::removeFile( CheckpointFile );
+	DataSystemVariables::SimulationRestartFile.clear();
+}
@@ -51,6 +51,7 @@
 
 // EnergyPlus Headers
 #include <EnergyPlus/SolarShading.hh>
+#include <EnergyPlus/BoundingVolumeHierarchy.hh>
 #include <EnergyPlus/DataBSDFWindow.hh>
 #include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataGlobals.hh>
@@ -60,11 +61,16 @@
 #include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 #include <EnergyPlus/DataVectorTypes.hh>
+#include <EnergyPlus/FileSystem.hh>
 #include <EnergyPlus/HeatBalanceManager.hh>
 #include <EnergyPlus/ScheduleManager.hh>
+#include <EnergyPlus/ShadingCache.hh>
 #include <EnergyPlus/SimulationManager.hh>
 #include <EnergyPlus/SurfaceGeometry.hh>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/member.functions.hh>
+
 #include "Fixtures/EnergyPlusFixture.hh"
 
 using namespace EnergyPlus;
@@ -649,7 +655,9 @@ TEST_F( EnergyPlusFixture, SolarShadingTest_FigureSolarBeamAtTimestep )
 	EXPECT_FALSE( FoundError );
 
 	SolarShading::AllocateModuleArrays();
+	DataSystemVariables::CheckShadowingCombinations = true;
 	SolarShading::DetermineShadowingCombinations();
+	DataSystemVariables::CheckShadowingCombinations = false;
 	DataEnvironment::DayOfYear_Schedule = 168;
 	DataEnvironment::DayOfWeek = 6;
 	DataGlobals::TimeStep = 4;
@@ -657,6 +665,26 @@ TEST_F( EnergyPlusFixture, SolarShadingTest_FigureSolarBeamAtTimestep )
 
 	compare_err_stream( "" ); // just for debugging
 
+	// The tree search must find the same casting surfaces as the exhaustive search
+	BoundingVolumeHierarchy CastingTree;
+	SolarShading::BuildCastingSurfaceTree( CastingTree );
+	EXPECT_FALSE( CastingTree.empty() );
+	int NumCasting( 0 );
+	for ( int GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) {
+		std::vector< int > SurfsOnBase;
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			if ( ( SurfNum != GRSNR ) && ( Surface( SurfNum ).BaseSurf == GRSNR ) ) SurfsOnBase.push_back( SurfNum );
+		}
+		Real64 const ZMIN( minval( Surface( GRSNR ).Vertex, &Vector::z ) );
+		std::vector< int > GSS;
+		std::vector< int > ExhaustiveGSS;
+		SolarShading::FindCastingSurfaces( GRSNR, ZMIN, SurfsOnBase, CastingTree, GSS );
+		SolarShading::FindCastingSurfacesExhaustive( GRSNR, ZMIN, ExhaustiveGSS );
+		EXPECT_EQ( ExhaustiveGSS, GSS );
+		NumCasting += GSS.size();
+	}
+	EXPECT_GT( NumCasting, 0 );
+
 	DataSurfaces::ShadingTransmittanceVaries = true;
 	DataSystemVariables::DetailedSkyDiffuseAlgorithm = true;
 	SolarDistribution = FullExterior;
@@ -672,3 +700,437 @@ TEST_F( EnergyPlusFixture, SolarShadingTest_FigureSolarBeamAtTimestep )
 
 }
 
+TEST_F( EnergyPlusFixture, SolarShadingTest_CalcPerSolarBeamThreaded )
+{
+	std::string const idf_objects = delimited_string( {
+		"  Version,8.6;                                                                       ",
+		"  Building,                                                                          ",
+		"    DemoFDT,                 !- Name                                                 ",
+		"    0,                       !- North Axis {deg}                                     ",
+		"    Suburbs,                 !- Terrain                                              ",
+		"    3.9999999E-02,           !- Loads Convergence Tolerance Value                    ",
+		"    4.0000002E-03,           !- Temperature Convergence Tolerance Value {deltaC}     ",
+		"    FullExterior,            !- Solar Distribution                                   ",
+		"    ,                        !- Maximum Number of Warmup Days                        ",
+		"    6;                       !- Minimum Number of Warmup Days                        ",
+		"  ShadowCalculation,                                                                 ",
+		"    TimestepFrequency,       !- Calculation Method                                   ",
+		"    ,                        !- Calculation Frequency                                ",
+		"    ,                        !- Maximum Figures in Shadow Overlap Calculations       ",
+		"    ,                        !- Polygon Clipping Algorithm                           ",
+		"    DetailedSkyDiffuseModeling;  !- Sky Diffuse Modeling Algorithm                   ",
+		"  SurfaceConvectionAlgorithm:Inside,TARP;                                            ",
+		"  SurfaceConvectionAlgorithm:Outside,TARP;                                           ",
+		"  HeatBalanceAlgorithm,ConductionTransferFunction;                                   ",
+		"  Timestep,6;                                                                        ",
+		"  RunPeriod,                                                                         ",
+		"    ,                        !- Name                                                 ",
+		"    1,                       !- Begin Month                                          ",
+		"    1,                       !- Begin Day of Month                                   ",
+		"    12,                      !- End Month                                            ",
+		"    31,                      !- End Day of Month                                     ",
+		"    ,                        !- Day of Week for Start Day                            ",
+		"    ,                        !- Use Weather File Holidays and Special Days           ",
+		"    ,                        !- Use Weather File Daylight Saving Period              ",
+		"    ,                        !- Apply Weekend Holiday Rule                           ",
+		"    ,                        !- Use Weather File Rain Indicators                     ",
+		"    ;                        !- Use Weather File Snow Indicators                     ",
+		"  ScheduleTypeLimits,                                                                ",
+		"    Fraction,                !- Name                                                 ",
+		"    0.0,                     !- Lower Limit Value                                    ",
+		"    1.0,                     !- Upper Limit Value                                    ",
+		"    Continuous;              !- Numeric Type                                         ",
+		"  ScheduleTypeLimits,                                                                ",
+		"    ON/OFF,                  !- Name                                                 ",
+		"    0,                       !- Lower Limit Value                                    ",
+		"    1,                       !- Upper Limit Value                                    ",
+		"    Discrete;                !- Numeric Type                                         ",
+		"  Schedule:Compact,                                                                  ",
+		"    SunShading,              !- Name                                                 ",
+		"    ON/OFF,                  !- Schedule Type Limits Name                            ",
+		"    Through: 4/30,           !- Field 1                                              ",
+		"    For: AllDays,            !- Field 2                                              ",
+		"    until: 24:00,1,          !- Field 3                                              ",
+		"    Through: 10/31,          !- Field 5                                              ",
+		"    For: AllDays,            !- Field 6                                              ",
+		"    until: 24:00,0,          !- Field 7                                              ",
+		"    Through: 12/31,          !- Field 9                                              ",
+		"    For: AllDays,            !- Field 10                                             ",
+		"    until: 24:00,1;          !- Field 11                                             ",
+		"  Material,                                                                          ",
+		"    A2 - 4 IN DENSE FACE BRICK,  !- Name                                             ",
+		"    Rough,                   !- Roughness                                            ",
+		"    0.1014984,               !- Thickness {m}                                        ",
+		"    1.245296,                !- Conductivity {W/m-K}                                 ",
+		"    2082.400,                !- Density {kg/m3}                                      ",
+		"    920.4800,                !- Specific Heat {J/kg-K}                               ",
+		"    0.9000000,               !- Thermal Absorptance                                  ",
+		"    0.9300000,               !- Solar Absorptance                                    ",
+		"    0.9300000;               !- Visible Absorptance                                  ",
+		"  Material,                                                                          ",
+		"    E1 - 3 / 4 IN PLASTER OR GYP BOARD,  !- Name                                     ",
+		"    Smooth,                  !- Roughness                                            ",
+		"    1.9050000E-02,           !- Thickness {m}                                        ",
+		"    0.7264224,               !- Conductivity {W/m-K}                                 ",
+		"    1601.846,                !- Density {kg/m3}                                      ",
+		"    836.8000,                !- Specific Heat {J/kg-K}                               ",
+		"    0.9000000,               !- Thermal Absorptance                                  ",
+		"    0.9200000,               !- Solar Absorptance                                    ",
+		"    0.9200000;               !- Visible Absorptance                                  ",
+		"  Material,                                                                          ",
+		"    E2 - 1 / 2 IN SLAG OR STONE,  !- Name                                            ",
+		"    Rough,                   !- Roughness                                            ",
+		"    1.2710161E-02,           !- Thickness {m}                                        ",
+		"    1.435549,                !- Conductivity {W/m-K}                                 ",
+		"    881.0155,                !- Density {kg/m3}                                      ",
+		"    1673.600,                !- Specific Heat {J/kg-K}                               ",
+		"    0.9000000,               !- Thermal Absorptance                                  ",
+		"    0.5500000,               !- Solar Absorptance                                    ",
+		"    0.5500000;               !- Visible Absorptance                                  ",
+		"  Material,                                                                          ",
+		"    C12 - 2 IN HW CONCRETE,  !- Name                                                 ",
+		"    MediumRough,             !- Roughness                                            ",
+		"    5.0901599E-02,           !- Thickness {m}                                        ",
+		"    1.729577,                !- Conductivity {W/m-K}                                 ",
+		"    2242.585,                !- Density {kg/m3}                                      ",
+		"    836.8000,                !- Specific Heat {J/kg-K}                               ",
+		"    0.9000000,               !- Thermal Absorptance                                  ",
+		"    0.6500000,               !- Solar Absorptance                                    ",
+		"    0.6500000;               !- Visible Absorptance                                  ",
+		"  Material:NoMass,                                                                   ",
+		"    R13LAYER,                !- Name                                                 ",
+		"    Rough,                   !- Roughness                                            ",
+		"    2.290965,                !- Thermal Resistance {m2-K/W}                          ",
+		"    0.9000000,               !- Thermal Absorptance                                  ",
+		"    0.7500000,               !- Solar Absorptance                                    ",
+		"    0.7500000;               !- Visible Absorptance                                  ",
+		"  WindowMaterial:Glazing,                                                            ",
+		"    GLASS - CLEAR PLATE 1 / 4 IN,  !- Name                                           ",
+		"    SpectralAverage,         !- Optical Data Type                                    ",
+		"    ,                        !- Window Glass Spectral Data Set Name                  ",
+		"    0.006,                   !- Thickness {m}                                        ",
+		"    0.80,                    !- Solar Transmittance at Normal Incidence              ",
+		"    0.10,                    !- Front Side Solar Reflectance at Normal Incidence     ",
+		"    0.10,                    !- Back Side Solar Reflectance at Normal Incidence      ",
+		"    0.80,                    !- Visible Transmittance at Normal Incidence            ",
+		"    0.10,                    !- Front Side Visible Reflectance at Normal Incidence   ",
+		"    0.10,                    !- Back Side Visible Reflectance at Normal Incidence    ",
+		"    0.0,                     !- Infrared Transmittance at Normal Incidence           ",
+		"    0.84,                    !- Front Side Infrared Hemispherical Emissivity         ",
+		"    0.84,                    !- Back Side Infrared Hemispherical Emissivity          ",
+		"    0.9;                     !- Conductivity {W/m-K}                                 ",
+		"  WindowMaterial:Gas,                                                                ",
+		"    AIRGAP,                  !- Name                                                 ",
+		"    AIR,                     !- Gas Type                                             ",
+		"    0.0125;                  !- Thickness {m}                                        ",
+		"  Construction,                                                                      ",
+		"    R13WALL,                 !- Name                                                 ",
+		"    R13LAYER;                !- Outside Layer                                        ",
+		"  Construction,                                                                      ",
+		"    EXTWALL09,               !- Name                                                 ",
+		"    A2 - 4 IN DENSE FACE BRICK,  !- Outside Layer                                    ",
+		"    E1 - 3 / 4 IN PLASTER OR GYP BOARD;  !- Layer 4                                  ",
+		"  Construction,                                                                      ",
+		"    INTERIOR,                !- Name                                                 ",
+		"    C12 - 2 IN HW CONCRETE;  !- Layer 4                                              ",
+		"  Construction,                                                                      ",
+		"    SLAB FLOOR,              !- Name                                                 ",
+		"    C12 - 2 IN HW CONCRETE;  !- Layer 4                                              ",
+		"  Construction,                                                                      ",
+		"    ROOF31,                  !- Name                                                 ",
+		"    E2 - 1 / 2 IN SLAG OR STONE,  !- Outside Layer                                   ",
+		"    C12 - 2 IN HW CONCRETE;  !- Layer 4                                              ",
+		"  Construction,                                                                      ",
+		"    DOUBLE PANE HW WINDOW,   !- Name                                                 ",
+		"    GLASS - CLEAR PLATE 1 / 4 IN,  !- Outside Layer                                  ",
+		"    AIRGAP,                  !- Layer 2                                              ",
+		"    GLASS - CLEAR PLATE 1 / 4 IN;  !- Layer 3                                        ",
+		"  Construction,                                                                      ",
+		"    PARTITION02,             !- Name                                                 ",
+		"    E1 - 3 / 4 IN PLASTER OR GYP BOARD,  !- Outside Layer                            ",
+		"    C12 - 2 IN HW CONCRETE,  !- Layer 4                                              ",
+		"    E1 - 3 / 4 IN PLASTER OR GYP BOARD;  !- Layer 3                                  ",
+		"  Construction,                                                                      ",
+		"    single PANE HW WINDOW,   !- Name                                                 ",
+		"    GLASS - CLEAR PLATE 1 / 4 IN;  !- Outside Layer                                  ",
+		"  Construction,                                                                      ",
+		"    EXTWALLdemo,             !- Name                                                 ",
+		"    A2 - 4 IN DENSE FACE BRICK,  !- Outside Layer                                    ",
+		"    E1 - 3 / 4 IN PLASTER OR GYP BOARD;  !- Layer 4                                  ",
+		"  GlobalGeometryRules,                                                               ",
+		"    UpperLeftCorner,         !- Starting Vertex Position                             ",
+		"    Counterclockwise,        !- Vertex Entry Direction                               ",
+		"    Relative;                !- Coordinate System                                    ",
+		"  Zone,                                                                              ",
+		"    ZONE ONE,                !- Name                                                 ",
+		"    0,                       !- Direction of Relative North {deg}                    ",
+		"    0,                       !- X Origin {m}                                         ",
+		"    0,                       !- Y Origin {m}                                         ",
+		"    0,                       !- Z Origin {m}                                         ",
+		"    1,                       !- Type                                                 ",
+		"    1,                       !- Multiplier                                           ",
+		"    0,                       !- Ceiling Height {m}                                   ",
+		"    0;                       !- Volume {m3}                                          ",
+		"  BuildingSurface:Detailed,                                                          ",
+		"    Zn001:Wall-North,        !- Name                                                 ",
+		"    Wall,                    !- Surface Type                                         ",
+		"    EXTWALLdemo,             !- Construction Name                                    ",
+		"    ZONE ONE,                !- Zone Name                                            ",
+		"    Outdoors,                !- Outside Boundary Condition                           ",
+		"    ,                        !- Outside Boundary Condition Object                    ",
+		"    SunExposed,              !- Sun Exposure                                         ",
+		"    WindExposed,             !- Wind Exposure                                        ",
+		"    0.5000000,               !- View Factor to Ground                                ",
+		"    4,                       !- Number of Vertices                                   ",
+		"    5,5,3,  !- X,Y,Z ==> Vertex 1 {m}                                                ",
+		"    5,5,0,  !- X,Y,Z ==> Vertex 2 {m}                                                ",
+		"    -5,5,0,  !- X,Y,Z ==> Vertex 3 {m}                                               ",
+		"    -5,5,3;  !- X,Y,Z ==> Vertex 4 {m}                                               ",
+		"  BuildingSurface:Detailed,                                                          ",
+		"    Zn001:Wall-East,         !- Name                                                 ",
+		"    Wall,                    !- Surface Type                                         ",
+		"    EXTWALL09,               !- Construction Name                                    ",
+		"    ZONE ONE,                !- Zone Name                                            ",
+		"    Outdoors,                !- Outside Boundary Condition                           ",
+		"    ,                        !- Outside Boundary Condition Object                    ",
+		"    SunExposed,              !- Sun Exposure                                         ",
+		"    WindExposed,             !- Wind Exposure                                        ",
+		"    0.5000000,               !- View Factor to Ground                                ",
+		"    4,                       !- Number of Vertices                                   ",
+		"    5,-5,3,  !- X,Y,Z ==> Vertex 1 {m}                                               ",
+		"    5,-5,0,  !- X,Y,Z ==> Vertex 2 {m}                                               ",
+		"    5,5,0,  !- X,Y,Z ==> Vertex 3 {m}                                                ",
+		"    5,5,3;  !- X,Y,Z ==> Vertex 4 {m}                                                ",
+		"  BuildingSurface:Detailed,                                                          ",
+		"    Zn001:Wall-South,        !- Name                                                 ",
+		"    Wall,                    !- Surface Type                                         ",
+		"    R13WALL,                 !- Construction Name                                    ",
+		"    ZONE ONE,                !- Zone Name                                            ",
+		"    Outdoors,                !- Outside Boundary Condition                           ",
+		"    ,                        !- Outside Boundary Condition Object                    ",
+		"    SunExposed,              !- Sun Exposure                                         ",
+		"    WindExposed,             !- Wind Exposure                                        ",
+		"    0.5000000,               !- View Factor to Ground                                ",
+		"    4,                       !- Number of Vertices                                   ",
+		"    -5,-5,3,  !- X,Y,Z ==> Vertex 1 {m}                                              ",
+		"    -5,-5,0,  !- X,Y,Z ==> Vertex 2 {m}                                              ",
+		"    5,-5,0,  !- X,Y,Z ==> Vertex 3 {m}                                               ",
+		"    5,-5,3;  !- X,Y,Z ==> Vertex 4 {m}                                               ",
+		"  BuildingSurface:Detailed,                                                          ",
+		"    Zn001:Wall-West,         !- Name                                                 ",
+		"    Wall,                    !- Surface Type                                         ",
+		"    EXTWALL09,               !- Construction Name                                    ",
+		"    ZONE ONE,                !- Zone Name                                            ",
+		"    Outdoors,                !- Outside Boundary Condition                           ",
+		"    ,                        !- Outside Boundary Condition Object                    ",
+		"    SunExposed,              !- Sun Exposure                                         ",
+		"    WindExposed,             !- Wind Exposure                                        ",
+		"    0.5000000,               !- View Factor to Ground                                ",
+		"    4,                       !- Number of Vertices                                   ",
+		"    -5,5,3,  !- X,Y,Z ==> Vertex 1 {m}                                               ",
+		"    -5,5,0,  !- X,Y,Z ==> Vertex 2 {m}                                               ",
+		"    -5,-5,0,  !- X,Y,Z ==> Vertex 3 {m}                                              ",
+		"    -5,-5,3;  !- X,Y,Z ==> Vertex 4 {m}                                              ",
+		"  BuildingSurface:Detailed,                                                          ",
+		"    Zn001:roof,              !- Name                                                 ",
+		"    Roof,                    !- Surface Type                                         ",
+		"    ROOF31,                  !- Construction Name                                    ",
+		"    ZONE ONE,                !- Zone Name                                            ",
+		"    Outdoors,                !- Outside Boundary Condition                           ",
+		"    ,                        !- Outside Boundary Condition Object                    ",
+		"    SunExposed,              !- Sun Exposure                                         ",
+		"    WindExposed,             !- Wind Exposure                                        ",
+		"    0.0000000,               !- View Factor to Ground                                ",
+		"    4,                       !- Number of Vertices                                   ",
+		"    -5,-5,3,  !- X,Y,Z ==> Vertex 1 {m}                                              ",
+		"    5,-5,3,  !- X,Y,Z ==> Vertex 2 {m}                                               ",
+		"    5,5,3,  !- X,Y,Z ==> Vertex 3 {m}                                                ",
+		"    -5,5,3;  !- X,Y,Z ==> Vertex 4 {m}                                               ",
+		"  BuildingSurface:Detailed,                                                          ",
+		"    Zn001:floor,             !- Name                                                 ",
+		"    Floor,                   !- Surface Type                                         ",
+		"    SLAB FLOOR,              !- Construction Name                                    ",
+		"    ZONE ONE,                !- Zone Name                                            ",
+		"    Outdoors,                !- Outside Boundary Condition                           ",
+		"    ,                        !- Outside Boundary Condition Object                    ",
+		"    SunExposed,              !- Sun Exposure                                         ",
+		"    WindExposed,             !- Wind Exposure                                        ",
+		"    0.0000000,               !- View Factor to Ground                                ",
+		"    4,                       !- Number of Vertices                                   ",
+		"    -5,5,0,  !- X,Y,Z ==> Vertex 1 {m}                                               ",
+		"    5,5,0,  !- X,Y,Z ==> Vertex 2 {m}                                                ",
+		"    5,-5,0,  !- X,Y,Z ==> Vertex 3 {m}                                               ",
+		"    -5,-5,0;  !- X,Y,Z ==> Vertex 4 {m}                                              ",
+		"  FenestrationSurface:Detailed,                                                      ",
+		"    Zn001:Wall-South:Win001, !- Name                                                 ",
+		"    Window,                  !- Surface Type                                         ",
+		"    DOUBLE PANE HW WINDOW,   !- Construction Name                                    ",
+		"    Zn001:Wall-South,        !- Building Surface Name                                ",
+		"    ,                        !- Outside Boundary Condition Object                    ",
+		"    0.5000000,               !- View Factor to Ground                                ",
+		"    ,                        !- Shading Control Name                                 ",
+		"    TestFrameAndDivider,     !- Frame and Divider Name                               ",
+		"    1.0,                     !- Multiplier                                           ",
+		"    4,                       !- Number of Vertices                                   ",
+		"    -3,-5,2.5,  !- X,Y,Z ==> Vertex 1 {m}                                            ",
+		"    -3,-5,0.5,  !- X,Y,Z ==> Vertex 2 {m}                                            ",
+		"    3,-5,0.5,  !- X,Y,Z ==> Vertex 3 {m}                                             ",
+		"    3,-5,2.5;  !- X,Y,Z ==> Vertex 4 {m}                                             ",
+		"  WindowProperty:FrameAndDivider,                                                    ",
+		"    TestFrameAndDivider,     !- Name                                                 ",
+		"    0.05,                    !- Frame Width {m}                                      ",
+		"    0.05,                    !- Frame Outside Projection {m}                         ",
+		"    0.05,                    !- Frame Inside Projection {m}                          ",
+		"    5.0,                     !- Frame Conductance {W/m2-K}                           ",
+		"    1.2,                     !- Ratio of Frame-Edge Glass Conductance to Center-Of-Gl",
+		"    0.8,                     !- Frame Solar Absorptance                              ",
+		"    0.8,                     !- Frame Visible Absorptance                            ",
+		"    0.9,                     !- Frame Thermal Hemispherical Emissivity               ",
+		"    DividedLite,             !- Divider Type                                         ",
+		"    0.02,                    !- Divider Width {m}                                    ",
+		"    2,                       !- Number of Horizontal Dividers                        ",
+		"    2,                       !- Number of Vertical Dividers                          ",
+		"    0.02,                    !- Divider Outside Projection {m}                       ",
+		"    0.02,                    !- Divider Inside Projection {m}                        ",
+		"    5.0,                     !- Divider Conductance {W/m2-K}                         ",
+		"    1.2,                     !- Ratio of Divider-Edge Glass Conductance to Center-Of-",
+		"    0.8,                     !- Divider Solar Absorptance                            ",
+		"    0.8,                     !- Divider Visible Absorptance                          ",
+		"    0.9;                     !- Divider Thermal Hemispherical Emissivity             ",
+		"  Shading:Zone:Detailed,                                                             ",
+		"    Zn001:Wall-South:Shade001,  !- Name                                              ",
+		"    Zn001:Wall-South,        !- Base Surface Name                                    ",
+		"    SunShading,              !- Transmittance Schedule Name                          ",
+		"    4,                       !- Number of Vertices                                   ",
+		"    -3,-5,2.5,  !- X,Y,Z ==> Vertex 1 {m}                                            ",
+		"    -3,-6,2.5,  !- X,Y,Z ==> Vertex 2 {m}                                            ",
+		"    3,-6,2.5,  !- X,Y,Z ==> Vertex 3 {m}                                             ",
+		"    3,-5,2.5;  !- X,Y,Z ==> Vertex 4 {m}                                             ",
+		"  ShadingProperty:Reflectance,                                                       ",
+		"    Zn001:Wall-South:Shade001,  !- Shading Surface Name                              ",
+		"    0.2,                     !- Diffuse Solar Reflectance of Unglazed Part of Shading",
+		"    0.2;                     !- Diffuse Visible Reflectance of Unglazed Part of Shadi"
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	SimulationManager::GetProjectData();
+	bool FoundError = false;
+
+	HeatBalanceManager::GetProjectControlData( FoundError ); // read project control data
+	EXPECT_FALSE( FoundError ); // expect no errors
+
+	HeatBalanceManager::SetPreConstructionInputParameters();
+	ScheduleManager::ProcessScheduleInput(); // read schedules
+
+	HeatBalanceManager::GetMaterialData( FoundError );
+	EXPECT_FALSE( FoundError );
+
+	HeatBalanceManager::GetFrameAndDividerData( FoundError );
+	EXPECT_FALSE( FoundError );
+
+	HeatBalanceManager::GetConstructData( FoundError );
+	EXPECT_FALSE( FoundError );
+
+	HeatBalanceManager::GetZoneData( FoundError ); // Read Zone data from input file
+	EXPECT_FALSE( FoundError );
+
+	SurfaceGeometry::GetGeometryParameters( FoundError );
+	EXPECT_FALSE( FoundError );
+
+	SurfaceGeometry::CosZoneRelNorth.allocate( 1 );
+	SurfaceGeometry::SinZoneRelNorth.allocate( 1 );
+
+	SurfaceGeometry::CosZoneRelNorth( 1 ) = std::cos( -Zone( 1 ).RelNorth * DegToRadians );
+	SurfaceGeometry::SinZoneRelNorth( 1 ) = std::sin( -Zone( 1 ).RelNorth * DegToRadians );
+	SurfaceGeometry::CosBldgRelNorth = 1.0;
+	SurfaceGeometry::SinBldgRelNorth = 0.0;
+
+	SurfaceGeometry::GetSurfaceData( FoundError ); // setup zone geometry and get zone data
+	EXPECT_FALSE( FoundError ); // expect no errors
+
+	compare_err_stream( "" ); // just for debugging
+
+	SurfaceGeometry::SetupZoneGeometry( FoundError ); // this calls GetSurfaceData()
+	EXPECT_FALSE( FoundError );
+
+	SolarShading::AllocateModuleArrays();
+	SolarShading::DetermineShadowingCombinations();
+	DataEnvironment::DayOfYear_Schedule = 168;
+	DataEnvironment::DayOfWeek = 6;
+	DataGlobals::TimeStep = 4;
+	DataGlobals::HourOfDay = 9;
+
+	compare_err_stream( "" ); // just for debugging
+
+	DataSurfaces::ShadingTransmittanceVaries = true;
+	DataSystemVariables::DetailedSkyDiffuseAlgorithm = true;
+	DataSystemVariables::DetailedSolarTimestepIntegration = false;
+	SolarDistribution = FullExterior;
+
+	CalcSkyDifShading = true;
+	SolarShading::SkyDifSolarShading();
+	CalcSkyDifShading = false;
+
+	// Serial reference for a period near the summer solstice
+	Real64 const AvgEqOfTime( 0.0 );
+	Real64 const AvgSinSolarDeclin( 0.3978 );
+	Real64 const AvgCosSolarDeclin( 0.9175 );
+	DataSystemVariables::NumberShadingThreads = 1;
+	CalcPerSolarBeam( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin );
+
+	Array3D< Real64 > const SerialSunlitFrac( SunlitFrac );
+	Array3D< Real64 > const SerialCosIncAng( CosIncAng );
+	Array2D< Real64 > const SerialSunlitFracHR( SunlitFracHR );
+	Array3D< Real64 > const SerialDifShdgRatioIsoSky( DifShdgRatioIsoSkyHRTS );
+	Array3D< Real64 > const SerialDifShdgRatioHoriz( DifShdgRatioHorizHRTS );
+	Array1D< SurfaceWindowCalc > const SerialSurfaceWindow( SurfaceWindow );
+
+	int NumPartlySunlit( 0 );
+	for ( std::size_t l = 0; l < SerialSunlitFrac.size(); ++l ) {
+		if ( SerialSunlitFrac[ l ] > 0.0 && SerialSunlitFrac[ l ] < 1.0 ) ++NumPartlySunlit;
+	}
+	EXPECT_GT( NumPartlySunlit, 0 );
+
+	// Hours spread over several threads must give identical results
+	DataSystemVariables::NumberShadingThreads = 4;
+	CalcPerSolarBeam( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin );
+	DataSystemVariables::NumberShadingThreads = 1;
+
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		for ( int Hour = 1; Hour <= 24; ++Hour ) {
+			EXPECT_EQ( SerialSunlitFracHR( Hour, SurfNum ), SunlitFracHR( Hour, SurfNum ) );
+			EXPECT_EQ( SerialSurfaceWindow( SurfNum ).OutProjSLFracMult( Hour ), SurfaceWindow( SurfNum ).OutProjSLFracMult( Hour ) );
+			EXPECT_EQ( SerialSurfaceWindow( SurfNum ).InOutProjSLFracMult( Hour ), SurfaceWindow( SurfNum ).InOutProjSLFracMult( Hour ) );
+			for ( int TS = 1; TS <= NumOfTimeStepInHour; ++TS ) {
+				EXPECT_EQ( SerialSunlitFrac( TS, Hour, SurfNum ), SunlitFrac( TS, Hour, SurfNum ) );
+				EXPECT_EQ( SerialCosIncAng( TS, Hour, SurfNum ), CosIncAng( TS, Hour, SurfNum ) );
+				EXPECT_EQ( SerialDifShdgRatioIsoSky( TS, Hour, SurfNum ), DifShdgRatioIsoSkyHRTS( TS, Hour, SurfNum ) );
+				EXPECT_EQ( SerialDifShdgRatioHoriz( TS, Hour, SurfNum ), DifShdgRatioHorizHRTS( TS, Hour, SurfNum ) );
+			}
+		}
+	}
+
+	// A run that fills the shading cache and a read back from it must also give identical results
+	DataSystemVariables::ShadingCacheDirectory = ".";
+	CalcPerSolarBeam( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin );
+	std::string const CacheFile( ShadingCache::CacheFilePath( ShadingCache::PeriodKey ) );
+	EXPECT_TRUE( FileSystem::fileExists( CacheFile ) );
+
+	SunlitFrac = 0.0;
+	CosIncAng = 0.0;
+	SunlitFracHR = 0.0;
+	DifShdgRatioIsoSkyHRTS = 0.0;
+	DifShdgRatioHorizHRTS = 0.0;
+	EXPECT_TRUE( ShadingCache::LoadSolarBeam( AvgEqOfTime, AvgSinSolarDeclin, AvgCosSolarDeclin ) );
+	EXPECT_FALSE( ShadingCache::LoadSolarBeam( AvgEqOfTime, AvgSinSolarDeclin + 0.01, AvgCosSolarDeclin ) ); // Different period
+	FileSystem::removeFile( CacheFile );
+	DataSystemVariables::ShadingCacheDirectory.clear();
+
+	EXPECT_TRUE( eq( SerialSunlitFrac, SunlitFrac ) );
+	EXPECT_TRUE( eq( SerialCosIncAng, CosIncAng ) );
+	EXPECT_TRUE( eq( SerialSunlitFracHR, SunlitFracHR ) );
+	EXPECT_TRUE( eq( SerialDifShdgRatioIsoSky, DifShdgRatioIsoSkyHRTS ) );
+	EXPECT_TRUE( eq( SerialDifShdgRatioHoriz, DifShdgRatioHorizHRTS ) );
+
+}
@@ -0,0 +1,212 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::SparseLUSolver Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/SparseLUSolver.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cmath>
+
+using namespace EnergyPlus;
+using namespace ObjexxFCL;
+using Ordering = SparseLUSolver::Ordering;
+
+namespace {
+
+	// Diagonally dominant, nonsymmetric values on a random-ish network pattern
+	void
+	fill_network( SparseLUSolver & s, SparseLUSolver::Couplings const & couplings )
+	{
+		int k( 0 );
+		for ( auto const & c : couplings ) {
+			++k;
+			s( c.first, c.second ) = -0.1 - 0.01 * ( k % 7 );
+			s( c.second, c.first ) = -0.2 - 0.03 * ( k % 5 );
+		}
+		SparseLUSolver const & t( s );
+		for ( int i = 1; i <= s.size(); ++i ) {
+			Real64 sum( 0.0 );
+			for ( int j = 1; j <= s.size(); ++j ) {
+				if ( j != i ) sum += std::abs( t( i, j ) );
+			}
+			s.diagonal( i ) = sum + 0.5 + 0.1 * ( i % 3 );
+		}
+	}
+
+	SparseLUSolver::Couplings
+	network_couplings( int const n )
+	{
+		SparseLUSolver::Couplings couplings;
+		for ( int i = 2; i <= n; ++i ) {
+			couplings.emplace_back( i, 1 + ( i * 7 ) % ( i - 1 ) ); // Tree
+			if ( i % 4 == 0 ) couplings.emplace_back( i, 1 + ( i * 13 ) % n ); // Loops
+		}
+		return couplings;
+	}
+
+}
+
+TEST( SparseLUSolverTest, Small )
+{
+	// 3x3 tridiagonal system with known solution
+	SparseLUSolver s;
+	s.setup( 3, { { 1, 2 }, { 2, 3 } } );
+	EXPECT_EQ( 3, s.size() );
+	EXPECT_EQ( 7u, s.nonZeros() );
+	EXPECT_TRUE( s.contains( 1, 2 ) );
+	EXPECT_TRUE( s.contains( 2, 1 ) );
+	EXPECT_FALSE( s.contains( 1, 3 ) );
+	s.diagonal( 1 ) = 4.0;
+	s( 1, 2 ) = -1.0;
+	s( 2, 1 ) = -2.0;
+	s.diagonal( 2 ) = 5.0;
+	s( 2, 3 ) = -1.0;
+	s( 3, 2 ) = -3.0;
+	s.diagonal( 3 ) = 6.0;
+
+	Array1D< Real64 > x( 3, { 1.0, 2.0, 3.0 } );
+	Array1D< Real64 > b( 3 );
+	s.multiply( x, b );
+	EXPECT_DOUBLE_EQ( 2.0, b( 1 ) );
+	EXPECT_DOUBLE_EQ( 5.0, b( 2 ) );
+	EXPECT_DOUBLE_EQ( 12.0, b( 3 ) );
+	EXPECT_TRUE( s.solve( b ) );
+	EXPECT_TRUE( s.factored() );
+	EXPECT_EQ( 0, s.singular() );
+	for ( int i = 1; i <= 3; ++i ) EXPECT_NEAR( x( i ), b( i ), 1.0e-14 );
+
+	// Changing an entry invalidates the factors
+	s( 3, 2 ) = -1.0;
+	EXPECT_FALSE( s.factored() );
+
+	// Dense copy is row-major
+	Array1D< Real64 > a( 9 );
+	s.to_dense( a );
+	EXPECT_DOUBLE_EQ( 4.0, a( 1 ) );
+	EXPECT_DOUBLE_EQ( -1.0, a( 2 ) );
+	EXPECT_DOUBLE_EQ( 0.0, a( 3 ) );
+	EXPECT_DOUBLE_EQ( -2.0, a( 4 ) );
+	EXPECT_DOUBLE_EQ( -1.0, a( 8 ) );
+	EXPECT_DOUBLE_EQ( 6.0, a( 9 ) );
+}
+
+TEST( SparseLUSolverTest, Orderings )
+{
+	int const n( 200 );
+	SparseLUSolver::Couplings const couplings( network_couplings( n ) );
+	Array1D< Real64 > x( n );
+	for ( int i = 1; i <= n; ++i ) x( i ) = 20.0 + std::sin( Real64( i ) );
+
+	for ( Ordering const ordering : { Ordering::Natural, Ordering::ReverseCuthillMcKee, Ordering::MinimumDegree } ) {
+		SparseLUSolver s;
+		s.setup( n, couplings, ordering );
+		fill_network( s, couplings );
+		Array1D< Real64 > b( n );
+		s.multiply( x, b );
+		EXPECT_TRUE( s.solve( b ) );
+		for ( int i = 1; i <= n; ++i ) EXPECT_NEAR( x( i ), b( i ), 1.0e-12 );
+
+		// Order is a permutation
+		std::vector< int > o( s.order() );
+		std::sort( o.begin(), o.end() );
+		for ( int i = 1; i <= n; ++i ) EXPECT_EQ( i, o[ i - 1 ] );
+	}
+}
+
+TEST( SparseLUSolverTest, FillReduction )
+{
+	// Star network with the hub first: Natural order fills in completely while minimum degree leaves the hub until the end
+	int const n( 50 );
+	SparseLUSolver::Couplings couplings;
+	for ( int i = 2; i <= n; ++i ) couplings.emplace_back( 1, i );
+
+	SparseLUSolver natural;
+	natural.setup( n, couplings, Ordering::Natural );
+	EXPECT_EQ( SparseLUSolver::size_type( n * n ), natural.factorNonZeros() );
+
+	SparseLUSolver md;
+	md.setup( n, couplings, Ordering::MinimumDegree );
+	EXPECT_EQ( md.nonZeros(), md.factorNonZeros() );
+	EXPECT_NE( 1, md.order().front() );
+
+	// Same solution either way
+	fill_network( natural, couplings );
+	fill_network( md, couplings );
+	Array1D< Real64 > b1( n, 1.0 );
+	Array1D< Real64 > b2( n, 1.0 );
+	EXPECT_TRUE( natural.solve( b1 ) );
+	EXPECT_TRUE( md.solve( b2 ) );
+	for ( int i = 1; i <= n; ++i ) EXPECT_NEAR( b1( i ), b2( i ), 1.0e-14 );
+}
+
+TEST( SparseLUSolverTest, VanishingPivot )
+{
+	// Singular matrix is reported so callers can fall back to a pivoting solver
+	SparseLUSolver s;
+	s.setup( 2, { { 1, 2 } } );
+	s.diagonal( 1 ) = 1.0;
+	s( 1, 2 ) = 1.0;
+	s( 2, 1 ) = 1.0;
+	s.diagonal( 2 ) = 1.0;
+	Array1D< Real64 > b( 2, 1.0 );
+	EXPECT_FALSE( s.solve( b ) );
+	EXPECT_FALSE( s.factored() );
+	EXPECT_EQ( s.order()[ 1 ], s.singular() ); // Second equation eliminated
+
+	// Zero keeps the pattern
+	s.zero();
+	EXPECT_EQ( 4u, s.nonZeros() );
+	EXPECT_DOUBLE_EQ( 0.0, s.diagonal( 1 ) );
+}
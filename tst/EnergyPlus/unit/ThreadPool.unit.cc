@@ -0,0 +1,92 @@
+// EnergyPlus, Copyright (c) 1996-2017, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// EnergyPlus::ThreadPool Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/ThreadPool.hh>
+
+// C++ Headers
+#include <stdexcept>
+#include <vector>
+
+using namespace EnergyPlus;
+
+TEST( ThreadPoolTest, RunsEveryTaskOnce )
+{
+	ThreadPool pool( 4 );
+	EXPECT_EQ( 4u, pool.size() );
+	for ( int batch = 0; batch < 50; ++batch ) { // Reused across many batches
+		std::size_t const n( 1 + batch * 7 );
+		std::vector< int > counts( n, 0 );
+		pool.run( n, [ & ]( ThreadPool::size_type const i ){ ++counts[ i ]; } );
+		for ( std::size_t i = 0; i < n; ++i ) EXPECT_EQ( 1, counts[ i ] );
+	}
+	pool.run( 0u, []( ThreadPool::size_type ){ FAIL(); } );
+}
+
+TEST( ThreadPoolTest, SingleThread )
+{
+	ThreadPool pool( 1 );
+	EXPECT_EQ( 1u, pool.size() );
+	std::vector< ThreadPool::size_type > order;
+	pool.run( 5u, [ & ]( ThreadPool::size_type const i ){ order.push_back( i ); } );
+	EXPECT_EQ( ( std::vector< ThreadPool::size_type >{ 0u, 1u, 2u, 3u, 4u } ), order );
+}
+
+TEST( ThreadPoolTest, RethrowsTaskException )
+{
+	ThreadPool pool( 3 );
+	EXPECT_THROW( pool.run( 100u, []( ThreadPool::size_type const i ){ if ( i == 37u ) throw std::runtime_error( "task" ); } ), std::runtime_error );
+
+	// Still usable after a failed batch
+	std::vector< int > counts( 10, 0 );
+	pool.run( 10u, [ & ]( ThreadPool::size_type const i ){ ++counts[ i ]; } );
+	for ( int const count : counts ) EXPECT_EQ( 1, count );
+}